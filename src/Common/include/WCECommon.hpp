@@ -32,3 +32,6 @@
 #include "../src/Woven.hpp"
 #include "../src/Zip.hpp"
 #include "../src/string.hpp"
+#include "../src/BinaryBlob.hpp"
+#include "../src/StableHash.hpp"
+#include "../src/ResultCache.hpp"
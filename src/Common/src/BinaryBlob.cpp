@@ -0,0 +1,81 @@
+#include <limits>
+#include <stdexcept>
+
+#include "BinaryBlob.hpp"
+
+namespace FenestrationCommon
+{
+    BinaryWriter::BinaryWriter(std::span<std::byte> bytes) : m_Bytes(bytes)
+    {}
+
+    void BinaryWriter::write(std::span<const double> values)
+    {
+        writeBytes(std::as_bytes(values));
+    }
+
+    void BinaryWriter::writeBytes(std::span<const std::byte> bytes)
+    {
+        if(bytes.size() > m_Bytes.size() - m_Offset)
+        {
+            throw std::runtime_error("Binary data does not fit into the buffer.");
+        }
+        std::memcpy(m_Bytes.data() + m_Offset, bytes.data(), bytes.size());
+        m_Offset += bytes.size();
+    }
+
+    size_t BinaryWriter::offset() const
+    {
+        return m_Offset;
+    }
+
+    BinaryReader::BinaryReader(std::span<const std::byte> bytes) : m_Bytes(bytes)
+    {}
+
+    std::span<const std::byte> BinaryReader::readBytes(size_t count)
+    {
+        if(count > remaining())
+        {
+            throw std::runtime_error("Binary data is truncated.");
+        }
+        const auto result{m_Bytes.subspan(m_Offset, count)};
+        m_Offset += count;
+        return result;
+    }
+
+    std::span<const double> BinaryReader::readDoubles(size_t count)
+    {
+        if(count > remaining() / sizeof(double))
+        {
+            throw std::runtime_error("Binary data is truncated.");
+        }
+        const auto raw{readBytes(count * sizeof(double))};
+        if(reinterpret_cast<std::uintptr_t>(raw.data()) % alignof(double) != 0u)
+        {
+            throw std::runtime_error("Binary data is not aligned to double.");
+        }
+        return {reinterpret_cast<const double *>(raw.data()), count};
+    }
+
+    size_t BinaryReader::remaining() const
+    {
+        return m_Bytes.size() - m_Offset;
+    }
+
+    std::uint64_t checkedMultiply(std::uint64_t first, std::uint64_t second)
+    {
+        if(first != 0u && second > std::numeric_limits<std::uint64_t>::max() / first)
+        {
+            throw std::runtime_error("Binary data size overflows.");
+        }
+        return first * second;
+    }
+
+    std::uint64_t checkedAdd(std::uint64_t first, std::uint64_t second)
+    {
+        if(second > std::numeric_limits<std::uint64_t>::max() - first)
+        {
+            throw std::runtime_error("Binary data size overflows.");
+        }
+        return first + second;
+    }
+}   // namespace FenestrationCommon
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+namespace FenestrationCommon
+{
+    //! \brief Sequential writer of fixed size values into a pre-sized byte buffer.
+    //!
+    //! Values are copied in host byte order. Writing past the end of the buffer throws.
+    class BinaryWriter
+    {
+    public:
+        explicit BinaryWriter(std::span<std::byte> bytes);
+
+        template<typename T>
+            requires std::is_trivially_copyable_v<T>
+        void write(const T & value)
+        {
+            writeBytes(std::as_bytes(std::span<const T, 1>(&value, 1u)));
+        }
+
+        void write(std::span<const double> values);
+        void writeBytes(std::span<const std::byte> bytes);
+
+        [[nodiscard]] size_t offset() const;
+
+    private:
+        std::span<std::byte> m_Bytes;
+        size_t m_Offset{0u};
+    };
+
+    //! \brief Sequential reader of fixed size values from a byte buffer.
+    //!
+    //! Every read is checked against the remaining size, so counts read from the data itself
+    //! cannot lead past its end. A short buffer throws std::runtime_error.
+    class BinaryReader
+    {
+    public:
+        explicit BinaryReader(std::span<const std::byte> bytes);
+
+        template<typename T>
+            requires std::is_trivially_copyable_v<T>
+        T read()
+        {
+            T value{};
+            std::memcpy(&value, readBytes(sizeof(T)).data(), sizeof(T));
+            return value;
+        }
+
+        std::span<const std::byte> readBytes(size_t count);
+
+        //! Doubles viewed in place, without a copy. Throws if they are not aligned to double.
+        std::span<const double> readDoubles(size_t count);
+
+        [[nodiscard]] size_t remaining() const;
+
+    private:
+        std::span<const std::byte> m_Bytes;
+        size_t m_Offset{0u};
+    };
+
+    //! Products and sums of sizes read from binary headers. Both throw std::runtime_error
+    //! instead of wrapping around.
+    [[nodiscard]] std::uint64_t checkedMultiply(std::uint64_t first, std::uint64_t second);
+    [[nodiscard]] std::uint64_t checkedAdd(std::uint64_t first, std::uint64_t second);
+}   // namespace FenestrationCommon
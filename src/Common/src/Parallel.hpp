@@ -3,6 +3,7 @@
 #include <vector>
 #include <thread>
 #include <algorithm>
+#include <atomic>
 
 #include "Utility.hpp"
 #include "Callbacks.hpp"
@@ -47,4 +48,40 @@ namespace FenestrationCommon
             }
         }
     }
+
+    //! Calls func(i) for every i in [0, count). Worker threads take the next index from a shared
+    //! counter instead of a fixed chunk, so tasks of very different cost keep all threads busy.
+    //! Zero numberOfThreads uses getNumberOfThreads(count).
+    template<typename IndexType, typename Function>
+    void executeInParallelDynamic(IndexType count, Function && func, size_t numberOfThreads = 0u)
+    {
+        if(count == 0)
+        {
+            return;
+        }
+
+        const auto threads = std::min<size_t>(
+          numberOfThreads == 0u ? getNumberOfThreads(count) : numberOfThreads, count);
+
+        std::atomic<IndexType> next{0};
+        const auto work = [&]() {
+            for(IndexType i = next++; i < count; i = next++)
+            {
+                func(i);
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1u);
+        for(size_t thread = 1u; thread < threads; ++thread)
+        {
+            workers.emplace_back(work);
+        }
+        work();
+
+        for(auto & worker : workers)
+        {
+            worker.join();
+        }
+    }
 }   // namespace FenestrationCommon
@@ -0,0 +1,254 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+
+#include "BinaryBlob.hpp"
+#include "ResultCache.hpp"
+#include "StableHash.hpp"
+
+namespace FenestrationCommon
+{
+    namespace
+    {
+        constexpr std::array<char, 8> magic{'W', 'C', 'E', 'R', 'C', '0', '1', '\0'};
+        constexpr auto entryExtension{".wcr"};
+        constexpr auto temporaryExtension{".tmp"};
+
+        //! Age after which a temporary file can no longer belong to a running store.
+        constexpr auto staleTemporaryAge{std::chrono::hours(1)};
+
+        struct EntryHeader
+        {
+            std::array<char, 8> magic{};
+            std::uint64_t key{0u};
+            std::uint64_t count{0u};
+            std::uint64_t checksum{0u};
+        };
+
+        std::uint64_t checksum(std::span<const double> values)
+        {
+            return StableHash().add(values).value();
+        }
+
+        //! Values of an entry file, or nothing if the file is not a valid entry for the key.
+        std::optional<std::vector<double>> parseEntry(std::span<const std::byte> bytes,
+                                                      std::uint64_t key)
+        {
+            if(bytes.size() < sizeof(EntryHeader))
+            {
+                return std::nullopt;
+            }
+            BinaryReader reader{bytes};
+            const auto header{reader.read<EntryHeader>()};
+            if(header.magic != magic || header.key != key
+               || reader.remaining() % sizeof(double) != 0u
+               || header.count != reader.remaining() / sizeof(double))
+            {
+                return std::nullopt;
+            }
+
+            std::vector<double> values(header.count);
+            const auto payload{reader.readBytes(reader.remaining())};
+            std::memcpy(values.data(), payload.data(), payload.size());
+            if(checksum(values) != header.checksum)
+            {
+                return std::nullopt;
+            }
+            return values;
+        }
+
+        enum class CacheFile
+        {
+            Entry,
+            Temporary,
+            Other
+        };
+
+        CacheFile cacheFile(const std::filesystem::directory_entry & entry)
+        {
+            std::error_code ec;
+            if(!entry.is_regular_file(ec))
+            {
+                return CacheFile::Other;
+            }
+            const auto extension{entry.path().extension()};
+            if(extension == entryExtension)
+            {
+                return CacheFile::Entry;
+            }
+            return extension == temporaryExtension ? CacheFile::Temporary : CacheFile::Other;
+        }
+
+        bool isStale(const std::filesystem::directory_entry & entry)
+        {
+            std::error_code ec;
+            const auto lastWrite{entry.last_write_time(ec)};
+            return !ec
+                   && lastWrite
+                        < std::filesystem::file_time_type::clock::now() - staleTemporaryAge;
+        }
+    }   // namespace
+
+    ResultCache::ResultCache(std::filesystem::path directory, std::uintmax_t maxSizeInBytes) :
+        m_Directory(std::move(directory)),
+        m_MaxSizeInBytes(maxSizeInBytes)
+    {
+        std::filesystem::create_directories(m_Directory);
+    }
+
+    std::optional<std::vector<double>> ResultCache::find(std::uint64_t key)
+    {
+        const auto path{entryPath(key)};
+        std::error_code ec;
+        const auto fileSize{std::filesystem::file_size(path, ec)};
+        std::ifstream file(path, std::ios::binary);
+        if(ec || !file)
+        {
+            return std::nullopt;
+        }
+
+        std::vector<std::byte> bytes(static_cast<size_t>(fileSize));
+        file.read(reinterpret_cast<char *>(bytes.data()),
+                  static_cast<std::streamsize>(bytes.size()));
+        const auto complete{static_cast<bool>(file)};
+        file.close();
+
+        auto values{complete ? parseEntry(bytes, key) : std::nullopt};
+        if(!values.has_value())
+        {
+            std::filesystem::remove(path, ec);
+            return std::nullopt;
+        }
+
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+
+        return values;
+    }
+
+    bool ResultCache::store(std::uint64_t key, std::span<const double> values)
+    {
+        const EntryHeader header{
+          .magic = magic, .key = key, .count = values.size(), .checksum = checksum(values)};
+        if(sizeof(header) + values.size_bytes() > m_MaxSizeInBytes)
+        {
+            return false;
+        }
+
+        std::vector<std::byte> image(sizeof(header) + values.size_bytes());
+        BinaryWriter writer{image};
+        writer.write(header);
+        writer.write(values);
+
+        const auto path{entryPath(key)};
+        const auto temporary{m_Directory
+                             / (toHex(key) + "." + toHex(std::random_device{}())
+                                + temporaryExtension)};
+        bool written{false};
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char *>(image.data()),
+                       static_cast<std::streamsize>(image.size()));
+            file.close();
+            written = file.good();
+        }
+        std::error_code ec;
+        if(written)
+        {
+            std::filesystem::rename(temporary, path, ec);
+        }
+        if(!written || ec)
+        {
+            std::filesystem::remove(temporary, ec);
+            return false;
+        }
+
+        evict();
+        return true;
+    }
+
+    std::uintmax_t ResultCache::sizeInBytes() const
+    {
+        std::uintmax_t size{0u};
+        std::error_code ec;
+        for(const auto & entry : std::filesystem::directory_iterator(m_Directory, ec))
+        {
+            if(cacheFile(entry) != CacheFile::Other)
+            {
+                size += entry.file_size(ec);
+            }
+        }
+        return size;
+    }
+
+    void ResultCache::clear()
+    {
+        // Temporary files that are not stale may still be renamed into place by their writer.
+        std::error_code ec;
+        for(const auto & entry : std::filesystem::directory_iterator(m_Directory, ec))
+        {
+            const auto type{cacheFile(entry)};
+            if(type == CacheFile::Entry || (type == CacheFile::Temporary && isStale(entry)))
+            {
+                std::filesystem::remove(entry.path(), ec);
+            }
+        }
+    }
+
+    std::filesystem::path ResultCache::entryPath(std::uint64_t key) const
+    {
+        return m_Directory / (toHex(key) + entryExtension);
+    }
+
+    void ResultCache::evict()
+    {
+        struct Entry
+        {
+            std::filesystem::path path;
+            std::filesystem::file_time_type lastUse;
+            std::uintmax_t size;
+        };
+
+        std::vector<Entry> entries;
+        std::uintmax_t totalSize{0u};
+        std::error_code ec;
+        for(const auto & entry : std::filesystem::directory_iterator(m_Directory, ec))
+        {
+            const auto type{cacheFile(entry)};
+            if(type == CacheFile::Temporary)
+            {
+                if(isStale(entry) && std::filesystem::remove(entry.path(), ec))
+                {
+                    continue;
+                }
+                totalSize += entry.file_size(ec);
+            }
+            else if(type == CacheFile::Entry)
+            {
+                entries.push_back({entry.path(), entry.last_write_time(ec), entry.file_size(ec)});
+                totalSize += entries.back().size;
+            }
+        }
+
+        if(totalSize <= m_MaxSizeInBytes)
+        {
+            return;
+        }
+
+        std::ranges::sort(entries, {}, &Entry::lastUse);
+        for(const auto & entry : entries)
+        {
+            if(totalSize <= m_MaxSizeInBytes)
+            {
+                break;
+            }
+            if(std::filesystem::remove(entry.path, ec))
+            {
+                totalSize -= entry.size;
+            }
+        }
+    }
+}   // namespace FenestrationCommon
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace FenestrationCommon
+{
+    //! \brief Content addressed cache of final calculation results in a local directory.
+    //!
+    //! Entries are keyed by a StableHash of the complete input description and hold the result
+    //! values as doubles. Every entry is a single checksummed file named by the key, so several
+    //! processes can share the same directory. Entries are written to a temporary file and
+    //! renamed into place; a damaged entry is treated as a miss and removed.
+    //!
+    //! When the directory grows over the size limit, the least recently used entries are
+    //! removed. Reading an entry counts as a use. Temporary files count against the limit too;
+    //! one that is older than an hour was left behind by a process that died while writing and
+    //! is removed.
+    class ResultCache
+    {
+    public:
+        ResultCache(std::filesystem::path directory, std::uintmax_t maxSizeInBytes);
+
+        //! Not const: a damaged entry is removed and a found one is marked as used.
+        [[nodiscard]] std::optional<std::vector<double>> find(std::uint64_t key);
+
+        //! Returns false if the entry was not written because it is over the size limit or
+        //! because of a file system error. The temporary file is removed in that case.
+        bool store(std::uint64_t key, std::span<const double> values);
+
+        //! Returns cached values for the key or calculates, stores and returns them. Values are
+        //! returned even if they could not be stored.
+        template<typename Calculate>
+        std::vector<double> getOrCalculate(std::uint64_t key, Calculate && calculate)
+        {
+            if(auto cached = find(key))
+            {
+                return std::move(cached.value());
+            }
+            std::vector<double> result = calculate();
+            store(key, result);
+            return result;
+        }
+
+        [[nodiscard]] std::uintmax_t sizeInBytes() const;
+
+        void clear();
+
+    private:
+        [[nodiscard]] std::filesystem::path entryPath(std::uint64_t key) const;
+        void evict();
+
+        std::filesystem::path m_Directory;
+        std::uintmax_t m_MaxSizeInBytes;
+    };
+}   // namespace FenestrationCommon
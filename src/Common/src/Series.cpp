@@ -87,6 +87,19 @@ namespace FenestrationCommon
         }
     }
 
+    CSeries::CSeries(std::span<const double> t_x, std::span<const double> t_values)
+    {
+        if(t_x.size() != t_values.size())
+        {
+            throw std::runtime_error("Series x and value arrays must have the same size.");
+        }
+        m_Series.reserve(t_x.size());
+        for(size_t i = 0u; i < t_x.size(); ++i)
+        {
+            m_Series.emplace_back(t_x[i], t_values[i]);
+        }
+    }
+
     void CSeries::addProperty(const double t_x, const double t_Value)
     {
         m_Series.emplace_back(t_x, t_Value);
@@ -4,6 +4,7 @@
 #include <vector>
 #include <memory>
 #include <optional>
+#include <span>
 
 namespace FenestrationCommon
 {   // Implementation of spectral property interface
@@ -39,6 +40,11 @@ namespace FenestrationCommon
         explicit CSeries(const std::vector<std::pair<double, double>> & t_values);
         CSeries(const std::initializer_list<std::pair<double, double>> & t_values);
 
+        //! \brief Builds the series in a single pass from contiguous x and value columns.
+        //!
+        //! Both spans must have the same length; otherwise runtime error will be thrown.
+        CSeries(std::span<const double> t_x, std::span<const double> t_values);
+
         CSeries(const CSeries & t_Series) = default;
         void addProperty(double t_x, double t_Value);
         void setPropertyAtIndex(size_t index, double x, double value);
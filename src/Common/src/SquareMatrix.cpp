@@ -2,6 +2,7 @@
 #include <cassert>
 #include <cmath>
 #include <algorithm>
+#include <limits>
 
 #include "SquareMatrix.hpp"
 
@@ -500,6 +501,31 @@ namespace FenestrationCommon
         }
     }
 
+    double LUFactor::smallestPivot() const
+    {
+        auto result{std::numeric_limits<double>::infinity()};
+        for(std::size_t k = 0; k < m_size; ++k)
+        {
+            const auto pivot{std::abs(m_LU[k][k])};
+            if(std::isnan(pivot))
+            {
+                return pivot;
+            }
+            result = std::min(result, pivot);
+        }
+        return result;
+    }
+
+    double LUFactor::largestPivot() const
+    {
+        auto result{0.0};
+        for(std::size_t k = 0; k < m_size; ++k)
+        {
+            result = std::max(result, std::abs(m_LU[k][k]));
+        }
+        return result;
+    }
+
     SquareMatrix LUFactor::solveRight(const SquareMatrix & B) const
     {
         if(B.m_size != m_size)
@@ -547,5 +573,68 @@ namespace FenestrationCommon
         return X;
     }
 
+    std::vector<std::vector<double>>
+      LUFactor::solve(const std::vector<std::vector<double>> & rightHandSides) const
+    {
+        const std::size_t n = m_size;
+        const std::size_t count = rightHandSides.size();
+
+        // Row-major n x count block so that the substitution sweeps all right-hand sides of a
+        // row together.
+        std::vector<double> X(n * count);
+        for(std::size_t j = 0; j < count; ++j)
+        {
+            if(rightHandSides[j].size() != n)
+            {
+                throw std::runtime_error("LUFactor::solve: size mismatch.");
+            }
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                X[i * count + j] = rightHandSides[j][i];
+            }
+        }
+
+        // Step 1: solve L * Y = B (L unit-diagonal).
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            for(std::size_t k = 0; k < i; ++k)
+            {
+                const double lik = m_LU[i][k];
+                for(std::size_t j = 0; j < count; ++j)
+                {
+                    X[i * count + j] -= lik * X[k * count + j];
+                }
+            }
+        }
+
+        // Step 2: solve U * X = Y.
+        for(std::size_t ii = n; ii-- > 0;)
+        {
+            for(std::size_t k = ii + 1; k < n; ++k)
+            {
+                const double uik = m_LU[ii][k];
+                for(std::size_t j = 0; j < count; ++j)
+                {
+                    X[ii * count + j] -= uik * X[k * count + j];
+                }
+            }
+            const double inv_uii = 1.0 / m_LU[ii][ii];
+            for(std::size_t j = 0; j < count; ++j)
+            {
+                X[ii * count + j] *= inv_uii;
+            }
+        }
+
+        std::vector<std::vector<double>> result(count, std::vector<double>(n));
+        for(std::size_t j = 0; j < count; ++j)
+        {
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                result[j][i] = X[i * count + j];
+            }
+        }
+        return result;
+    }
+
 
 }   // namespace FenestrationCommon
@@ -69,8 +69,18 @@ namespace FenestrationCommon
         // factorised A.
         [[nodiscard]] SquareMatrix solveRight(const SquareMatrix & B) const;
 
+        // Solves A * x = b for every b in rightHandSides against the one factorisation. Each
+        // right-hand side goes through the same arithmetic as when it is solved alone.
+        [[nodiscard]] std::vector<std::vector<double>>
+          solve(const std::vector<std::vector<double>> & rightHandSides) const;
+
         [[nodiscard]] std::size_t size() const { return m_size; }
 
+        // Smallest absolute diagonal entry of U. Without pivoting, a zero (or NaN) here means the
+        // factorised matrix is singular and the solves return inf or NaN.
+        [[nodiscard]] double smallestPivot() const;
+        [[nodiscard]] double largestPivot() const;
+
     private:
         std::size_t m_size;
         // Lower triangle (i > j) holds L's multipliers (L has unit diagonal);
@@ -0,0 +1,119 @@
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#include "StableHash.hpp"
+#include "Series.hpp"
+#include "SquareMatrix.hpp"
+
+namespace FenestrationCommon
+{
+    namespace
+    {
+        constexpr std::uint64_t fnvOffsetBasis{14695981039346656037ull};
+        constexpr std::uint64_t fnvPrime{1099511628211ull};
+
+        std::uint64_t fnv1aUpdate(std::uint64_t hash, std::span<const std::byte> bytes)
+        {
+            for(const auto byte : bytes)
+            {
+                hash ^= static_cast<std::uint64_t>(byte);
+                hash *= fnvPrime;
+            }
+            return hash;
+        }
+    }   // namespace
+
+    StableHash & StableHash::add(double value)
+    {
+        if(std::isnan(value))
+        {
+            value = std::numeric_limits<double>::quiet_NaN();
+        }
+        else if(value == 0.0)
+        {
+            value = 0.0;
+        }
+        return addInteger(std::bit_cast<std::uint64_t>(value));
+    }
+
+    StableHash & StableHash::add(std::string_view text)
+    {
+        addInteger(text.size());
+        addBytes(text.data(), text.size());
+        return *this;
+    }
+
+    StableHash & StableHash::add(std::span<const double> values)
+    {
+        addInteger(values.size());
+        for(const auto value : values)
+        {
+            add(value);
+        }
+        return *this;
+    }
+
+    std::uint64_t StableHash::value() const
+    {
+        return m_Hash;
+    }
+
+    std::string StableHash::hex() const
+    {
+        return toHex(m_Hash);
+    }
+
+    StableHash & StableHash::addInteger(std::uint64_t value)
+    {
+        // Bytes are fed least significant first so that the key does not depend on endianness.
+        for(size_t i = 0u; i < sizeof(value); ++i)
+        {
+            const auto byte{static_cast<unsigned char>(value >> (8u * i))};
+            addBytes(&byte, 1u);
+        }
+        return *this;
+    }
+
+    void StableHash::addBytes(const void * data, size_t size)
+    {
+        m_Hash = fnv1aUpdate(m_Hash, {static_cast<const std::byte *>(data), size});
+    }
+
+    std::string toHex(std::uint64_t key)
+    {
+        constexpr std::array<char, 16> digits{
+          '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+        std::string result(16u, '0');
+        for(auto it = result.rbegin(); it != result.rend(); ++it)
+        {
+            *it = digits[key & 0xFu];
+            key >>= 4u;
+        }
+        return result;
+    }
+
+    std::uint64_t fnv1a(std::span<const std::byte> bytes)
+    {
+        return fnv1aUpdate(fnvOffsetBasis, bytes);
+    }
+
+    void hashAppend(StableHash & hash, const CSeries & series)
+    {
+        hash.add(series.getXArray());
+        hash.add(series.getYArray());
+    }
+
+    void hashAppend(StableHash & hash, const SquareMatrix & matrix)
+    {
+        hash.add(matrix.size());
+        for(size_t i = 0u; i < matrix.size(); ++i)
+        {
+            for(size_t j = 0u; j < matrix.size(); ++j)
+            {
+                hash.add(matrix(i, j));
+            }
+        }
+    }
+}   // namespace FenestrationCommon
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace FenestrationCommon
+{
+    class CSeries;
+    class SquareMatrix;
+
+    //! \brief 64 bit FNV-1a hash used to build cache keys from calculation inputs.
+    //!
+    //! Values are hashed by their bit pattern, so the same input gives the same key on every run
+    //! and in every process. Negative zero and NaN payloads are canonicalized before hashing.
+    //! Sequences are prefixed by their length so that adjacent arrays cannot alias each other.
+    class StableHash
+    {
+    public:
+        StableHash & add(double value);
+        StableHash & add(std::string_view text);
+        StableHash & add(std::span<const double> values);
+
+        template<std::integral T>
+        StableHash & add(T value)
+        {
+            return addInteger(static_cast<std::uint64_t>(value));
+        }
+
+        template<typename T>
+            requires std::is_enum_v<T>
+        StableHash & add(T value)
+        {
+            using Underlying = std::underlying_type_t<T>;
+            return addInteger(static_cast<std::uint64_t>(static_cast<Underlying>(value)));
+        }
+
+        [[nodiscard]] std::uint64_t value() const;
+
+        //! Key as 16 lower case hexadecimal characters
+        [[nodiscard]] std::string hex() const;
+
+    private:
+        StableHash & addInteger(std::uint64_t value);
+        void addBytes(const void * data, size_t size);
+
+        std::uint64_t m_Hash{14695981039346656037ull};
+    };
+
+    //! Key as 16 lower case hexadecimal characters
+    [[nodiscard]] std::string toHex(std::uint64_t key);
+
+    //! Plain FNV-1a of a byte range, the same function StableHash is built on. Used as the
+    //! checksum of binary result files.
+    [[nodiscard]] std::uint64_t fnv1a(std::span<const std::byte> bytes);
+
+    //! Hashing of the common types. Other modules provide their own overloads next to the type.
+    void hashAppend(StableHash & hash, const CSeries & series);
+    void hashAppend(StableHash & hash, const SquareMatrix & matrix);
+}   // namespace FenestrationCommon
@@ -0,0 +1,34 @@
+#include <atomic>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "WCECommon.hpp"
+
+using namespace FenestrationCommon;
+
+TEST(TestExecuteInParallelDynamic, EveryIndexRunsOnce)
+{
+    constexpr size_t count{1000u};
+    std::vector<std::atomic<size_t>> visits(count);
+
+    for(const size_t threads : {0u, 1u, 4u, 2000u})
+    {
+        for(auto & visit : visits)
+        {
+            visit = 0u;
+        }
+        executeInParallelDynamic<size_t>(
+          count, [&](const size_t idx) { ++visits[idx]; }, threads);
+        for(size_t idx = 0u; idx < count; ++idx)
+        {
+            EXPECT_EQ(1u, visits[idx].load()) << "index " << idx << " with " << threads;
+        }
+    }
+}
+
+TEST(TestExecuteInParallelDynamic, EmptyRangeDoesNothing)
+{
+    size_t calls{0u};
+    executeInParallelDynamic<size_t>(0u, [&](size_t) { ++calls; }, 4u);
+    EXPECT_EQ(0u, calls);
+}
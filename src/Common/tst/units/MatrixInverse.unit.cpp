@@ -66,3 +66,42 @@ TEST_F(TestMatrixInverse, Test2)
         }
     }
 }
+
+TEST_F(TestMatrixInverse, LUFactorSolvesSeveralRightHandSides)
+{
+    SCOPED_TRACE("Begin Test: LU factor solve with several right-hand sides (3 x 3).");
+
+    SquareMatrix a{{3.12, 8.56, 4.19}, {6.87, 4.39, 7.11}, {6.59, 4.98, 7.69}};
+    const LUFactor factor{a};
+
+    const std::vector<std::vector<double>> rightHandSides{{1, 0, 0}, {0.5, -2, 3}, {0, 0, 0}};
+    const auto solutions = factor.solve(rightHandSides);
+    ASSERT_EQ(rightHandSides.size(), solutions.size());
+
+    // The right-hand sides as the columns of one matrix, solved by the existing matrix path.
+    SquareMatrix columns{3u};
+    for(size_t idx = 0; idx < rightHandSides.size(); ++idx)
+    {
+        for(size_t i = 0; i < 3u; ++i)
+        {
+            columns(i, idx) = rightHandSides[idx][i];
+        }
+    }
+    const auto columnSolutions = factor.solveRight(columns);
+
+    for(size_t idx = 0; idx < rightHandSides.size(); ++idx)
+    {
+        for(size_t i = 0; i < 3u; ++i)
+        {
+            EXPECT_NEAR(columnSolutions(i, idx), solutions[idx][i], 1e-14);
+        }
+
+        const auto product = a * solutions[idx];
+        for(size_t i = 0; i < product.size(); ++i)
+        {
+            EXPECT_NEAR(rightHandSides[idx][i], product[i], 1e-12);
+        }
+    }
+
+    EXPECT_THROW(static_cast<void>(factor.solve({{1.0, 2.0}})), std::runtime_error);
+}
@@ -0,0 +1,156 @@
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <gtest/gtest.h>
+
+#include "WCECommon.hpp"
+
+using namespace FenestrationCommon;
+
+class TestResultCache : public testing::Test
+{
+    std::filesystem::path m_Directory;
+
+protected:
+    void SetUp() override
+    {
+        const auto * testName = testing::UnitTest::GetInstance()->current_test_info()->name();
+        m_Directory = std::filesystem::temp_directory_path() / "WCEResultCache" / testName;
+        std::filesystem::remove_all(m_Directory);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(m_Directory);
+    }
+
+public:
+    [[nodiscard]] const std::filesystem::path & directory() const
+    {
+        return m_Directory;
+    }
+};
+
+TEST_F(TestResultCache, HashIsStable)
+{
+    EXPECT_EQ(14695981039346656037ull, StableHash().value());
+
+    const std::vector<double> values{0.3, 0.5, 2.5};
+    const auto key = StableHash().add(values).add(std::string_view{"NFRC 102"}).add(3).value();
+    EXPECT_EQ(key, StableHash().add(values).add(std::string_view{"NFRC 102"}).add(3).value());
+    EXPECT_EQ("6e2c7eac1c2493e6", toHex(key));
+
+    EXPECT_EQ(StableHash().add(0.0).value(), StableHash().add(-0.0).value());
+    EXPECT_EQ(StableHash().add(std::numeric_limits<double>::quiet_NaN()).value(),
+              StableHash().add(-std::numeric_limits<double>::quiet_NaN()).value());
+    EXPECT_NE(StableHash().add(std::vector<double>{1.0}).add(std::vector<double>{}).value(),
+              StableHash().add(std::vector<double>{}).add(std::vector<double>{1.0}).value());
+}
+
+TEST_F(TestResultCache, StoreAndFind)
+{
+    ResultCache cache(directory(), 1024u * 1024u);
+    const auto key = StableHash().add(1.0).value();
+
+    EXPECT_FALSE(cache.find(key).has_value());
+
+    size_t calculations{0u};
+    const auto calculate = [&calculations]() {
+        ++calculations;
+        return std::vector<double>{0.7, 0.25};
+    };
+    EXPECT_EQ(std::vector<double>({0.7, 0.25}), cache.getOrCalculate(key, calculate));
+    EXPECT_EQ(std::vector<double>({0.7, 0.25}), cache.getOrCalculate(key, calculate));
+    EXPECT_EQ(1u, calculations);
+
+    // Another cache on the same directory sees the stored entry
+    ResultCache otherCache(directory(), 1024u * 1024u);
+    EXPECT_EQ(std::vector<double>({0.7, 0.25}), otherCache.find(key).value());
+}
+
+TEST_F(TestResultCache, CorruptedEntryIsMiss)
+{
+    ResultCache cache(directory(), 1024u * 1024u);
+    const auto key = StableHash().add(2.0).value();
+    cache.store(key, std::vector<double>{1.0, 2.0, 3.0});
+
+    const auto path = directory() / (toHex(key) + ".wcr");
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-1, std::ios::end);
+        file.put('\x7f');
+    }
+
+    EXPECT_FALSE(cache.find(key).has_value());
+    EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+TEST_F(TestResultCache, LeastRecentlyUsedIsEvicted)
+{
+    const std::vector<double> values(100u, 1.0);
+    const std::uintmax_t entrySize{32u + values.size() * sizeof(double)};
+    ResultCache cache(directory(), 2u * entrySize);
+
+    cache.store(1u, values);
+    cache.store(2u, values);
+    std::filesystem::last_write_time(directory() / (toHex(1u) + ".wcr"),
+                                     std::filesystem::file_time_type::clock::now()
+                                       - std::chrono::hours(2));
+    std::filesystem::last_write_time(directory() / (toHex(2u) + ".wcr"),
+                                     std::filesystem::file_time_type::clock::now()
+                                       - std::chrono::hours(1));
+
+    // Reading entry 1 makes entry 2 the least recently used one
+    EXPECT_TRUE(cache.find(1u).has_value());
+    cache.store(3u, values);
+
+    EXPECT_TRUE(cache.find(1u).has_value());
+    EXPECT_FALSE(cache.find(2u).has_value());
+    EXPECT_TRUE(cache.find(3u).has_value());
+    EXPECT_EQ(2u * entrySize, cache.sizeInBytes());
+
+    cache.clear();
+    EXPECT_EQ(0u, cache.sizeInBytes());
+}
+
+TEST_F(TestResultCache, TemporaryFilesCountAndStaleOnesAreRemoved)
+{
+    ResultCache cache(directory(), 1024u * 1024u);
+    const auto writeFile = [this](const std::string & name) {
+        std::ofstream file(directory() / name, std::ios::binary);
+        file << std::string(100u, 'x');
+    };
+
+    // One left behind by a process that died while writing, one of a store still running.
+    writeFile("0000000000000001.0123456789abcdef.tmp");
+    writeFile("0000000000000002.0123456789abcdef.tmp");
+    std::filesystem::last_write_time(directory() / "0000000000000001.0123456789abcdef.tmp",
+                                     std::filesystem::file_time_type::clock::now()
+                                       - std::chrono::hours(2));
+    EXPECT_EQ(200u, cache.sizeInBytes());
+
+    const std::vector<double> values(10u, 1.0);
+    cache.store(3u, values);
+    EXPECT_FALSE(std::filesystem::exists(directory() / "0000000000000001.0123456789abcdef.tmp"));
+    EXPECT_TRUE(std::filesystem::exists(directory() / "0000000000000002.0123456789abcdef.tmp"));
+    EXPECT_EQ(100u + 32u + values.size() * sizeof(double), cache.sizeInBytes());
+}
+
+TEST_F(TestResultCache, FailedStoreKeepsCalculatedValues)
+{
+    ResultCache cache(directory(), 1024u * 1024u);
+    const auto key = StableHash().add(2.0).value();
+
+    // A directory in place of the entry makes the final rename fail.
+    const auto blocked = directory() / (toHex(key) + ".wcr");
+    std::filesystem::create_directories(blocked / "occupied");
+
+    const std::vector<double> values{0.1, 0.2};
+    EXPECT_FALSE(cache.store(key, values));
+    EXPECT_EQ(values, cache.getOrCalculate(key, [&values]() { return values; }));
+
+    for(const auto & entry : std::filesystem::directory_iterator(directory()))
+    {
+        EXPECT_NE(".tmp", entry.path().extension());
+    }
+}
@@ -353,4 +353,15 @@ namespace Gases
         return m_GasItem;
     }
 
+    void hashAppend(FenestrationCommon::StableHash & hash, const CGas & gas)
+    {
+        const auto items{gas.gasItems()};
+        hash.add(items.size());
+        for(const auto & item : items)
+        {
+            hash.add(item.fraction());
+            item.gasData().appendToHash(hash);
+        }
+    }
+
 }   // namespace Gases
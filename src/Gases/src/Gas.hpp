@@ -60,4 +60,7 @@ namespace Gases
         double m_Pressure{DefaultPressure};
     };
 
+    //! Adds fractions and data of every gas in the mixture to the cache key.
+    void hashAppend(FenestrationCommon::StableHash & hash, const CGas & gas);
+
 }   // namespace Gases
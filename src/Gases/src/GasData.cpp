@@ -60,4 +60,15 @@ namespace Gases
         return !(rhs == *this);
     }
 
+    void CGasData::appendToHash(FenestrationCommon::StableHash & hash) const
+    {
+        hash.add(m_gasName).add(m_molWeight).add(m_specificHeatRatio);
+        hash.add(m_Coefficients.size());
+        for(const auto & [type, coefficients] : m_Coefficients)
+        {
+            hash.add(type);
+            coefficients.appendToHash(hash);
+        }
+    }
+
 }   // namespace Gases
@@ -29,6 +29,8 @@ namespace Gases
         bool operator==(const CGasData & rhs) const;
         bool operator!=(const CGasData & rhs) const;
 
+        void appendToHash(FenestrationCommon::StableHash & hash) const;
+
     private:
         std::string m_gasName;
         double m_molWeight;
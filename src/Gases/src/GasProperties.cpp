@@ -28,6 +28,11 @@ namespace Gases
         return !(rhs == *this);
     }
 
+    void CIntCoeff::appendToHash(FenestrationCommon::StableHash & hash) const
+    {
+        hash.add(m_A).add(m_B).add(m_C);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////
     //   GasProperties
     ////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,5 +1,10 @@
 #pragma once
 
+namespace FenestrationCommon
+{
+    class StableHash;
+}
+
 namespace Gases
 {
     enum class CoeffType
@@ -19,6 +24,8 @@ namespace Gases
         bool operator==(const CIntCoeff & rhs) const;
         bool operator!=(const CIntCoeff & rhs) const;
 
+        void appendToHash(FenestrationCommon::StableHash & hash) const;
+
     private:
         double m_A{0};
         double m_B{0};
@@ -1,3 +1,5 @@
+#include <stdexcept>
+
 #include "EquivalentBSDFLayer.hpp"
 #include "EquivalentBSDFLayerSingleBand.hpp"
 
@@ -122,6 +124,12 @@ namespace MultiLayerOptics
     }
 
     void CEquivalentBSDFLayer::calculate(const FenestrationCommon::ProgressCallback & callback)
+    {
+        allocateCache();
+        calculateWavelengthByWavelengthProperties(callback);
+    }
+
+    void CEquivalentBSDFLayer::allocateCache()
     {
         for(Side aSide : FenestrationCommon::allSides())
         {
@@ -135,8 +143,6 @@ namespace MultiLayerOptics
                   m_Lambda.size(), m_Lambda.size(), m_CombinedLayerWavelengths.size());
             }
         }
-
-        calculateWavelengthByWavelengthProperties(callback);
     }
 
     void CEquivalentBSDFLayer::setCommonBandWavelengths(const std::vector<double> & value)
@@ -171,6 +177,95 @@ namespace MultiLayerOptics
         m_TotJSC.clear();
     }
 
+    SingleLayerOptics::StoredBSDFResults CEquivalentBSDFLayer::storeResults()
+    {
+        ensureCache();
+
+        const auto & directions{getDirections(SingleLayerOptics::BSDFDirection::Incoming)};
+        SingleLayerOptics::StoredBSDFResults stored{.wavelengths = m_CombinedLayerWavelengths,
+                                                    .layerCount = m_Layer.size()};
+        stored.results.reserve(m_CombinedLayerWavelengths.size());
+        for(size_t index = 0u; index < m_CombinedLayerWavelengths.size(); ++index)
+        {
+            SingleLayerOptics::BSDFIntegrator integrator{directions};
+            for(auto aSide : FenestrationCommon::allSides())
+            {
+                for(auto aProperty : FenestrationCommon::allPropertySimple())
+                {
+                    auto & series{m_Tot.at({aSide, aProperty})};
+                    auto & matrix{integrator.getMatrix(aSide, aProperty)};
+                    for(size_t i = 0u; i < matrix.size(); ++i)
+                    {
+                        for(size_t j = 0u; j < matrix.size(); ++j)
+                        {
+                            matrix(i, j) = series[i][j][index].value();
+                        }
+                    }
+                }
+                for(size_t layerNumber = 0u; layerNumber < m_Layer.size(); ++layerNumber)
+                {
+                    for(const auto & series : m_TotA.at(aSide)[layerNumber])
+                    {
+                        stored.layerAbsorptances.push_back(series[index].value());
+                    }
+                    for(const auto & series : m_TotJSC.at(aSide)[layerNumber])
+                    {
+                        stored.layerJSC.push_back(series[index].value());
+                    }
+                }
+            }
+            stored.results.push_back(std::move(integrator));
+        }
+
+        return stored;
+    }
+
+    void CEquivalentBSDFLayer::restoreResults(const SingleLayerOptics::StoredBSDFResults & stored)
+    {
+        const auto directionsSize{m_Lambda.size()};
+        const auto layerValues{stored.results.size() * 2u * m_Layer.size() * directionsSize};
+        if(stored.results.size() != stored.wavelengths.size() || stored.layerCount != m_Layer.size()
+           || stored.layerAbsorptances.size() != layerValues
+           || stored.layerJSC.size() != layerValues)
+        {
+            throw std::runtime_error("Stored results do not match the equivalent BSDF layer.");
+        }
+
+        setCommonBandWavelengths(stored.wavelengths);
+        allocateCache();
+
+        size_t offset{0u};
+        for(size_t index = 0u; index < stored.wavelengths.size(); ++index)
+        {
+            const auto wavelength{stored.wavelengths[index]};
+            for(auto aSide : FenestrationCommon::allSides())
+            {
+                for(auto aProperty : FenestrationCommon::allPropertySimple())
+                {
+                    m_Tot.at({aSide, aProperty})
+                      .setPropertiesAtIndex(
+                        index, wavelength, stored.results[index].at(aSide, aProperty));
+                }
+                for(size_t layerNumber = 0u; layerNumber < m_Layer.size(); ++layerNumber)
+                {
+                    const auto first{stored.layerAbsorptances.begin() + offset};
+                    m_TotA.at(aSide).setPropertiesAtIndex(
+                      index,
+                      layerNumber,
+                      wavelength,
+                      std::vector<double>(first, first + directionsSize));
+                    const auto firstJSC{stored.layerJSC.begin() + offset};
+                    m_TotJSC.at(aSide).setPropertiesAtIndex(
+                      index,
+                      layerNumber,
+                      wavelength,
+                      std::vector<double>(firstJSC, firstJSC + directionsSize));
+                    offset += directionsSize;
+                }
+            }
+        }
+    }
+
     void CEquivalentBSDFLayer::calculateWavelengthByWavelengthProperties(
       const FenestrationCommon::ProgressCallback & callback)
     {
@@ -61,6 +61,14 @@ namespace MultiLayerOptics
         // Clear cached calculation results to free memory
         void invalidateCache();
 
+        //! Wavelength by wavelength equivalent matrices together with layer absorptances and
+        //! photovoltaic currents, ready to be persisted with BSDFSerialization.
+        [[nodiscard]] SingleLayerOptics::StoredBSDFResults storeResults();
+
+        //! Replaces the cached wavelength by wavelength results with previously stored ones.
+        //! Common band wavelengths are set to the stored wavelengths.
+        void restoreResults(const SingleLayerOptics::StoredBSDFResults & stored);
+
     private:
         [[nodiscard]] CEquivalentBSDFLayerSingleBand
           getEquivalentLayerAtWavelength(size_t wavelengthIndex) const;
@@ -110,6 +118,9 @@ namespace MultiLayerOptics
         bool hasCache() const;
         void ensureCache();
 
+        // Allocates empty cache series for the current common wavelengths
+        void allocateCache();
+
         void calculateWavelengthByWavelengthProperties(
           const FenestrationCommon::ProgressCallback & callback = nullptr);
     };
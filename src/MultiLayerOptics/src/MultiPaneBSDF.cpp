@@ -501,6 +501,17 @@ namespace MultiLayerOptics
         return m_EquivalentLayer.getMaxLambda();
     }
 
+    SingleLayerOptics::StoredBSDFResults CMultiPaneBSDF::storeResults()
+    {
+        return m_EquivalentLayer.storeResults();
+    }
+
+    void CMultiPaneBSDF::restoreResults(const SingleLayerOptics::StoredBSDFResults & stored)
+    {
+        m_EquivalentLayer.restoreResults(stored);
+        invalidate();
+    }
+
     void CMultiPaneBSDF::setCalculationProperties(
       const SingleLayerOptics::CalculationProperties & calcProperties)
     {
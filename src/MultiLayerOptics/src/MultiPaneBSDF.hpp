@@ -196,6 +196,15 @@ namespace MultiLayerOptics
         [[nodiscard]] double getMinLambda() const override;
         [[nodiscard]] double getMaxLambda() const override;
 
+        //! Wavelength by wavelength results of the equivalent layer, ready to be persisted with
+        //! BSDFSerialization.
+        [[nodiscard]] SingleLayerOptics::StoredBSDFResults storeResults();
+
+        //! Uses previously stored wavelength by wavelength results instead of calculating them.
+        //! Call it after setCalculationProperties; integrated results are recalculated from the
+        //! restored ones on the next query.
+        void restoreResults(const SingleLayerOptics::StoredBSDFResults & stored);
+
         void setCalculationProperties(
           const SingleLayerOptics::CalculationProperties & calcProperties) override;
 
@@ -0,0 +1,104 @@
+#include <memory>
+#include <gtest/gtest.h>
+
+#include <WCESpectralAveraging.hpp>
+#include <WCEMultiLayerOptics.hpp>
+#include <WCESingleLayerOptics.hpp>
+#include <WCECommon.hpp>
+
+#include "optical/standardData.hpp"
+#include "optical/spectralSampleData.hpp"
+
+using namespace SingleLayerOptics;
+using namespace FenestrationCommon;
+using namespace SpectralAveraging;
+using namespace MultiLayerOptics;
+
+// Equivalent layer results restored from the persisted data must match the calculated ones
+class TestEquivalentBSDFLayerSerialization : public testing::Test
+{
+public:
+    static BSDFHemisphere hemisphere()
+    {
+        return BSDFHemisphere::create(
+          {{0, 1}, {15, 1}, {30, 1}, {45, 1}, {60, 1}, {75, 1}, {86.25, 1}});
+    }
+
+    static std::vector<std::shared_ptr<CBSDFLayer>> createLayers()
+    {
+        auto thickness = 3.048e-3;   // [m]
+        const auto aMaterial_102 = SingleLayerOptics::Material::nBandMaterial(
+          SpectralSample::NFRC_102(), thickness, MaterialType::Monolithic);
+        thickness = 5.715e-3;   // [m]
+        const auto aMaterial_103 = SingleLayerOptics::Material::nBandMaterial(
+          SpectralSample::NFRC_103(), thickness, MaterialType::Monolithic);
+
+        const auto aBSDF = hemisphere();
+
+        return {CBSDFLayerMaker::getSpecularLayer(aMaterial_102, aBSDF),
+                CBSDFLayerMaker::getSpecularLayer(aMaterial_103, aBSDF)};
+    }
+
+    static CEquivalentBSDFLayer createEquivalentLayer()
+    {
+        return CEquivalentBSDFLayer(createLayers(), std::nullopt);
+    }
+
+    static std::unique_ptr<CMultiPaneBSDF> createMultiPane()
+    {
+        auto multiPane = CMultiPaneBSDF::create(createLayers());
+        multiPane->setCalculationProperties(
+          CalculationProperties{StandardData::solarRadiationASTM_E891_87_Table1(),
+                                StandardData::solarRadiationASTM_E891_87_Table1().getXArray()});
+        return multiPane;
+    }
+};
+
+TEST_F(TestEquivalentBSDFLayerSerialization, RestoredResultsMatchCalculated)
+{
+    auto calculated = createEquivalentLayer();
+    const auto blob = BSDFSerialization::serialize(calculated.storeResults());
+
+    auto restored = createEquivalentLayer();
+    const auto & directions = restored.getDirections(BSDFDirection::Incoming);
+    restored.restoreResults(BSDFSerialization::deserialize(blob, directions));
+
+    EXPECT_EQ(calculated.getCommonWavelengths(), restored.getCommonWavelengths());
+    EXPECT_EQ(blob, BSDFSerialization::serialize(restored.storeResults()));
+
+    auto calculatedA = calculated.getTotalA(Side::Back);
+    auto restoredA = restored.getTotalA(Side::Back);
+    EXPECT_EQ(calculatedA[1][3].getYArray(), restoredA[1][3].getYArray());
+
+    auto calculatedT = calculated.getTotal(Side::Front, PropertySurface::T);
+    auto restoredT = restored.getTotal(Side::Front, PropertySurface::T);
+    EXPECT_EQ(calculatedT[2][2].getYArray(), restoredT[2][2].getYArray());
+}
+
+TEST_F(TestEquivalentBSDFLayerSerialization, LayerCountMismatchThrows)
+{
+    auto calculated = createEquivalentLayer();
+    auto stored = calculated.storeResults();
+    stored.layerCount = 1u;
+
+    auto restored = createEquivalentLayer();
+    EXPECT_THROW(restored.restoreResults(stored), std::runtime_error);
+}
+
+TEST_F(TestEquivalentBSDFLayerSerialization, MultiPaneRestoredResultsMatchCalculated)
+{
+    auto calculated = createMultiPane();
+    const auto blob = BSDFSerialization::serialize(calculated->storeResults());
+
+    auto restored = createMultiPane();
+    const auto aBSDF = hemisphere();
+    restored->restoreResults(
+      BSDFSerialization::deserialize(blob, aBSDF.getDirections(BSDFDirection::Incoming)));
+
+    constexpr auto minLambda{0.3};
+    constexpr auto maxLambda{2.5};
+    EXPECT_EQ(calculated->DiffDiff(minLambda, maxLambda, Side::Front, PropertySurface::T),
+              restored->DiffDiff(minLambda, maxLambda, Side::Front, PropertySurface::T));
+    EXPECT_EQ(calculated->AbsDiff(minLambda, maxLambda, Side::Back, 2),
+              restored->AbsDiff(minLambda, maxLambda, Side::Back, 2));
+}
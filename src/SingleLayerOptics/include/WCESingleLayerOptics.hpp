@@ -23,8 +23,10 @@
 #include "../src/SpectrumLocus.hpp"
 #include "../src/SpecularCellDescription.hpp"
 #include "../src/VenetianCellDescription.hpp"
+#include "../src/VenetianGeometryCache.hpp"
 #include "../src/VenetianSlat.hpp"
 #include "../src/WovenCellDescription.hpp"
 #include "../src/IScatteringLayer.hpp"
 #include "../src/ColorProperties.hpp"
 #include "../src/CalculationProperties.hpp"
+#include "../src/BSDFSerialization.hpp"
@@ -258,4 +258,23 @@ namespace SingleLayerOptics
         return m_Directions.at(t_Side).profileAngles();
     }
 
+    void hashAppend(StableHash & hash, BSDFBasis basis)
+    {
+        hash.add(basis);
+    }
+
+    void hashAppend(StableHash & hash, const BSDFHemisphere & hemisphere)
+    {
+        for(const auto direction : {BSDFDirection::Incoming, BSDFDirection::Outgoing})
+        {
+            const auto & directions{hemisphere.getDirections(direction)};
+            hash.add(directions.size());
+            for(const auto & patch : directions)
+            {
+                hash.add(patch.centerPoint().theta()).add(patch.centerPoint().phi());
+                hash.add(patch.lambda());
+            }
+        }
+    }
+
 }   // namespace SingleLayerOptics
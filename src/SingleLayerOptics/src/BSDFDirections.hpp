@@ -92,6 +92,8 @@ namespace SingleLayerOptics
 
     [[nodiscard]] std::vector<BSDFDefinition> bsdfDefinition(BSDFBasis basis);
 
+    void hashAppend(FenestrationCommon::StableHash & hash, BSDFBasis basis);
+
     class BSDFHemisphere
     {
     public:
@@ -113,4 +115,7 @@ namespace SingleLayerOptics
           generateBSDFDirections(const std::vector<BSDFDefinition> & t_Definitions);
     };
 
+    //! Adds center and solid angle of every patch, so custom bases are told apart as well.
+    void hashAppend(FenestrationCommon::StableHash & hash, const BSDFHemisphere & hemisphere);
+
 }   // namespace SingleLayerOptics
\ No newline at end of file
@@ -80,17 +80,59 @@ namespace SingleLayerOptics
 
     std::vector<BSDFIntegrator> CBSDFLayer::getWavelengthResults()
     {
+        if(!m_StoredWavelengthResults.empty())
+        {
+            return m_StoredWavelengthResults;
+        }
         return calculate_wv();
     }
 
     BSDFIntegrator CBSDFLayer::getResultsAtWavelength(size_t wavelengthIndex)
     {
+        if(!m_StoredWavelengthResults.empty())
+        {
+            return m_StoredWavelengthResults.at(wavelengthIndex);
+        }
         BSDFIntegrator results{m_BSDFHemisphere.getDirections(BSDFDirection::Incoming)};
         calculate_dir_dir_wl(wavelengthIndex, results);
         calculate_dir_dif_wv(wavelengthIndex, results);
         return results;
     }
 
+    StoredBSDFResults CBSDFLayer::storeWavelengthResults()
+    {
+        StoredBSDFResults stored{.wavelengths = getBandWavelengths(),
+                                 .results = getWavelengthResults()};
+        stored.results.push_back(getResults());
+        return stored;
+    }
+
+    void CBSDFLayer::restoreWavelengthResults(StoredBSDFResults stored)
+    {
+        const bool hasIntegrated{stored.results.size() == stored.wavelengths.size() + 1u};
+        if(stored.wavelengths.size() != stored.results.size() && !hasIntegrated)
+        {
+            throw std::runtime_error(
+              "Stored BSDF results must contain one result for each band wavelength.");
+        }
+        const auto matrixSize{m_BSDFHemisphere.getDirections(BSDFDirection::Incoming).size()};
+        for(const auto & result : stored.results)
+        {
+            if(result.at(Side::Front, PropertySurface::T).size() != matrixSize)
+            {
+                throw std::runtime_error("Stored BSDF results do not match the layer directions.");
+            }
+        }
+        m_Results.reset();
+        if(hasIntegrated)
+        {
+            m_Results = std::move(stored.results.back());
+            stored.results.pop_back();
+        }
+        m_Cell->setBandWavelengths(stored.wavelengths);
+        m_StoredWavelengthResults = std::move(stored.results);
+    }
+
     void CBSDFLayer::calculate_dir_dir_wl(size_t wavelengthIndex, BSDFIntegrator & results) const
     {
         for(Side aSide : allSides())
@@ -144,6 +186,10 @@ namespace SingleLayerOptics
 
     void CBSDFLayer::setBandWavelengths(const std::vector<double> & wavelengths)
     {
+        if(!m_StoredWavelengthResults.empty() && wavelengths != getBandWavelengths())
+        {
+            m_StoredWavelengthResults.clear();
+        }
         m_Cell->setBandWavelengths(wavelengths);
     }
 
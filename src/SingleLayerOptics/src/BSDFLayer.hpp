@@ -8,6 +8,7 @@
 
 #include "BSDFDirections.hpp"
 #include "BSDFIntegrator.hpp"
+#include "BSDFSerialization.hpp"
 #include "PhotovoltaicProperties.hpp"
 
 namespace FenestrationCommon
@@ -82,6 +83,17 @@ namespace SingleLayerOptics
         std::vector<BSDFIntegrator> getWavelengthResults();
         BSDFIntegrator getResultsAtWavelength(size_t wavelengthIndex);
 
+        //! Band wavelengths together with the results for each of them, followed by the results
+        //! over the entire range, ready to be persisted with BSDFSerialization.
+        [[nodiscard]] StoredBSDFResults storeWavelengthResults();
+
+        //! Uses previously stored results instead of calculating them from the cell. Band
+        //! wavelengths of the cell are set to the stored ones. The last result, when there is one
+        //! more than band wavelengths, is used as the result over the entire range until the
+        //! source data changes. Stored band results are discarded once band wavelengths are
+        //! changed to something else.
+        void restoreWavelengthResults(StoredBSDFResults stored);
+
         int getBandIndex(double t_Wavelength);
 
         std::vector<double> getBandWavelengths() const;
@@ -130,6 +142,9 @@ namespace SingleLayerOptics
         std::shared_ptr<CBaseCell> m_Cell;
         std::optional<BSDFIntegrator> m_Results;
 
+        //! Results for each band wavelength restored from the persisted data.
+        std::vector<BSDFIntegrator> m_StoredWavelengthResults;
+
     private:
         void calc_dir_dir();
         void calc_dir_dif();
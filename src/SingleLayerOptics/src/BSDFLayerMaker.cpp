@@ -12,6 +12,7 @@
 #include "PerforatedCellDescription.hpp"
 #include "WovenCellDescription.hpp"
 #include "FlatCellDescription.hpp"
+#include "MaterialDescription.hpp"
 
 namespace SingleLayerOptics
 {
@@ -113,13 +114,65 @@ namespace SingleLayerOptics
                                         DistributionMethod method,
                                         bool isHorizontal)
     {
-        CVenetianCellDescription aCellDescription{geometry, numOfSlatSegments};
+        return venetianLayer(t_Material,
+                             t_BSDF,
+                             geometry,
+                             numOfSlatSegments,
+                             method,
+                             isHorizontal,
+                             t_BSDF.profileAngles(BSDFDirection::Incoming),
+                             t_BSDF.profileAngles(BSDFDirection::Outgoing));
+    }
 
+    std::vector<std::shared_ptr<CBSDFLayer>>
+      CBSDFLayerMaker::getVenetianLayers(const std::shared_ptr<CMaterial> & t_Material,
+                                         const BSDFHemisphere & t_BSDF,
+                                         const FenestrationCommon::Venetian::Geometry & geometry,
+                                         const std::vector<double> & slatTilts,
+                                         size_t numOfSlatSegments,
+                                         DistributionMethod method,
+                                         bool isHorizontal)
+    {
         const auto profileAnglesIncoming = t_BSDF.profileAngles(BSDFDirection::Incoming);
+        const auto profileAnglesOutgoing = t_BSDF.profileAngles(BSDFDirection::Outgoing);
+
+        // Band properties are calculated lazily by some materials, so they are settled here
+        // before the cells read them from several threads.
+        (void)t_Material->getBandProperties();
+
+        std::vector<std::shared_ptr<CBSDFLayer>> layers(slatTilts.size());
+        FenestrationCommon::executeInParallelDynamic(slatTilts.size(), [&](const size_t index) {
+            auto tiltGeometry{geometry};
+            tiltGeometry.SlatTiltAngle = slatTilts[index];
+            auto layer = venetianLayer(t_Material,
+                                       t_BSDF,
+                                       tiltGeometry,
+                                       numOfSlatSegments,
+                                       method,
+                                       isHorizontal,
+                                       profileAnglesIncoming,
+                                       profileAnglesOutgoing);
+            (void)layer->getResults();
+            layers[index] = std::move(layer);
+        });
+
+        return layers;
+    }
+
+    std::shared_ptr<CBSDFLayer>
+      CBSDFLayerMaker::venetianLayer(const std::shared_ptr<CMaterial> & t_Material,
+                                     const BSDFHemisphere & t_BSDF,
+                                     const FenestrationCommon::Venetian::Geometry & geometry,
+                                     size_t numOfSlatSegments,
+                                     DistributionMethod method,
+                                     bool isHorizontal,
+                                     const std::vector<double> & profileAnglesIncoming,
+                                     const std::vector<double> & profileAnglesOutgoing)
+    {
+        CVenetianCellDescription aCellDescription{geometry, numOfSlatSegments};
+
         aCellDescription.preCalculateForProfileAngles(FenestrationCommon::Side::Front,
                                                       profileAnglesIncoming);
-
-        const auto profileAnglesOutgoing = t_BSDF.profileAngles(BSDFDirection::Outgoing);
         aCellDescription.preCalculateForProfileAngles(FenestrationCommon::Side::Back,
                                                       profileAnglesOutgoing);
 
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "PhotovoltaicProperties.hpp"
 #include "CellDescription.hpp"
@@ -77,6 +78,19 @@ namespace SingleLayerOptics
                            DistributionMethod method = DistributionMethod::DirectionalDiffuse,
                            bool isHorizontal = true);
 
+        //! One layer for every slat tilt, in the order of slatTilts, with the BSDF over the
+        //! entire range already calculated. Tilts are calculated in parallel. The material, the
+        //! hemisphere and its profile angles are shared by all of them and the slat tilt angle of
+        //! geometry is replaced by each tilt in turn.
+        static std::vector<std::shared_ptr<CBSDFLayer>>
+          getVenetianLayers(const std::shared_ptr<CMaterial> & t_Material,
+                            const BSDFHemisphere & t_BSDF,
+                            const FenestrationCommon::Venetian::Geometry & geometry,
+                            const std::vector<double> & slatTilts,
+                            size_t numOfSlatSegments,
+                            DistributionMethod method = DistributionMethod::DirectionalDiffuse,
+                            bool isHorizontal = true);
+
         static std::shared_ptr<CBSDFLayer>
           getPerfectlyDiffuseLayer(const std::shared_ptr<CMaterial> & t_Material,
                                    const BSDFHemisphere & t_BSDF);
@@ -109,6 +123,16 @@ namespace SingleLayerOptics
 
 
     private:
+        static std::shared_ptr<CBSDFLayer>
+          venetianLayer(const std::shared_ptr<CMaterial> & t_Material,
+                        const BSDFHemisphere & t_BSDF,
+                        const FenestrationCommon::Venetian::Geometry & geometry,
+                        size_t numOfSlatSegments,
+                        DistributionMethod method,
+                        bool isHorizontal,
+                        const std::vector<double> & profileAnglesIncoming,
+                        const std::vector<double> & profileAnglesOutgoing);
+
         std::shared_ptr<CBSDFLayer> m_Layer;
         std::shared_ptr<CBaseCell> m_Cell;
     };
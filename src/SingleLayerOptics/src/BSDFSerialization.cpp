@@ -0,0 +1,242 @@
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include <WCECommon.hpp>
+
+#include "BSDFSerialization.hpp"
+#include "BSDFDirections.hpp"
+
+using namespace FenestrationCommon;
+
+namespace SingleLayerOptics::BSDFSerialization
+{
+    namespace
+    {
+        constexpr std::array<char, 8> magic{'W', 'C', 'E', 'B', 'S', 'D', 'F', '\0'};
+
+        struct Header
+        {
+            std::uint64_t version{0};
+            std::uint64_t matrixSize{0};
+            std::uint64_t resultCount{0};
+            std::uint64_t wavelengthCount{0};
+            std::uint64_t layerCount{0};
+            std::uint64_t checksum{0};
+        };
+
+        constexpr size_t headerSize = magic.size() + 6u * sizeof(std::uint64_t);
+
+        //! Order in which the matrices of a single integrator are written.
+        constexpr std::array<std::pair<Side, PropertySurface>, 4> matrixOrder{
+          {{Side::Front, PropertySurface::T},
+           {Side::Front, PropertySurface::R},
+           {Side::Back, PropertySurface::T},
+           {Side::Back, PropertySurface::R}}};
+
+        //! Number of doubles in each of the layer absorptance and layer JSC sections. Counts come
+        //! from the file on reading, so every product is checked.
+        std::uint64_t layerSectionSize(const Header & header)
+        {
+            return checkedMultiply(
+              checkedMultiply(checkedMultiply(header.resultCount, 2u), header.layerCount),
+              header.matrixSize);
+        }
+
+        std::uint64_t payloadSize(const Header & header)
+        {
+            const auto matrixValues{checkedMultiply(
+              checkedMultiply(header.resultCount, matrixOrder.size()),
+              checkedMultiply(header.matrixSize, header.matrixSize))};
+            const auto values{checkedAdd(checkedAdd(header.wavelengthCount, matrixValues),
+                                         checkedMultiply(2u, layerSectionSize(header)))};
+            return checkedMultiply(values, sizeof(double));
+        }
+    }   // namespace
+
+    std::vector<std::byte> serialize(const StoredBSDFResults & results)
+    {
+        Header header{
+          .version = version,
+          .matrixSize = results.results.empty()
+                          ? 0u
+                          : results.results.front().at(Side::Front, PropertySurface::T).size(),
+          .resultCount = results.results.size(),
+          .wavelengthCount = results.wavelengths.size(),
+          .layerCount = results.layerCount};
+
+        const auto layerValues = layerSectionSize(header);
+        if(results.layerAbsorptances.size() != layerValues
+           || results.layerJSC.size() != layerValues)
+        {
+            throw std::runtime_error("Layer results do not match the number of BSDF results.");
+        }
+
+        std::vector<std::byte> blob(headerSize + payloadSize(header));
+        const auto payload = std::span<std::byte>(blob).subspan(headerSize);
+
+        BinaryWriter payloadWriter{payload};
+        for(const auto wavelength : results.wavelengths)
+        {
+            payloadWriter.write(wavelength);
+        }
+        for(const auto & integrator : results.results)
+        {
+            for(const auto & [side, property] : matrixOrder)
+            {
+                const auto & matrix = integrator.at(side, property);
+                if(matrix.size() != header.matrixSize)
+                {
+                    throw std::runtime_error("All BSDF results must have the same matrix size.");
+                }
+                for(size_t i = 0u; i < matrix.size(); ++i)
+                {
+                    for(size_t j = 0u; j < matrix.size(); ++j)
+                    {
+                        payloadWriter.write(matrix(i, j));
+                    }
+                }
+            }
+        }
+        for(const auto value : results.layerAbsorptances)
+        {
+            payloadWriter.write(value);
+        }
+        for(const auto value : results.layerJSC)
+        {
+            payloadWriter.write(value);
+        }
+
+        header.checksum = fnv1a(payload);
+
+        BinaryWriter headerWriter{blob};
+        headerWriter.write(magic);
+        headerWriter.write(header.version);
+        headerWriter.write(header.matrixSize);
+        headerWriter.write(header.resultCount);
+        headerWriter.write(header.wavelengthCount);
+        headerWriter.write(header.layerCount);
+        headerWriter.write(header.checksum);
+
+        return blob;
+    }
+
+    StoredBSDFResults deserialize(std::span<const std::byte> blob,
+                                  const BSDFDirections & directions)
+    {
+        if(blob.size() < headerSize || std::memcmp(blob.data(), magic.data(), magic.size()) != 0)
+        {
+            throw std::runtime_error("Unknown BSDF results format.");
+        }
+
+        BinaryReader headerReader{blob.subspan(magic.size())};
+        Header header;
+        header.version = headerReader.read<std::uint64_t>();
+        header.matrixSize = headerReader.read<std::uint64_t>();
+        header.resultCount = headerReader.read<std::uint64_t>();
+        header.wavelengthCount = headerReader.read<std::uint64_t>();
+        header.layerCount = headerReader.read<std::uint64_t>();
+        header.checksum = headerReader.read<std::uint64_t>();
+
+        if(header.version != version)
+        {
+            throw std::runtime_error("Unsupported BSDF results version.");
+        }
+        if(header.resultCount > 0u && header.matrixSize != directions.size())
+        {
+            throw std::runtime_error("Stored BSDF results do not match the BSDF directions.");
+        }
+        if(blob.size() - headerSize != payloadSize(header))
+        {
+            throw std::runtime_error("BSDF results are truncated.");
+        }
+
+        const auto payload = blob.subspan(headerSize);
+        if(fnv1a(payload) != header.checksum)
+        {
+            throw std::runtime_error("BSDF results checksum mismatch.");
+        }
+
+        BinaryReader reader{payload};
+        StoredBSDFResults result;
+        result.wavelengths.resize(header.wavelengthCount);
+        for(auto & wavelength : result.wavelengths)
+        {
+            wavelength = reader.read<double>();
+        }
+
+        result.results.reserve(header.resultCount);
+        for(std::uint64_t index = 0u; index < header.resultCount; ++index)
+        {
+            BSDFIntegrator integrator{directions};
+            for(const auto & [side, property] : matrixOrder)
+            {
+                auto & matrix = integrator.getMatrix(side, property);
+                for(size_t i = 0u; i < matrix.size(); ++i)
+                {
+                    for(size_t j = 0u; j < matrix.size(); ++j)
+                    {
+                        matrix(i, j) = reader.read<double>();
+                    }
+                }
+            }
+            result.results.push_back(std::move(integrator));
+        }
+
+        result.layerCount = header.layerCount;
+        result.layerAbsorptances.resize(layerSectionSize(header));
+        for(auto & value : result.layerAbsorptances)
+        {
+            value = reader.read<double>();
+        }
+        result.layerJSC.resize(layerSectionSize(header));
+        for(auto & value : result.layerJSC)
+        {
+            value = reader.read<double>();
+        }
+
+        return result;
+    }
+
+    void save(const std::filesystem::path & fileName, const StoredBSDFResults & results)
+    {
+        const auto blob = serialize(results);
+        std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+        if(!file)
+        {
+            throw std::runtime_error("Cannot open BSDF results file for writing.");
+        }
+        file.write(reinterpret_cast<const char *>(blob.data()),
+                   static_cast<std::streamsize>(blob.size()));
+        file.close();
+        if(!file)
+        {
+            throw std::runtime_error("Cannot write BSDF results file.");
+        }
+    }
+
+    StoredBSDFResults load(const std::filesystem::path & fileName,
+                           const BSDFDirections & directions)
+    {
+        std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+        if(!file)
+        {
+            throw std::runtime_error("Cannot open BSDF results file for reading.");
+        }
+        const auto size{file.tellg()};
+        if(size < 0)
+        {
+            throw std::runtime_error("Cannot read BSDF results file.");
+        }
+        std::vector<std::byte> blob(static_cast<size_t>(size));
+        file.seekg(0);
+        file.read(reinterpret_cast<char *>(blob.data()), static_cast<std::streamsize>(blob.size()));
+        if(!file)
+        {
+            throw std::runtime_error("Cannot read BSDF results file.");
+        }
+
+        return deserialize(blob, directions);
+    }
+}   // namespace SingleLayerOptics::BSDFSerialization
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+#include "BSDFIntegrator.hpp"
+
+namespace SingleLayerOptics
+{
+    class BSDFDirections;
+
+    //! BSDF results as they are persisted: band wavelengths and one integrator per band. Single
+    //! layer results carry one more integrator at the end, the result over the entire range.
+    //!
+    //! Equivalent (multi-layer) results additionally carry absorptances and photovoltaic currents
+    //! of every layer. Both are flattened as [result][side (front, back)][layer][direction].
+    struct StoredBSDFResults
+    {
+        std::vector<double> wavelengths;
+        std::vector<BSDFIntegrator> results;
+
+        size_t layerCount{0u};
+        std::vector<double> layerAbsorptances;
+        std::vector<double> layerJSC;
+    };
+
+    //! Versioned binary image of BSDF results. All fields are 8 bytes wide and stored in host
+    //! byte order so the file can be memory-mapped and read in place:
+    //!
+    //!   header  : char[8] magic "WCEBSDF", uint64 version, uint64 matrixSize,
+    //!             uint64 resultCount, uint64 wavelengthCount, uint64 layerCount,
+    //!             uint64 checksum
+    //!   payload : double[wavelengthCount] wavelengths,
+    //!             per result: Tf, Rf, Tb, Rb matrices (matrixSize^2 doubles each, row major),
+    //!             layer absorptances and layer JSC (resultCount * 2 * layerCount * matrixSize
+    //!             doubles each)
+    //!
+    //! The checksum is FNV-1a over the payload bytes. Only the T/R matrices are stored; the
+    //! hemispherical and diffuse-diffuse values are recomputed lazily by BSDFIntegrator.
+    namespace BSDFSerialization
+    {
+        inline constexpr std::uint64_t version = 1u;
+
+        [[nodiscard]] std::vector<std::byte> serialize(const StoredBSDFResults & results);
+
+        //! Throws if the blob has a wrong magic, version, checksum or a matrix size that does not
+        //! match the given directions.
+        [[nodiscard]] StoredBSDFResults deserialize(std::span<const std::byte> blob,
+                                                    const BSDFDirections & directions);
+
+        void save(const std::filesystem::path & fileName, const StoredBSDFResults & results);
+
+        [[nodiscard]] StoredBSDFResults load(const std::filesystem::path & fileName,
+                                             const BSDFDirections & directions);
+    }   // namespace BSDFSerialization
+}   // namespace SingleLayerOptics
@@ -10,6 +10,7 @@
 #include "BaseCell.hpp"
 #include "BeamDirection.hpp"
 #include "MaterialDescription.hpp"
+#include "VenetianGeometryCache.hpp"
 #include "WovenCellDescription.hpp"
 
 using FenestrationCommon::CSeries;
@@ -139,8 +140,8 @@ namespace SingleLayerOptics
                && "Venetian cell must carry a CVenetianCellDescription.");
 
         auto const & forward = std::get<CVenetianCellDescription>(m_CellDescription);
-        auto forwardGeometry = makeVenetianGeometry(forward);
-        auto backwardGeometry = makeVenetianGeometry(forward.getBackwardFlowCell());
+        auto forwardGeometry = cachedVenetianGeometry(forward);
+        auto backwardGeometry = cachedVenetianGeometry(forward.getBackwardFlowCell());
 
         m_Venetian->m_Energy = CVenetianEnergy(*m_Material, forwardGeometry, backwardGeometry);
         m_Venetian->m_EnergiesBand.clear();
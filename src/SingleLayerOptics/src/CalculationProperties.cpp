@@ -34,4 +34,21 @@ namespace SingleLayerOptics
     {
         return DetectorData.has_value() && DetectorData.value().size() != 0;
     }
+
+    void hashAppend(FenestrationCommon::StableHash & hash,
+                    const CalculationProperties & properties)
+    {
+        hashAppend(hash, properties.SolarRadiation);
+        hash.add(properties.CommonWavelengths.has_value());
+        if(properties.CommonWavelengths.has_value())
+        {
+            hash.add(properties.CommonWavelengths.value());
+        }
+        hash.add(properties.isDetectorDataValid());
+        if(properties.isDetectorDataValid())
+        {
+            hashAppend(hash, properties.DetectorData.value());
+        }
+        hash.add(properties.m_IntegrationType).add(properties.m_NormalizationCoefficient);
+    }
 }   // namespace SingleLayerOptics
\ No newline at end of file
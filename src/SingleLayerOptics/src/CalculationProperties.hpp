@@ -29,4 +29,7 @@ namespace SingleLayerOptics
         [[nodiscard]] FenestrationCommon::CSeries scaledSolarRadiation() const;
         [[nodiscard]] bool isDetectorDataValid() const;
     };
+
+    void hashAppend(FenestrationCommon::StableHash & hash,
+                    const CalculationProperties & properties);
 }   // namespace SingleLayerOptics
\ No newline at end of file
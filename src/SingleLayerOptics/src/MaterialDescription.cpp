@@ -207,6 +207,7 @@ namespace SingleLayerOptics
         std::lock_guard lock(baseMaterialMutex);
         m_Wavelengths = wavelengths;
         m_WavelengthsCalculated = true;
+        m_WavelengthsAssigned = true;
     }
 
     size_t CMaterial::getBandSize()
@@ -248,6 +249,21 @@ namespace SingleLayerOptics
         return {};
     }
 
+    void CMaterial::appendToHash(StableHash & hash) const
+    {
+        hash.add(m_MinLambda).add(m_MaxLambda);
+        hash.add(m_WavelengthsAssigned);
+        if(m_WavelengthsAssigned)
+        {
+            hash.add(m_Wavelengths);
+        }
+    }
+
+    void hashAppend(StableHash & hash, const CMaterial & material)
+    {
+        material.appendToHash(hash);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     ////   CMaterialSingleBand
     ////////////////////////////////////////////////////////////////////////////////////
@@ -331,6 +347,18 @@ namespace SingleLayerOptics
         return {m_MinLambda, m_MaxLambda};
     }
 
+    void CMaterialSingleBand::appendToHash(StableHash & hash) const
+    {
+        hash.add(std::string_view("CMaterialSingleBand"));
+        CMaterial::appendToHash(hash);
+        for(const auto & [key, surface] : m_Property)
+        {
+            const auto & [side, scattering] = key;
+            hash.add(side).add(scattering);
+            hash.add(surface->getProperty(Property::T)).add(surface->getProperty(Property::R));
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     ////   IMaterialDualBand
     ////////////////////////////////////////////////////////////////////////////////////
@@ -450,6 +478,15 @@ namespace SingleLayerOptics
         return m_Wavelengths;
     }
 
+    void IMaterialDualBand::appendToHash(StableHash & hash) const
+    {
+        // Scaled range is created from the two ranges below
+        hash.add(std::string_view("IMaterialDualBand"));
+        CMaterial::appendToHash(hash);
+        m_MaterialVisibleRange->appendToHash(hash);
+        m_MaterialSolarRange->appendToHash(hash);
+    }
+
     std::shared_ptr<CMaterial>
       IMaterialDualBand::getMaterialFromWavelength(const double wavelength) const
     {
@@ -557,6 +594,13 @@ namespace SingleLayerOptics
         m_AngularSample.Flipped(flipped);
     }
 
+    void CMaterialSample::appendToHash(StableHash & hash) const
+    {
+        hash.add(std::string_view("CMaterialSample"));
+        CMaterial::appendToHash(hash);
+        m_AngularSample.appendToHash(hash);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     ////   CMaterialPhotovoltaicSample
     ////////////////////////////////////////////////////////////////////////////////////
@@ -574,6 +618,12 @@ namespace SingleLayerOptics
         return m_PVSample->jscPrime(t_Side);
     }
 
+    void CMaterialPhotovoltaicSample::appendToHash(StableHash & hash) const
+    {
+        CMaterialSample::appendToHash(hash);
+        m_PVSample->appendToHash(hash);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     ////   CMaterialMeasured
     ////////////////////////////////////////////////////////////////////////////////////
@@ -658,6 +708,13 @@ namespace SingleLayerOptics
         return aSample->getWavelengthsFromSample();
     }
 
+    void CMaterialMeasured::appendToHash(StableHash & hash) const
+    {
+        hash.add(std::string_view("CMaterialMeasured"));
+        CMaterial::appendToHash(hash);
+        m_AngularMeasurements->appendToHash(hash);
+    }
+
     CMaterialSingleBandBSDF::CMaterialSingleBandBSDF(std::vector<std::vector<double>> const & t_Tf,
                                                      std::vector<std::vector<double>> const & t_Tb,
                                                      std::vector<std::vector<double>> const & t_Rf,
@@ -761,6 +818,21 @@ namespace SingleLayerOptics
         return m_Hemisphere;
     }
 
+    void CMaterialSingleBandBSDF::appendToHash(StableHash & hash) const
+    {
+        hash.add(std::string_view("CMaterialSingleBandBSDF"));
+        CMaterial::appendToHash(hash);
+        for(const auto & [key, matrix] : m_Property)
+        {
+            hash.add(key.first).add(key.second).add(matrix.size());
+            for(const auto & row : matrix)
+            {
+                hash.add(row);
+            }
+        }
+        hashAppend(hash, m_Hemisphere);
+    }
+
     std::vector<double> CMaterialSingleBandBSDF::calculateBandWavelengths()
     {
         return {m_MinLambda, m_MaxLambda};
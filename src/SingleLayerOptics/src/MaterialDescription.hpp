@@ -23,6 +23,7 @@ namespace FenestrationCommon
     enum class MaterialType;
     enum class WavelengthRange;
     class CSeries;
+    class StableHash;
 
 }   // namespace FenestrationCommon
 
@@ -134,6 +135,12 @@ namespace SingleLayerOptics
         [[nodiscard]] virtual FenestrationCommon::CSeries
           jscPrime(FenestrationCommon::Side t_Side) const;
 
+        //! Adds every input that affects material properties to the cache key. Base
+        //! implementation adds the wavelength range and assigned band wavelengths and has to be
+        //! called by every override. Band wavelengths that are calculated are not added because
+        //! they follow from the material data.
+        virtual void appendToHash(FenestrationCommon::StableHash & hash) const = 0;
+
     protected:
         double m_MinLambda;
         double m_MaxLambda;
@@ -141,9 +148,12 @@ namespace SingleLayerOptics
         // Set state in order not to calculate wavelengths every time
         virtual std::vector<double> calculateBandWavelengths() = 0;
         bool m_WavelengthsCalculated{false};
+        bool m_WavelengthsAssigned{false};
         std::vector<double> m_Wavelengths;
     };
 
+    void hashAppend(FenestrationCommon::StableHash & hash, const CMaterial & material);
+
     //////////////////////////////////////////////////////////////////////////////////////////
     ///   CMaterialSingleBand
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -180,6 +190,8 @@ namespace SingleLayerOptics
                           const CBeamDirection & t_OutgoingDirection = CBeamDirection(),
                           OutgoingAggregation t_Agg = OutgoingAggregation::Beam) const override;
 
+        void appendToHash(FenestrationCommon::StableHash & hash) const override;
+
     private:
         std::vector<double> calculateBandWavelengths() override;
 
@@ -233,6 +245,8 @@ namespace SingleLayerOptics
 
         BSDFHemisphere getHemisphere() const;
 
+        void appendToHash(FenestrationCommon::StableHash & hash) const override;
+
     private:
         std::vector<double> calculateBandWavelengths() override;
         // Checks to make sure a matrix has the same number of values as the BSDF hemisphere
@@ -293,6 +307,8 @@ namespace SingleLayerOptics
         // Creates all the required ranges in m_Materials from solar radiation
         void createRangesFromSolarRadiation(const FenestrationCommon::CSeries & t_SolarRadiation);
 
+        void appendToHash(FenestrationCommon::StableHash & hash) const override;
+
     protected:
         std::vector<double> calculateBandWavelengths() override;
 
@@ -407,6 +423,8 @@ namespace SingleLayerOptics
 
         void Flipped(bool flipped) override;
 
+        void appendToHash(FenestrationCommon::StableHash & hash) const override;
+
     protected:
         std::vector<double> calculateBandWavelengths() override;
         mutable SpectralAveraging::CAngularSpectralSample m_AngularSample;
@@ -427,6 +445,8 @@ namespace SingleLayerOptics
         [[nodiscard]] FenestrationCommon::CSeries
           jscPrime(FenestrationCommon::Side t_Side) const override;
 
+        void appendToHash(FenestrationCommon::StableHash & hash) const override;
+
     private:
         std::shared_ptr<SpectralAveraging::CPhotovoltaicSample> m_PVSample;
     };
@@ -470,6 +490,8 @@ namespace SingleLayerOptics
                           const CBeamDirection & t_OutgoingDirection = CBeamDirection(),
                           OutgoingAggregation t_Agg = OutgoingAggregation::Beam) const override;
 
+        void appendToHash(FenestrationCommon::StableHash & hash) const override;
+
     private:
         std::vector<double> calculateBandWavelengths() override;
         std::shared_ptr<SpectralAveraging::CAngularMeasurements> m_AngularMeasurements;
@@ -0,0 +1,133 @@
+#include <list>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <WCEViewer.hpp>
+
+#include "VenetianGeometryCache.hpp"
+#include "VenetianCellDescription.hpp"
+#include "VenetianSegments.hpp"
+
+namespace SingleLayerOptics
+{
+    namespace
+    {
+        using GeometryKey = std::vector<double>;
+
+        GeometryKey geometryKey(const CVenetianCellDescription & t_Cell)
+        {
+            const auto geometry{t_Cell.getVenetianGeometry()};
+            GeometryKey key{static_cast<double>(t_Cell.numOfSegments()),
+                            geometry.SlatWidth,
+                            geometry.SlatSpacing,
+                            geometry.SlatTiltAngle,
+                            geometry.CurvatureRadius};
+
+            // Slats are built from the tilt angle before it is clamped, so the coordinates are
+            // part of the key as well.
+            for(const auto & segment : t_Cell.getSlats())
+            {
+                key.push_back(segment.startPoint().x());
+                key.push_back(segment.startPoint().y());
+                key.push_back(segment.endPoint().x());
+                key.push_back(segment.endPoint().y());
+            }
+            return key;
+        }
+
+        //! Least recently used entries are at the back of the list.
+        struct GeometryCache
+        {
+            using Entry = std::pair<GeometryKey, std::shared_ptr<VenetianGeometry>>;
+
+            std::mutex mutex;
+            std::list<Entry> entries;
+            std::map<GeometryKey, std::list<Entry>::iterator> index;
+            VenetianGeometryCacheStatistics statistics{.capacity = 256u};
+
+            void trim()
+            {
+                while(entries.size() > statistics.capacity)
+                {
+                    index.erase(entries.back().first);
+                    entries.pop_back();
+                    ++statistics.evictions;
+                }
+                statistics.size = entries.size();
+            }
+        };
+
+        GeometryCache & geometryCache()
+        {
+            static GeometryCache cache;
+            return cache;
+        }
+    }   // namespace
+
+    double VenetianGeometryCacheStatistics::hitRate() const
+    {
+        const auto requests{hits + misses};
+        return requests == 0u ? 0.0 : static_cast<double>(hits) / static_cast<double>(requests);
+    }
+
+    std::shared_ptr<VenetianGeometry>
+      cachedVenetianGeometry(const CVenetianCellDescription & t_Cell)
+    {
+        auto & cache{geometryCache()};
+        auto key{geometryKey(t_Cell)};
+        {
+            std::lock_guard lock(cache.mutex);
+            if(const auto it = cache.index.find(key); it != cache.index.end())
+            {
+                ++cache.statistics.hits;
+                cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+                return it->second->second;
+            }
+            ++cache.statistics.misses;
+        }
+
+        // View factors are calculated without holding the lock. If another thread stored the
+        // same geometry meanwhile, its bundle is kept and returned so that cells still share.
+        auto geometry{makeVenetianGeometry(t_Cell)};
+
+        std::lock_guard lock(cache.mutex);
+        if(cache.statistics.capacity == 0u)
+        {
+            return geometry;
+        }
+        if(const auto it = cache.index.find(key); it != cache.index.end())
+        {
+            return it->second->second;
+        }
+        cache.entries.emplace_front(key, std::move(geometry));
+        cache.index.emplace(std::move(key), cache.entries.begin());
+        cache.trim();
+        return cache.entries.front().second;
+    }
+
+    VenetianGeometryCacheStatistics venetianGeometryCacheStatistics()
+    {
+        auto & cache{geometryCache()};
+        std::lock_guard lock(cache.mutex);
+        return cache.statistics;
+    }
+
+    void setVenetianGeometryCacheCapacity(const size_t capacity)
+    {
+        auto & cache{geometryCache()};
+        std::lock_guard lock(cache.mutex);
+        cache.statistics.capacity = capacity;
+        cache.trim();
+    }
+
+    void clearVenetianGeometryCache()
+    {
+        auto & cache{geometryCache()};
+        std::lock_guard lock(cache.mutex);
+        cache.entries.clear();
+        cache.index.clear();
+        cache.statistics = {.capacity = cache.statistics.capacity};
+    }
+}   // namespace SingleLayerOptics
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace SingleLayerOptics
+{
+    class CVenetianCellDescription;
+    struct VenetianGeometry;
+
+    struct VenetianGeometryCacheStatistics
+    {
+        size_t hits{0u};
+        size_t misses{0u};
+        size_t evictions{0u};
+        size_t size{0u};
+        size_t capacity{0u};
+
+        //! Fraction of requests served from the cache. Zero before the first request.
+        [[nodiscard]] double hitRate() const;
+    };
+
+    //! Process-wide cache of venetian geometry bundles (enclosure view factors and slat mesh).
+    //!
+    //! Cells with the same slats share one bundle no matter which material they are made of. The
+    //! key is the exact slat coordinates together with the slat geometry and the number of
+    //! segments, so only truly identical geometries share. Once the capacity is exceeded, the
+    //! least recently used bundle is dropped from the cache; cells that still hold it keep it
+    //! alive. All functions are thread safe.
+    [[nodiscard]] std::shared_ptr<VenetianGeometry>
+      cachedVenetianGeometry(const CVenetianCellDescription & t_Cell);
+
+    [[nodiscard]] VenetianGeometryCacheStatistics venetianGeometryCacheStatistics();
+
+    //! Zero capacity disables caching; every request then builds a new bundle.
+    void setVenetianGeometryCacheCapacity(size_t capacity);
+
+    //! Drops all cached bundles and resets the counters.
+    void clearVenetianGeometryCache();
+}   // namespace SingleLayerOptics
@@ -0,0 +1,177 @@
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <gtest/gtest.h>
+
+#include <WCESpectralAveraging.hpp>
+#include <WCESingleLayerOptics.hpp>
+#include <WCECommon.hpp>
+
+using namespace SingleLayerOptics;
+using namespace FenestrationCommon;
+using namespace SpectralAveraging;
+
+// Persisted wavelength results must reproduce the calculated ones exactly
+class TestBSDFSerialization : public testing::Test
+{
+    std::shared_ptr<CBSDFLayer> m_Layer;
+
+protected:
+    void SetUp() override
+    {
+        m_Layer = createLayer();
+    }
+
+public:
+    static std::shared_ptr<CBSDFLayer> createLayer(double reflectance = 0.0470)
+    {
+        const auto aMeasurements = CSpectralSampleData::create(
+          {{0.300, {0.0020, 0.0020, reflectance, 0.0480}, {0.0, 0.0, 0.0, 0.0}},
+           {0.305, {0.0030, 0.0030, reflectance, 0.0480}, {0.0, 0.0, 0.0, 0.0}},
+           {0.310, {0.0090, 0.0090, reflectance, 0.0480}, {0.0, 0.0, 0.0, 0.0}},
+           {0.315, {0.0350, 0.0350, reflectance, 0.0480}, {0.0, 0.0, 0.0, 0.0}},
+           {0.320, {0.1000, 0.1000, reflectance, 0.0480}, {0.0, 0.0, 0.0, 0.0}}});
+
+        constexpr auto thickness = 3.048e-3;   // [m]
+        const auto aMaterial =
+          Material::nBandMaterial(aMeasurements, thickness, MaterialType::Monolithic);
+
+        const auto aBSDF = BSDFHemisphere::create(BSDFBasis::Quarter);
+
+        return CBSDFLayerMaker::getPerfectlyDiffuseLayer(aMaterial, aBSDF);
+    }
+
+    [[nodiscard]] std::shared_ptr<CBSDFLayer> getLayer() const
+    {
+        return m_Layer;
+    }
+};
+
+namespace
+{
+    void expectSameMatrices(BSDFIntegrator & expected, BSDFIntegrator & result)
+    {
+        for(const auto side : allSides())
+        {
+            for(const auto property : allPropertySimple())
+            {
+                const auto & correct = expected.getMatrix(side, property);
+                const auto & matrix = result.getMatrix(side, property);
+                ASSERT_EQ(correct.size(), matrix.size());
+                for(size_t i = 0u; i < correct.size(); ++i)
+                {
+                    for(size_t j = 0u; j < correct.size(); ++j)
+                    {
+                        EXPECT_EQ(correct(i, j), matrix(i, j));
+                    }
+                }
+            }
+        }
+    }
+}   // namespace
+
+TEST_F(TestBSDFSerialization, WavelengthResultsRoundTrip)
+{
+    auto aLayer = getLayer();
+    const auto stored = aLayer->storeWavelengthResults();
+    const auto blob = BSDFSerialization::serialize(stored);
+
+    const auto & directions = aLayer->getDirections(BSDFDirection::Incoming);
+    auto restoredLayer = createLayer();
+    restoredLayer->restoreWavelengthResults(BSDFSerialization::deserialize(blob, directions));
+
+    EXPECT_EQ(aLayer->getBandWavelengths(), restoredLayer->getBandWavelengths());
+
+    auto expected = aLayer->getWavelengthResults();
+    auto result = restoredLayer->getWavelengthResults();
+    ASSERT_EQ(expected.size(), result.size());
+    for(size_t i = 0u; i < expected.size(); ++i)
+    {
+        expectSameMatrices(expected[i], result[i]);
+        EXPECT_NEAR(expected[i].DiffDiff(Side::Front, PropertySurface::R),
+                    result[i].DiffDiff(Side::Front, PropertySurface::R),
+                    1e-12);
+    }
+
+    auto atWavelength = restoredLayer->getResultsAtWavelength(2u);
+    expectSameMatrices(expected[2u], atWavelength);
+}
+
+TEST_F(TestBSDFSerialization, IntegratedResultsAreRestored)
+{
+    auto aLayer = getLayer();
+    const auto stored = aLayer->storeWavelengthResults();
+    ASSERT_EQ(stored.wavelengths.size() + 1u, stored.results.size());
+
+    // Restored into a layer with different measurements, so a recalculation from the cell
+    // would not match the stored values.
+    const auto & directions = aLayer->getDirections(BSDFDirection::Incoming);
+    auto restoredLayer = createLayer(0.2);
+    restoredLayer->restoreWavelengthResults(
+      BSDFSerialization::deserialize(BSDFSerialization::serialize(stored), directions));
+
+    auto expected = aLayer->getResults();
+    auto result = restoredLayer->getResults();
+    expectSameMatrices(expected, result);
+    EXPECT_EQ(aLayer->getWavelengthResults().size(),
+              restoredLayer->getWavelengthResults().size());
+}
+
+TEST_F(TestBSDFSerialization, FileRoundTripAndFailures)
+{
+    auto aLayer = getLayer();
+    const auto & directions = aLayer->getDirections(BSDFDirection::Incoming);
+    const auto folder{std::filesystem::temp_directory_path() / "WCEBSDFSerializationTest"};
+    std::filesystem::remove_all(folder);
+    std::filesystem::create_directories(folder);
+
+    const auto fileName{folder / "layer.wcebsdf"};
+    BSDFSerialization::save(fileName, aLayer->storeWavelengthResults());
+    auto loaded = BSDFSerialization::load(fileName, directions);
+    auto expected = aLayer->getResults();
+    expectSameMatrices(expected, loaded.results.back());
+
+    EXPECT_THROW(BSDFSerialization::save(folder, aLayer->storeWavelengthResults()),
+                 std::runtime_error);
+    EXPECT_THROW((void)BSDFSerialization::load(folder / "missing.wcebsdf", directions),
+                 std::runtime_error);
+
+    std::filesystem::remove_all(folder);
+}
+
+TEST_F(TestBSDFSerialization, CorruptedDataThrows)
+{
+    auto aLayer = getLayer();
+    const auto & directions = aLayer->getDirections(BSDFDirection::Incoming);
+    auto blob = BSDFSerialization::serialize(aLayer->storeWavelengthResults());
+
+    auto truncated = blob;
+    truncated.pop_back();
+    EXPECT_THROW((void)BSDFSerialization::deserialize(truncated, directions), std::runtime_error);
+
+    blob.back() ^= std::byte{0x01};
+    EXPECT_THROW((void)BSDFSerialization::deserialize(blob, directions), std::runtime_error);
+
+    const auto fullBasis = BSDFHemisphere::create(BSDFBasis::Full);
+    const auto validBlob = BSDFSerialization::serialize(aLayer->storeWavelengthResults());
+    EXPECT_THROW(
+      (void)BSDFSerialization::deserialize(validBlob,
+                                           fullBasis.getDirections(BSDFDirection::Incoming)),
+      std::runtime_error);
+}
+
+TEST_F(TestBSDFSerialization, OverflowingHeaderCountsThrow)
+{
+    auto aLayer = getLayer();
+    const auto & directions = aLayer->getDirections(BSDFDirection::Incoming);
+    const auto stored = aLayer->storeWavelengthResults();
+    ASSERT_EQ(0u, stored.layerCount);
+    auto blob = BSDFSerialization::serialize(stored);
+
+    // 32 * 2^59 wraps to zero, so without checked arithmetic the layer sections would add
+    // nothing to the expected payload size and the blob would pass the size and checksum tests.
+    const std::uint64_t layerCount{std::uint64_t{1u} << 59u};
+    constexpr size_t layerCountOffset{8u + 4u * sizeof(std::uint64_t)};
+    std::memcpy(blob.data() + layerCountOffset, &layerCount, sizeof(layerCount));
+    EXPECT_THROW((void)BSDFSerialization::deserialize(blob, directions), std::runtime_error);
+}
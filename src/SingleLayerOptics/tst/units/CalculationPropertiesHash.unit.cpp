@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include "WCECommon.hpp"
+#include "WCESingleLayerOptics.hpp"
+
+using namespace FenestrationCommon;
+using namespace SingleLayerOptics;
+
+// A cache hit is only correct if every input that changes the calculation changes the key.
+
+namespace
+{
+    CSeries solarRadiation()
+    {
+        return CSeries{{0.30, 0.0}, {0.50, 1500.0}, {0.80, 1100.0}, {2.50, 30.0}};
+    }
+
+    std::uint64_t keyOf(const CalculationProperties & properties)
+    {
+        StableHash hash;
+        hashAppend(hash, properties);
+        return hash.value();
+    }
+}   // namespace
+
+TEST(CalculationPropertiesHash, EqualPropertiesGiveEqualKeys)
+{
+    const CalculationProperties first{solarRadiation(), std::vector<double>{0.3, 0.5, 2.5}};
+    const CalculationProperties second{solarRadiation(), std::vector<double>{0.3, 0.5, 2.5}};
+    EXPECT_EQ(keyOf(first), keyOf(second));
+}
+
+TEST(CalculationPropertiesHash, EveryInputChangesKey)
+{
+    const auto reference = keyOf(CalculationProperties{solarRadiation()});
+
+    auto otherRadiation = solarRadiation();
+    otherRadiation.addProperty(3.0, 10.0);
+    EXPECT_NE(reference, keyOf(CalculationProperties{otherRadiation}));
+
+    EXPECT_NE(reference,
+              keyOf(CalculationProperties{solarRadiation(), std::vector<double>{0.3, 2.5}}));
+    EXPECT_NE(keyOf(CalculationProperties{solarRadiation(), std::vector<double>{0.3, 2.5}}),
+              keyOf(CalculationProperties{solarRadiation(), std::vector<double>{0.3, 2.4}}));
+
+    // An empty common wavelength set is not the same as none.
+    EXPECT_NE(reference,
+              keyOf(CalculationProperties{solarRadiation(), std::vector<double>{}}));
+
+    const CSeries detector{{0.38, 0.0001}, {0.55, 1.0}, {0.78, 0.0001}};
+    EXPECT_NE(reference, keyOf(CalculationProperties{solarRadiation(), std::nullopt, detector}));
+
+    EXPECT_NE(reference,
+              keyOf(CalculationProperties{
+                solarRadiation(), std::nullopt, std::nullopt, IntegrationType::Rectangular}));
+    EXPECT_NE(reference,
+              keyOf(CalculationProperties{solarRadiation(),
+                                          std::nullopt,
+                                          std::nullopt,
+                                          IntegrationType::Trapezoidal,
+                                          0.5}));
+}
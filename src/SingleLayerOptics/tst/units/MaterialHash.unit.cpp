@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include "WCECommon.hpp"
+#include "WCESpectralAveraging.hpp"
+#include "WCESingleLayerOptics.hpp"
+
+using namespace FenestrationCommon;
+using namespace SpectralAveraging;
+using namespace SingleLayerOptics;
+
+// Material key has to follow the data the material was built from and not the state of its
+// lazily calculated members.
+
+namespace
+{
+    std::shared_ptr<CSpectralSampleData> measurement(double transmittanceScale = 1.0)
+    {
+        return CSpectralSampleData::create(
+          {{0.30, {0.00 * transmittanceScale, 0.00 * transmittanceScale, 0.05, 0.05}, {}},
+           {0.50, {0.80 * transmittanceScale, 0.80 * transmittanceScale, 0.07, 0.08}, {}},
+           {0.80, {0.70 * transmittanceScale, 0.70 * transmittanceScale, 0.06, 0.07}, {}},
+           {2.50, {0.20 * transmittanceScale, 0.20 * transmittanceScale, 0.04, 0.05}, {}}});
+    }
+
+    std::uint64_t keyOf(const CMaterial & material)
+    {
+        StableHash hash;
+        hashAppend(hash, material);
+        return hash.value();
+    }
+
+    std::vector<std::vector<double>> diagonal(size_t size, double value)
+    {
+        std::vector<std::vector<double>> result(size, std::vector<double>(size, 0.0));
+        for(size_t i = 0u; i < size; ++i)
+        {
+            result[i][i] = value;
+        }
+        return result;
+    }
+}   // namespace
+
+TEST(MaterialHash, EqualDataGiveEqualKeys)
+{
+    EXPECT_EQ(keyOf(*Material::singleBandMaterial(0.1, 0.1, 0.5, 0.5)),
+              keyOf(*Material::singleBandMaterial(0.1, 0.1, 0.5, 0.5)));
+    EXPECT_EQ(keyOf(*Material::nBandMaterial(measurement(), 0.003, MaterialType::Monolithic)),
+              keyOf(*Material::nBandMaterial(measurement(), 0.003, MaterialType::Monolithic)));
+}
+
+TEST(MaterialHash, CalculatedBandWavelengthsDoNotChangeKey)
+{
+    auto material = Material::nBandMaterial(measurement(), 0.003, MaterialType::Monolithic);
+    const auto before = keyOf(*material);
+    EXPECT_FALSE(material->getBandWavelengths().empty());
+    EXPECT_EQ(before, keyOf(*material));
+}
+
+TEST(MaterialHash, SingleBandPropertiesChangeKey)
+{
+    const auto reference = keyOf(*Material::singleBandMaterial(0.1, 0.1, 0.5, 0.5));
+    EXPECT_NE(reference, keyOf(*Material::singleBandMaterial(0.2, 0.1, 0.5, 0.5)));
+    EXPECT_NE(reference, keyOf(*Material::singleBandMaterial(0.1, 0.2, 0.5, 0.5)));
+    EXPECT_NE(reference, keyOf(*Material::singleBandMaterial(0.1, 0.1, 0.4, 0.5)));
+    EXPECT_NE(reference, keyOf(*Material::singleBandMaterial(0.1, 0.1, 0.5, 0.4)));
+}
+
+TEST(MaterialHash, SampleInputsChangeKey)
+{
+    const auto make = [] {
+        return Material::nBandMaterial(measurement(), 0.003, MaterialType::Monolithic);
+    };
+    const auto reference = keyOf(*make());
+
+    EXPECT_NE(reference,
+              keyOf(*Material::nBandMaterial(measurement(0.9), 0.003, MaterialType::Monolithic)));
+    EXPECT_NE(reference,
+              keyOf(*Material::nBandMaterial(measurement(), 0.004, MaterialType::Monolithic)));
+    EXPECT_NE(reference,
+              keyOf(*Material::nBandMaterial(measurement(), 0.003, MaterialType::Coated)));
+
+    const CSeries detector{{0.38, 0.0001}, {0.55, 1.0}, {0.78, 0.0001}};
+    EXPECT_NE(reference,
+              keyOf(*Material::nBandMaterial(
+                measurement(), detector, 0.003, MaterialType::Monolithic)));
+
+    auto withSource = make();
+    withSource->setSourceData(CSeries{{0.30, 0.0}, {0.50, 1500.0}, {2.50, 30.0}});
+    EXPECT_NE(reference, keyOf(*withSource));
+
+    auto flipped = make();
+    flipped->Flipped(true);
+    EXPECT_NE(reference, keyOf(*flipped));
+
+    auto assigned = make();
+    assigned->setBandWavelengths({0.3, 0.5, 2.5});
+    EXPECT_NE(reference, keyOf(*assigned));
+}
+
+TEST(MaterialHash, DualBandHashesBothRanges)
+{
+    const auto dualBand = [](double solarTf, double visibleTf) {
+        return keyOf(
+          *Material::dualBandMaterial(solarTf, 0.1, 0.5, 0.5, visibleTf, 0.2, 0.4, 0.4));
+    };
+    const auto reference = dualBand(0.1, 0.2);
+    EXPECT_NE(reference, dualBand(0.1, 0.3));
+    EXPECT_NE(reference, dualBand(0.2, 0.2));
+    EXPECT_NE(reference, keyOf(*Material::singleBandMaterial(0.1, 0.1, 0.5, 0.5)));
+}
+
+TEST(MaterialHash, BSDFMaterialHashesMatricesAndBasis)
+{
+    const auto small = BSDFHemisphere::create(BSDFBasis::Small);
+    const auto make = [&](double transmittance, const BSDFHemisphere & hemisphere) {
+        const auto n = hemisphere.getDirections(BSDFDirection::Incoming).size();
+        return Material::singleBandBSDFMaterial(diagonal(n, transmittance),
+                                                diagonal(n, transmittance),
+                                                diagonal(n, 0.1),
+                                                diagonal(n, 0.1),
+                                                hemisphere);
+    };
+
+    const auto reference = keyOf(*make(0.5, small));
+    EXPECT_EQ(reference, keyOf(*make(0.5, small)));
+    EXPECT_NE(reference, keyOf(*make(0.4, small)));
+    EXPECT_NE(reference, keyOf(*make(0.5, BSDFHemisphere::create(BSDFBasis::Quarter))));
+}
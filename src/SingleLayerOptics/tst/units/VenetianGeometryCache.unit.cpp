@@ -0,0 +1,96 @@
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "WCECommon.hpp"
+#include "WCESingleLayerOptics.hpp"
+
+using namespace SingleLayerOptics;
+using namespace FenestrationCommon;
+
+// Venetian cells with the same slats share one geometry bundle regardless of their material.
+
+class TestVenetianGeometryCache : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        clearVenetianGeometryCache();
+    }
+
+    void TearDown() override
+    {
+        setVenetianGeometryCacheCapacity(256u);
+        clearVenetianGeometryCache();
+    }
+
+public:
+    static std::shared_ptr<CBSDFLayer> venetianLayer(double tilt, double transmittance = 0.0)
+    {
+        const auto aMaterial = Material::singleBandMaterial(transmittance, transmittance, 0.7, 0.7);
+        const auto aBSDF = BSDFHemisphere::create(BSDFBasis::Quarter);
+        return CBSDFLayerMaker::getVenetianLayer(aMaterial,
+                                                 aBSDF,
+                                                 Venetian::Geometry{0.016, 0.012, tilt, 0.0},
+                                                 5u,
+                                                 DistributionMethod::UniformDiffuse,
+                                                 true);
+    }
+};
+
+TEST_F(TestVenetianGeometryCache, SameGeometryIsBuiltOnce)
+{
+    auto first = venetianLayer(45);
+    auto statistics = venetianGeometryCacheStatistics();
+    EXPECT_EQ(0u, statistics.hits);
+    EXPECT_EQ(2u, statistics.misses);   // forward and backward flow cells
+    EXPECT_EQ(2u, statistics.size);
+
+    // Different material, same slats
+    auto second = venetianLayer(45, 0.1);
+    statistics = venetianGeometryCacheStatistics();
+    EXPECT_EQ(2u, statistics.hits);
+    EXPECT_EQ(2u, statistics.misses);
+    EXPECT_DOUBLE_EQ(0.5, statistics.hitRate());
+
+    auto third = venetianLayer(30);
+    statistics = venetianGeometryCacheStatistics();
+    EXPECT_EQ(4u, statistics.misses);
+    EXPECT_EQ(4u, statistics.size);
+}
+
+TEST_F(TestVenetianGeometryCache, SharedGeometryGivesSameResults)
+{
+    auto cached = venetianLayer(45, 0.1);
+    auto cachedResults = venetianLayer(45, 0.1)->getResults();
+
+    setVenetianGeometryCacheCapacity(0u);
+    auto uncachedResults = venetianLayer(45, 0.1)->getResults();
+
+    const auto & expected = uncachedResults.getMatrix(Side::Front, PropertySurface::T);
+    const auto & result = cachedResults.getMatrix(Side::Front, PropertySurface::T);
+    ASSERT_EQ(expected.size(), result.size());
+    for(size_t i = 0u; i < expected.size(); ++i)
+    {
+        for(size_t j = 0u; j < expected.size(); ++j)
+        {
+            EXPECT_EQ(expected(i, j), result(i, j));
+        }
+    }
+}
+
+TEST_F(TestVenetianGeometryCache, CapacityBoundsSize)
+{
+    setVenetianGeometryCacheCapacity(3u);
+    auto first = venetianLayer(45);
+    auto second = venetianLayer(30);
+
+    const auto statistics = venetianGeometryCacheStatistics();
+    EXPECT_EQ(3u, statistics.size);
+    EXPECT_EQ(1u, statistics.evictions);
+
+    // The forward cell of the first layer was dropped for the second layer and its backward
+    // cell makes room for the forward one coming back.
+    auto again = venetianLayer(45);
+    EXPECT_EQ(0u, venetianGeometryCacheStatistics().hits);
+    EXPECT_EQ(3u, venetianGeometryCacheStatistics().evictions);
+}
@@ -0,0 +1,59 @@
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "WCECommon.hpp"
+#include "WCESingleLayerOptics.hpp"
+
+using namespace SingleLayerOptics;
+using namespace FenestrationCommon;
+
+// Layers from a slat tilt sweep must be the same as layers created one tilt at a time.
+
+TEST(VenetianSlatTiltSweep, SweepMatchesSingleLayers)
+{
+    const auto aMaterial = Material::singleBandMaterial(0, 0, 0.7, 0.7);
+    const auto aBSDF = BSDFHemisphere::create(BSDFBasis::Quarter);
+    const Venetian::Geometry geometry{0.016, 0.012, 0.0, 0.0};
+    const std::vector<double> tilts{-45, 0, 30, 60};
+    constexpr size_t numOfSlatSegments{5u};
+
+    const auto layers = CBSDFLayerMaker::getVenetianLayers(
+      aMaterial, aBSDF, geometry, tilts, numOfSlatSegments, DistributionMethod::UniformDiffuse);
+    ASSERT_EQ(tilts.size(), layers.size());
+
+    for(size_t i = 0u; i < tilts.size(); ++i)
+    {
+        auto tiltGeometry{geometry};
+        tiltGeometry.SlatTiltAngle = tilts[i];
+        auto single = CBSDFLayerMaker::getVenetianLayer(
+          aMaterial, aBSDF, tiltGeometry, numOfSlatSegments, DistributionMethod::UniformDiffuse);
+
+        auto expected = single->getResults();
+        auto result = layers[i]->getResults();
+        for(const auto side : allSides())
+        {
+            for(const auto property : allPropertySimple())
+            {
+                const auto & correct = expected.getMatrix(side, property);
+                const auto & matrix = result.getMatrix(side, property);
+                ASSERT_EQ(correct.size(), matrix.size());
+                for(size_t row = 0u; row < correct.size(); ++row)
+                {
+                    for(size_t col = 0u; col < correct.size(); ++col)
+                    {
+                        EXPECT_EQ(correct(row, col), matrix(row, col));
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(VenetianSlatTiltSweep, EmptySweep)
+{
+    const auto aMaterial = Material::singleBandMaterial(0, 0, 0.7, 0.7);
+    const auto aBSDF = BSDFHemisphere::create(BSDFBasis::Quarter);
+    EXPECT_TRUE(CBSDFLayerMaker::getVenetianLayers(
+                  aMaterial, aBSDF, Venetian::Geometry{0.016, 0.012, 0.0, 0.0}, {}, 5u)
+                  .empty());
+}
@@ -4,6 +4,7 @@
 #include "../src/AngularProperties.hpp"
 #include "../src/AngularSpectralSample.hpp"
 #include "../src/SpectralSampleData.hpp"
+#include "../src/SpectralSampleBlob.hpp"
 #include "../src/NIRRatio.hpp"
 #include "../src/SpectralSample.hpp"
 #include "../src/SpectrumFunctions.hpp"
@@ -197,5 +197,23 @@ namespace SpectralAveraging
         return {m_CommonWavelengths[0], m_CommonWavelengths[m_CommonWavelengths.size() - 1]};
     }
 
+    void CAngularMeasurements::appendToHash(StableHash & hash) const
+    {
+        hash.add(m_CommonWavelengths);
+        auto appendMeasurement = [&hash](const CSingleAngularMeasurement & measurement) {
+            hash.add(measurement.getAngle());
+            measurement.getData()->appendToHash(hash);
+        };
+        hash.add(m_SingleMeasurement != nullptr);
+        if(m_SingleMeasurement != nullptr)
+        {
+            appendMeasurement(*m_SingleMeasurement);
+        }
+        hash.add(m_Measurements.size());
+        for(const auto & measurement : m_Measurements)
+        {
+            appendMeasurement(*measurement);
+        }
+    }
 
 }   // namespace SpectralAveraging
@@ -64,6 +64,9 @@ namespace SpectralAveraging
 
         [[nodiscard]] FenestrationCommon::Limits getWavelengthLimits() const;
 
+        //! Adds common wavelengths and every measurement with its angle to the cache key.
+        void appendToHash(FenestrationCommon::StableHash & hash) const;
+
     private:
         // Do not forget storage for it
         std::shared_ptr<CSingleAngularMeasurement> m_SingleMeasurement;
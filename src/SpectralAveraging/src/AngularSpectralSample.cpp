@@ -223,6 +223,12 @@ namespace SpectralAveraging
         }
     }
 
+    void CAngularSpectralSample::appendToHash(StableHash & hash) const
+    {
+        hash.add(m_Thickness).add(m_Type);
+        m_SpectralSampleZero.appendToHash(hash);
+    }
+
     std::shared_ptr<CSpectralSample>
       CAngularSpectralSample::findSpectralSample(const double t_Angle)
     {
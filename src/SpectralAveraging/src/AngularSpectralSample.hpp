@@ -96,6 +96,10 @@ namespace SpectralAveraging
 
         void Flipped(bool flipped);
 
+        //! Adds thickness, material type and the normal incidence sample to the cache key.
+        //! Samples at other angles are derived from those.
+        void appendToHash(FenestrationCommon::StableHash & hash) const;
+
     protected:
         // Finds spectral sample or creates new one if sample is not already created
         std::shared_ptr<CSpectralSample> findSpectralSample(double t_Angle);
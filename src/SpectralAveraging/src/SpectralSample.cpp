@@ -127,6 +127,14 @@ namespace SpectralAveraging
         return m_Wavelengths.size();
     }
 
+    void CSample::appendToHash(StableHash & hash) const
+    {
+        hashAppend(hash, m_SourceData);
+        hashAppend(hash, m_DetectorData);
+        hash.add(m_Wavelengths).add(m_WavelengthSet);
+        hash.add(m_IntegrationType).add(m_NormalizationCoefficient);
+    }
+
     void CSample::reset()
     {
         m_StateCalculated = false;
@@ -286,6 +294,16 @@ namespace SpectralAveraging
         return m_SampleData->getWavelengthLimits();
     }
 
+    void CSpectralSample::appendToHash(StableHash & hash) const
+    {
+        CSample::appendToHash(hash);
+        hash.add(m_SampleData != nullptr);
+        if(m_SampleData != nullptr)
+        {
+            m_SampleData->appendToHash(hash);
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////
     /// CPhotovoltaicSample
     /////////////////////////////////////////////////////////////////////////////////////
@@ -78,6 +78,10 @@ namespace SpectralAveraging
 
         [[nodiscard]] size_t getBandSize() const;
 
+        //! Adds source, detector, wavelength and integration settings to the cache key.
+        //! Derived samples add their measured data.
+        virtual void appendToHash(FenestrationCommon::StableHash & hash) const;
+
     protected:
         virtual void reset();
         virtual void calculateState(FenestrationCommon::IntegrationType integrator,
@@ -135,6 +139,8 @@ namespace SpectralAveraging
 
         [[nodiscard]] FenestrationCommon::Limits getWavelengthLimits() const;
 
+        void appendToHash(FenestrationCommon::StableHash & hash) const override;
+
     protected:
         void calculateProperties(FenestrationCommon::IntegrationType integrator,
                                  double normalizationCoefficient) override;
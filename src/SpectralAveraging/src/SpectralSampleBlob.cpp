@@ -0,0 +1,140 @@
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "WCECommon.hpp"
+
+#include "SpectralSampleBlob.hpp"
+
+using namespace FenestrationCommon;
+
+namespace SpectralAveraging
+{
+    namespace
+    {
+        constexpr std::array<char, 8> blobMagic{'W', 'C', 'E', 'S', 'S', 'D', '0', '1'};
+
+        //! Bytes of a sample before its columns: row count and diffuse flag.
+        constexpr size_t sampleHeaderSize{2u * sizeof(std::uint64_t)};
+
+        void writeColumn(BinaryWriter & writer, std::span<const double> values, size_t rowCount)
+        {
+            if(values.size() != rowCount)
+            {
+                throw std::runtime_error(
+                  "Measured columns must have the same number of values as wavelengths.");
+            }
+            writer.write(values);
+        }
+
+        bool hasDiffuse(const MeasuredColumns & sample)
+        {
+            return !sample.diffuseTf.empty() || !sample.diffuseTb.empty()
+                   || !sample.diffuseRf.empty() || !sample.diffuseRb.empty();
+        }
+    }   // namespace
+
+    std::vector<MeasuredColumns> measuredColumnsFromBlob(std::span<const std::byte> blob)
+    {
+        if(reinterpret_cast<std::uintptr_t>(blob.data()) % alignof(double) != 0)
+        {
+            throw std::runtime_error("Spectral sample blob is not aligned to double.");
+        }
+        BinaryReader reader(blob);
+
+        const auto magic = reader.readBytes(blobMagic.size());
+        if(std::memcmp(magic.data(), blobMagic.data(), blobMagic.size()) != 0)
+        {
+            throw std::runtime_error("Unknown spectral sample blob format.");
+        }
+
+        // The count comes from the blob, so it is checked against what the blob can hold before
+        // anything is reserved for it.
+        const auto sampleCount = reader.read<std::uint64_t>();
+        if(sampleCount > reader.remaining() / sampleHeaderSize)
+        {
+            throw std::runtime_error("Spectral sample blob is truncated.");
+        }
+        std::vector<MeasuredColumns> result;
+        result.reserve(static_cast<size_t>(sampleCount));
+        for(std::uint64_t sample = 0u; sample < sampleCount; ++sample)
+        {
+            const auto rowCount = static_cast<size_t>(reader.read<std::uint64_t>());
+            const auto hasDiffuse = reader.read<std::uint64_t>() != 0u;
+
+            MeasuredColumns columns;
+            columns.wavelength = reader.readDoubles(rowCount);
+            columns.Tf = reader.readDoubles(rowCount);
+            columns.Tb = reader.readDoubles(rowCount);
+            columns.Rf = reader.readDoubles(rowCount);
+            columns.Rb = reader.readDoubles(rowCount);
+            if(hasDiffuse)
+            {
+                columns.diffuseTf = reader.readDoubles(rowCount);
+                columns.diffuseTb = reader.readDoubles(rowCount);
+                columns.diffuseRf = reader.readDoubles(rowCount);
+                columns.diffuseRb = reader.readDoubles(rowCount);
+            }
+            result.push_back(columns);
+        }
+
+        return result;
+    }
+
+    std::vector<std::shared_ptr<CSpectralSampleData>>
+      createSpectralSamples(std::span<const std::byte> blob)
+    {
+        const auto columns = measuredColumnsFromBlob(blob);
+
+        std::vector<std::shared_ptr<CSpectralSampleData>> result;
+        result.reserve(columns.size());
+        for(const auto & sample : columns)
+        {
+            result.push_back(CSpectralSampleData::create(sample));
+        }
+
+        return result;
+    }
+
+    std::vector<std::byte> spectralSamplesToBlob(const std::vector<MeasuredColumns> & samples)
+    {
+        size_t size = blobMagic.size() + sizeof(std::uint64_t);
+        for(const auto & sample : samples)
+        {
+            const auto columnCount = hasDiffuse(sample) ? 9u : 5u;
+            size += sampleHeaderSize + columnCount * sample.wavelength.size() * sizeof(double);
+        }
+
+        std::vector<std::byte> blob(size);
+        BinaryWriter writer(blob);
+        writer.writeBytes(std::as_bytes(std::span<const char>(blobMagic)));
+        writer.write<std::uint64_t>(samples.size());
+
+        for(const auto & sample : samples)
+        {
+            const auto rowCount = sample.wavelength.size();
+            const auto diffuse = hasDiffuse(sample);
+            writer.write<std::uint64_t>(rowCount);
+            writer.write<std::uint64_t>(diffuse ? 1u : 0u);
+
+            for(const auto & column :
+                {sample.wavelength, sample.Tf, sample.Tb, sample.Rf, sample.Rb})
+            {
+                writeColumn(writer, column, rowCount);
+            }
+            if(diffuse)
+            {
+                const std::vector<double> zeros(rowCount, 0.0);
+                for(auto column :
+                    {sample.diffuseTf, sample.diffuseTb, sample.diffuseRf, sample.diffuseRb})
+                {
+                    writeColumn(
+                      writer, column.empty() ? std::span<const double>(zeros) : column, rowCount);
+                }
+            }
+        }
+
+        return blob;
+    }
+}   // namespace SpectralAveraging
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "SpectralSampleData.hpp"
+
+namespace SpectralAveraging
+{
+    //! Binary layout of a spectral sample database. All fields are 8 bytes wide and stored in
+    //! host byte order, so a memory-mapped file can be read in place:
+    //!
+    //!   header : char[8] magic "WCESSD01", uint64 sampleCount
+    //!   sample : uint64 rowCount, uint64 hasDiffuse,
+    //!            double[rowCount] x (wavelength, Tf, Tb, Rf, Rb[, dTf, dTb, dRf, dRb])
+    //!
+    //! The blob start must be aligned to alignof(double).
+
+    //! Returns column views that point directly into the blob (no copy). Throws on a malformed
+    //! or misaligned blob.
+    [[nodiscard]] std::vector<MeasuredColumns>
+      measuredColumnsFromBlob(std::span<const std::byte> blob);
+
+    //! Creates one CSpectralSampleData per sample stored in the blob.
+    [[nodiscard]] std::vector<std::shared_ptr<CSpectralSampleData>>
+      createSpectralSamples(std::span<const std::byte> blob);
+
+    //! Serializes samples into the layout above.
+    [[nodiscard]] std::vector<std::byte>
+      spectralSamplesToBlob(const std::vector<MeasuredColumns> & samples);
+}   // namespace SpectralAveraging
@@ -1,5 +1,6 @@
 #include <array>
 #include <utility>
+#include <stdexcept>
 
 #include <WCECommon.hpp>
 
@@ -132,6 +133,44 @@ namespace SpectralAveraging
         }
     }
 
+    CSpectralSampleData::CSpectralSampleData(const MeasuredColumns & columns) : SampleData()
+    {
+        const auto size = columns.wavelength.size();
+        const std::vector<double> zeros(size, 0.0);
+
+        const auto column = [&](std::span<const double> values, bool optional) {
+            if(optional && values.empty())
+            {
+                return std::span<const double>(zeros);
+            }
+            if(values.size() != size)
+            {
+                throw std::runtime_error(
+                  "Measured columns must have the same number of values as wavelengths.");
+            }
+            return values;
+        };
+
+        const auto & wl = columns.wavelength;
+        m_Property.emplace(key(PropertySurface::T, Side::Front, MeasurementType::Direct),
+                           CSeries(wl, column(columns.Tf, false)));
+        m_Property.emplace(key(PropertySurface::T, Side::Back, MeasurementType::Direct),
+                           CSeries(wl, column(columns.Tb, false)));
+        m_Property.emplace(key(PropertySurface::R, Side::Front, MeasurementType::Direct),
+                           CSeries(wl, column(columns.Rf, false)));
+        m_Property.emplace(key(PropertySurface::R, Side::Back, MeasurementType::Direct),
+                           CSeries(wl, column(columns.Rb, false)));
+
+        m_Property.emplace(key(PropertySurface::T, Side::Front, MeasurementType::Diffuse),
+                           CSeries(wl, column(columns.diffuseTf, true)));
+        m_Property.emplace(key(PropertySurface::T, Side::Back, MeasurementType::Diffuse),
+                           CSeries(wl, column(columns.diffuseTb, true)));
+        m_Property.emplace(key(PropertySurface::R, Side::Front, MeasurementType::Diffuse),
+                           CSeries(wl, column(columns.diffuseRf, true)));
+        m_Property.emplace(key(PropertySurface::R, Side::Back, MeasurementType::Diffuse),
+                           CSeries(wl, column(columns.diffuseRb, true)));
+    }
+
     CSeries CSpectralSampleData::properties(const Property prop,
                                             const Side side,
                                             const ScatteringType type)
@@ -205,9 +244,15 @@ namespace SpectralAveraging
         return std::make_shared<CSpectralSampleData>(tValues);
     }
 
+    std::shared_ptr<CSpectralSampleData>
+      CSpectralSampleData::create(const MeasuredColumns & columns)
+    {
+        return std::make_shared<CSpectralSampleData>(columns);
+    }
+
     std::shared_ptr<CSpectralSampleData> CSpectralSampleData::create()
     {
-        return create({});
+        return create(std::vector<MeasuredRow>{});
     }
 
     void CSpectralSampleData::cutExtraData(const double minLambda, const double maxLambda)
@@ -222,6 +267,18 @@ namespace SpectralAveraging
         }
     }
 
+    void CSpectralSampleData::appendToHash(StableHash & hash) const
+    {
+        hash.add(Flipped());
+        hash.add(m_Property.size());
+        for(const auto & [measurement, series] : m_Property)
+        {
+            const auto & [property, side, type] = measurement;
+            hash.add(property).add(side).add(type);
+            hashAppend(hash, series);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// PhotovoltaicData
     ///////////////////////////////////////////////////////////////////////////
@@ -251,4 +308,14 @@ namespace SpectralAveraging
         return m_EQE.at(side);
     }
 
+    void PhotovoltaicSampleData::appendToHash(StableHash & hash) const
+    {
+        CSpectralSampleData::appendToHash(hash);
+        for(const auto & [side, series] : m_EQE)
+        {
+            hash.add(side);
+            hashAppend(hash, series);
+        }
+    }
+
 }   // namespace SpectralAveraging
@@ -4,6 +4,7 @@
 #include <memory>
 #include <map>
 #include <array>
+#include <span>
 
 #include <WCECommon.hpp>
 
@@ -35,6 +36,26 @@ namespace SpectralAveraging
         OpticalProperties diffuse;
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// MeasuredColumns
+    ///////////////////////////////////////////////////////////////////////////
+
+    //! Column-oriented, non-owning view over measured sample data. Every non-empty column must
+    //! have the same length as wavelengths. Empty diffuse columns are treated as zero diffuse
+    //! components. Referenced memory has to stay alive only while the sample is constructed.
+    struct MeasuredColumns
+    {
+        std::span<const double> wavelength;
+        std::span<const double> Tf;
+        std::span<const double> Tb;
+        std::span<const double> Rf;
+        std::span<const double> Rb;
+        std::span<const double> diffuseTf{};
+        std::span<const double> diffuseTb{};
+        std::span<const double> diffuseRf{};
+        std::span<const double> diffuseRb{};
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     /// SampleData
     ///////////////////////////////////////////////////////////////////////////
@@ -69,9 +90,15 @@ namespace SpectralAveraging
         CSpectralSampleData();
         explicit CSpectralSampleData(const std::vector<MeasuredRow> & tValues);
 
+        //! Bulk constructor. Each property series is filled in one pass straight from the
+        //! columns, without going through per-row records.
+        explicit CSpectralSampleData(const MeasuredColumns & columns);
+
         static std::shared_ptr<CSpectralSampleData>
           create(const std::vector<MeasuredRow> & tValues);
 
+        static std::shared_ptr<CSpectralSampleData> create(const MeasuredColumns & columns);
+
         static std::shared_ptr<CSpectralSampleData> create();
 
         void addRecord(double t_Wavelength,
@@ -94,6 +121,9 @@ namespace SpectralAveraging
 
         void cutExtraData(double minLambda, double maxLambda) override;
 
+        //! Adds orientation and every measured series to the cache key.
+        virtual void appendToHash(FenestrationCommon::StableHash & hash) const;
+
     protected:
         std::map<MeasurementKey, FenestrationCommon::CSeries> m_Property;
     };
@@ -113,6 +143,8 @@ namespace SpectralAveraging
 
         [[nodiscard]] FenestrationCommon::CSeries eqe(const FenestrationCommon::Side side) const;
 
+        void appendToHash(FenestrationCommon::StableHash & hash) const override;
+
     private:
         std::map<FenestrationCommon::Side, FenestrationCommon::CSeries> m_EQE;
     };
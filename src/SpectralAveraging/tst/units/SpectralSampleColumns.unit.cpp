@@ -0,0 +1,96 @@
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <WCESpectralAveraging.hpp>
+#include <WCECommon.hpp>
+
+#include "optical/spectralSampleData.hpp"
+#include "optical/standardData.hpp"
+
+
+using namespace SpectralAveraging;
+using namespace FenestrationCommon;
+
+// Bulk (column) ingestion must produce exactly the same sample as the row based constructor.
+class TestSpectralSampleColumns : public testing::Test
+{
+    std::vector<double> m_Wavelengths;
+    std::vector<double> m_Tf;
+    std::vector<double> m_Tb;
+    std::vector<double> m_Rf;
+    std::vector<double> m_Rb;
+
+protected:
+    void SetUp() override
+    {
+        const auto rows = SpectralSample::NFRC_1042();
+        m_Wavelengths = rows->getWavelengths();
+        m_Tf = rows->properties(Property::T, Side::Front, ScatteringType::Direct).getYArray();
+        m_Tb = rows->properties(Property::T, Side::Back, ScatteringType::Direct).getYArray();
+        m_Rf = rows->properties(Property::R, Side::Front, ScatteringType::Direct).getYArray();
+        m_Rb = rows->properties(Property::R, Side::Back, ScatteringType::Direct).getYArray();
+    }
+
+public:
+    [[nodiscard]] MeasuredColumns columns() const
+    {
+        return {.wavelength = m_Wavelengths, .Tf = m_Tf, .Tb = m_Tb, .Rf = m_Rf, .Rb = m_Rb};
+    }
+};
+
+TEST_F(TestSpectralSampleColumns, ColumnsMatchRows)
+{
+    const auto rows = SpectralSample::NFRC_1042();
+    const auto bulk = CSpectralSampleData::create(columns());
+
+    EXPECT_EQ(rows->getWavelengths(), bulk->getWavelengths());
+    for(const auto & prop : {Property::T, Property::R, Property::Abs})
+    {
+        for(const auto & side : allSides())
+        {
+            const auto expected = rows->properties(prop, side, ScatteringType::Total).getYArray();
+            const auto result = bulk->properties(prop, side, ScatteringType::Total).getYArray();
+            EXPECT_EQ(expected, result);
+        }
+    }
+}
+
+TEST_F(TestSpectralSampleColumns, BlobRoundTrip)
+{
+    const auto blob = spectralSamplesToBlob({columns(), columns()});
+    const auto samples = createSpectralSamples(blob);
+    ASSERT_EQ(2u, samples.size());
+
+    const auto solarRadiation = StandardData::solarRadiationASTM_E891_87_Table1();
+    for(const auto & sampleData : samples)
+    {
+        CSpectralSample sample(sampleData, solarRadiation);
+        const auto transmittedSolar =
+          sample.getEnergy(0.3, 2.5, Property::T, Side::Front, ScatteringType::Total);
+        EXPECT_NEAR(341.803618, transmittedSolar, 1e-6);
+    }
+}
+
+TEST_F(TestSpectralSampleColumns, MismatchedColumnsThrow)
+{
+    auto cols = columns();
+    cols.Rb = cols.Rb.first(cols.Rb.size() - 1);
+    EXPECT_THROW(CSpectralSampleData{cols}, std::runtime_error);
+}
+
+TEST_F(TestSpectralSampleColumns, MalformedBlobThrows)
+{
+    auto blob = spectralSamplesToBlob({columns()});
+
+    auto truncated = blob;
+    truncated.resize(truncated.size() - sizeof(double));
+    EXPECT_THROW((void)measuredColumnsFromBlob(truncated), std::runtime_error);
+
+    // A sample count the blob cannot hold is rejected before anything is reserved for it.
+    const auto sampleCount = std::numeric_limits<std::uint64_t>::max();
+    std::memcpy(blob.data() + 8u, &sampleCount, sizeof(sampleCount));
+    EXPECT_THROW((void)measuredColumnsFromBlob(blob), std::runtime_error);
+}
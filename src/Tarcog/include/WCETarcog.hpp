@@ -19,6 +19,8 @@
 #include "../src/NusseltNumber.hpp"
 #include "../src/OutdoorEnvironment.hpp"
 #include "../src/SingleSystem.hpp"
+#include "../src/SolverTelemetry.hpp"
+#include "../src/ThermalSweep.hpp"
 #include "../src/SupportPillar.hpp"
 #include "../src/SupportPillarMeasured.hpp"
 #include "../src/Surface.hpp"
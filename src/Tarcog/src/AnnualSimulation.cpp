@@ -0,0 +1,174 @@
+#include <algorithm>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include <WCECommon.hpp>
+
+#include "AnnualSimulation.hpp"
+#include "Environment.hpp"
+#include "Environments.hpp"
+#include "IndoorEnvironment.hpp"
+#include "OutdoorEnvironment.hpp"
+#include "System.hpp"
+
+namespace Tarcog::ISO15099
+{
+    CAnnualSimulation::CAnnualSimulation(CIGU t_IGU,
+                                         const std::shared_ptr<CEnvironment> & t_Indoor,
+                                         WeatherSeries t_Weather,
+                                         SolarSeries t_Solar) :
+        m_IGU(std::move(t_IGU)),
+        m_Indoor(t_Indoor),
+        m_Weather(std::move(t_Weather)),
+        m_Solar(std::move(t_Solar))
+    {
+        const auto hours{numberOfHours()};
+        const auto hasAllHours = [hours](const std::vector<double> & column) {
+            return column.size() == hours;
+        };
+
+        if(!hasAllHours(m_Weather.windSpeed) || !hasAllHours(m_Weather.skyTemperature)
+           || !hasAllHours(m_Weather.directSolarRadiation)
+           || !hasAllHours(m_Solar.solarTransmittance))
+        {
+            throw std::runtime_error(
+              "Weather and solar columns must have the same number of hours.");
+        }
+        if(m_Weather.indoorTemperature.empty() ? m_Indoor == nullptr
+                                               : !hasAllHours(m_Weather.indoorTemperature))
+        {
+            throw std::runtime_error(
+              "Indoor environment or indoor temperature for every hour must be given.");
+        }
+        if(m_Solar.layerAbsorptances.size() != m_IGU.getSolidLayers().size())
+        {
+            throw std::runtime_error(
+              "Number of absorptance columns does not match number of solid layers.");
+        }
+        if(!std::ranges::all_of(m_Solar.layerAbsorptances, hasAllHours))
+        {
+            throw std::runtime_error("Absorptance columns must have the same number of hours.");
+        }
+    }
+
+    size_t CAnnualSimulation::numberOfHours() const
+    {
+        return m_Weather.outdoorTemperature.size();
+    }
+
+    std::vector<HourlyResult>
+      CAnnualSimulation::solveHours(const size_t warmUpStart,
+                                    const size_t first,
+                                    const size_t last,
+                                    const BoundaryConditionsCoeffModel outdoorHCoeffModel) const
+    {
+        std::vector<HourlyResult> results;
+        results.reserve(last - first);
+
+        std::vector<double> absorptances(m_Solar.layerAbsorptances.size());
+        std::map<System, std::vector<double>> initialGuess;
+        for(auto hour = warmUpStart; hour < last; ++hour)
+        {
+            const auto solarRadiation{m_Weather.directSolarRadiation[hour]};
+            for(size_t layer = 0u; layer < absorptances.size(); ++layer)
+            {
+                absorptances[layer] = m_Solar.layerAbsorptances[layer][hour];
+            }
+            CIGU igu{m_IGU};
+            igu.setAbsorptances(absorptances, solarRadiation);
+
+            auto outdoor{Environments::outdoor(m_Weather.outdoorTemperature[hour],
+                                               m_Weather.windSpeed[hour],
+                                               solarRadiation,
+                                               m_Weather.skyTemperature[hour],
+                                               SkyModel::AllSpecified)};
+            outdoor->setHCoeffModel(outdoorHCoeffModel);
+
+            std::shared_ptr<CEnvironment> indoor;
+            if(m_Weather.indoorTemperature.empty())
+            {
+                indoor = m_Indoor->cloneEnvironment();
+            }
+            else
+            {
+                indoor = Environments::indoor(m_Weather.indoorTemperature[hour]);
+            }
+
+            CSystem system(std::move(igu), indoor, outdoor, initialGuess);
+            initialGuess = {{System::Uvalue, system.getTemperatures(System::Uvalue)},
+                            {System::SHGC, system.getTemperatures(System::SHGC)}};
+
+            if(hour >= first)
+            {
+                results.push_back(
+                  {hour,
+                   system.getUValue(),
+                   system.getSHGC(m_Solar.solarTransmittance[hour]),
+                   initialGuess.at(System::SHGC),
+                   system.getHeatFlow(System::SHGC, Environment::Indoor),
+                   system.getHeatFlow(System::SHGC, Environment::Outdoor),
+                   system.getSolverCounters(System::Uvalue).outerIterations
+                     + system.getSolverCounters(System::SHGC).outerIterations});
+            }
+        }
+        return results;
+    }
+
+    void CAnnualSimulation::run(const HourlySink & sink,
+                                const AnnualSimulationOptions & options) const
+    {
+        const auto hours{numberOfHours()};
+        const auto chunkSize{options.chunkSize == 0u ? std::max<size_t>(hours, 1u)
+                                                     : options.chunkSize};
+        const auto numberOfChunks{(hours + chunkSize - 1u) / chunkSize};
+
+        // Finished chunks wait here until all chunks before them are reported. Exceptions cannot
+        // leave worker threads. The one from the first failed chunk is rethrown at the end.
+        std::mutex sinkMutex;
+        std::map<size_t, std::vector<HourlyResult>> finished;
+        size_t nextChunk{0u};
+        std::vector<std::exception_ptr> errors(numberOfChunks);
+        FenestrationCommon::executeInParallelDynamic(
+          numberOfChunks,
+          [&](const size_t chunk) {
+              try
+              {
+                  const auto first{chunk * chunkSize};
+                  const auto last{std::min(first + chunkSize, hours)};
+                  auto results{solveHours(first - std::min(first, options.overlap),
+                                          first,
+                                          last,
+                                          options.outdoorHCoeffModel)};
+
+                  std::scoped_lock lock(sinkMutex);
+                  finished.emplace(chunk, std::move(results));
+                  for(auto it = finished.find(nextChunk); it != finished.end();
+                      it = finished.find(nextChunk))
+                  {
+                      for(const auto & result : it->second)
+                      {
+                          sink(result);
+                      }
+                      finished.erase(it);
+                      ++nextChunk;
+                  }
+              }
+              catch(...)
+              {
+                  errors[chunk] = std::current_exception();
+              }
+          },
+          options.numberOfThreads);
+
+        for(const auto & error : errors)
+        {
+            if(error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+}   // namespace Tarcog::ISO15099
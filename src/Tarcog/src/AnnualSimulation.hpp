@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "IGU.hpp"
+#include "EnvironmentConfigurations.hpp"
+
+namespace Tarcog::ISO15099
+{
+    class CEnvironment;
+
+    //! Hourly weather. Every column has one value per hour.
+    struct WeatherSeries
+    {
+        std::vector<double> outdoorTemperature;
+        std::vector<double> windSpeed;
+        std::vector<double> skyTemperature;
+        std::vector<double> directSolarRadiation;
+        //! Empty column keeps the indoor environment of the simulation for every hour.
+        std::vector<double> indoorTemperature;
+    };
+
+    //! Hourly optical results of the glazing.
+    struct SolarSeries
+    {
+        //! One column per solid layer, outdoor side first.
+        std::vector<std::vector<double>> layerAbsorptances;
+        //! Total solar transmittance used by SHGC.
+        std::vector<double> solarTransmittance;
+    };
+
+    struct HourlyResult
+    {
+        size_t hour{0u};
+        double uValue{0};
+        double shgc{0};
+        //! Surface temperatures under the hourly conditions, outdoor side first.
+        std::vector<double> temperatures;
+        //! Heat flows under the hourly conditions.
+        double indoorHeatFlow{0};
+        double outdoorHeatFlow{0};
+        //! Outer solver iterations of the U-value and SHGC systems together.
+        size_t iterations{0u};
+    };
+
+    using HourlySink = std::function<void(const HourlyResult &)>;
+
+    struct AnnualSimulationOptions
+    {
+        //! Zero solves the whole series as a single chunk.
+        size_t chunkSize{0u};
+        //! Hours before each chunk that are solved only to warm up the solution. Their results
+        //! are not reported.
+        size_t overlap{24u};
+        //! Zero uses all cores.
+        size_t numberOfThreads{0u};
+        BoundaryConditionsCoeffModel outdoorHCoeffModel{BoundaryConditionsCoeffModel::CalculateH};
+    };
+
+    //! Solves the glazing for every hour of the weather series. Each hour starts from the
+    //! solution of the previous one. Series can be split into chunks that are solved in parallel
+    //! and warmed up by the hours before them.
+    class CAnnualSimulation
+    {
+    public:
+        CAnnualSimulation(CIGU t_IGU,
+                          const std::shared_ptr<CEnvironment> & t_Indoor,
+                          WeatherSeries t_Weather,
+                          SolarSeries t_Solar);
+
+        [[nodiscard]] size_t numberOfHours() const;
+
+        //! Sink receives hours in order and is never called from two threads at the same time.
+        //! Chunks that finish before the previous ones wait in memory until those are reported.
+        void run(const HourlySink & sink, const AnnualSimulationOptions & options = {}) const;
+
+    private:
+        //! Results of the hours in [first, last). Hours from warmUpStart are solved before them.
+        [[nodiscard]] std::vector<HourlyResult>
+          solveHours(size_t warmUpStart,
+                     size_t first,
+                     size_t last,
+                     BoundaryConditionsCoeffModel outdoorHCoeffModel) const;
+
+        CIGU m_IGU;
+        std::shared_ptr<CEnvironment> m_Indoor;
+        WeatherSeries m_Weather;
+        SolarSeries m_Solar;
+    };
+}   // namespace Tarcog::ISO15099
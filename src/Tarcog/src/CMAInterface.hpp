@@ -2,6 +2,8 @@
 
 #include <cassert>
 #include <map>
+#include <span>
+#include <vector>
 
 #include <WCECommon.hpp>
 
@@ -46,6 +48,14 @@ namespace CMA
         std::map<Option, T> m_Value;
     };
 
+    //! Whole-window results of a bulk CMA query, one entry per input row
+    struct CMABulkResults
+    {
+        std::vector<double> uValue;
+        std::vector<double> shgc;
+        std::vector<double> vt;
+    };
+
     class ICMAWindow
     {
     public:
@@ -55,5 +65,12 @@ namespace CMA
         [[nodiscard]] virtual double shgc(double SHGCcog, double keffSpacer) = 0;
         [[nodiscard]] virtual double vt(double tVis) = 0;
         [[nodiscard]] virtual Tarcog::IGUDimensions getIGUDimensions() = 0;
+
+        //! Same as calling uValue, shgc and vt for every row of the input columns. All columns
+        //! must have the same size, otherwise std::runtime_error is thrown.
+        [[nodiscard]] virtual CMABulkResults bulkResults(std::span<const double> Ucog,
+                                                         std::span<const double> SHGCcog,
+                                                         std::span<const double> tVis,
+                                                         std::span<const double> keffSpacer) = 0;
     };
 }   // namespace CMA
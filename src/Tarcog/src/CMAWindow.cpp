@@ -1,3 +1,5 @@
+#include <stdexcept>
+
 #include "CMAWindow.hpp"
 
 #include "SimpleIGU.hpp"
@@ -48,10 +50,8 @@ namespace CMA
 
     double CMAWindow::shgc(const double SHGCcog, const double keffSpacer)
     {
-        // For CMA it does not matter what the value of tsol is
-        const auto tSol{1.0};
-        return SHGCb(keffSpacer, tSol)
-               + (SHGCw(keffSpacer, tSol) - SHGCb(keffSpacer, tSol)) * SHGCcog;
+        const auto shgcb{SHGCb(keffSpacer)};
+        return shgcb + (SHGCw(keffSpacer) - shgcb) * SHGCcog;
     }
 
     Tarcog::IGUDimensions CMAWindow::getIGUDimensions()
@@ -59,48 +59,133 @@ namespace CMA
         return windowAt(Option::Best, Option::Best).getIGUDimensions();
     }
 
-    double CMAWindow::Ub(const double spacerKeff)
+    CMABulkResults CMAWindow::bulkResults(std::span<const double> Ucog,
+                                          std::span<const double> SHGCcog,
+                                          std::span<const double> tVis,
+                                          std::span<const double> keffSpacer)
     {
-        const auto lnTop{std::log(spacerKeff) - std::log(m_Spacer.value(Option::Best))};
-        const auto lnBot{std::log(m_Spacer.value(Option::Worst))
-                         - std::log(m_Spacer.value(Option::Best))};
-        const auto dU{windowAt(Option::Worst, Option::Best).uValue()
-                      - windowAt(Option::Best, Option::Best).uValue()};
+        const auto rows{Ucog.size()};
+        if(SHGCcog.size() != rows || tVis.size() != rows || keffSpacer.size() != rows)
+        {
+            throw std::runtime_error("CMA bulk query columns must have the same size.");
+        }
+
+        const auto & bestBest{corner(Option::Best, Option::Best)};
+        const auto & bestWorst{corner(Option::Best, Option::Worst)};
+        const auto & worstBest{corner(Option::Worst, Option::Best)};
+        const auto & worstWorst{corner(Option::Worst, Option::Worst)};
+
+        const auto dUb{worstBest.uValue - bestBest.uValue};
+        const auto dUw{worstWorst.uValue - bestWorst.uValue};
+        const auto dSHGCb{worstBest.shgcUnitTSol - bestBest.shgcUnitTSol};
+        const auto dSHGCw{worstWorst.shgcUnitTSol - bestWorst.shgcUnitTSol};
+
+        const auto ucb{m_BestWorstIGUUvalues.at(Option::Best).uValue()};
+        const auto ucw{m_BestWorstIGUUvalues.at(Option::Worst).uValue()};
 
-        return windowAt(Option::Best, Option::Best).uValue() + dU * lnTop / lnBot;
+        const auto lnBest{std::log(m_Spacer.value(Option::Best))};
+        const auto lnBot{std::log(m_Spacer.value(Option::Worst)) - lnBest};
+
+        // Visible transmittance is linear in tVis and the same for all corner windows
+        const auto & window{windowAt(Option::Best, Option::Best)};
+        const auto vt0{window.vt0()};
+        const auto dVT{window.vt1() - vt0};
+
+        CMABulkResults results{.uValue = std::vector<double>(rows),
+                               .shgc = std::vector<double>(rows),
+                               .vt = std::vector<double>(rows)};
+        for(size_t row = 0u; row < rows; ++row)
+        {
+            const auto fraction{(std::log(keffSpacer[row]) - lnBest) / lnBot};
+
+            const auto ub{bestBest.uValue + dUb * fraction};
+            const auto uw{bestWorst.uValue + dUw * fraction};
+            results.uValue[row] = ub + (uw - ub) * (Ucog[row] - ucb) / (ucw - ucb);
+
+            const auto shgcb{bestBest.shgc + dSHGCb * fraction};
+            const auto shgcw{bestWorst.shgc + dSHGCw * fraction};
+            results.shgc[row] = shgcb + (shgcw - shgcb) * SHGCcog[row];
+
+            results.vt[row] = vt0 + dVT * tVis[row];
+        }
+
+        return results;
+    }
+
+    double CMAWindow::Ub(const double spacerKeff)
+    {
+        const auto & best{corner(Option::Best, Option::Best)};
+        const auto & worst{corner(Option::Worst, Option::Best)};
+        return best.uValue + (worst.uValue - best.uValue) * spacerFraction(spacerKeff);
     }
 
     double CMAWindow::Uw(const double spacerKeff)
     {
-        const auto lnTop{std::log(spacerKeff) - std::log(m_Spacer.value(Option::Best))};
-        const auto lnBot{std::log(m_Spacer.value(Option::Worst))
-                         - std::log(m_Spacer.value(Option::Best))};
-        const auto dU{windowAt(Option::Worst, Option::Worst).uValue()
-                      - windowAt(Option::Best, Option::Worst).uValue()};
+        const auto & best{corner(Option::Best, Option::Worst)};
+        const auto & worst{corner(Option::Worst, Option::Worst)};
+        return best.uValue + (worst.uValue - best.uValue) * spacerFraction(spacerKeff);
+    }
 
-        return windowAt(Option::Best, Option::Worst).uValue() + dU * lnTop / lnBot;
+    double CMAWindow::SHGCb(const double spacerKeff)
+    {
+        const auto & best{corner(Option::Best, Option::Best)};
+        const auto & worst{corner(Option::Worst, Option::Best)};
+        return best.shgc + (worst.shgcUnitTSol - best.shgcUnitTSol) * spacerFraction(spacerKeff);
     }
 
-    double CMAWindow::SHGCb(const double spacerKeff, const double tSol)
+    double CMAWindow::SHGCw(const double spacerKeff)
     {
-        const auto lnTop{std::log(spacerKeff) - std::log(m_Spacer.value(Option::Best))};
-        const auto lnBot{std::log(m_Spacer.value(Option::Worst))
-                         - std::log(m_Spacer.value(Option::Best))};
-        const auto dU{windowAt(Option::Worst, Option::Best).shgc(tSol)
-                      - windowAt(Option::Best, Option::Best).shgc(tSol)};
+        const auto & best{corner(Option::Best, Option::Worst)};
+        const auto & worst{corner(Option::Worst, Option::Worst)};
+        return best.shgc + (worst.shgcUnitTSol - best.shgcUnitTSol) * spacerFraction(spacerKeff);
+    }
+
+    void CMAWindow::invalidateCorners()
+    {
+        m_Corners.reset();
+    }
+
+    const CMAWindow::CornerResults & CMAWindow::corner(const Option spacer, const Option glazing)
+    {
+        const auto cornerIndex = [](const Option spacerOption, const Option glazingOption) {
+            return 2u * static_cast<size_t>(spacerOption) + static_cast<size_t>(glazingOption);
+        };
 
-        return windowAt(Option::Best, Option::Best).shgc() + dU * lnTop / lnBot;
+        if(!m_Corners.has_value())
+        {
+            // windowAt is virtual and not meant to be called concurrently, so the windows are
+            // collected first and only their (const) evaluation runs on the worker threads.
+            std::array<const Tarcog::IWindow *, 4u> windows{};
+            EnumOption options;
+            for(auto spacerOption : options)
+            {
+                for(auto glazingOption : options)
+                {
+                    windows[cornerIndex(spacerOption, glazingOption)] =
+                      &windowAt(spacerOption, glazingOption);
+                }
+            }
+
+            // For CMA it does not matter what the value of tsol is
+            constexpr auto unitTSol{1.0};
+            std::array<CornerResults, 4u> corners{};
+            FenestrationCommon::executeInParallelDynamic(windows.size(), [&](const size_t index) {
+                corners[index] = {.uValue = windows[index]->uValue(),
+                                  .shgc = windows[index]->shgc(),
+                                  .shgcUnitTSol = windows[index]->shgc(unitTSol)};
+            });
+            m_Corners = corners;
+        }
+
+        return (*m_Corners)[cornerIndex(spacer, glazing)];
     }
 
-    double CMAWindow::SHGCw(const double spacerKeff, const double tSol)
+    double CMAWindow::spacerFraction(const double spacerKeff) const
     {
         const auto lnTop{std::log(spacerKeff) - std::log(m_Spacer.value(Option::Best))};
         const auto lnBot{std::log(m_Spacer.value(Option::Worst))
                          - std::log(m_Spacer.value(Option::Best))};
-        const auto dU{windowAt(Option::Worst, Option::Worst).shgc(tSol)
-                      - windowAt(Option::Best, Option::Worst).shgc(tSol)};
-
-        return windowAt(Option::Best, Option::Worst).shgc() + dU * lnTop / lnBot;
+        return lnTop / lnBot;
     }
 
     std::map<Option, std::map<Option, Tarcog::ISO15099::WindowSingleVision>>
@@ -181,6 +266,7 @@ namespace CMA
                 m_Window.at(spacerOption).at(glazingOption).setFrameData(position, frameData);
             }
         }
+        invalidateCorners();
     }
 
     void CMAWindowSingleVision::setFrameData(const SingleVisionFrameMap & frames)
@@ -206,6 +292,7 @@ namespace CMA
                   .setDividers(frameData, nHorizontal, nVertical);
             }
         }
+        invalidateCorners();
     }
 
     //////////////////////////////////////////
@@ -235,6 +322,7 @@ namespace CMA
                 m_Window.at(spacerOption).at(glazingOption).setFrameData(position, frameData);
             }
         }
+        invalidateCorners();
     }
 
     void CMAWindowDualVisionHorizontal::setFrameData(const DualHorizontalFrameMap & frames)
@@ -260,6 +348,7 @@ namespace CMA
                   .setDividers(frameData, nHorizontal, nVertical);
             }
         }
+        invalidateCorners();
     }
 
     void CMAWindowDualVisionHorizontal::setDividersAuto(CMAFrame divider)
@@ -273,6 +362,7 @@ namespace CMA
                 m_Window.at(spacerOption).at(glazingOption).setDividersAuto(frameData);
             }
         }
+        invalidateCorners();
     }
 
     std::map<Option, std::map<Option, Tarcog::ISO15099::DualVisionHorizontal>>
@@ -371,6 +461,7 @@ namespace CMA
                 m_Window.at(spacerOption).at(glazingOption).setFrameData(position, frameData);
             }
         }
+        invalidateCorners();
     }
 
     void CMAWindowDualVisionVertical::setFrameData(const DualVerticalFrameMap & frames)
@@ -396,6 +487,7 @@ namespace CMA
                   .setDividers(frameData, nHorizontal, nVertical);
             }
         }
+        invalidateCorners();
     }
 
     std::map<Option, std::map<Option, Tarcog::ISO15099::DualVisionVertical>>
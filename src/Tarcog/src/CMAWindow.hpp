@@ -1,5 +1,8 @@
 #pragma once
 
+#include <array>
+#include <optional>
+
 #include "CMAInterface.hpp"
 #include "Frame.hpp"
 #include "WholeWindow.hpp"
@@ -43,17 +46,46 @@ namespace CMA
 
         [[nodiscard]] Tarcog::IGUDimensions getIGUDimensions() override;
 
+        //! Corner windows and frame weights are evaluated once; each row then only interpolates.
+        [[nodiscard]] CMABulkResults bulkResults(std::span<const double> Ucog,
+                                                 std::span<const double> SHGCcog,
+                                                 std::span<const double> tVis,
+                                                 std::span<const double> keffSpacer) override;
+
     protected:
         [[nodiscard]] double Ub(double spacerKeff);
         [[nodiscard]] double Uw(double spacerKeff);
-        [[nodiscard]] double SHGCb(double spacerKeff, const double tSol);
-        [[nodiscard]] double SHGCw(double spacerKeff, const double tSol);
+        [[nodiscard]] double SHGCb(double spacerKeff);
+        [[nodiscard]] double SHGCw(double spacerKeff);
 
         [[nodiscard]] virtual Tarcog::IWindow & windowAt(Option spacer, Option glazing) = 0;
 
+        //! Derived classes call it whenever frames, dividers or anything else in the corner
+        //! windows changes.
+        void invalidateCorners();
+
         std::map<Option, CMABestWorstUFactors> m_BestWorstIGUUvalues;
 
         BestWorst<double> m_Spacer;
+
+    private:
+        //! Whole-window results of one (spacer, glazing) corner window. They depend neither on
+        //! the spacer keff nor on the center of glass values, so every query reuses them.
+        struct CornerResults
+        {
+            double uValue{0.0};
+            double shgc{0.0};
+            //! SHGC at unit solar transmittance, used for the spacer interpolation
+            double shgcUnitTSol{0.0};
+        };
+
+        //! The four corner windows are calculated concurrently on the first query after a change.
+        [[nodiscard]] const CornerResults & corner(Option spacer, Option glazing);
+
+        //! Fraction of the way from the best to the worst spacer on a logarithmic keff scale
+        [[nodiscard]] double spacerFraction(double spacerKeff) const;
+
+        std::optional<std::array<CornerResults, 4u>> m_Corners;
     };
 
     using SingleVisionFrameMap = std::map<Tarcog::ISO15099::SingleVisionFramePosition, CMAFrame>;
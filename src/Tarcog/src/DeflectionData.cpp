@@ -1,3958 +1,1699 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
 #include <optional>
+#include <span>
+#include <vector>
+
 #include <WCECommon.hpp>
 
+#include "DeflectionData.hpp"
+
 namespace DeflectionData
 {
-    Table::Table2D<std::optional<double>> getWNData()
+    namespace
     {
-        const std::vector<std::optional<double>> x{1, 1.5849, 2.5119, 3.9811, 6.3096, 10};
-        const std::vector<std::optional<double>> y{-5, -2.6, -0.2, 2.2, 4.6, 7};
-        const std::vector<std::vector<std::optional<double>>> values{
-          {-5.296, -4.5908, -4.2526, -4.1455, -4.1268, -4.1207},
-          {-2.8966, -2.1922, -1.8533, -1.7454, -1.7267, -1.7207},
-          {-0.5569, 0.0834, 0.478, 0.6578, 0.6826, 0.6846},
-          {1.067, 1.5661, 2.0892, 2.5669, 2.9394, 3.1262},
-          {2.1892, 2.6411, 3.1511, 3.8313, 4.2809, 4.7056},
-          {3.2125, 3.663, 4.7048, 5.0957, 5.6665, 6.23315}};
+        //! Marks the points that are missing from the published curves.
+        constexpr double missing{std::numeric_limits<double>::quiet_NaN()};
 
-        Table::Table2D table{x, y, values};
+        constexpr std::array<double, 6u> WNAspectRatio{
+          1, 1.5849, 2.5119, 3.9811, 6.3096, 10};
 
-        return table;
-    }
+        constexpr std::array<double, 6u> WNLogLoad{
+          -5, -2.6, -0.2, 2.2, 4.6, 7};
 
-    Table::Table2D<std::optional<double>> getVNData()
-    {
-        const std::vector<std::optional<double>> x{
-          1,           1.023292992, 1.047128548, 1.071519305, 1.096478196, 1.122018454, 1.148153621,
+        //! Row major, one row per load and one column per aspect ratio.
+        constexpr std::array<double, 6u * 6u> WNLogValues{
+          -5.296, -4.5908, -4.2526, -4.1455, -4.1268, -4.1207,
+          -2.8966, -2.1922, -1.8533, -1.7454, -1.7267, -1.7207,
+          -0.5569, 0.0834, 0.478, 0.6578, 0.6826, 0.6846,
+          1.067, 1.5661, 2.0892, 2.5669, 2.9394, 3.1262,
+          2.1892, 2.6411, 3.1511, 3.8313, 4.2809, 4.7056,
+          3.2125, 3.663, 4.7048, 5.0957, 5.6665, 6.23315};
+
+        constexpr std::array<double, 101u> VNAspectRatio{
+          1, 1.023292992, 1.047128548, 1.071519305, 1.096478196, 1.122018454, 1.148153621,
           1.174897555, 1.202264435, 1.230268771, 1.258925412, 1.288249552, 1.318256739, 1.348962883,
           1.380384265, 1.412537545, 1.445439771, 1.479108388, 1.513561248, 1.548816619, 1.584893192,
-          1.621810097, 1.659586907, 1.698243652, 1.737800829, 1.77827941,  1.819700859, 1.862087137,
-          1.905460718, 1.9498446,   1.995262315, 2.041737945, 2.089296131, 2.13796209,  2.187761624,
+          1.621810097, 1.659586907, 1.698243652, 1.737800829, 1.77827941, 1.819700859, 1.862087137,
+          1.905460718, 1.9498446, 1.995262315, 2.041737945, 2.089296131, 2.13796209, 2.187761624,
           2.238721139, 2.290867653, 2.344228815, 2.398832919, 2.454708916, 2.511886432, 2.570395783,
           2.630267992, 2.691534804, 2.754228703, 2.818382931, 2.884031503, 2.951209227, 3.01995172,
-          3.090295433, 3.16227766,  3.235936569, 3.311311215, 3.388441561, 3.467368505, 3.548133892,
-          3.630780548, 3.715352291, 3.801893963, 3.89045145,  3.981071706, 4.073802778, 4.168693835,
+          3.090295433, 3.16227766, 3.235936569, 3.311311215, 3.388441561, 3.467368505, 3.548133892,
+          3.630780548, 3.715352291, 3.801893963, 3.89045145, 3.981071706, 4.073802778, 4.168693835,
           4.265795188, 4.365158322, 4.466835922, 4.570881896, 4.677351413, 4.786300923, 4.897788194,
-          5.011872336, 5.12861384,  5.248074602, 5.370317964, 5.495408739, 5.623413252, 5.754399373,
-          5.888436554, 6.025595861, 6.165950019, 6.309573445, 6.45654229,  6.60693448,  6.760829754,
-          6.918309709, 7.079457844, 7.244359601, 7.413102413, 7.58577575,  7.762471166, 7.943282347,
-          8.128305162, 8.317637711, 8.511380382, 8.7096359,   8.912509381, 9.120108394, 9.332543008,
-          9.54992586,  9.77237221,  10};
+          5.011872336, 5.12861384, 5.248074602, 5.370317964, 5.495408739, 5.623413252, 5.754399373,
+          5.888436554, 6.025595861, 6.165950019, 6.309573445, 6.45654229, 6.60693448, 6.760829754,
+          6.918309709, 7.079457844, 7.244359601, 7.413102413, 7.58577575, 7.762471166, 7.943282347,
+          8.128305162, 8.317637711, 8.511380382, 8.7096359, 8.912509381, 9.120108394, 9.332543008,
+          9.54992586, 9.77237221, 10};
+
+        constexpr std::array<double, 101u> VNLogLoad{
+          -5, -4.9, -4.8, -4.7, -4.6, -4.5, -4.4, -4.3, -4.2, -4.1, -4, -3.9, -3.8, -3.7, -3.6,
+          -3.5, -3.4, -3.3, -3.2, -3.1, -3, -2.9, -2.8, -2.7, -2.6, -2.5, -2.4, -2.3, -2.2, -2.1,
+          -2, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1, -0.9, -0.8, -0.7, -0.6,
+          -0.5, -0.4, -0.3, -0.2, -0.1, 0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1, 1.1, 1.2,
+          1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, 2, 2.1, 2.2, 2.3, 2.4, 2.5, 2.6, 2.7, 2.8, 2.9, 3, 3.1,
+          3.2, 3.3, 3.4, 3.5, 3.6, 3.7, 3.8, 3.9, 4, 4.1, 4.2, 4.3, 4.4, 4.5, 4.6, 4.7, 4.8, 4.9,
+          5};
+
+        //! Row major, one row per load and one column per aspect ratio.
+        constexpr std::array<double, 101u * 101u> VNLogValues{
+          -4.781907584, -4.713365067, -4.645834221, -4.579370543, -4.513899017, -4.449501338,
+          -4.386130708, -4.323751239, -4.262396852, -4.202034265, -4.142693692, -4.084321188,
+          -4.026909425, -3.970485472, -3.914980899, -3.860420462, -3.806767586, -3.754044016,
+          -3.70219083, -3.65119732, -3.601083242, -3.551777572, -3.503298734, -3.455609029,
+          -3.408724767, -3.362575442, -3.317176617, -3.272491388, -3.228533761, -3.185234348,
+          -3.14260694, -3.100616052, -3.059274454, -3.018514335, -2.978348707, -2.938761087,
+          -2.899712772, -2.861188986, -2.823185761, -2.78568922, -2.748653906, -2.71208707,
+          -2.675959769, -2.640286175, -2.605002459, -2.570118127, -2.535624038, -2.501494789,
+          -2.467745627, -2.434316088, -2.401217422, -2.368442304, -2.335968685, -2.303790349,
+          -2.271918692, -2.240297732, -2.208940457, -2.17784161, -2.146982844, -2.116378188,
+          -2.085981876, -2.055808721, -2.025842572, -1.996080153, -1.966514281, -1.937160738,
+          -1.907966983, -1.87895003, -1.850103838, -1.821426194, -1.79292469, -1.764556376,
+          -1.736337103, -1.708261982, -1.680326323, -1.652528854, -1.624858722, -1.597336441,
+          -1.56991474, -1.542611718, -1.515423798, -1.488347206, -1.46137864, -1.434514811,
+          -1.407775648, -1.381111334, -1.354542616, -1.328066658, -1.301680724, -1.275382177,
+          -1.249168469, -1.223037143, -1.19701107, -1.171036869, -1.145138184, -1.119312874,
+          -1.093558867, -1.067874163, -1.042256823, -1.016704975, -0.991243473,
+          -4.681908318, -4.61336587, -4.545835095, -4.479371488, -4.413900035, -4.34950243,
+          -4.286131871, -4.223752473, -4.162398155, -4.102035634, -4.042695123, -3.984322677,
+          -3.926910968, -3.870487063, -3.814982531, -3.760422129, -3.706769281, -3.654045733,
+          -3.60219256, -3.551199058, -3.501084981, -3.451779304, -3.403300453, -3.355610728,
+          -3.30872644, -3.262577084, -3.217178224, -3.172492954, -3.128535284, -3.085235823,
+          -3.042608365, -3.000617425, -2.959275775, -2.9185156, -2.878349917, -2.838762243,
+          -2.799713874, -2.761190034, -2.723186757, -2.685690166, -2.648654803, -2.612087919,
+          -2.575960574, -2.540286937, -2.505003181, -2.470118811, -2.435624686, -2.401495403,
+          -2.367746211, -2.334316642, -2.301217949, -2.268442807, -2.235969165, -2.203790807,
+          -2.171919131, -2.140298152, -2.108940861, -2.077841997, -2.046983217, -2.016378548,
+          -1.985982223, -1.955809056, -1.925842896, -1.896080467, -1.866514585, -1.837161032,
+          -1.807967268, -1.778950307, -1.750104107, -1.721426455, -1.692924943, -1.664556622,
+          -1.636337343, -1.608262215, -1.580326549, -1.552529074, -1.524858935, -1.49733665,
+          -1.469914943, -1.442611916, -1.415424015, -1.388347417, -1.361378845, -1.334515011,
+          -1.307775843, -1.281111524, -1.254542801, -1.228066838, -1.2016809, -1.175382348,
+          -1.149168636, -1.123037305, -1.097011229, -1.071037024, -1.045138335, -1.019313021,
+          -0.993559011, -0.967874302, -0.942256959, -0.916705107, -0.891243603,
+          -4.581909214, -4.51336685, -4.445836161, -4.379372643, -4.313901279, -4.249503762,
+          -4.186133292, -4.123753981, -4.062399747, -4.002037306, -3.942696872, -3.884324497,
+          -3.826912851, -3.770489005, -3.714984523, -3.660424165, -3.606771351, -3.55404783,
+          -3.502194674, -3.451201181, -3.401087104, -3.351781419, -3.303302551, -3.255612802,
+          -3.208728484, -3.16257909, -3.117180186, -3.072494867, -3.028537143, -2.985237625,
+          -2.942610106, -2.900619102, -2.859277387, -2.818517146, -2.778351396, -2.738763656,
+          -2.69971522, -2.661191314, -2.623187973, -2.585691321, -2.548655898, -2.512088956,
+          -2.475961556, -2.440287868, -2.405004062, -2.370119646, -2.335625477, -2.301496154,
+          -2.267746924, -2.23431732, -2.201218594, -2.168443421, -2.135969751, -2.103791366,
+          -2.071919667, -2.040298666, -2.008941353, -1.977842471, -1.946983672, -1.916378987,
+          -1.885982647, -1.855809465, -1.825843291, -1.796080849, -1.766514955, -1.737161391,
+          -1.707967616, -1.678950645, -1.650104435, -1.621426773, -1.592925253, -1.564556923,
+          -1.536337635, -1.508262499, -1.480326825, -1.452529342, -1.424859197, -1.397336905,
+          -1.36991519, -1.342612157, -1.31542428, -1.288347675, -1.261379096, -1.234515255,
+          -1.207776081, -1.181111756, -1.154543027, -1.128067058, -1.101681114, -1.075382557,
+          -1.049168839, -1.023037503, -0.997011423, -0.971037213, -0.945138519, -0.9193132,
+          -0.893559185, -0.867874472, -0.842257125, -0.816705269, -0.791243762,
+          -4.481910309, -4.413368047, -4.345837464, -4.279374054, -4.213902798, -4.14950539,
+          -4.086135028, -4.023755823, -3.962401691, -3.902039348, -3.842699007, -3.784326719,
+          -3.726915152, -3.670491377, -3.614986957, -3.560426651, -3.50677388, -3.454050391,
+          -3.402197257, -3.351203773, -3.301089697, -3.251784002, -3.203305114, -3.155615336,
+          -3.108730981, -3.062581541, -3.017182583, -2.972497203, -2.928539415, -2.885239826,
+          -2.842612232, -2.800621151, -2.759279357, -2.718519034, -2.678353202, -2.638765381,
+          -2.599716864, -2.561192878, -2.523189459, -2.485692731, -2.448657235, -2.412090223,
+          -2.375962756, -2.340289005, -2.305005139, -2.270120666, -2.235626444, -2.20149707,
+          -2.167747794, -2.134318147, -2.101219381, -2.068444171, -2.035970466, -2.00379205,
+          -1.971920322, -1.940299293, -1.908941955, -1.877843049, -1.846984229, -1.816379524,
+          -1.785983164, -1.755809965, -1.725843774, -1.696081316, -1.666515407, -1.63716183,
+          -1.607968042, -1.578951057, -1.550104835, -1.521427161, -1.492925631, -1.464557291,
+          -1.436337992, -1.408262846, -1.380327163, -1.35252967, -1.324859516, -1.297337216,
+          -1.269915493, -1.242612451, -1.215424603, -1.188347989, -1.161379402, -1.134515553,
+          -1.107776372, -1.08111204, -1.054543303, -1.028067327, -1.001681376, -0.975382812,
+          -0.949169088, -0.923037745, -0.89701166, -0.871037444, -0.845138744, -0.819313419,
+          -0.793559399, -0.767874681, -0.742257328, -0.716705467, -0.691243956,
+          -4.381911646, -4.31336951, -4.245839055, -4.179375776, -4.113904653, -4.049507378,
+          -3.986137149, -3.923758072, -3.862404066, -3.802041843, -3.742701615, -3.684329433,
+          -3.626917963, -3.570494275, -3.51498993, -3.460429688, -3.406776968, -3.354053518,
+          -3.30220041, -3.25120694, -3.201092865, -3.151787157, -3.103308245, -3.055618431,
+          -3.00873403, -2.962584533, -2.91718551, -2.872500057, -2.828542189, -2.785242514,
+          -2.742614829, -2.700623652, -2.659281762, -2.61852134, -2.578355408, -2.538767488,
+          -2.499718872, -2.461194788, -2.423191274, -2.385694455, -2.348658869, -2.312091771,
+          -2.275964222, -2.240290394, -2.205006454, -2.170121912, -2.135627624, -2.10149819,
+          -2.067748858, -2.034319158, -2.001220343, -1.968445087, -1.93597134, -1.903792885,
+          -1.871921121, -1.840300059, -1.80894269, -1.777843756, -1.746984908, -1.716380179,
+          -1.685983796, -1.655810575, -1.625844364, -1.596081887, -1.566515959, -1.537162366,
+          -1.507968561, -1.478951561, -1.450105324, -1.421427636, -1.392926093, -1.364557739,
+          -1.336338428, -1.30826327, -1.280327575, -1.252530071, -1.224859905, -1.197337596,
+          -1.169915863, -1.142612811, -1.115424998, -1.088348374, -1.061379776, -1.034515917,
+          -1.007776728, -0.981112386, -0.95454364, -0.928067655, -0.901681696, -0.875383123,
+          -0.849169391, -0.823038041, -0.797011949, -0.771037725, -0.745139019, -0.719313687,
+          -0.69355966, -0.667874935, -0.642257576, -0.616705708, -0.591244192,
+          -4.281913279, -4.213371296, -4.145840999, -4.07937788, -4.013906918, -3.949509807,
+          -3.886139738, -3.823760819, -3.762406966, -3.702044889, -3.642704801, -3.584332747,
+          -3.526921395, -3.470497814, -3.414993562, -3.360433397, -3.30678074, -3.254057339,
+          -3.202204262, -3.151210808, -3.101096734, -3.051791011, -3.003312069, -2.955622211,
+          -2.908737755, -2.862588189, -2.817189085, -2.772503542, -2.728545578, -2.685245797,
+          -2.642618001, -2.600626708, -2.5592847, -2.518524157, -2.478358102, -2.438770062,
+          -2.399721324, -2.361197121, -2.32319349, -2.285696559, -2.248660864, -2.212093661,
+          -2.175966012, -2.140292091, -2.105008061, -2.070123433, -2.035629066, -2.001499557,
+          -1.967750157, -1.934320393, -1.901221517, -1.868446206, -1.835972407, -1.803793904,
+          -1.771922098, -1.740300995, -1.708943588, -1.677844618, -1.646985738, -1.61638098,
+          -1.585984569, -1.555811321, -1.525845085, -1.496082584, -1.466516634, -1.43716302,
+          -1.407969196, -1.378952176, -1.350105921, -1.321428216, -1.292926657, -1.264558287,
+          -1.23633896, -1.208263787, -1.180328078, -1.15253056, -1.124860381, -1.09733806,
+          -1.069916314, -1.04261325, -1.01542548, -0.988348843, -0.961380233, -0.934516362,
+          -0.907777162, -0.881112809, -0.854544052, -0.828068057, -0.801682087, -0.775383504,
+          -0.749169762, -0.723038402, -0.697012302, -0.67103807, -0.645139354, -0.619314014,
+          -0.593559978, -0.567875245, -0.542257878, -0.516706003, -0.491244482,
+          -4.181915274, -4.113373478, -4.045843372, -3.97938045, -3.913909686, -3.849512773,
+          -3.786142901, -3.723764175, -3.662410509, -3.602048611, -3.542708693, -3.484336796,
+          -3.426925588, -3.370502136, -3.314997997, -3.260437927, -3.206785347, -3.154062005,
+          -3.102208967, -3.051215532, -3.00110146, -2.951795718, -2.90331674, -2.855626828,
+          -2.808742304, -2.762592653, -2.717193452, -2.672507799, -2.628549717, -2.585249807,
+          -2.542621875, -2.500630441, -2.459288289, -2.418527597, -2.378361393, -2.338773205,
+          -2.299724319, -2.26119997, -2.223196197, -2.18569913, -2.148663301, -2.11209597,
+          -2.075968198, -2.040294163, -2.005010022, -1.970125291, -1.935630827, -1.901501227,
+          -1.867751744, -1.8343219, -1.801222952, -1.768447572, -1.735973711, -1.70379515,
+          -1.671923291, -1.640302138, -1.608944685, -1.577845672, -1.546986752, -1.516381958,
+          -1.485985512, -1.455812231, -1.425845965, -1.396083435, -1.366517458, -1.33716382,
+          -1.307969971, -1.278952928, -1.25010665, -1.221428924, -1.192927346, -1.164558956,
+          -1.136339611, -1.108264419, -1.080328692, -1.052531158, -1.024860962, -0.997338626,
+          -0.969916865, -0.942613786, -0.915426069, -0.888349416, -0.861380791, -0.834516906,
+          -0.807777693, -0.781113325, -0.754544555, -0.728068546, -0.701682564, -0.675383969,
+          -0.649170215, -0.623038843, -0.597012734, -0.57103849, -0.545139764, -0.519314413,
+          -0.493560368, -0.467875625, -0.442258248, -0.416706364, -0.391244835,
+          -4.08191771, -4.013376143, -3.945846271, -3.879383589, -3.813913066, -3.749516396,
+          -3.686146765, -3.623768273, -3.562414835, -3.502053156, -3.442713445, -3.384341741,
+          -3.326930709, -3.270507416, -3.215003413, -3.16044346, -3.106790974, -3.054067704,
+          -3.002214713, -2.951221301, -2.901107231, -2.851801467, -2.803322444, -2.755632467,
+          -2.70874786, -2.662598106, -2.617198785, -2.572512999, -2.528554772, -2.485254705,
+          -2.442626607, -2.400634999, -2.359292672, -2.318531799, -2.278365412, -2.238777044,
+          -2.199727977, -2.161203451, -2.123199503, -2.085702269, -2.048666277, -2.01209879,
+          -1.975970869, -1.940296693, -1.905012419, -1.870127561, -1.835632978, -1.801503267,
+          -1.767753682, -1.734323742, -1.701224704, -1.668449241, -1.635975303, -1.603796671,
+          -1.571924748, -1.540303534, -1.508946024, -1.477846959, -1.44698799, -1.416383152,
+          -1.385986664, -1.355813343, -1.325847039, -1.296084475, -1.266518465, -1.237164797,
+          -1.207970917, -1.178953846, -1.150107541, -1.121429789, -1.092928187, -1.064559774,
+          -1.036340405, -1.008265192, -0.980329443, -0.952531888, -0.924861672, -0.897339318,
+          -0.869917539, -0.842614442, -0.815426789, -0.788350117, -0.761381473, -0.734517569,
+          -0.707778341, -0.681113956, -0.65454517, -0.628069145, -0.601683147, -0.575384536,
+          -0.549170768, -0.523039382, -0.497013261, -0.471039004, -0.445140264, -0.419314901,
+          -0.393560843, -0.367876088, -0.3422587, -0.316706804, -0.291245266,
+          -3.981920685, -3.913379397, -3.845849813, -3.779387423, -3.713917195, -3.64952082,
+          -3.586151483, -3.523773279, -3.46242012, -3.402058707, -3.34271925, -3.284347781,
+          -3.226936963, -3.170513864, -3.115010029, -3.060450218, -3.006797846, -2.954074665,
+          -2.902221731, -2.851228348, -2.801114281, -2.751808489, -2.703329411, -2.655639354,
+          -2.608754645, -2.562604766, -2.5172053, -2.472519349, -2.428560946, -2.385260687,
+          -2.342632386, -2.300640567, -2.259298025, -2.218536931, -2.178370322, -2.138781733,
+          -2.099732445, -2.061207701, -2.023203541, -1.985706104, -1.948669913, -1.912102235,
+          -1.875974131, -1.840299784, -1.805015345, -1.770130333, -1.735635605, -1.701505758,
+          -1.667756049, -1.634325991, -1.601226843, -1.56845128, -1.535977248, -1.503798529,
+          -1.471926527, -1.440305239, -1.40894766, -1.377848531, -1.346989503, -1.316384611,
+          -1.285988071, -1.255814702, -1.225848352, -1.196085745, -1.166519694, -1.137165989,
+          -1.107972074, -1.078954967, -1.050108629, -1.021430845, -0.992929215, -0.964560772,
+          -0.936341375, -0.908266135, -0.88033036, -0.852532779, -0.824862539, -0.797340164,
+          -0.769918361, -0.742615242, -0.715427668, -0.688350972, -0.661382305, -0.63451838,
+          -0.607779132, -0.581114727, -0.55454592, -0.528069876, -0.501683858, -0.47538523,
+          -0.449171443, -0.42304004, -0.397013905, -0.371039631, -0.345140875, -0.319315496,
+          -0.293561423, -0.267876654, -0.242259251, -0.216707342, -0.191245793,
+          -3.88192432, -3.813383372, -3.745854138, -3.679392106, -3.613922237, -3.549526225,
+          -3.486157246, -3.423779393, -3.362426574, -3.302065487, -3.24272634, -3.184355157,
+          -3.126944602, -3.070521739, -3.01501811, -2.960458472, -2.90680624, -2.854083166,
+          -2.802230303, -2.751236955, -2.701122891, -2.651817065, -2.603337921, -2.555647766,
+          -2.508762934, -2.4626129, -2.417213256, -2.372527106, -2.328568488, -2.285267993,
+          -2.242639444, -2.200647368, -2.159304564, -2.118543199, -2.078376317, -2.03878746,
+          -1.999737903, -1.961212893, -1.923208474, -1.885710788, -1.848674353, -1.812106441,
+          -1.775978114, -1.740303559, -1.70501892, -1.670133719, -1.635638813, -1.601508801,
+          -1.56775894, -1.534328738, -1.501229457, -1.46845377, -1.435979623, -1.403800798,
+          -1.3719287, -1.340307321, -1.308949658, -1.277850451, -1.24699135, -1.216386393,
+          -1.185989789, -1.155816361, -1.125849956, -1.096087296, -1.066521195, -1.037167446,
+          -1.007973486, -0.978956337, -0.950109958, -0.921432135, -0.89293047, -0.864561992,
+          -0.83634256, -0.808267286, -0.780331479, -0.752533868, -0.724863598, -0.697341197,
+          -0.669919366, -0.642616219, -0.615428741, -0.588352016, -0.561383322, -0.534519369,
+          -0.507780099, -0.481115668, -0.454546837, -0.428070768, -0.401684728, -0.375386077,
+          -0.349172268, -0.323040844, -0.297014691, -0.271040397, -0.245141622, -0.219316224,
+          -0.193562132, -0.167877345, -0.142259925, -0.116707998, -0.091246436,
+          -3.781928759, -3.713388228, -3.64585942, -3.579397825, -3.513928396, -3.449532825,
+          -3.386164285, -3.323786861, -3.262434458, -3.202073769, -3.142734999, -3.084364167,
+          -3.026953932, -2.970531358, -2.91502798, -2.860468554, -2.806816492, -2.75409355,
+          -2.702240773, -2.651247467, -2.601133407, -2.551827539, -2.503348314, -2.45565804,
+          -2.408773057, -2.362622835, -2.317222973, -2.272536579, -2.228577698, -2.185276917,
+          -2.142648066, -2.100655674, -2.05931255, -2.018550855, -1.978383641, -1.938794455,
+          -1.899744568, -1.861219234, -1.823214498, -1.785716508, -1.748679776, -1.712111579,
+          -1.67598298, -1.64030817, -1.605023286, -1.570137854, -1.535642732, -1.501512517,
+          -1.467762472, -1.434332094, -1.401232649, -1.368456811, -1.335982524, -1.303803569,
+          -1.271931355, -1.240309865, -1.208952099, -1.177852796, -1.146993606, -1.116388569,
+          -1.085991888, -1.055818387, -1.025851914, -0.99608919, -0.966523029, -0.937169225,
+          -0.90797521, -0.87895801, -0.850111581, -0.821433711, -0.792932003, -0.764563481,
+          -0.736344007, -0.708268693, -0.680332847, -0.652535198, -0.624864892, -0.597342458,
+          -0.569920593, -0.542617413, -0.515430052, -0.488353292, -0.461384564, -0.434520578,
+          -0.40778128, -0.381116818, -0.354547956, -0.328071859, -0.30168579, -0.275387111,
+          -0.249173276, -0.223041825, -0.197015651, -0.171041333, -0.145142534, -0.119317112,
+          -0.093562998, -0.067878189, -0.042260747, -0.0167088, 0.008752778,
+          -3.681934181, -3.613394158, -3.545865872, -3.47940481, -3.413935918, -3.349540887,
+          -3.286172882, -3.223795981, -3.162444086, -3.102083883, -3.042745575, -2.984375171,
+          -2.926965327, -2.870543107, -2.815040034, -2.760480866, -2.706829013, -2.654106232,
+          -2.60225356, -2.551260307, -2.50114625, -2.451840332, -2.403361008, -2.355670588,
+          -2.30878542, -2.26263497, -2.217234842, -2.17254815, -2.128588947, -2.085287816,
+          -2.042658595, -2.000665818, -1.959322304, -1.918560206, -1.878392585, -1.838802999,
+          -1.799752709, -1.761226979, -1.723221856, -1.685723495, -1.6486864, -1.612117855,
+          -1.575988923, -1.540313802, -1.505028619, -1.470142905, -1.435647519, -1.401517057,
+          -1.367766784, -1.334336192, -1.301236548, -1.268460525, -1.235986067, -1.203806954,
+          -1.171934597, -1.140312971, -1.108955079, -1.07785566, -1.046996362, -1.016391227,
+          -0.985994451, -0.955820862, -0.925854306, -0.896091504, -0.866525269, -0.837171398,
+          -0.807977317, -0.778960053, -0.750113564, -0.721435635, -0.692933876, -0.6645653,
+          -0.636345775, -0.608270411, -0.580334517, -0.552536822, -0.524866471, -0.497343998,
+          -0.469922092, -0.442618872, -0.415431653, -0.38835485, -0.361386081, -0.334522055,
+          -0.307782722, -0.281118222, -0.254549323, -0.22807319, -0.201687087, -0.175388374,
+          -0.149174506, -0.123043024, -0.097016824, -0.071042475, -0.045143647, -0.019318197,
+          0.006435944, 0.032120781, 0.057738248, 0.083290221, 0.108751818,
+          -3.581940802, -3.513401401, -3.445873752, -3.379413342, -3.313945105, -3.249550734,
+          -3.186183383, -3.123807121, -3.062455846, -3.002096237, -2.942758493, -2.884388612,
+          -2.826979244, -2.770557456, -2.715054756, -2.660495905, -2.606844306, -2.554121721,
+          -2.502269177, -2.451275988, -2.401161937, -2.351855957, -2.303376512, -2.255685913,
+          -2.208800521, -2.16264979, -2.117249338, -2.072562281, -2.028602687, -1.985301127,
+          -1.942671455, -1.900678208, -1.859334216, -1.818571626, -1.778403509, -1.738813434,
+          -1.699762652, -1.661236438, -1.623230842, -1.585732029, -1.54869449, -1.51212552,
+          -1.475996182, -1.440320681, -1.405035132, -1.370149074, -1.335653365, -1.301522601,
+          -1.267772052, -1.234341198, -1.20124131, -1.168465062, -1.135990395, -1.103811088,
+          -1.071938557, -1.040316765, -1.00895872, -0.977859158, -0.946999727, -0.916394473,
+          -0.885997582, -0.855823885, -0.825857227, -0.796094329, -0.766528004, -0.737174053,
+          -0.70797989, -0.678962548, -0.650115985, -0.621437986, -0.592936163, -0.564567522,
+          -0.536347934, -0.50827251, -0.480336558, -0.452538806, -0.424868401, -0.397345879,
+          -0.369923922, -0.342620652, -0.315433608, -0.288356754, -0.261387933, -0.234523858,
+          -0.207784483, -0.181119937, -0.154550993, -0.128074816, -0.101688671, -0.075389917,
+          -0.049176009, -0.023044488, 0.002981744, 0.028956129, 0.054854993, 0.080680477,
+          0.106434653, 0.132119522, 0.157737021, 0.183289024, 0.208750645,
+          -3.48194889, -3.413410247, -3.345883377, -3.279423763, -3.213956326, -3.14956276,
+          -3.086196207, -3.023820726, -2.962470209, -2.902111325, -2.842774269, -2.784405027,
+          -2.726996243, -2.67057498, -2.615072737, -2.560514272, -2.506862984, -2.454140638,
+          -2.402288251, -2.35129514, -2.301181095, -2.25187504, -2.203395447, -2.155704631,
+          -2.108818963, -2.06266789, -2.017267042, -1.972579541, -1.928619467, -1.885317386,
+          -1.842687162, -1.800693341, -1.759348766, -1.718585575, -1.678416852, -1.638826178,
+          -1.599774796, -1.561247991, -1.523241818, -1.485742451, -1.448704372, -1.412134882,
+          -1.376005048, -1.340329082, -1.305043087, -1.270156609, -1.235660506, -1.201529373,
+          -1.167778486, -1.134347311, -1.101247127, -1.068470602, -1.03599568, -1.003816138,
+          -0.971943393, -0.940321399, -0.908963166, -0.87786343, -0.847003838, -0.816398438,
+          -0.786001406, -0.755827577, -0.725860795, -0.696097781, -0.666531345, -0.637177294,
+          -0.607983032, -0.578965596, -0.550118942, -0.521440857, -0.492938956, -0.464570235,
+          -0.436350571, -0.408275072, -0.380339049, -0.352541229, -0.324870757, -0.297348177,
+          -0.269926157, -0.242622828, -0.215435996, -0.188359078, -0.161390196, -0.134526061,
+          -0.107786634, -0.081122031, -0.054553033, -0.028076802, -0.001690605, 0.024608199,
+          0.050822155, 0.076953723, 0.102979995, 0.128954425, 0.154853332, 0.180678859, 0.206433075,
+          0.232117984, 0.257735522, 0.283287563, 0.308749214,
+          -3.381958769, -3.313421052, -3.245895132, -3.17943649, -3.113970032, -3.049577448,
+          -2.986211871, -2.923837343, -2.862487751, -2.802129752, -2.742793538, -2.684425075,
+          -2.627017003, -2.570596384, -2.515094698, -2.460536704, -2.406885796, -2.354163743,
+          -2.302311547, -2.25131853, -2.201204494, -2.151898347, -2.103418573, -2.055727491,
+          -2.008841487, -1.962689996, -1.917288664, -1.87260062, -1.828639962, -1.785337242,
+          -1.742706345, -1.700711823, -1.659366536, -1.618602611, -1.578433147, -1.538841744,
+          -1.499789629, -1.461262102, -1.423255223, -1.385755181, -1.34871644, -1.312146316,
+          -1.276015876, -1.240339343, -1.205052803, -1.170165812, -1.135669227, -1.101537643,
+          -1.067786344, -1.034354778, -1.00125423, -0.96847737, -0.936002136, -0.903822305,
+          -0.8719493, -0.840327059, -0.808968596, -0.777868648, -0.747008858, -0.71640328,
+          -0.686006076, -0.655832086, -0.625865153, -0.596101996, -0.566535426, -0.537181253,
+          -0.50798687, -0.478969318, -0.450122554, -0.421444363, -0.392942368, -0.36457355,
+          -0.336353791, -0.308278203, -0.280342092, -0.252544188, -0.224873635, -0.197350983,
+          -0.169928887, -0.142625484, -0.115438913, -0.088361916, -0.061392959, -0.034528751,
+          -0.00778926, 0.018875411, 0.045444477, 0.071920772, 0.098307032, 0.124605897, 0.150819914,
+          0.176951539, 0.202977858, 0.228952343, 0.254851304, 0.280676882, 0.306431149, 0.332116106,
+          0.357733692, 0.383285779, 0.408747465,
+          -3.281970834, -3.213434248, -3.14590949, -3.079452034, -3.01398677, -2.949595388,
+          -2.886231001, -2.823857637, -2.762509176, -2.702152258, -2.642817071, -2.58444956,
+          -2.527042358, -2.470622525, -2.415121519, -2.3605641, -2.306913656, -2.25419196,
+          -2.202339998, -2.151347097, -2.101233071, -2.051926811, -2.003446817, -1.955755411,
+          -1.908868996, -1.862716995, -1.817315072, -1.772626365, -1.728664992, -1.685361493,
+          -1.642729774, -1.600734395, -1.559388239, -1.518623417, -1.47845305, -1.438860755,
+          -1.399807744, -1.361279335, -1.323271596, -1.285770729, -1.24873118, -1.212160281,
+          -1.176029101, -1.140351876, -1.10506467, -1.070177052, -1.035679879, -1.001547745,
+          -0.967795942, -0.934363898, -0.901262906, -0.868485635, -0.83601002, -0.803829837,
+          -0.771956515, -0.740333971, -0.708975229, -0.677875021, -0.647014989, -0.616409195,
+          -0.58601178, -0.555837593, -0.525870475, -0.496107144, -0.466540409, -0.437186089,
+          -0.407991557, -0.378973864, -0.350126965, -0.321448645, -0.292946534, -0.264577597,
+          -0.236357724, -0.208282026, -0.180345809, -0.152547802, -0.12487715, -0.097354411,
+          -0.069932222, -0.042628729, -0.015440241, 0.011634617, 0.038603667, 0.065467965,
+          0.092207532, 0.118872288, 0.145441435, 0.17191781, 0.198304147, 0.224603087, 0.250817176,
+          0.276948872, 0.302975249, 0.328949801, 0.354848826, 0.380674468, 0.406428796, 0.432113813,
+          0.457731457, 0.4832836, 0.50874533,
+          -3.181985569, -3.113450365, -3.045927025, -2.979471019, -2.914007214, -2.849617298,
+          -2.786254366, -2.723882424, -2.662535342, -2.602179745, -2.542845812, -2.484479464,
+          -2.427073324, -2.37065445, -2.315154275, -2.260597559, -2.206947681, -2.154226421,
+          -2.102374744, -2.051381985, -2.001267971, -1.951961574, -1.90348131, -1.855789508,
+          -1.808902592, -1.762749968, -1.717347323, -1.672657806, -1.62869556, -1.58539111,
+          -1.542758387, -1.500761963, -1.459414745, -1.418648827, -1.378477357, -1.338883973,
+          -1.299829868, -1.261300383, -1.223291593, -1.185789717, -1.148749182, -1.112177337,
+          -1.076045253, -1.040367182, -1.005079164, -0.970190779, -0.935692888, -0.901560082,
+          -0.867807664, -0.834375036, -0.801273503, -0.768495729, -0.73601965, -0.703839036,
+          -0.671965326, -0.640342413, -0.608983329, -0.577882804, -0.547022478, -0.516416418,
+          -0.486018746, -0.455844319, -0.425876975, -0.396113431, -0.366546496, -0.337191994,
+          -0.307997281, -0.278979416, -0.250132353, -0.221453875, -0.192951623, -0.16458254,
+          -0.136362528, -0.108286694, -0.080350348, -0.052552216, -0.024881443, 0.002641404,
+          0.030063706, 0.057367309, 0.084555903, 0.111630383, 0.138599546, 0.165463953, 0.192203614,
+          0.218868473, 0.24543772, 0.271914192, 0.298300624, 0.324599655, 0.350813832, 0.376945615,
+          0.402972063, 0.428946696, 0.454845801, 0.480671519, 0.506425922, 0.532111013, 0.557728727,
+          0.583280939, 0.608742722,
+          -3.082003567, -3.01347005, -2.945948441, -2.879494206, -2.814032182, -2.749644057,
+          -2.686282901, -2.623912695, -2.562567299, -2.502213315, -2.442880913, -2.384515985,
+          -2.327111142, -2.270693439, -2.215194279, -2.16063842, -2.106989234, -2.054268507,
+          -2.002417179, -1.951424592, -1.901310593, -1.852004028, -1.803523435, -1.755831149,
+          -1.708943621, -1.662790236, -1.61738671, -1.572696204, -1.528732893, -1.485427281,
+          -1.442793332, -1.40079563, -1.359447117, -1.318679861, -1.278507043, -1.238912329,
+          -1.199856889, -1.16132609, -1.123316015, -1.085812909, -1.048771169, -1.012198168,
+          -0.97606498, -0.940385876, -0.905096865, -0.870207546, -0.835708777, -0.80157515,
+          -0.767821981, -0.73438864, -0.701286445, -0.668508058, -0.636031411, -0.603850272,
+          -0.571976087, -0.540352723, -0.508993222, -0.47789231, -0.447031623, -0.416425239,
+          -0.386027254, -0.355852533, -0.325884914, -0.29612111, -0.266553929, -0.237199206,
+          -0.208004272, -0.178986196, -0.150138932, -0.121460262, -0.092957837, -0.064588577,
+          -0.036368394, -0.008292396, 0.019644109, 0.047442394, 0.075113314, 0.102636292,
+          0.130058733, 0.15736247, 0.184551194, 0.211625213, 0.238594514, 0.265459054, 0.29219883,
+          0.318863814, 0.345433184, 0.371909774, 0.398296321, 0.424595463, 0.450809749, 0.476941637,
+          0.502968172, 0.528942905, 0.554842107, 0.580667919, 0.606422413, 0.632107592, 0.657725393,
+          0.68327769, 0.708739537,
+          -2.982025547, -2.913494091, -2.845974598, -2.779522524, -2.714062675, -2.649676738,
+          -2.586317751, -2.523949665, -2.462606327, -2.402254312, -2.342923781, -2.284560586,
+          -2.227157327, -2.170741055, -2.115243132, -2.060688322, -2.00703998, -1.954319904,
+          -1.902469, -1.851476625, -1.801362643, -1.752055874, -1.703574879, -1.655882002,
+          -1.608993727, -1.562839412, -1.51743481, -1.472743096, -1.428778485, -1.385471454,
+          -1.342836008, -1.300836747, -1.25948665, -1.218717762, -1.178543298, -1.13894696,
+          -1.099889889, -1.061357484, -1.023345841, -0.985841232, -0.948798022, -0.912223609,
+          -0.876089073, -0.840408708, -0.805118485, -0.770228023, -0.735728183, -0.701593553,
+          -0.667839466, -0.634405254, -0.601302251, -0.568523115, -0.536045774, -0.503863993,
+          -0.471989229, -0.440365315, -0.409005304, -0.377903919, -0.347042792, -0.316436012,
+          -0.286037644, -0.255862565, -0.225894608, -0.196130487, -0.166563006, -0.137208014,
+          -0.10801281, -0.078994476, -0.050146967, -0.021468062, 0.007034573, 0.03540405,
+          0.063624442, 0.09170064, 0.119637339, 0.14743581, 0.175106912, 0.202630049, 0.230052659,
+          0.25735656, 0.284545443, 0.3116189, 0.338588368, 0.365453071, 0.392192987, 0.418858126,
+          0.445427644, 0.471904379, 0.498291066, 0.524590345, 0.550804763, 0.576936779, 0.602963421,
+          0.628938275, 0.654837595, 0.680663522, 0.706418128, 0.732103416, 0.757721322, 0.783273721,
+          0.808735648,
+          -2.882052392, -2.813523453, -2.746006542, -2.679557108, -2.614099916, -2.549716649,
+          -2.486360311, -2.423994815, -2.36265399, -2.302304379, -2.242976131, -2.184615054,
+          -2.127213728, -2.070799203, -2.015302793, -1.960749261, -1.90710195, -1.854382668,
+          -1.802532283, -1.751540165, -1.701426206, -1.652119186, -1.603637701, -1.555944102,
+          -1.509054914, -1.462899465, -1.41749355, -1.372800361, -1.328834161, -1.285525398,
+          -1.242888124, -1.200886959, -1.15953493, -1.118764047, -1.078587574, -1.038989253,
+          -0.999930191, -0.961395826, -0.923382268, -0.885875824, -0.848830817, -0.81225468,
+          -0.776118499, -0.740436593, -0.705144888, -0.670253032, -0.635751883, -0.601616029,
+          -0.56786082, -0.534425545, -0.501321555, -0.468541505, -0.436063316, -0.403880751,
+          -0.37200528, -0.340380693, -0.309020059, -0.277918096, -0.247056432, -0.216449169,
+          -0.186050333, -0.155874816, -0.125906447, -0.096141939, -0.066574092, -0.03721877,
+          -0.008023236, 0.020995412, 0.049843221, 0.078522412, 0.107025305, 0.135395047,
+          0.163615693, 0.191692137, 0.219629072, 0.247427771, 0.275099093, 0.302622425, 0.330045242,
+          0.357349343, 0.384538419, 0.41161119, 0.438580864, 0.465445766, 0.492185853, 0.518851179,
+          0.54542088, 0.571897791, 0.59828465, 0.624584095, 0.650798675, 0.676930848, 0.702957619,
+          0.728932622, 0.754832086, 0.780658154, 0.806412896, 0.832098316, 0.857716351, 0.883268876,
+          0.908730899,
+          -2.782085178, -2.713559312, -2.646045555, -2.579599345, -2.514145397, -2.449765391,
+          -2.386412287, -2.324049952, -2.262712195, -2.20236552, -2.143040061, -2.084681568,
+          -2.027282604, -1.97087021, -1.915375647, -1.860823677, -1.807177624, -1.754459311,
+          -1.70260956, -1.651617757, -1.601503823, -1.552196498, -1.503714414, -1.456019934,
+          -1.409129632, -1.362972797, -1.317565278, -1.272870289, -1.22890215, -1.185591273,
+          -1.142951767, -1.100948277, -1.059593888, -1.018820571, -0.978641644, -0.939040902,
+          -0.899979408, -0.86144265, -0.823426754, -0.785918069, -0.748870868, -0.712292627,
+          -0.676154435, -0.640470648, -0.605177135, -0.570283575, -0.535780828, -0.501643478,
+          -0.4678869, -0.434450326, -0.40134513, -0.368563963, -0.336084739, -0.303901217,
+          -0.272024881, -0.240399473, -0.209038078, -0.177935409, -0.147073089, -0.116465236,
+          -0.086065828, -0.055889776, -0.025920905, 0.003844077, 0.03341237, 0.062768096,
+          0.091964032, 0.120983063, 0.149831239, 0.17851078, 0.207013988, 0.235384052, 0.263605009,
+          0.291681752, 0.319618976, 0.347417954, 0.375089545, 0.402613115, 0.430036185, 0.45734053,
+          0.484529843, 0.511601777, 0.538571701, 0.565436846, 0.592177142, 0.618842697, 0.64541262,
+          0.671889747, 0.698276815, 0.724576464, 0.750791241, 0.776923605, 0.802950534, 0.828925719,
+          0.854825359, 0.880651598, 0.906406507, 0.932092089, 0.957710282, 0.983262959, 1.008725101,
+          -2.682125219, -2.613603105, -2.5460932, -2.479650926, -2.414200938, -2.349824915,
+          -2.28647576, -2.224117285, -2.162783274, -2.102440183, -2.043118129, -1.984762791,
+          -1.927366708, -1.870956918, -1.815464608, -1.760914545, -1.707270027, -1.654552898,
+          -1.60270392, -1.5517125, -1.501598599, -1.452290901, -1.403808085, -1.35611253,
+          -1.309220868, -1.263062341, -1.217652864, -1.172955678, -1.128985171, -1.085671712,
+          -1.043029481, -1.001023154, -0.959665884, -0.918889594, -0.878707672, -0.839103975,
+          -0.800039511, -0.761499831, -0.72348108, -0.685969659, -0.64891978, -0.612338969,
+          -0.576198322, -0.540512238, -0.505216517, -0.470320876, -0.435816177, -0.401677001,
+          -0.36791875, -0.33448059, -0.301373921, -0.268591389, -0.236110901, -0.203926209,
+          -0.172048818, -0.140422407, -0.109060082, -0.077956552, -0.04709343, -0.016484855,
+          0.013915251, 0.044091956, 0.074061441, 0.103827001, 0.13339584, 0.162752057, 0.191948486,
+          0.220967985, 0.249816608, 0.278496576, 0.307000167, 0.335370627, 0.363591963, 0.391669072,
+          0.419606648, 0.447405966, 0.475077886, 0.502601747, 0.530025125, 0.557329768, 0.58451937,
+          0.611590284, 0.638560514, 0.665425955, 0.692166506, 0.718832341, 0.745402535, 0.771879926,
+          0.798267249, 0.824567146, 0.850782164, 0.876914763, 0.902941884, 0.928917291, 0.954817146,
+          0.980643595, 1.006398707, 1.032084487, 1.057702871, 1.083255735, 1.108718021,
+          -2.582174117, -2.513656587, -2.446151383, -2.379713917, -2.314268765, -2.249897603,
+          -2.186553269, -2.124199506, -2.062870069, -2.002531354, -1.943213455, -1.884861969,
+          -1.827469405, -1.771062792, -1.715573233, -1.661025496, -1.607382853, -1.554667168,
+          -1.502819133, -1.451828181, -1.401714319, -1.352406165, -1.303922456, -1.256225588,
+          -1.209332265, -1.163171674, -1.117759807, -1.073059938, -1.029086542, -0.985769931,
+          -0.943124374, -0.901114583, -0.859753796, -0.818973878, -0.778788299, -0.739180994,
+          -0.700112906, -0.661569659, -0.623547422, -0.58603266, -0.548979512, -0.512395562,
+          -0.476251918, -0.440563028, -0.40526461, -0.370366429, -0.335859346, -0.301717939,
+          -0.267957647, -0.234517549, -0.201409081, -0.168624882, -0.13614285, -0.103956729,
+          -0.072078049, -0.040450413, -0.009086952, 0.022017631, 0.052881731, 0.083491188,
+          0.113892146, 0.144069649, 0.174039883, 0.203806149, 0.233375655, 0.262732473, 0.291929502,
+          0.320949573, 0.349798742, 0.378479233, 0.406983293, 0.435354234, 0.463576034, 0.491653589,
+          0.519591596, 0.547391329, 0.57506365, 0.602587866, 0.63001162, 0.657316628, 0.684506583,
+          0.711576252, 0.738546856, 0.765412659, 0.792153522, 0.818819698, 0.845390224, 0.871867936,
+          0.898255571, 0.924555771, 0.950771083, 0.976903967, 1.002931324, 1.028907001, 1.05480712,
+          1.080633823, 1.106389184, 1.132075205, 1.157693824, 1.183246916, 1.208709378,
+          -2.482233833, -2.413721898, -2.346222435, -2.279790837, -2.214351589, -2.149986364,
+          -2.086647914, -2.024299904, -1.96297605, -1.902642676, -1.843329849, -1.784983065,
+          -1.727594794, -1.671192059, -1.615705857, -1.561160959, -1.507520603, -1.454806681,
+          -1.402959797, -1.351969416, -1.3018556, -1.25254689, -1.20406209, -1.15636362,
+          -1.10946827, -1.063305159, -1.017890375, -0.973187232, -0.929210308, -0.885889852,
+          -0.843240236, -0.801226216, -0.759861137, -0.71907679, -0.678886748, -0.639275039,
+          -0.600202527, -0.561654925, -0.523628434, -0.486109594, -0.449052452, -0.412464672,
+          -0.376317368, -0.340625053, -0.305323342, -0.270422058, -0.235912064, -0.201767933,
+          -0.168005146, -0.134562681, -0.101452016, -0.068665781, -0.036181864, -0.003993997,
+          0.027886258, 0.059515391, 0.090880238, 0.121986107, 0.152851403, 0.183461935, 0.213863936,
+          0.244042413, 0.274013563, 0.30378069, 0.33335101, 0.362708561, 0.391906324, 0.420927094,
+          0.44977693, 0.478458057, 0.50696269, 0.535334219, 0.563556585, 0.591634685, 0.619573217,
+          0.647373457, 0.675046269, 0.702570918, 0.729995132, 0.757300584, 0.78449097, 0.811559124,
+          0.838530183, 0.865396428, 0.892137671, 0.918804265, 0.945375194, 0.971853299, 0.998241315,
+          1.024541885, 1.050757556, 1.076890789, 1.102918434, 1.128894441, 1.15479488, 1.180621896,
+          1.206377559, 1.232063874, 1.25768278, 1.28323615, 1.308698828,
+          -2.382306756, -2.313801651, -2.246309198, -2.179884764, -2.114452723, -2.050094743,
+          -1.986763478, -1.92442249, -1.863105449, -1.802778594, -1.743471957, -1.68513091,
+          -1.627747879, -1.571349875, -1.51586777, -1.461326336, -1.407688771, -1.354976998,
+          -1.303131518, -1.252141832, -1.202028074, -1.152718684, -1.104232553, -1.056532127,
+          -1.009634304, -0.963468118, -0.918049773, -0.873342635, -0.829361408, -0.786036257,
+          -0.743381688, -0.701362509, -0.659992192, -0.61920244, -0.579006951, -0.539389866,
+          -0.500311955, -0.461759038, -0.423727353, -0.386203535, -0.34914152, -0.312549062,
+          -0.276397291, -0.240700793, -0.205395061, -0.170489989, -0.13597644, -0.101828982,
+          -0.068063148, -0.034617794, -0.001504445, 0.031284277, 0.063770498, 0.095960496,
+          0.127842675, 0.159473637, 0.190840178, 0.221947618, 0.252814375, 0.283426221, 0.313829493,
+          0.34400916, 0.373981428, 0.403749608, 0.433320922, 0.462679368, 0.491878027, 0.52089965,
+          0.549750299, 0.578432205, 0.606937536, 0.635309784, 0.663532841, 0.691611606, 0.71955078,
+          0.747351639, 0.775025048, 0.802550227, 0.829975002, 0.857280998, 0.884471909, 0.911538217,
+          0.938509832, 0.965376617, 0.992118325, 1.018785427, 1.04535685, 1.071835434, 1.098223915,
+          1.124524936, 1.150741045, 1.176874704, 1.2029027, 1.22887911, 1.254779941, 1.280607337,
+          1.30636337, 1.332050045, 1.3576693, 1.38322301, 1.40868595,
+          -2.282395802, -2.213899036, -2.14641514, -2.079999451, -2.014576207, -1.95022707,
+          -1.886904573, -1.824572154, -1.763263428, -1.702944527, -1.643645445, -1.585311398,
+          -1.527934759, -1.471542528, -1.41606542, -1.361528211, -1.30789405, -1.255184899,
+          -1.20334113, -1.152352292, -1.102238602, -1.052928383, -1.004440627, -0.956737814,
+          -0.909836973, -0.863667034, -0.818244347, -0.773532334, -0.729545856, -0.686214979,
+          -0.643554366, -0.601528892, -0.560152184, -0.519355838, -0.479153702, -0.439530059,
+          -0.400445559, -0.361886155, -0.323848132, -0.286318238, -0.249250274, -0.212652107,
+          -0.176494881, -0.140793278, -0.105482637, -0.070572939, -0.036055049, -0.001903528,
+          0.031866026, 0.065314911, 0.098431538, 0.131223297, 0.163712332, 0.195904935, 0.227789463,
+          0.259422658, 0.290791268, 0.321900627, 0.352769168, 0.383382619, 0.413787445, 0.443968566,
+          0.473942198, 0.503711664, 0.533284192, 0.562643732, 0.591843484, 0.620866147, 0.649717791,
+          0.678400647, 0.70690683, 0.735279955, 0.763503855, 0.791583433, 0.81952339, 0.847325004,
+          0.874999144, 0.902524969, 0.929950429, 0.957257087, 0.984448641, 1.011528642, 1.038484997,
+          1.065352439, 1.092094714, 1.118762437, 1.145334463, 1.171813631, 1.19820268, 1.224504252,
+          1.250720896, 1.276855073, 1.302883498, 1.3288604, 1.354761709, 1.38058957, 1.406346054,
+          1.432033168, 1.457652849, 1.483206974, 1.508670234,
+          -2.182504531, -2.114017944, -2.046544492, -1.980139476, -1.914726969, -1.850388624,
+          -1.787076826, -1.724754862, -1.663456282, -1.603147085, -1.543857218, -1.48553171,
+          -1.428162868, -1.371777678, -1.316306664, -1.261774608, -1.208144597, -1.155438642,
+          -1.103596959, -1.052609154, -1.002495546, -0.953184313, -0.904694575, -0.85698885,
+          -0.810084327, -0.763909812, -0.718481827, -0.673763868, -0.629770985, -0.586433124,
+          -0.543765139, -0.501731986, -0.460347482, -0.419543092, -0.379332848, -0.339701203,
+          -0.300608664, -0.262041345, -0.223995588, -0.18645828, -0.149383057, -0.112777922,
+          -0.076614038, -0.040906202, -0.005589568, 0.029325778, 0.063848968, 0.09800545,
+          0.131779549, 0.165232745, 0.198353376, 0.231148845, 0.263641317, 0.295837101, 0.3277245,
+          0.359360423, 0.390731561, 0.421843263, 0.452713983, 0.483329396, 0.513736118, 0.543919014,
+          0.573894314, 0.603665349, 0.633239358, 0.662600233, 0.69180132, 0.720825255, 0.749678111,
+          0.778362127, 0.806869352, 0.835243547, 0.863468476, 0.891549046, 0.919489959, 0.947292495,
+          0.974967526, 1.00249414, 1.029920435, 1.057227903, 1.08442024, 1.111501, 1.138454693,
+          1.165322939, 1.192065905, 1.218734386, 1.245307147, 1.271787029, 1.29817677, 1.324479014,
+          1.35069631, 1.376831122, 1.402860069, 1.428837572, 1.454739464, 1.480567891, 1.506324926,
+          1.532012575, 1.557632777, 1.583187407, 1.608651059,
+          -2.082637285, -2.014163122, -1.946702415, -1.880310423, -1.814911017, -1.750585839,
+          -1.687287094, -1.624977885, -1.563691681, -1.503394321, -1.444115691, -1.385800597,
+          -1.328441263, -1.272064657, -1.216601073, -1.162075298, -1.108450345, -1.055748286,
+          -1.003909145, -0.952922596, -0.902809086, -0.853496616, -0.805004459, -0.757295183,
+          -0.710386169, -0.664206073, -0.618771627, -0.574046418, -0.530045726, -0.486699347,
+          -0.444022374, -0.401979857, -0.360585847, -0.319771645, -0.279551513, -0.239910109,
+          -0.200807764, -0.162230791, -0.124175599, -0.086629245, -0.049545164, -0.012931525,
+          0.023240484, 0.058955927, 0.094279877, 0.129202118, 0.16373178, 0.19789432, 0.231673968,
+          0.26513243, 0.298257951, 0.331057952, 0.363554623, 0.395754292, 0.427645199, 0.459284455,
+          0.49065868, 0.521773245, 0.552646627, 0.583264434, 0.613673474, 0.643858537, 0.673835872,
+          0.703608823, 0.733184642, 0.762547147, 0.791749863, 0.820775349, 0.849629687, 0.878315117,
+          0.906823613, 0.935199114, 0.9634253, 0.991507079, 1.019449159, 1.047252821, 1.07492894,
+          1.102456517, 1.129883832, 1.157192287, 1.18438558, 1.211467267, 1.238417726, 1.265286951,
+          1.292030762, 1.318700167, 1.345273825, 1.371754576, 1.398145162, 1.424448226, 1.450666318,
+          1.476801903, 1.502831489, 1.528809723, 1.554712327, 1.580541445, 1.606299152, 1.631987454,
+          1.657608291, 1.683163538, 1.708627668,
+          -1.982799359, -1.914340356, -1.846895201, -1.7805191, -1.715135675, -1.65082656,
+          -1.587543735, -1.525250082, -1.463978969, -1.403696041, -1.344431113, -1.286128713,
+          -1.228780969, -1.172414825, -1.116960296, -1.062442175, -1.008823385, -0.95612607,
+          -0.904290023, -0.853305004, -0.80319161, -0.753877629, -0.705382522, -0.657668915,
+          -0.610754427, -0.564567527, -0.519125207, -0.47439116, -0.430380949, -0.387024188,
+          -0.344336257, -0.302282326, -0.260876727, -0.220050565, -0.179818377, -0.140165073,
+          -0.101050771, -0.062462025, -0.024395325, 0.013162063, 0.05025695, 0.086880963,
+          0.123062886, 0.158787613, 0.194120493, 0.229051151, 0.263588714, 0.297758651, 0.331545075,
+          0.365009968, 0.398141461, 0.430946998, 0.463448799, 0.495653215, 0.527548406, 0.559191733,
+          0.590569731, 0.621687793, 0.652564426, 0.683185158, 0.713597028, 0.743784737, 0.773764558,
+          0.803539849, 0.833117876, 0.862482371, 0.891687076, 0.920714455, 0.949570599, 0.978257757,
+          1.006767804, 1.035144899, 1.063372617, 1.091455873, 1.119399376, 1.147204411, 1.174881858,
+          1.202410609, 1.229839169, 1.257148829, 1.284343288, 1.311426106, 1.338400705, 1.365243062,
+          1.391987902, 1.418658434, 1.445233186, 1.471714999, 1.498106615, 1.524410678, 1.550629742,
+          1.576766269, 1.602796634, 1.628775761, 1.654679232, 1.680509194, 1.70626772, 1.731956818,
+          1.757578429, 1.783134429, 1.808599141,
+          -1.882997211, -1.814556704, -1.74713052, -1.680773801, -1.615409868, -1.551120339,
+          -1.487856927, -1.42558224, -1.364329522, -1.304064186, -1.244815956, -1.186529026,
+          -1.129195402, -1.072842004, -1.017398503, -0.962889703, -0.909278416, -0.856586877,
+          -0.804754595, -0.753771433, -0.703658177, -0.654342352, -0.605843647, -0.558124762,
+          -0.511203603, -0.465008412, -0.419556497, -0.374811683, -0.330789873, -0.287420464,
+          -0.244719183, -0.202651344, -0.161231623, -0.120390887, -0.080144006, -0.040476198,
+          -0.001347322, 0.037255777, 0.075336507, 0.11290735, 0.150015416, 0.186652084, 0.222846102,
+          0.258582156, 0.293925933, 0.328866864, 0.363414072, 0.397593041, 0.43138774, 0.464860487,
+          0.497999275, 0.530811574, 0.563319641, 0.595529857, 0.627430282, 0.659078584, 0.690461189,
+          0.721583523, 0.752464127, 0.783088432, 0.813503758, 0.843694699, 0.873677554, 0.903455701,
+          0.933036425, 0.962403347, 0.991610479, 1.020640169, 1.049498518, 1.078187783, 1.106699722,
+          1.135078761, 1.16330835, 1.191393406, 1.219338646, 1.247145356, 1.274824422, 1.302354606,
+          1.329784685, 1.357095814, 1.384291697, 1.411375893, 1.438351829, 1.465189553, 1.491935649,
+          1.518607556, 1.545183641, 1.571666747, 1.598059619, 1.624364902, 1.650585149, 1.676722826,
+          1.70275414, 1.728734356, 1.754638885, 1.780469875, 1.8062294, 1.831919469, 1.857542023,
+          1.883098942, 1.908564364,
+          -1.783238708, -1.714820761, -1.647417714, -1.58108463, -1.515744461, -1.451478809,
+          -1.388239058, -1.325987483, -1.264757182, -1.204513277, -1.145285387, -1.087017296,
+          -1.029700867, -0.973362987, -0.917932912, -0.863435455, -0.809833298, -0.757148784,
+          -0.705321079, -0.654340173, -0.604227078, -0.554909002, -0.506405911, -0.458680595,
+          -0.41175131, -0.365546023, -0.320082424, -0.275324498, -0.231288565, -0.187903754,
+          -0.145186215, -0.103101439, -0.06166452, -0.020806031, 0.019458747, 0.059144223,
+          0.098290858, 0.136911447, 0.175009276, 0.212596519, 0.249720653, 0.286372751, 0.322581521,
+          0.358331394, 0.393688466, 0.428641934, 0.463200915, 0.497390909, 0.531195712, 0.56467805,
+          0.59782575, 0.630646309, 0.66316203, 0.695379331, 0.727286152, 0.758940531, 0.790328766,
+          0.821456318, 0.852341774, 0.882970443, 0.913389989, 0.943584876, 0.973571436, 1.003353069,
+          1.032937083, 1.062306969, 1.091517062, 1.12054957, 1.149410608, 1.178102444, 1.20661669,
+          1.234998101, 1.263229971, 1.291317224, 1.319264581, 1.347073333, 1.374754375, 1.402286307,
+          1.429718237, 1.457031159, 1.484228778, 1.511314656, 1.538292221, 1.565164773, 1.591871969,
+          1.618545551, 1.645123261, 1.671607945, 1.698002347, 1.724309116, 1.750530805, 1.776669883,
+          1.802702355, 1.828683898, 1.854589717, 1.880421958, 1.906182701, 1.931873954, 1.957497658,
+          1.983055695, 2.008521983,
+          -1.683533437, -1.615142997, -1.547768157, -1.481463882, -1.416152677, -1.35191612,
+          -1.288705194, -1.226481772, -1.165278769, -1.105060959, -1.045857831, -0.987612671,
+          -0.930317166, -0.873998165, -0.81858442, -0.764100758, -0.710509701, -0.657833724,
+          -0.606011578, -0.555033405, -0.504920496, -0.455599672, -0.407091239, -0.359358091,
+          -0.312418914, -0.26620134, -0.220723521, -0.175949641, -0.131896522, -0.088492968,
+          -0.045755644, -0.003650257, 0.037807595, 0.078687692, 0.118974258, 0.158681246,
+          0.197849505, 0.236491396, 0.274610055, 0.312217282, 0.349360996, 0.386031904, 0.422258659,
+          0.458025384, 0.493398674, 0.528367438, 0.562940787, 0.59714424, 0.63096138, 0.664455431,
+          0.697614014, 0.730444663, 0.762969736, 0.795195695, 0.82711033, 0.858772135, 0.890167248,
+          0.921301176, 0.952192558, 0.982826557, 1.013251257, 1.043450961, 1.073442043, 1.103227931,
+          1.132815959, 1.162189462, 1.191403167, 1.220439113, 1.249303431, 1.2779984, 1.306515461,
+          1.334899763, 1.363134413, 1.391224344, 1.419174284, 1.446985526, 1.474668975, 1.502203039,
+          1.529637227, 1.556952334, 1.584152069, 1.611239998, 1.63821955, 1.665094028, 1.691842364,
+          1.718470026, 1.745049715, 1.77153632, 1.797932587, 1.824241165, 1.850464612, 1.876605396,
+          1.902639279, 1.928622438, 1.954529827, 1.980363595, 2.00612582, 2.031818514, 2.05744362,
+          2.083003018, 2.108470363,
+          -1.583893067, -1.515536155, -1.448195689, -1.381926516, -1.316650591, -1.252449467,
+          -1.18927364, -1.127084489, -1.065914709, -1.005728651, -0.946555645, -0.888338372,
+          -0.831068308, -0.774772257, -0.719378357, -0.664911454, -0.611333877, -0.558668264,
+          -0.506852859, -0.455877994, -0.405765297, -0.35644112, -0.30792618, -0.260183504,
+          -0.213232295, -0.166999777, -0.121504669, -0.076711389, -0.032637375, 0.010788969,
+          0.053550348, 0.095680801, 0.13716411, 0.178070489, 0.218383559, 0.25811672, 0.297311295,
+          0.335979114, 0.374123133, 0.411754693, 0.448922258, 0.485616083, 0.521864758, 0.557652027,
+          0.593045096, 0.628032519, 0.662623399, 0.696843279, 0.73067548, 0.764183835, 0.79735571,
+          0.830198686, 0.862735185, 0.894971721, 0.926895907, 0.958566784, 0.989970302, 1.021112019,
+          1.052010639, 1.082651151, 1.113082143, 1.143287729, 1.173284331, 1.20307541, 1.232668336,
+          1.262046249, 1.29126436, 1.320304497, 1.349172813, 1.377871602, 1.406392095, 1.434779921,
+          1.46301796, 1.491111154, 1.51906424, 1.546878517, 1.574564901, 1.602101563, 1.629538502,
+          1.656856272, 1.684058586, 1.711149013, 1.738130987, 1.765007813, 1.791758173, 1.818378085,
+          1.844960184, 1.871449128, 1.897847664, 1.924158446, 1.950384032, 1.976526893, 2.002562495,
+          2.028547622, 2.054456923, 2.080292548, 2.106056579, 2.131751027, 2.157377839, 2.182938896,
+          2.208407527,
+          -1.484331792, -1.416015729, -1.348717132, -1.282490702, -1.217257728, -1.15309973,
+          -1.089966609, -1.027819146, -0.966689769, -0.906542311, -0.847405915, -0.789222526,
+          -0.731983364, -0.675715181, -0.62034537, -0.565898803, -0.512337576, -0.459684525,
+          -0.407877284, -0.356906412, -0.306793952, -0.257465683, -0.208942826, -0.161188565,
+          -0.114222734, -0.067972061, -0.022455951, 0.022360893, 0.066460286, 0.109914311,
+          0.152704912, 0.194865815, 0.236380052, 0.277318368, 0.317663651, 0.35742863, 0.396655202,
+          0.435354555, 0.473529426, 0.511190599, 0.548387199, 0.585108931, 0.621384309, 0.657196613,
+          0.692613791, 0.727623969, 0.762236235, 0.796476161, 0.83032675, 0.863852569, 0.897040679,
+          0.929898714, 0.962449174, 0.994698636, 1.026634493, 1.058316458, 1.089730246, 1.120881479,
+          1.151788943, 1.182437408, 1.212876084, 1.243088849, 1.273092187, 1.3028896, 1.3324885,
+          1.361871793, 1.391095273, 1.420140519, 1.449013707, 1.477717151, 1.506241825, 1.534633944,
+          1.56287611, 1.59097328, 1.618930199, 1.646748172, 1.67443813, 1.701977957, 1.729418247,
+          1.756739262, 1.783944717, 1.811038188, 1.838023111, 1.864902798, 1.891655623, 1.918334897,
+          1.944851273, 1.971343062, 1.997744359, 2.024057822, 2.05028601, 2.076431399, 2.102469093,
+          2.128456614, 2.15436824, 2.180206125, 2.205972352, 2.231668935, 2.257297822, 2.282860896,
+          2.308331095,
+          -1.384866868, -1.316600543, -1.249352912, -1.183178498, -1.117997774, -1.053892223,
+          -0.990811021, -0.92871422, -0.867633927, -0.807533349, -0.748441398, -0.69029913,
+          -0.633097457, -0.576863068, -0.521522457, -0.467100531, -0.413559102, -0.360921255,
+          -0.309123879, -0.258157817, -0.208045612, -0.158712353, -0.11017987, -0.062411539,
+          -0.015427959, 0.030844745, 0.076386336, 0.121231765, 0.165361947, 0.208849552,
+          0.251675605, 0.293873455, 0.335425226, 0.376402306, 0.416786697, 0.456590313, 0.495855752,
+          0.534593422, 0.572805793, 0.610502974, 0.647734892, 0.684490586, 0.720798472, 0.756641269,
+          0.792087825, 0.827125741, 0.861764089, 0.896028473, 0.929901504, 0.963448648, 0.996656587,
+          1.029533018, 1.062100537, 1.094365796, 1.126315919, 1.158011435, 1.189437773, 1.220600635,
+          1.251518902, 1.282177083, 1.312625141, 1.342846669, 1.372858226, 1.402663364, 1.432269548,
+          1.4616594, 1.490889423, 1.519940892, 1.548820015, 1.577529127, 1.606058893, 1.634456239,
+          1.66270343, 1.690805439, 1.718767023, 1.746589496, 1.774283805, 1.801827486, 1.829271856,
+          1.856596819, 1.8838061, 1.910903275, 1.93789179, 1.964774958, 1.991530786, 2.018213345,
+          2.044799763, 2.07121415, 2.097618804, 2.123935525, 2.150166877, 2.176315337, 2.202355577,
+          2.228346008, 2.25426046, 2.280101092, 2.305869988, 2.331569166, 2.357200574, 2.3827661,
+          2.408238206,
+          -1.285519242, -1.217313439, -1.1501278, -1.084016632, -1.018899415, -0.954857583,
+          -0.891839434, -0.829804135, -0.768783402, -0.708739683, -0.649701616, -0.591609181,
+          -0.534452917, -0.478259445, -0.42295417, -0.368562045, -0.315044547, -0.262425059,
+          -0.210639578, -0.159679289, -0.109567345, -0.060228001, -0.011683826, 0.03610157,
+          0.083106665, 0.129406063, 0.174978521, 0.219858576, 0.26402605, 0.30755433, 0.350423329,
+          0.392665943, 0.434263196, 0.475287262, 0.515719067, 0.555569541, 0.594882133, 0.633666308,
+          0.671924212, 0.709665132, 0.746939973, 0.783736962, 0.820084396, 0.855964309, 0.891446643,
+          0.926518359, 0.961188505, 0.995482722, 1.029383141, 1.062956319, 1.096188476, 1.129087382,
+          1.161675747, 1.193960312, 1.225927875, 1.257639956, 1.289081633, 1.320258705, 1.35119017,
+          1.38186022, 1.412319732, 1.442551955, 1.472573537, 1.502388096, 1.532003157, 1.561401003,
+          1.590638996, 1.619698042, 1.648584389, 1.6773004, 1.705836363, 1.734240067, 1.762493373,
+          1.790601267, 1.818568527, 1.846396473, 1.874096074, 1.901644446, 1.929093778, 1.956423545,
+          1.983637478, 2.010739161, 2.037732044, 2.064619447, 2.091378931, 2.118065486, 2.144655781,
+          2.171152677, 2.197466368, 2.223787045, 2.250022238, 2.276174429, 2.302217763, 2.328211726,
+          2.354129611, 2.379973577, 2.405745715, 2.431448042, 2.457082513, 2.482651016, 2.508125441,
+          -1.186314311, -1.118182088, -1.051071786, -0.98503744, -0.919997327, -0.856032819,
+          -0.793091146, -0.731130403, -0.670181835, -0.610206974, -0.551234125, -0.493201971,
+          -0.436100608, -0.379956577, -0.324693973, -0.270337811, -0.216849166, -0.164251793,
+          -0.112480611, -0.061527225, -0.011415527, 0.037931232, 0.08648959, 0.134295654,
+          0.181326784, 0.227658468, 0.273268249, 0.318190167, 0.362402723, 0.405980181, 0.448901108,
+          0.491197857, 0.532850126, 0.573931044, 0.61442024, 0.654327451, 0.693697165, 0.732537702,
+          0.770850818, 0.808644805, 0.845971752, 0.882818902, 0.919214406, 0.955139462, 0.990665341,
+          1.025778218, 1.060487115, 1.094817708, 1.128751546, 1.162356503, 1.195618236, 1.228544601,
+          1.261158441, 1.293466606, 1.325455493, 1.357187823, 1.38864825, 1.41984269, 1.450790279,
+          1.481474829, 1.511948324, 1.542193597, 1.572227406, 1.602053448, 1.631679326, 1.661086908,
+          1.690334603, 1.719402869, 1.748298003, 1.777022403, 1.805565904, 1.833977337, 1.862238073,
+          1.890353122, 1.918327279, 1.946161877, 1.973867909, 2.001421984, 2.028877347, 2.056212952,
+          2.083432539, 2.110539701, 2.137537894, 2.164430445, 2.191194375, 2.217885787, 2.244480794,
+          2.270982262, 2.297392955, 2.323715538, 2.34984686, 2.376003574, 2.402050665, 2.428048912,
+          2.453970959, 2.47981897, 2.505595037, 2.531301184, 2.556939368, 2.582511482, 2.607988724,
+          -1.087282817, -1.019239958, -0.952221103, -0.886279956, -0.821333328, -0.757462515,
+          -0.694613454, -0.632742941, -0.571881652, -0.511990014, -0.453095941, -0.39513655,
+          -0.338101409, -0.282016973, -0.226805764, -0.172492883, -0.119038927, -0.066468106,
+          -0.01471405, 0.036231125, 0.086342629, 0.13569842, 0.184273954, 0.232104999, 0.279167567,
+          0.325538212, 0.371193021, 0.416165432, 0.460432365, 0.504069141, 0.547052714, 0.589414786,
+          0.631133459, 0.672283021, 0.712841541, 0.752817318, 0.7922561, 0.831164827, 0.869544784,
+          0.907403057, 0.944793174, 0.981701179, 1.018155048, 1.054134958, 1.089713789, 1.124876763,
+          1.159632855, 1.194007787, 1.227982387, 1.261626131, 1.294923981, 1.327883894, 1.360528871,
+          1.392865888, 1.424880852, 1.456637941, 1.488121292, 1.519336959, 1.550304251, 1.581006515,
+          1.611497079, 1.641758273, 1.671806991, 1.701647024, 1.731286074, 1.760705511, 1.789965006,
+          1.819044482, 1.847950295, 1.876684886, 1.905237546, 1.933658366, 1.961928124, 1.990051858,
+          2.018034388, 2.045877061, 2.073590901, 2.101151902, 2.128614587, 2.15595728, 2.183183732,
+          2.210297546, 2.237302186, 2.264200987, 2.29097032, 2.317667628, 2.344268356, 2.370775377,
+          2.397191458, 2.423519271, 2.449761394, 2.475796731, 2.501848378, 2.527851812, 2.553778898,
+          2.579631806, 2.605412632, 2.631123404, 2.656766083, 2.682342568, 2.707823228,
+          -0.988461892, -0.92052743, -0.853619423, -0.78779117, -0.722957701, -0.659200219,
+          -0.596463091, -0.534701547, -0.473945581, -0.414154294, -0.355355129, -0.297483329,
+          -0.24052784, -0.184515023, -0.12936552, -0.075104547, -0.021692144, 0.03084692,
+          0.082580558, 0.133516027, 0.18362745, 0.232994232, 0.281590526, 0.329451692, 0.376552122,
+          0.422969656, 0.46867863, 0.513711773, 0.558044105, 0.601752228, 0.644811162, 0.68725184,
+          0.729050445, 0.770282676, 0.810924725, 0.850983166, 0.890505271, 0.929496323, 0.967957039,
+          1.005893047, 1.043359616, 1.08034134, 1.116865976, 1.152912463, 1.188555623, 1.223779514,
+          1.258593051, 1.293021998, 1.327046304, 1.360737376, 1.394079327, 1.427080227, 1.459763262,
+          1.492135555, 1.524182418, 1.555969785, 1.587481167, 1.618722785, 1.649714153, 1.680438061,
+          1.71094946, 1.741230072, 1.771296961, 1.801154036, 1.830809116, 1.860242977, 1.889516813,
+          1.918609906, 1.947528683, 1.976275642, 2.004839419, 2.033271623, 2.06155232, 2.089686585,
+          2.117679266, 2.145531729, 2.173255035, 2.200824439, 2.228296, 2.255647287, 2.282882062,
+          2.310003941, 2.337016399, 2.363922779, 2.390698669, 2.417403128, 2.444010794, 2.470524547,
+          2.496947163, 2.523281319, 2.5495296, 2.575694499, 2.601748369, 2.627613652, 2.653546828,
+          2.679405654, 2.70519223, 2.730908592, 2.756556705, 2.782138471, 2.807623274,
+          -0.889896274, -0.822093089, -0.755319218, -0.689627461, -0.624930686, -0.56130998,
+          -0.498707816, -0.437077537, -0.37644832, -0.316777675, -0.258092499, -0.200325792,
+          -0.143465768, -0.087538699, -0.032462988, 0.021735988, 0.07509884, 0.12760011, 0.17930954,
+          0.230233625, 0.280345174, 0.329725317, 0.378346642, 0.426244018, 0.473389898, 0.519863668,
+          0.565637575, 0.610743505, 0.655154211, 0.698947847, 0.742097128, 0.784632072, 0.826526578,
+          0.867858047, 0.908600432, 0.948758239, 0.988380587, 1.027470767, 1.066028819, 1.104058611,
+          1.141617518, 1.178688377, 1.21529868, 1.251425852, 1.287147066, 1.322444957, 1.357328355,
+          1.391823063, 1.425907951, 1.459656755, 1.493052546, 1.52610352, 1.558833078, 1.591248508,
+          1.623334398, 1.655158804, 1.686704469, 1.717977816, 1.748998609, 1.779748965, 1.810285793,
+          1.840590086, 1.870679115, 1.900556934, 1.930231509, 1.959682907, 1.988974157, 2.018083769,
+          2.047018266, 2.075780214, 2.104357467, 2.132803456, 2.161097398, 2.18924441, 2.217249379,
+          2.24511369, 2.272848453, 2.300428036, 2.327910341, 2.35527203, 2.382516881, 2.409648523,
+          2.436670445, 2.463586001, 2.490369839, 2.517082956, 2.543699022, 2.570220926, 2.596651453,
+          2.622993289, 2.649249026, 2.675421166, 2.701481059, 2.727493915, 2.753267044, 2.779133005,
+          2.804926517, 2.830649619, 2.856304283, 2.88189242, 2.907382233,
+          -0.791639695, -0.72399519, -0.657383293, -0.591856188, -0.527324122, -0.463868041,
+          -0.401428131, -0.33995547, -0.279478266, -0.219952135, -0.161403334, -0.103762198,
+          -0.047016095, 0.008808784, 0.063796682, 0.117921998, 0.171226091, 0.223682654,
+          0.275363585, 0.326274452, 0.376386479, 0.425782842, 0.474434252, 0.522374994, 0.569575213,
+          0.616116144, 0.661967552, 0.707160335, 0.751664555, 0.795560237, 0.838817363, 0.881464883,
+          0.923473975, 0.964924103, 1.005786555, 1.046063373, 1.085805904, 1.125015063, 1.163690078,
+          1.201832706, 1.239502854, 1.276681244, 1.313395036, 1.34961982, 1.385435594, 1.420823262,
+          1.45579153, 1.490366233, 1.524524914, 1.558344112, 1.591805618, 1.624917762, 1.65770419,
+          1.69017238, 1.722306031, 1.754175753, 1.78576336, 1.817075512, 1.848132271, 1.878914949,
+          1.90948281, 1.939815976, 1.969931969, 1.999835025, 2.029533292, 2.059005995, 2.088318362,
+          2.117447991, 2.14640152, 2.175181603, 2.203775164, 2.232237817, 2.260547764, 2.288710177,
+          2.316729989, 2.344608612, 2.372357215, 2.399949106, 2.427444389, 2.454818645, 2.48207567,
+          2.509219109, 2.536252466, 2.56317911, 2.589972565, 2.616696143, 2.64332236, 2.669854115,
+          2.696294202, 2.722645319, 2.748910066, 2.775090956, 2.801158143, 2.827179284, 2.853123572,
+          2.878993194, 2.904607032, 2.93033824, 2.956000784, 2.981596581, 3.007092443,
+          -0.69375643, -0.626303278, -0.559886463, -0.494557406, -0.430223191, -0.366964584,
+          -0.304719027, -0.243434889, -0.183139231, -0.123785427, -0.065398999, -0.007907137,
+          0.048703761, 0.104407555, 0.159291593, 0.213329959, 0.26656486, 0.318968938, 0.370616618,
+          0.421512332, 0.471625403, 0.521041414, 0.569728845, 0.617721283, 0.664986139, 0.711606855,
+          0.757550264, 0.802846119, 0.847461308, 0.891478109, 0.934863283, 0.977644545, 1.019789855,
+          1.061381173, 1.102386631, 1.142805352, 1.182691366, 1.222042762, 1.260857809, 1.299135729,
+          1.336939475, 1.37424722, 1.41108572, 1.447428333, 1.483358447, 1.518854853, 1.553926089,
+          1.588597998, 1.622846494, 1.656751475, 1.690293158, 1.723480015, 1.756335959, 1.788868683,
+          1.8210608, 1.852985983, 1.884624914, 1.915984534, 1.947085263, 1.97790745, 2.008513183,
+          2.038881544, 2.069030364, 2.098964102, 2.128691137, 2.158189695, 2.187527637, 2.216681483,
+          2.245658014, 2.274459997, 2.303073257, 2.331556008, 2.359885252, 2.388066228, 2.416103928,
+          2.4439998, 2.471765079, 2.499371819, 2.526882743, 2.554272145, 2.581543842, 2.6087015,
+          2.635748642, 2.662688654, 2.689493721, 2.716229914, 2.742868369, 2.769411999, 2.795863614,
+          2.82222592, 2.848501531, 2.87469297, 2.900768971, 2.926800101, 2.952754093, 2.978633143,
+          3.004439374, 3.029965036, 3.055637028, 3.081242009, 3.106745156,
+          -0.596322994, -0.529099921, -0.462917307, -0.397825632, -0.333728166, -0.270705451,
+          -0.208691645, -0.147631892, -0.087551916, -0.028402454, 0.029791803, 0.087107346,
+          0.143558863, 0.199120213, 0.253882348, 0.307818912, 0.360973046, 0.413316098, 0.464925413,
+          0.515804043, 0.565919037, 0.615358787, 0.664089127, 0.712142829, 0.759484087, 0.806198955,
+          0.852250844, 0.897668186, 0.94241416, 0.98657375, 1.030109953, 1.073049074, 1.115355305,
+          1.157113605, 1.198288403, 1.238875387, 1.278931808, 1.318452417, 1.357434349, 1.395873807,
+          1.433837385, 1.471300202, 1.50828851, 1.544772966, 1.580841005, 1.61646885, 1.651664797,
+          1.686454663, 1.720812359, 1.754821793, 1.788461247, 1.821739326, 1.854680239, 1.887291902,
+          1.919555604, 1.951548677, 1.983250432, 2.014668137, 2.045822635, 2.076693127, 2.107345076,
+          2.13775633, 2.167945098, 2.197916117, 2.227678047, 2.25720795, 2.286576823, 2.315759912,
+          2.344764188, 2.373592558, 2.402229559, 2.430736488, 2.459088933, 2.487292221, 2.515351418,
+          2.543268012, 2.571053329, 2.598677935, 2.626207654, 2.653615255, 2.680904586, 2.708079336,
+          2.735143049, 2.762099131, 2.788918187, 2.815669544, 2.842322713, 2.868880623, 2.895346097,
+          2.921721857, 2.948010531, 2.974214654, 3.000301282, 3.02634442, 3.052310078, 3.078200463,
+          3.104017708, 3.129763876, 3.155440962, 3.180818625, 3.206330518,
+          -0.4994299, -0.432482472, -0.366579907, -0.301771521, -0.237955999, -0.175213608,
+          -0.113474592, -0.052680289, 0.007145123, 0.066053979, 0.124022499, 0.181131438,
+          0.237396671, 0.292791959, 0.347412387, 0.401230978, 0.454291877, 0.506564825, 0.558130505,
+          0.608990294, 0.659108532, 0.708576856, 0.75735799, 0.805483753, 0.852914597, 0.89973965,
+          0.945918359, 0.99147767, 1.036376473, 1.080702979, 1.124415845, 1.16753979, 1.210034634,
+          1.251988935, 1.293362816, 1.334147957, 1.374405454, 1.414126153, 1.453305858, 1.491937188,
+          1.530091079, 1.567738995, 1.604906572, 1.641561195, 1.677795115, 1.713581428, 1.748928093,
+          1.78386084, 1.818351116, 1.852487594, 1.886246178, 1.91963558, 1.952680316, 1.985388532,
+          2.017739896, 2.049816094, 2.081594772, 2.113083574, 2.144303843, 2.175233417, 2.205941771,
+          2.236405294, 2.266642656, 2.296658941, 2.326463162, 2.356031024, 2.385437238, 2.414655573,
+          2.443693235, 2.472553315, 2.501218852, 2.529754777, 2.558135028, 2.586365044, 2.614449982,
+          2.642391389, 2.670200696, 2.697846728, 2.72539895, 2.752828346, 2.780138796, 2.807334018,
+          2.834417582, 2.861392918, 2.888228775, 2.914998302, 2.941669104, 2.968244126, 2.994726209,
+          3.021118092, 3.04742242, 3.073641743, 3.099741147, 3.125798675, 3.151778311, 3.177682278,
+          3.20351272, 3.229271714, 3.254961267, 3.280315264, 3.305837622,
+          -0.403183389, -0.336564717, -0.270995372, -0.206523227, -0.143041479, -0.080630058,
+          -0.019214578, 0.041268079, 0.100795496, 0.159423535, 0.217129384, 0.273998665,
+          0.330048502, 0.385252395, 0.439710095, 0.493393747, 0.546348523, 0.598542178, 0.65005914,
+          0.700898757, 0.751022169, 0.800524707, 0.849365477, 0.897575203, 0.945110025, 0.992062668,
+          1.038388048, 1.084111476, 1.129186943, 1.173706503, 1.21762387, 1.260962026, 1.30367578,
+          1.345857986, 1.38746382, 1.428480336, 1.468973204, 1.508928731, 1.548341186, 1.587198956,
+          1.625578122, 1.663445804, 1.700826876, 1.737684775, 1.774117444, 1.810094188, 1.845622489,
+          1.880727899, 1.915378834, 1.949669596, 1.983573163, 2.017098303, 2.050269834, 2.083096113,
+          2.115554829, 2.147732821, 2.179605712, 2.21118157, 2.242482319, 2.273484187, 2.304261394,
+          2.334788612, 2.365085075, 2.395156293, 2.425011716, 2.454625497, 2.484076713, 2.513337435,
+          2.542415168, 2.57131324, 2.600012974, 2.628583547, 2.656996994, 2.685258897, 2.713374532,
+          2.741345522, 2.769183428, 2.796855054, 2.824434105, 2.851889489, 2.879225126, 2.906444769,
+          2.933552017, 2.960550326, 2.987406288, 3.014197501, 3.040889346, 3.067484793, 3.0939867,
+          3.120397829, 3.146720842, 3.172958308, 3.199073022, 3.225147724, 3.251144044, 3.277064218,
+          3.30291041, 3.32868471, 3.354389139, 3.380025653, 3.405254627,
+          -0.307706903, -0.241478151, -0.176302853, -0.112227095, -0.049137549, 0.012886273,
+          0.073924179, 0.134044452, 0.193226631, 0.251530559, 0.308934395, 0.365529216, 0.421333379,
+          0.476319876, 0.530593598, 0.579965289, 0.632790942, 0.684892486, 0.736358395, 0.787184437,
+          0.837326765, 0.886885358, 0.935814239, 0.98414284, 1.031821684, 1.078948928, 1.129486109,
+          1.175396654, 1.220673556, 1.265413407, 1.309564394, 1.353147662, 1.396112362, 1.438556456,
+          1.480429516, 1.52171333, 1.562478968, 1.602707533, 1.642391533, 1.681514412, 1.720158293,
+          1.75828517, 1.795918977, 1.8330184, 1.869688066, 1.905892694, 1.941639096, 1.976952509,
+          2.01179762, 2.046275343, 2.080355055, 2.114045487, 2.147371721, 2.180342284, 2.212932437,
+          2.245235082, 2.277223383, 2.308905876, 2.340305149, 2.37139553, 2.402256818, 2.432861672,
+          2.463230011, 2.493367868, 2.523285237, 2.55295451, 2.58245987, 2.611771448, 2.640897141,
+          2.669840582, 2.698581154, 2.727192956, 2.755645855, 2.78394562, 2.812097682, 2.840103762,
+          2.867975588, 2.89567764, 2.923288511, 2.950774725, 2.978140249, 3.005388876, 3.03252424,
+          3.059549829, 3.086429744, 3.113246713, 3.139963556, 3.166583265, 3.193108724, 3.219542717,
+          3.245887928, 3.272146949, 3.298279936, 3.324375037, 3.350391173, 3.3763306, 3.402195499,
+          3.427987977, 3.453710076, 3.479019343, 3.504568963,
+          -0.213142015, -0.147372512, -0.082659603, -0.019047172, 0.04358582, 0.105160355,
+          0.16576253, 0.225466516, 0.284253958, 0.337962841, 0.394972579, 0.467417244, 0.523185289,
+          0.578131509, 0.632363306, 0.685853576, 0.738650475, 0.790720678, 0.842154916, 0.8929509,
+          0.943066291, 0.99260192, 1.041512281, 1.089826497, 1.137494666, 1.184613758, 1.231131939,
+          1.277071363, 1.306468147, 1.35148142, 1.395925709, 1.439821264, 1.483110759, 1.529908762,
+          1.572085356, 1.613673867, 1.654751684, 1.695294035, 1.73529144, 1.77472162, 1.813673739,
+          1.85210378, 1.890034527, 1.927418978, 1.964369535, 2.000845394, 2.036852441, 2.072415393,
+          2.107494361, 2.142197959, 2.176491142, 2.210382456, 2.243897162, 2.277043865, 2.309794846,
+          2.342250091, 2.374379777, 2.406192928, 2.437712874, 2.468911707, 2.499875735, 2.530575271,
+          2.561031053, 2.591249752, 2.621242036, 2.650978326, 2.680548724, 2.709921189, 2.739104117,
+          2.768101546, 2.796890702, 2.825551334, 2.854050878, 2.88239535, 2.910590386, 2.93863784,
+          2.966549648, 2.994287661, 3.021936041, 3.049458604, 3.076859376, 3.104142196, 3.131310741,
+          3.158368533, 3.185276841, 3.212124225, 3.238870592, 3.265518962, 3.292072245, 3.318533249,
+          3.344904687, 3.371189174, 3.397343864, 3.423463064, 3.449502607, 3.475464774, 3.501351768,
+          3.526763456, 3.552516636, 3.578200537, 3.603767605,
+          -0.119648325, -0.054415007, 0.009760575, 0.072837237, 0.134945037, 0.196005523,
+          0.251811911, 0.327377651, 0.386113878, 0.44398409, 0.500969632, 0.557171035, 0.612610931,
+          0.667264259, 0.721245872, 0.774527711, 0.827159821, 0.879106125, 0.930463313, 0.981226165,
+          1.031347556, 1.080934033, 1.129934553, 1.178376493, 1.226203269, 1.273517202, 1.320259373,
+          1.366449227, 1.412025847, 1.457090677, 1.501582295, 1.54551745, 1.588836195, 1.615458188,
+          1.658004448, 1.699974165, 1.741454104, 1.786507576, 1.826861842, 1.866643815, 1.905950767,
+          1.944731717, 1.983008038, 2.020725963, 2.058006851, 2.094803281, 2.131119871, 2.166980539,
+          2.202339788, 2.23731513, 2.271866098, 2.306000823, 2.339744598, 2.373105943, 2.406053479,
+          2.438695405, 2.470998253, 2.502971525, 2.534639352, 2.565971186, 2.597060878, 2.627875999,
+          2.658438255, 2.688755088, 2.718837987, 2.74865521, 2.778303655, 2.807748884, 2.836999936,
+          2.866061385, 2.894908113, 2.923626283, 2.952180658, 2.980577585, 3.008822975, 3.036918866,
+          3.064877461, 3.092657682, 3.120349949, 3.147915055, 3.175357095, 3.202679968, 3.229887396,
+          3.25698294, 3.28392469, 3.310807752, 3.33758876, 3.364270763, 3.390856701, 3.417349411,
+          3.443751633, 3.470066013, 3.496246338, 3.52239382, 3.547986218, 3.57398724, 3.599911984,
+          3.625762616, 3.651541229, 3.677249849, 3.702837373,
+          -0.027401645, 0.037212562, 0.100771395, 0.158933949, 0.236866065, 0.297861625,
+          0.357878059, 0.416998436, 0.475209207, 0.532583199, 0.589103714, 0.644880151, 0.699937603,
+          0.735047701, 0.78871856, 0.841768181, 0.894241772, 0.946091828, 0.997418067, 1.048206474,
+          1.098399425, 1.148110005, 1.197278232, 1.245930206, 1.294000972, 1.341604039, 1.388673462,
+          1.435229797, 1.48120446, 1.526714204, 1.589901743, 1.634215284, 1.677920072, 1.72112682,
+          1.76376762, 1.80580835, 1.847333966, 1.888310391, 1.91258651, 1.952820852, 1.99260045,
+          2.03598594, 2.074659606, 2.112763397, 2.150428864, 2.18760073, 2.224424141, 2.260819175,
+          2.296713838, 2.332210858, 2.367237146, 2.401800383, 2.43592744, 2.466446644, 2.499808807,
+          2.532839163, 2.565499116, 2.597798954, 2.629764444, 2.661362814, 2.692697616, 2.723734219,
+          2.754496628, 2.784994226, 2.815240518, 2.845202743, 2.874985693, 2.904553472, 2.93322054,
+          2.962411841, 2.991374083, 3.020202537, 3.048859378, 3.077352173, 3.105687897, 3.133869416,
+          3.161909853, 3.189764943, 3.21753312, 3.245171737, 3.272685168, 3.300077511, 3.327352619,
+          3.354514142, 3.381516205, 3.408462068, 3.435304268, 3.462045862, 3.4886898, 3.515238931,
+          3.541696012, 3.568063711, 3.594291598, 3.620489526, 3.646605545, 3.672642004, 3.698601174,
+          3.724485252, 3.750296365, 3.77603657, 3.801651086,
+          0.06341047, 0.122964046, 0.202660976, 0.265029713, 0.32640874, 0.386720392, 0.446068729,
+          0.504546239, 0.542678257, 0.5993564, 0.655287504, 0.710581952, 0.765255153, 0.819268661,
+          0.87274451, 0.925639551, 0.977998185, 1.029768106, 1.081052547, 1.131833669, 1.182048632,
+          1.231815223, 1.28106845, 1.329833556, 1.378040266, 1.425808162, 1.473066245, 1.519834589,
+          1.566039133, 1.611804153, 1.657055589, 1.701811308, 1.745995898, 1.789739122, 1.832965574,
+          1.894172891, 1.937413327, 1.959819269, 2.001204752, 2.042056856, 2.08246529, 2.128833819,
+          2.168568047, 2.2076659, 2.246245998, 2.277083552, 2.314527527, 2.351474786, 2.387858893,
+          2.423812782, 2.459279844, 2.494265597, 2.525884978, 2.560065426, 2.593770151, 2.627129158,
+          2.660097087, 2.692684012, 2.72491614, 2.756756031, 2.788318226, 2.81865144, 2.849661325,
+          2.880386715, 2.910841785, 2.940989407, 2.970946518, 3.000672834, 3.030180383, 3.059476446,
+          3.088531616, 3.117449564, 3.14618962, 3.17476024, 3.203169196, 3.231419986, 3.259526466,
+          3.287441235, 3.315270377, 3.342967908, 3.370538459, 3.39798632, 3.425315486, 3.4525297,
+          3.479579296, 3.506575373, 3.533466539, 3.560255865, 3.586946304, 3.613540713, 3.640041857,
+          3.666452416, 3.692717877, 3.718956418, 3.745111907, 3.771186719, 3.797183155, 3.823103445,
+          3.848949748, 3.874724153, 3.900367497,
+          0.165275876, 0.229059612, 0.291743994, 0.353293394, 0.413862412, 0.453723486, 0.512142309,
+          0.569830228, 0.62676913, 0.68303416, 0.738597016, 0.793571366, 0.847970192, 0.90175058,
+          0.955037822, 1.007784059, 1.060032568, 1.111725906, 1.162970695, 1.213745238, 1.263981401,
+          1.313801846, 1.363136623, 1.412010408, 1.460347736, 1.508274696, 1.55571545, 1.602690044,
+          1.649119154, 1.695216031, 1.740887848, 1.784525362, 1.82907619, 1.873217686, 1.916862294,
+          1.959991188, 2.002694183, 2.058416381, 2.101404085, 2.131852585, 2.17311565, 2.213876751,
+          2.254123094, 2.293752346, 2.332898143, 2.365648644, 2.403612913, 2.441078967, 2.477968213,
+          2.514427053, 2.550386661, 2.583155386, 2.618201772, 2.652799912, 2.686896756, 2.720634849,
+          2.753960643, 2.78688341, 2.818350868, 2.850535323, 2.882429582, 2.913985449, 2.94522791,
+          2.976167148, 3.006818223, 3.037140541, 3.067261489, 3.097137175, 3.126780901, 3.156201157,
+          3.185366085, 3.214175594, 3.24302632, 3.271698134, 3.300200096, 3.328536831, 3.356723484,
+          3.38470964, 3.412610227, 3.440375948, 3.468012056, 3.495523329, 3.522914137, 3.550188495,
+          3.577292644, 3.604346427, 3.631294145, 3.658138879, 3.68488357, 3.711531041, 3.738084023,
+          3.764545164, 3.790855298, 3.817141959, 3.843344264, 3.869464595, 3.895505269, 3.921468543,
+          3.947356604, 3.973171579, 3.998849369,
+          0.254094746, 0.316929031, 0.378658377, 0.419386948, 0.478924987, 0.537566316, 0.595429606,
+          0.652614209, 0.70909943, 0.764960856, 0.820166058, 0.874831027, 0.928965545, 0.98252158,
+          1.0356273, 1.088229814, 1.140371217, 1.191988833, 1.24319276, 1.293957628, 1.344210087,
+          1.394077988, 1.443486564, 1.492460291, 1.54099996, 1.589211954, 1.636954719, 1.682942935,
+          1.72965828, 1.775988373, 1.821864042, 1.867325883, 1.91222476, 1.956605263, 2.000583528,
+          2.044134149, 2.085743543, 2.137327065, 2.180665243, 2.223420951, 2.256599988, 2.29784598,
+          2.338614736, 2.37879043, 2.418521384, 2.452912389, 2.49142282, 2.529440404, 2.566873048,
+          2.603881048, 2.637881695, 2.673876699, 2.70940909, 2.74447844, 2.779021627, 2.813194838,
+          2.845713485, 2.879073489, 2.912041539, 2.944563355, 2.976780095, 3.008636319, 3.040157453,
+          3.07135396, 3.101797166, 3.13236748, 3.162722776, 3.192813089, 3.222652538, 3.25225054,
+          3.281571782, 3.310740586, 3.339709469, 3.368489518, 3.397091049, 3.425519793, 3.453792173,
+          3.481854778, 3.509831367, 3.53766937, 3.565374696, 3.592952666, 3.620408081, 3.647745281,
+          3.674906547, 3.702020371, 3.729026865, 3.755929159, 3.782730208, 3.809432826, 3.83603972,
+          3.862553509, 3.888910437, 3.915247266, 3.941498418, 3.967666275, 3.993753164, 4.019761358,
+          4.045693073, 4.071550465, 4.097264568,
+          0.320968502, 0.382466466, 0.443054545, 0.502704417, 0.561596289, 0.619641158, 0.676960969,
+          0.733656564, 0.789703057, 0.845175225, 0.900035472, 0.95440142, 1.008279275, 1.061615645,
+          1.114541668, 1.16699951, 1.219030438, 1.270566747, 1.321722462, 1.372468928, 1.422832154,
+          1.472865371, 1.522456906, 1.571770032, 1.619162252, 1.667453825, 1.715316975, 1.762810519,
+          1.809812215, 1.856252543, 1.902185193, 1.946816953, 1.991797692, 2.03645357, 2.080722389,
+          2.138626337, 2.168140681, 2.215910666, 2.259558871, 2.302709217, 2.345470906, 2.380557002,
+          2.421835804, 2.462551168, 2.502866956, 2.542665472, 2.577768406, 2.616363543, 2.654371842,
+          2.691968399, 2.726715323, 2.763255332, 2.799325043, 2.83492043, 2.869966586, 2.903317614,
+          2.937556348, 2.971360713, 3.004752812, 3.037669282, 3.069577389, 3.101823573, 3.133715341,
+          3.165261626, 3.196477172, 3.227309353, 3.257911947, 3.288229096, 3.318275902, 3.347840994,
+          3.377352334, 3.406699805, 3.435830887, 3.464757963, 3.49349274, 3.522042299, 3.550424747,
+          3.578583651, 3.606653106, 3.634577244, 3.662363174, 3.690017286, 3.717545297, 3.744952317,
+          3.772176748, 3.799356606, 3.826427768, 3.853393584, 3.880257131, 3.907021267, 3.933688683,
+          3.960261947, 3.986672182, 4.013066279, 4.039373426, 4.065595938, 4.091736096, 4.117796146,
+          4.143778293, 4.169684702, 4.195440987,
+          0.404749574, 0.465450628, 0.525296719, 0.58425779, 0.642519823, 0.699986531, 0.756781034,
+          0.813003924, 0.868624787, 0.92371681, 0.978236776, 1.032303992, 1.085921442, 1.139030743,
+          1.191766866, 1.244067584, 1.296030999, 1.347610829, 1.39883673, 1.449776225, 1.5003462,
+          1.54900501, 1.598602701, 1.647859514, 1.696691538, 1.74523867, 1.793024036, 1.840289324,
+          1.886507045, 1.933030104, 1.979140733, 2.024911715, 2.070294275, 2.115499884, 2.159598663,
+          2.211667326, 2.25737338, 2.293798212, 2.337705215, 2.381185297, 2.424369087, 2.467109178,
+          2.503594255, 2.544828287, 2.585714, 2.626119694, 2.662479195, 2.701668062, 2.740275137,
+          2.778491557, 2.813988814, 2.851116267, 2.887771158, 2.923945314, 2.958166224, 2.993379466,
+          3.028140589, 3.062450247, 3.095486694, 3.128872723, 3.161935599, 3.194597845, 3.226882927,
+          3.258798906, 3.28991309, 3.321086347, 3.352017181, 3.38264046, 3.41297114, 3.443019676,
+          3.472741288, 3.502286502, 3.531597509, 3.56068806, 3.589451923, 3.618151213, 3.646669631,
+          3.67494718, 3.703129457, 3.731156832, 3.759037829, 3.786780174, 3.814390818, 3.841875974,
+          3.869170381, 3.896422193, 3.923563205, 3.950597264, 3.977527798, 4.004357888, 4.031090342,
+          4.057727754, 4.084195939, 4.110652361, 4.137020737, 4.163303275, 4.189502158, 4.215619547,
+          4.241657588, 4.267618405, 4.29342185,
+          0.486756357, 0.546675238, 0.605798987, 0.664092567, 0.721744834, 0.778649759, 0.834929875,
+          0.890684543, 0.945877418, 1.000580471, 1.054745455, 1.108494664, 1.161829137, 1.214779531,
+          1.26744784, 1.319713039, 1.37187059, 1.423701078, 1.475220199, 1.526365539, 1.574286435,
+          1.624439901, 1.674274151, 1.723537632, 1.771948851, 1.819573943, 1.867403903, 1.914802319,
+          1.96173356, 2.008443413, 2.055092492, 2.101043046, 2.146577502, 2.191916324, 2.236987755,
+          2.285143481, 2.330806227, 2.376244649, 2.42137461, 2.458596534, 2.502128309, 2.545293777,
+          2.588068391, 2.625473362, 2.666899721, 2.707890078, 2.745420338, 2.785206434, 2.824422969,
+          2.863278612, 2.899551519, 2.937300431, 2.974581025, 3.009998305, 3.046159192, 3.08196228,
+          3.117302844, 3.151236557, 3.185656118, 3.219552118, 3.253116061, 3.28625793, 3.318401117,
+          3.350768105, 3.382761011, 3.414308669, 3.445598693, 3.476220663, 3.506883655, 3.53724197,
+          3.567243267, 3.597054568, 3.626609994, 3.655924017, 3.68501074, 3.713879636, 3.742552153,
+          3.770876174, 3.799197933, 3.82735211, 3.855348692, 3.883196874, 3.910905038, 3.938480762,
+          3.965855243, 3.993187538, 4.020405467, 4.047513731, 4.074516444, 4.101417214, 4.128219216,
+          4.154925274, 4.181455854, 4.207979427, 4.234414117, 4.260762026, 4.287025203, 4.313205673,
+          4.339305454, 4.365326567, 4.391182704,
+          0.567028772, 0.626188976, 0.684611429, 0.74225269, 0.799302124, 0.855642437, 0.911395351,
+          0.966659897, 1.021395164, 1.075674122, 1.129524502, 1.183056534, 1.236208003, 1.289346981,
+          1.34246658, 1.395303642, 1.44784528, 1.499852606, 1.550945138, 1.597685688, 1.648393977,
+          1.698330883, 1.747383593, 1.795851455, 1.844375138, 1.892511336, 1.94024068, 1.988521623,
+          2.035599478, 2.082412407, 2.128914658, 2.175188486, 2.22117636, 2.267115461, 2.318252995,
+          2.365377189, 2.404092137, 2.449516184, 2.494734915, 2.53960803, 2.578604459, 2.622115504,
+          2.665309597, 2.70801391, 2.746325662, 2.787862604, 2.82897531, 2.866874367, 2.906696383,
+          2.946195532, 2.983281341, 3.021673993, 3.059609752, 3.0956863, 3.132473364, 3.168912778,
+          3.203896725, 3.23935614, 3.274370158, 3.308835298, 3.342252347, 3.375935038, 3.409205496,
+          3.442067492, 3.474055001, 3.506050362, 3.53777877, 3.569153131, 3.600187603, 3.630608771,
+          3.660939294, 3.691066694, 3.72091535, 3.750500109, 3.779835656, 3.808932091, 3.837812147,
+          3.866406546, 3.894887924, 3.923108005, 3.951247094, 3.979224923, 4.007051351, 4.034735435,
+          4.062204689, 4.089630038, 4.116935209, 4.144126092, 4.171207854, 4.198184997, 4.225061424,
+          4.251840518, 4.278437573, 4.305032482, 4.33153786, 4.357955808, 4.384288289, 4.410537187,
+          4.436704352, 4.462791629, 4.488706142,
+          0.645616221, 0.704031537, 0.761755034, 0.818732815, 0.875154836, 0.930893559, 0.986072874,
+          1.040826491, 1.095165957, 1.149064198, 1.20291288, 1.25712216, 1.311261153, 1.365185453,
+          1.418885897, 1.471304091, 1.522359054, 1.567828921, 1.619735733, 1.670389648, 1.719854993,
+          1.768796109, 1.818076301, 1.866852353, 1.915101376, 1.964480034, 2.012366411, 2.059895468,
+          2.107026904, 2.154025412, 2.200863503, 2.248294482, 2.294301622, 2.340206976, 2.387807646,
+          2.434479043, 2.481212663, 2.527866822, 2.567498129, 2.612446972, 2.657308655, 2.697515044,
+          2.741043997, 2.784142943, 2.823956471, 2.865989453, 2.907648, 2.946617308, 2.987025909,
+          3.027156364, 3.06509176, 3.104136334, 3.142742704, 3.179537573, 3.216980241, 3.254092571,
+          3.289705415, 3.325817184, 3.361477615, 3.395791288, 3.43051958, 3.464800119, 3.498082677,
+          3.531499893, 3.564504239, 3.596998867, 3.628813717, 3.660658408, 3.692140811, 3.723269569,
+          3.753973393, 3.784210512, 3.814405628, 3.844312869, 3.873947267, 3.903319287, 3.932452742,
+          3.961271395, 3.9899649, 4.018456816, 4.046676182, 4.074813784, 4.102785482, 4.130601812,
+          4.158186136, 4.185722506, 4.213130076, 4.240416146, 4.267587213, 4.294648995, 4.321606484,
+          4.348463993, 4.375131975, 4.401802182, 4.428381984, 4.454873745, 4.481279542, 4.507601247,
+          4.533840602, 4.559999282, 4.585977488,
+          0.722532712, 0.780184555, 0.837172987, 0.893435716, 0.949168575, 1.008261593, 1.06436749,
+          1.119940472, 1.168164357, 1.223395372, 1.278662077, 1.334015795, 1.388444903, 1.440818124,
+          1.491508537, 1.535837846, 1.588831027, 1.640192321, 1.690164179, 1.739064705, 1.788833116,
+          1.838212242, 1.887053906, 1.935507063, 1.985793275, 2.033941232, 2.081727939, 2.129272136,
+          2.176562144, 2.225399259, 2.272185626, 2.318792941, 2.365162463, 2.411566568, 2.457926876,
+          2.504181635, 2.550534526, 2.59688347, 2.643171348, 2.684477543, 2.729408902, 2.774157664,
+          2.815280032, 2.858687259, 2.901970894, 2.942285029, 2.984431577, 3.026245437, 3.065394186,
+          3.106128089, 3.144934682, 3.184624167, 3.223900816, 3.261460234, 3.299574865, 3.337384092,
+          3.373684382, 3.410485959, 3.446045082, 3.481759708, 3.517153831, 3.551460829, 3.585932691,
+          3.61996696, 3.653569767, 3.686142776, 3.718914519, 3.751287149, 3.782921324, 3.814533653,
+          3.845684801, 3.876605803, 3.907196779, 3.93724928, 3.967238338, 3.996939711, 4.026378136,
+          4.055468794, 4.084421089, 4.113149738, 4.141568822, 4.169902778, 4.198053131, 4.22603188,
+          4.25375749, 4.281428833, 4.308959667, 4.336358824, 4.363634289, 4.390793207, 4.417841912,
+          4.444785952, 4.471531224, 4.498281846, 4.524940212, 4.55150932, 4.577991706, 4.604389528,
+          4.630704653, 4.656938744, 4.682984955,
+          0.797709226, 0.854533584, 0.914045489, 0.971349467, 1.028567313, 1.082618297, 1.132063886,
+          1.188401782, 1.245079689, 1.292421654, 1.345658339, 1.398348365, 1.458802976, 1.501828789,
+          1.55604501, 1.608386756, 1.65888572, 1.707805537, 1.75715478, 1.807157286, 1.856468627,
+          1.905340645, 1.956521268, 2.00525235, 2.053475965, 2.101460597, 2.149209238, 2.199283438,
+          2.246544746, 2.293681057, 2.340658316, 2.387587748, 2.434414819, 2.481430601, 2.528547221,
+          2.575686003, 2.623052349, 2.666040025, 2.712046988, 2.75790438, 2.800576113, 2.845379316,
+          2.890047387, 2.931711711, 2.975291918, 3.018631588, 3.059387422, 3.101677931, 3.141829937,
+          3.18297959, 3.223827732, 3.262923349, 3.302786845, 3.342334944, 3.380014731, 3.418502537,
+          3.455645614, 3.493160456, 3.529443695, 3.565864122, 3.60199012, 3.636938114, 3.672049203,
+          3.706857441, 3.740614876, 3.774366521, 3.807340885, 3.840357909, 3.87257925, 3.904769279,
+          3.936159637, 3.967600735, 3.998682184, 4.029199188, 4.059613295, 4.089709683, 4.119514056,
+          4.148932583, 4.178061617, 4.207085325, 4.235874912, 4.264445241, 4.292810639, 4.320984803,
+          4.348881162, 4.37671433, 4.404392442, 4.431925989, 4.45932456, 4.48659683, 4.513750574,
+          4.540792688, 4.567624748, 4.594463287, 4.621205975, 4.647856716, 4.674418825, 4.700895098,
+          4.727287899, 4.753599235, 4.779715821,
+          0.874797077, 0.932977446, 0.991222311, 1.03804765, 1.094950221, 1.152394836, 1.201842241,
+          1.25620054, 1.309921923, 1.362914631, 1.424399769, 1.46629317, 1.521874453, 1.575273211,
+          1.62644553, 1.675572701, 1.723320326, 1.773857894, 1.823855094, 1.873231713, 1.921976003,
+          1.974109685, 2.022935996, 2.071351803, 2.119341708, 2.16722513, 2.218187213, 2.265770838,
+          2.313034572, 2.360288705, 2.407516231, 2.454846175, 2.502224283, 2.54968077, 2.596254144,
+          2.642769035, 2.68947647, 2.736135375, 2.78284149, 2.826211311, 2.871945192, 2.917713827,
+          2.960271046, 3.004836292, 3.047140293, 3.090931758, 3.132711256, 3.175617864, 3.21659089,
+          3.258623627, 3.299022126, 3.340064087, 3.379752528, 3.41984925, 3.458495541, 3.497709617,
+          3.535696182, 3.57414872, 3.611273339, 3.647863567, 3.684831816, 3.720659881, 3.756100545,
+          3.791606416, 3.826155591, 3.860579563, 3.894274385, 3.927588778, 3.960823255, 3.993324702,
+          4.025586696, 4.057342459, 4.088965926, 4.120218068, 4.150914943, 4.181468458, 4.211701583,
+          4.241362141, 4.271006066, 4.300372641, 4.329477925, 4.358245393, 4.386883491, 4.41530679,
+          4.443421262, 4.471461608, 4.499327866, 4.527032238, 4.554586059, 4.581999752, 4.609282809,
+          4.636443791, 4.663379585, 4.690321, 4.717160457, 4.743903082, 4.770553261, 4.797114718,
+          4.82359059, 4.849983513, 4.876173752,
+          0.951902546, 0.998943958, 1.056685096, 1.115292304, 1.164115205, 1.218958847, 1.273074992,
+          1.326197494, 1.388536098, 1.429532641, 1.486487885, 1.53085608, 1.583189516, 1.635379992,
+          1.6902227, 1.738637186, 1.78936962, 1.839324717, 1.888647528, 1.937382203, 1.990293491,
+          2.039210541, 2.087656838, 2.135774279, 2.183586537, 2.235447982, 2.283164724, 2.330674654,
+          2.377963347, 2.425374776, 2.472975915, 2.522434973, 2.569073517, 2.615959304, 2.662992665,
+          2.710279583, 2.756533681, 2.803047655, 2.849820084, 2.894593259, 2.940528868, 2.984934596,
+          3.030128916, 3.075045786, 3.118225832, 3.162590467, 3.204937178, 3.247397477, 3.290224866,
+          3.331769254, 3.373922841, 3.414709243, 3.45525026, 3.496351231, 3.535801659, 3.575065594,
+          3.613934447, 3.652383564, 3.691053603, 3.72840878, 3.765520751, 3.802197371, 3.838939527,
+          3.874696636, 3.910028478, 3.944766765, 3.979611173, 4.013634769, 4.047249473, 4.080731108,
+          4.113351975, 4.145995054, 4.177984947, 4.2096154, 4.241069769, 4.271979702, 4.302715021,
+          4.332979484, 4.362929231, 4.392709197, 4.422198521, 4.451319237, 4.480283325, 4.509005632,
+          4.53738296, 4.565673179, 4.593714213, 4.621630145, 4.64937585, 4.676963545, 4.704404557,
+          4.731709282, 4.758769499, 4.785832033, 4.812783546, 4.839630727, 4.866379393, 4.893034544,
+          4.919600432, 4.946080634, 4.972349264,
+          1.01737696, 1.069452916, 1.125281193, 1.180653841, 1.235307366, 1.288403336, 1.340023908,
+          1.391759575, 1.440155046, 1.49207181, 1.544533698, 1.597162363, 1.649590659, 1.702748889,
+          1.753014718, 1.803836581, 1.853931075, 1.903154899, 1.951725042, 2.00540509, 2.05428406,
+          2.102771578, 2.1508574, 2.198723961, 2.251302343, 2.299516759, 2.346858424, 2.394073286,
+          2.441319097, 2.492027768, 2.538898292, 2.585932312, 2.635288573, 2.681865892, 2.728580538,
+          2.775553226, 2.822866978, 2.869307687, 2.915943942, 2.961686905, 3.007998805, 3.052939443,
+          3.09869922, 3.142769095, 3.186920806, 3.231409052, 3.274722261, 3.318773712, 3.361295183,
+          3.403694895, 3.445744602, 3.487415324, 3.529511107, 3.570338267, 3.610588134, 3.650637287,
+          3.690276789, 3.729489053, 3.768286103, 3.806465329, 3.844402174, 3.882375059, 3.919386991,
+          3.955957117, 3.992084377, 4.027582054, 4.062833829, 4.097647177, 4.132321178, 4.166232814,
+          4.199557347, 4.232652837, 4.265558306, 4.29782963, 4.329720304, 4.361399103, 4.392541521,
+          4.423330903, 4.453791526, 4.484053452, 4.513885808, 4.543527278, 4.572880589, 4.601882889,
+          4.630583808, 4.659183676, 4.687504906, 4.715678063, 4.743657416, 4.771456915, 4.799089719,
+          4.826568126, 4.853778043, 4.880984425, 4.908067324, 4.935035262, 4.961895792, 4.988655529,
+          5.015320192, 5.041894666, 5.068247299,
+          1.085450327, 1.141326114, 1.188153582, 1.241815174, 1.300826965, 1.35339854, 1.400339227,
+          1.456834704, 1.508653508, 1.557642751, 1.610352478, 1.662856576, 1.715028322, 1.76663452,
+          1.817672234, 1.867856974, 1.917138159, 1.969876203, 2.019453895, 2.068486393, 2.116904769,
+          2.165446904, 2.21778498, 2.266085591, 2.313436406, 2.360528986, 2.412274402, 2.459514466,
+          2.506224422, 2.557047074, 2.603911277, 2.650548555, 2.697294444, 2.746749236, 2.793291956,
+          2.841694063, 2.887960585, 2.935556035, 2.981520042, 3.027475508, 3.073768631, 3.119590032,
+          3.164988955, 3.209826138, 3.255061933, 3.299467638, 3.343538974, 3.387279487, 3.4304707,
+          3.473508459, 3.516187932, 3.558492069, 3.601031205, 3.642578907, 3.683535835, 3.724310721,
+          3.76468453, 3.804639733, 3.844189054, 3.88311144, 3.921813791, 3.960071358, 3.997897499,
+          4.035279053, 4.072213159, 4.108491375, 4.144535064, 4.180129609, 4.215276971, 4.249973104,
+          4.284041776, 4.31788197, 4.351295391, 4.38449134, 4.41705657, 4.449218155, 4.481000188,
+          4.512381962, 4.54342156, 4.574115383, 4.604584031, 4.634614985, 4.664433137, 4.693865719,
+          4.722952861, 4.751925057, 4.780583326, 4.809069959, 4.8373354, 4.865395091, 4.893226843,
+          4.920922893, 4.948320316, 4.97570564, 5.002950549, 5.030065563, 5.057060206, 5.083942999,
+          5.110721477, 5.137402212, 5.163848071,
+          1.147536557, 1.201480212, 1.269697585, 1.314571668, 1.365119445, 1.417658128, 1.469509561,
+          1.52115649, 1.570068451, 1.622911547, 1.675492758, 1.727889639, 1.779439643, 1.830849128,
+          1.882057783, 1.931718849, 1.982490851, 2.032903136, 2.083168457, 2.132742259, 2.182641548,
+          2.23229411, 2.281634926, 2.330988339, 2.379803968, 2.429135494, 2.477827867, 2.526003422,
+          2.573571459, 2.623052127, 2.670445316, 2.717447373, 2.76406006, 2.813009769, 2.859458302,
+          2.907486759, 2.953627282, 3.001058795, 3.046935343, 3.092623858, 3.139152367, 3.185262539,
+          3.230797099, 3.276090677, 3.321236635, 3.366049086, 3.410521012, 3.454684952, 3.498322195,
+          3.541846294, 3.585465741, 3.628333038, 3.670866479, 3.713045105, 3.754641639, 3.795608605,
+          3.836675037, 3.877343734, 3.917626979, 3.957285432, 3.996755292, 4.035793523, 4.074412334,
+          4.112595172, 4.150336396, 4.187404319, 4.223933891, 4.260350586, 4.29631565, 4.331821428,
+          4.36666715, 4.401294323, 4.435478784, 4.469226231, 4.502543699, 4.535432818, 4.567916696,
+          4.599954556, 4.631642963, 4.662954558, 4.693902834, 4.72460534, 4.754857766, 4.78479207,
+          4.814334269, 4.843677487, 4.872811614, 4.901619978, 4.930238357, 4.958621493, 4.986785464,
+          5.014709389, 5.042338745, 5.069945358, 5.0973902, 5.124685805, 5.151843759, 5.178874651,
+          5.205788053, 5.23259251, 5.259145342,
+          1.226591836, 1.275507738, 1.325108656, 1.377804315, 1.429863078, 1.481475047, 1.529039385,
+          1.581991163, 1.634876144, 1.687783206, 1.739815431, 1.791492086, 1.843051756, 1.892450976,
+          1.943396226, 1.994261056, 2.044958135, 2.094398501, 2.144845318, 2.194094886, 2.244002595,
+          2.293836716, 2.343057862, 2.392545528, 2.441628703, 2.490786394, 2.539794669, 2.588608493,
+          2.637127591, 2.685601565, 2.73371551, 2.781816817, 2.829429762, 2.87706069, 2.924370396,
+          2.971191332, 3.018324949, 3.064862166, 3.11158027, 3.157642408, 3.203959307, 3.249710728,
+          3.295604438, 3.3410188, 3.386352818, 3.431412638, 3.476184991, 3.520696968, 3.564712856,
+          3.608920509, 3.652607488, 3.695974323, 3.738685295, 3.781401899, 3.82355739, 3.865607742,
+          3.907307134, 3.948633424, 3.989599304, 4.02994699, 4.070143034, 4.109541918, 4.148920889,
+          4.187881037, 4.226414112, 4.264264801, 4.301614419, 4.338841613, 4.375620596, 4.411939956,
+          4.447325403, 4.482768324, 4.517760544, 4.552304572, 4.5864044, 4.620058292, 4.653287712,
+          4.685877085, 4.718280061, 4.750279198, 4.78188629, 4.813114122, 4.843976358, 4.874578384,
+          4.90455629, 4.93441146, 4.964030161, 4.993283326, 5.022320579, 5.051038744, 5.079562332,
+          5.107811535, 5.135727149, 5.16360819, 5.191301694, 5.218797241, 5.246160934, 5.273377488,
+          5.300458574, 5.327414856, 5.354097341,
+          1.284552941, 1.337393651, 1.389542222, 1.441231748, 1.49292277, 1.540659878, 1.593504651,
+          1.646600111, 1.699613528, 1.751358746, 1.802978007, 1.852469837, 1.903451797, 1.954333955,
+          2.004272932, 2.05513, 2.105868777, 2.154887027, 2.205181219, 2.254610507, 2.30444398,
+          2.35431344, 2.403558529, 2.45309291, 2.502217799, 2.551454549, 2.600433028, 2.649163503,
+          2.697809352, 2.746407661, 2.794516716, 2.84275218, 2.890338403, 2.938177625, 2.98557946,
+          3.032836385, 3.079943936, 3.126957961, 3.173769698, 3.220237424, 3.266665261, 3.312850774,
+          3.358869746, 3.404457084, 3.450021393, 3.495352823, 3.540430708, 3.58527946, 3.629650144,
+          3.6739891, 3.7180601, 3.761841216, 3.805352561, 3.848570566, 3.891242244, 3.933848603,
+          3.976131476, 4.018067733, 4.059671375, 4.100321615, 4.141192055, 4.181674632, 4.221781042,
+          4.26115994, 4.30045366, 4.339062923, 4.377230835, 4.415260172, 4.452852321, 4.489736192,
+          4.52617461, 4.562440848, 4.598255291, 4.633408662, 4.668326594, 4.702788258, 4.73681302,
+          4.770154674, 4.803170701, 4.835919107, 4.868251668, 4.900178889, 4.931712456, 4.962865122,
+          4.993438421, 5.023964822, 5.054062757, 5.083838657, 5.113370789, 5.142543777, 5.171444244,
+          5.20013307, 5.228353571, 5.256572346, 5.28457393, 5.312345243, 5.33996256, 5.367408246,
+          5.394695983, 5.421821753, 5.448664427,
+          1.348723073, 1.400558703, 1.452301763, 1.499171904, 1.552017937, 1.604968266, 1.65897642,
+          1.710664902, 1.762149146, 1.811935885, 1.862696216, 1.913712851, 1.964110033, 2.014998023,
+          2.064521545, 2.114899907, 2.165383142, 2.214756036, 2.264878534, 2.314420129, 2.364127689,
+          2.4137464, 2.463305286, 2.512749948, 2.561975384, 2.611080687, 2.660168508, 2.708820873,
+          2.757523955, 2.805752581, 2.854277078, 2.902180029, 2.950241823, 2.997884933, 3.045637192,
+          3.092968881, 3.140299015, 3.187492797, 3.234646396, 3.28129835, 3.327936053, 3.37436214,
+          3.420609332, 3.466441603, 3.512282828, 3.557910908, 3.603302488, 3.648483818, 3.693195423,
+          3.737905003, 3.782367114, 3.826559684, 3.870505626, 3.914181232, 3.957322072, 4.000434789,
+          4.043249814, 4.085743746, 4.127648957, 4.169223112, 4.210728469, 4.251870851, 4.292363791,
+          4.33276913, 4.37279114, 4.411841203, 4.451065174, 4.48987668, 4.527998241, 4.565946047,
+          4.602934936, 4.640026828, 4.676673512, 4.712658864, 4.748408944, 4.783699202, 4.818368036,
+          4.852500769, 4.886473822, 4.919861842, 4.952968047, 4.985648339, 5.017911779, 5.049768761,
+          5.080990443, 5.112083835, 5.142808224, 5.173178167, 5.20320894, 5.232916386, 5.262373497,
+          5.291476907, 5.320107743, 5.348732615, 5.377069633, 5.405215117, 5.433114366, 5.460846133,
+          5.4883929, 5.515749056, 5.542790407,
+          1.411355395, 1.463099508, 1.510474485, 1.563223178, 1.61824695, 1.669681538, 1.720077774,
+          1.770908936, 1.821531221, 1.872575264, 1.923431233, 1.974364266, 2.0239023, 2.074217539,
+          2.124781657, 2.174379071, 2.224544394, 2.274023573, 2.323883987, 2.37366523, 2.423217331,
+          2.472897005, 2.522371797, 2.571789714, 2.620790374, 2.669966401, 2.718655962, 2.767590261,
+          2.81580894, 2.864501792, 2.912578152, 2.961019072, 3.009062896, 3.056922318, 3.104670346,
+          3.152166457, 3.199661368, 3.247022432, 3.294198158, 3.341045669, 3.387901203, 3.43456141,
+          3.481060591, 3.527150443, 3.573271763, 3.6191927, 3.664889177, 3.710390571, 3.755426711,
+          3.800487018, 3.845316201, 3.889891809, 3.934239733, 3.978336193, 4.021905516, 4.06548025,
+          4.108779688, 4.151780575, 4.194270007, 4.236387642, 4.278476169, 4.320226508, 4.361391886,
+          4.402455504, 4.443160839, 4.482920516, 4.522872038, 4.56218101, 4.601333294, 4.640065542,
+          4.677830244, 4.715734756, 4.752983467, 4.790014388, 4.826399533, 4.862531363, 4.898042458,
+          4.932983723, 4.967791392, 5.001996676, 5.035915811, 5.069394569, 5.102313809, 5.134938129,
+          5.166872607, 5.198686764, 5.230104498, 5.261054704, 5.291725316, 5.322040213, 5.352078339,
+          5.381721948, 5.41083286, 5.439889586, 5.468714115, 5.49723185, 5.525508232, 5.553590089,
+          5.581428473, 5.609097506, 5.636385879,
+          1.469275444, 1.521801636, 1.577233467, 1.628520258, 1.679114916, 1.729855596, 1.779955567,
+          1.831078181, 1.882379377, 1.932513411, 1.982853492, 2.033231373, 2.083334028, 2.133459098,
+          2.18327469, 2.233186422, 2.283131372, 2.332829553, 2.382490273, 2.432327905, 2.481945678,
+          2.531415039, 2.580771601, 2.630093322, 2.678920494, 2.728042077, 2.77661063, 2.825520069,
+          2.873705364, 2.922411669, 2.970440133, 3.018691913, 3.066951984, 3.114971208, 3.162861408,
+          3.210483435, 3.258106217, 3.30560445, 3.352930378, 3.399940213, 3.446982258, 3.493844607,
+          3.540563023, 3.586878032, 3.633248491, 3.679433749, 3.725409035, 3.771206654, 3.816544791,
+          3.861934554, 3.90698764, 3.95192079, 3.996642968, 4.041129844, 4.085093949, 4.129093893,
+          4.172837422, 4.21630135, 4.259508322, 4.301939074, 4.344560917, 4.386867307, 4.428876296,
+          4.470330706, 4.511668035, 4.552329974, 4.592732969, 4.632999085, 4.67265258, 4.712132695,
+          4.750657704, 4.789348578, 4.827409097, 4.86525652, 4.902472062, 4.939440299, 4.975791275,
+          5.0115477, 5.047036229, 5.082245451, 5.116855434, 5.151171079, 5.184910789, 5.218346174,
+          5.251040208, 5.283523055, 5.31570029, 5.347469008, 5.378840459, 5.409827106, 5.440442498,
+          5.470701137, 5.500363367, 5.529969486, 5.559265625, 5.588268577, 5.616995321, 5.645499136,
+          5.673719967, 5.701715484, 5.729310991,
+          1.536137343, 1.587545429, 1.63788434, 1.688388554, 1.73840779, 1.789589075, 1.841324771,
+          1.891248291, 1.941662081, 1.991963074, 2.042126759, 2.092305363, 2.142062088, 2.191939005,
+          2.241893189, 2.291634434, 2.341547892, 2.391098487, 2.440882557, 2.490425636, 2.539836787,
+          2.589080982, 2.638381843, 2.687261124, 2.736266872, 2.784873075, 2.83380021, 2.882265267,
+          2.930758461, 2.979231778, 3.027626988, 3.076157401, 3.124201916, 3.172318401, 3.220291012,
+          3.26799177, 3.315707837, 3.363137176, 3.410597202, 3.457754895, 3.504967708, 3.552013892,
+          3.598931019, 3.645448934, 3.692045875, 3.73847255, 3.784703259, 3.83077287, 3.876386885,
+          3.922078071, 3.967569331, 4.012836073, 4.057793491, 4.10264411, 4.14697451, 4.191369579,
+          4.235524673, 4.279416214, 4.323070065, 4.366151576, 4.409109168, 4.45192555, 4.494467593,
+          4.536710138, 4.578444503, 4.619692073, 4.660967332, 4.701688549, 4.74225711, 4.782239007,
+          4.821691604, 4.861138122, 4.899975868, 4.93861607, 4.976637742, 5.014236689, 5.051606037,
+          5.087993761, 5.124501063, 5.160398243, 5.196015155, 5.23103266, 5.265754674, 5.299894703,
+          5.333383733, 5.36667615, 5.399656121, 5.432106996, 5.46424516, 5.495974086, 5.527304867,
+          5.558175284, 5.588463363, 5.618700152, 5.648593331, 5.678158805, 5.707413029, 5.736372844,
+          5.765093662, 5.7935116, 5.821445731,
+          1.596611983, 1.646888822, 1.696761987, 1.749114905, 1.800256103, 1.849929691, 1.900298167,
+          1.950681176, 2.000781749, 2.050989082, 2.100560135, 2.150586527, 2.200366121, 2.250057598,
+          2.299878129, 2.349563045, 2.39934135, 2.448818693, 2.498379801, 2.547712268, 2.597012108,
+          2.6459906, 2.695230871, 2.743948172, 2.792866509, 2.841446492, 2.890201637, 2.938810007,
+          2.987247106, 3.035788956, 3.084371472, 3.13257769, 3.180649242, 3.228792294, 3.276800678,
+          3.324552551, 3.372345669, 3.420054042, 3.467623114, 3.514898427, 3.56224889, 3.609444523,
+          3.656526428, 3.703214116, 3.749879723, 3.796518745, 3.842976555, 3.889290589, 3.935153236,
+          3.981119711, 4.026901384, 4.072472198, 4.117866007, 4.16305602, 4.207728701, 4.252495936,
+          4.29692372, 4.341213946, 4.385283964, 4.428783837, 4.472359522, 4.515657832, 4.558703226,
+          4.601308706, 4.64377568, 4.685573487, 4.727442114, 4.768803836, 4.810013574, 4.850870352,
+          4.890795615, 4.930953819, 4.970540781, 5.009936436, 5.04874405, 5.087327484, 5.12532237,
+          5.162682575, 5.199850037, 5.23659389, 5.273066593, 5.308939584, 5.344524326, 5.379517595,
+          5.41382436, 5.447956935, 5.481659324, 5.515043117, 5.547991959, 5.580413629, 5.612519141,
+          5.644130542, 5.675102273, 5.706035484, 5.73659441, 5.766793351, 5.796592307, 5.826122448,
+          5.855340087, 5.88430323, 5.912671361,
+          1.655332627, 1.706041502, 1.757977448, 1.808515772, 1.859034075, 1.909007787, 1.959251962,
+          2.008875557, 2.058963727, 2.108736786, 2.158571997, 2.208361453, 2.258029697, 2.307669677,
+          2.357329936, 2.406883852, 2.456489173, 2.505732087, 2.55518775, 2.604228788, 2.653440389,
+          2.702229832, 2.751335151, 2.799987494, 2.848695196, 2.897394378, 2.946080343, 2.99492929,
+          3.043352986, 3.091886427, 3.140143935, 3.188490213, 3.236557433, 3.284720943, 3.332765693,
+          3.380565622, 3.428425732, 3.476215577, 3.523876191, 3.571248767, 3.618715179, 3.665905808,
+          3.713129965, 3.75996451, 3.806928326, 3.85375302, 3.900410102, 3.946940174, 3.993022509,
+          4.039127752, 4.085172842, 4.131021278, 4.176709732, 4.222209772, 4.267193912, 4.312301516,
+          4.357200925, 4.401866407, 4.446329651, 4.490224472, 4.534227452, 4.577969561, 4.621478404,
+          4.664589985, 4.707562187, 4.749865458, 4.792280922, 4.834400438, 4.87604276, 4.917514699,
+          4.958256123, 4.998904435, 5.039378441, 5.079493568, 5.119046369, 5.158391142, 5.197168875,
+          5.235117002, 5.273278118, 5.310848958, 5.348165347, 5.384885331, 5.421177415, 5.457182373,
+          5.492173167, 5.527306211, 5.561860569, 5.595980997, 5.629781147, 5.663033183, 5.69596145,
+          5.728367185, 5.760077286, 5.791770602, 5.822987254, 5.853895942, 5.884429191, 5.914601205,
+          5.944373455, 5.973873763, 6.002752612,
+          1.716637475, 1.767156693, 1.817609317, 1.867480844, 1.917838068, 1.96725026, 2.01729801,
+          2.066869995, 2.116754023, 2.166297612, 2.215968945, 2.26551605, 2.315186828, 2.364586587,
+          2.414173043, 2.463501726, 2.512993933, 2.561957277, 2.611278785, 2.660125994, 2.709170476,
+          2.757839802, 2.806729859, 2.855445153, 2.904306813, 2.953001677, 3.001655827, 3.05029985,
+          3.098701424, 3.147199289, 3.195583825, 3.243728857, 3.291793059, 3.339976383, 3.38805269,
+          3.435891407, 3.483805622, 3.531661153, 3.57939534, 3.626711942, 3.67427519, 3.72170517,
+          3.769051491, 3.816011052, 3.863123969, 3.910111502, 3.956831155, 4.003553012, 4.049829704,
+          4.096264634, 4.142545729, 4.188644146, 4.234599853, 4.280382931, 4.325651736, 4.371074172,
+          4.416304405, 4.461315311, 4.506141577, 4.550400227, 4.594798845, 4.638951936, 4.682890218,
+          4.726586706, 4.770033527, 4.81281034, 4.855601187, 4.898247155, 4.940608215, 4.982659129,
+          5.023978502, 5.065267313, 5.106390584, 5.147178442, 5.18744047, 5.227503165, 5.267032781,
+          5.30588968, 5.344661955, 5.383207999, 5.421174508, 5.458894572, 5.496025265, 5.532733418,
+          5.568692944, 5.604551953, 5.63997708, 5.675095076, 5.709639893, 5.743867241, 5.777536234,
+          5.810777086, 5.843269269, 5.875683811, 5.907772816, 5.939370228, 5.970649625, 6.00153929,
+          6.031989819, 6.062144745, 6.091601828,
+          1.776196542, 1.8260384, 1.876291973, 1.925599507, 1.975808081, 2.025081151, 2.074855911,
+          2.124252246, 2.173948245, 2.223381656, 2.272875037, 2.322255941, 2.371784005, 2.420983621,
+          2.470431416, 2.519506627, 2.568829819, 2.617580026, 2.666732476, 2.715403643, 2.76418676,
+          2.813281347, 2.861906325, 2.910632821, 2.959196492, 3.007896449, 3.056508555, 3.105089992,
+          3.153420439, 3.201866786, 3.250215466, 3.298352933, 3.346411196, 3.394607292, 3.442704302,
+          3.490567872, 3.538520406, 3.586424886, 3.634081369, 3.681593021, 3.729236536, 3.77675686,
+          3.82420749, 3.871272607, 3.918400769, 3.965530369, 4.012515972, 4.059405778, 4.105851695,
+          4.15248262, 4.198974239, 4.245296309, 4.291492461, 4.337531286, 4.383056725, 4.428766084,
+          4.474299032, 4.519626974, 4.564787841, 4.609381437, 4.654146791, 4.698681424, 4.743019212,
+          4.787131916, 4.831012, 4.874218992, 4.917617458, 4.960759456, 5.003636452, 5.046222563,
+          5.088075148, 5.130112158, 5.171688858, 5.213102487, 5.254193145, 5.294767175, 5.335172382,
+          5.374722538, 5.414244573, 5.453559733, 5.492315073, 5.530843126, 5.568796222, 5.606340437,
+          5.643110028, 5.679827318, 5.716117911, 5.752114774, 5.787532414, 5.822514689, 5.857180071,
+          5.891282924, 5.924588559, 5.957844276, 5.990675567, 6.023176638, 6.055171267, 6.086840816,
+          6.118035569, 6.148915695, 6.179018533,
+          1.834091216, 1.884081834, 1.934214222, 1.983302829, 2.033184556, 2.08233387, 2.131898707,
+          2.181171992, 2.230652694, 2.279949366, 2.329269658, 2.378476519, 2.427848642, 2.4768135,
+          2.526068205, 2.574929013, 2.62408599, 2.672643027, 2.721475119, 2.770546013, 2.819049214,
+          2.867743016, 2.916430679, 2.965139113, 3.013635027, 3.062251045, 3.110775061, 3.159282166,
+          3.207547483, 3.255952724, 3.304272027, 3.352574688, 3.400452819, 3.448649622, 3.496753324,
+          3.544626416, 3.592601745, 3.640540036, 3.688240956, 3.735798833, 3.783507641, 3.83110229,
+          3.878640327, 3.925792616, 3.97303293, 4.020284404, 4.067402202, 4.114438758, 4.161031444,
+          4.207835469, 4.254513844, 4.301034851, 4.34744614, 4.393714774, 4.43947004, 4.48543942,
+          4.531247844, 4.576865213, 4.622333047, 4.667233678, 4.71233796, 4.75722611, 4.801935339,
+          4.846435923, 4.890820279, 4.934429934, 4.97826984, 5.021871479, 5.065226774, 5.108308981,
+          5.150654548, 5.193229072, 5.235522396, 5.27752501, 5.319227084, 5.360443771, 5.401506723,
+          5.441705304, 5.481939847, 5.521981512, 5.561659784, 5.600790979, 5.63953966, 5.678055231,
+          5.715450238, 5.753165677, 5.790304847, 5.827023343, 5.863456273, 5.899310618, 5.934731661,
+          5.969841347, 6.003856928, 6.037987534, 6.071790024, 6.105048705, 6.137976394, 6.170382471,
+          6.202377002, 6.234044071, 6.264853084,
+          1.892757995, 1.941695593, 1.991447716, 2.040457706, 2.090124584, 2.139128617, 2.188439225,
+          2.237835655, 2.286877975, 2.336220803, 2.385170108, 2.434384733, 2.48335331, 2.532385805,
+          2.581168412, 2.630193376, 2.678691281, 2.727477536, 2.77607989, 2.82473681, 2.873243613,
+          2.921921962, 2.970531688, 3.019142651, 3.067529944, 3.116054457, 3.164499719, 3.212944852,
+          3.261151938, 3.309516348, 3.357800946, 3.40607916, 3.453943989, 3.502129226, 3.550226566,
+          3.598095893, 3.646081218, 3.694040958, 3.741776435, 3.789367077, 3.837127123, 3.88478096,
+          3.932390543, 3.979612913, 4.026950074, 4.074305517, 4.121536772, 4.168700717, 4.21541959,
+          4.26237569, 4.309218953, 4.355916075, 4.402519039, 4.448993267, 4.494953155, 4.541157012,
+          4.587214806, 4.633094909, 4.678842786, 4.72402318, 4.769527445, 4.814740692, 4.859793234,
+          4.904653802, 4.949315241, 4.993390903, 5.037640237, 5.081668744, 5.125468667, 5.169012152,
+          5.211815014, 5.255011332, 5.297829794, 5.340378326, 5.382647668, 5.424465558, 5.466141002,
+          5.506942963, 5.548002549, 5.588732554, 5.628955081, 5.668987024, 5.708490445, 5.7477828,
+          5.785929221, 5.824460366, 5.862428628, 5.900144868, 5.937286287, 5.97400802, 6.010445224,
+          6.046304408, 6.081149413, missing, missing, missing, missing, missing, missing, missing,
+          missing,
+          1.949890526, 1.998753712, 2.048308318, 2.097154637, 2.146541819, 2.195717632, 2.244513489,
+          2.293746222, 2.342640618, 2.391784424, 2.44054093, 2.48956631, 2.538301603, 2.587146232,
+          2.635648636, 2.684456965, 2.733006923, 2.78176062, 2.830243495, 2.878825504, 2.927242325,
+          2.975815166, 3.02431549, 3.072823984, 3.121109872, 3.169551223, 3.2179204, 3.266124669,
+          3.31426767, 3.362583405, 3.410824201, 3.459068148, 3.507044496, 3.555070026, 3.603150665,
+          3.651005887, 3.698991027, 3.746961817, 3.794722242, 3.842333202, 3.890131531, 3.937830697,
+          3.98549745, 4.032774489, 4.080194685, 4.127637998, 4.174965764, 4.222239542, 4.269065893,
+          4.316154978, 4.363143268, 4.409995734, 4.456768948, 4.503426544, 4.54956778, 4.59598235,
+          4.642351275, 4.688467302, 4.734467962, 4.779900275, 4.825599574, 4.871196979, 4.916564183,
+          4.961755631, 5.006764393, 5.051176831, 5.095805665, 5.140230615, 5.184444162, 5.228516531,
+          5.271746109, 5.315290368, 5.358592127, 5.401642919, 5.444559419, 5.4870686, 5.529319559,
+          5.570687521, 5.61221832, 5.653584197, 5.694632844, 5.73535376, 5.775573682, 5.815600668,
+          5.85462671, 5.893774035, 5.93270347, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing,
+          2.006697867, 2.055407773, 2.104624007, 2.153683282, 2.202496543, 2.251488403, 2.300156099,
+          2.349169503, 2.397895807, 2.446847014, 2.495373954, 2.544193433, 2.593036239, 2.641279583,
+          2.690138421, 2.738525906, 2.786980407, 2.835314426, 2.883774703, 2.932278029, 2.980583302,
+          3.029041663, 3.077427956, 3.125835776, 3.174024665, 3.222386607, 3.270680518, 3.318993049,
+          3.366909602, 3.415169846, 3.463359331, 3.511560911, 3.559491511, 3.607497521, 3.6555534,
+          3.703386077, 3.751362232, 3.799334706, 3.847221045, 3.894730652, 3.942555764, 3.990288016,
+          4.037999302, 4.085317416, 4.132902873, 4.180418799, 4.227826872, 4.275193589, 4.322109283,
+          4.369312881, 4.416426926, 4.463414523, 4.510337068, 4.557156275, 4.60345594, 4.650057829,
+          4.696541189, 4.742871089, 4.789183441, 4.834842353, 4.88079909, 4.926664066, 4.972318813,
+          5.017813464, 5.063141359, 5.107862017, 5.152841702, 5.197722258, 5.242319488, 5.286691844,
+          5.330410361, 5.374389764, 5.418144877, 5.461667597, 5.505061914, 5.54807827, 5.590857897,
+          5.632744935, 5.674994308, 5.716958608, 5.75862801, 5.799992412, 5.840886728, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing,
+          2.062942212, 2.111523614, 2.160481352, 2.209337663, 2.25804831, 2.306796805, 2.355309215,
+          2.404120695, 2.452873319, 2.501384676, 2.550001151, 2.598273165, 2.64701887, 2.695235629,
+          2.743601341, 2.791921725, 2.840547263, 2.888760328, 2.937099926, 2.985481844, 3.033658845,
+          3.082002994, 3.130103516, 3.178416247, 3.226507468, 3.274785349, 3.32299771, 3.371237548,
+          3.419232426, 3.467293954, 3.515426056, 3.563578912, 3.611456842, 3.659555174, 3.707461539,
+          3.755264256, 3.803223552, 3.851189363, 3.899074011, 3.946692976, 3.994433219, 4.042187949,
+          4.089932816, 4.137280086, 4.184916996, 4.232493607, 4.279969382, 4.327416056, 4.374407256,
+          4.421711286, 4.468936397, 4.516043642, 4.563099491, 4.610063556, 4.656584024, 4.703353068,
+          4.750016142, 4.796536485, 4.843051928, 4.888914082, 4.935104119, 4.981210601, 5.027127375,
+          5.07289902, 5.118598223, 5.163520589, 5.208905074, 5.254035098, 5.298987035, 5.343813042,
+          5.387799859, 5.432272783, 5.476448497, 5.520409593, 5.564248539, 5.607736654, 5.651008483,
+          5.693494986, 5.736281108, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing,
+          2.118741671, 2.167467171, 2.215954137, 2.264550953, 2.313125716, 2.361656426, 2.410169829,
+          2.458595355, 2.507136153, 2.555666882, 2.603873637, 2.652120354, 2.700397212, 2.748754998,
+          2.796990618, 2.845191882, 2.893473689, 2.941576335, 2.989794926, 3.038054319, 3.086105161,
+          3.13434039, 3.182514019, 3.23072855, 3.278717173, 3.32675667, 3.374884388, 3.423048662,
+          3.470963977, 3.519098996, 3.567044232, 3.615143586, 3.662963455, 3.711020736, 3.759007771,
+          3.806665843, 3.854601507, 3.902553541, 3.950428727, 3.998038636, 4.045888166, 4.093655382,
+          4.141332316, 4.188698241, 4.236375974, 4.284002033, 4.331533535, 4.379047727, 4.426100978,
+          4.47357245, 4.520892477, 4.568102356, 4.615273852, 4.662364357, 4.708925955, 4.755921655,
+          4.802745366, 4.849436156, 4.896133296, 4.942177171, 4.98857821, 5.034902468, 5.081057415,
+          5.127156912, 5.173041689, 5.218301294, 5.263898618, 5.309340231, 5.354695991, 5.399777345,
+          5.444179388, 5.48902044, 5.533585785, 5.577953608, 5.622206512, 5.666136954, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing,
+          2.174158011, 2.222610971, 2.270963547, 2.319332625, 2.367901379, 2.416086215, 2.464379148,
+          2.512757487, 2.560960135, 2.609177606, 2.657449332, 2.705522159, 2.753649546, 2.80161447,
+          2.849759666, 2.898046299, 2.946198765, 2.994162768, 3.042081426, 3.090220641, 3.138149605,
+          3.186277742, 3.2343454, 3.282461062, 3.330345971, 3.37844716, 3.426355408, 3.474441904,
+          3.522274186, 3.570341548, 3.618346168, 3.66627455, 3.714032051, 3.76204409, 3.809989006,
+          3.857713158, 3.905520539, 3.953452836, 4.001311973, 4.048905623, 4.096756054, 4.144528606,
+          4.192312274, 4.239686339, 4.287394217, 4.335058388, 4.382633505, 4.430202557, 4.477304059,
+          4.524767534, 4.572171278, 4.619547326, 4.666819925, 4.714021625, 4.760688129, 4.807813435,
+          4.85478037, 4.901623298, 4.948482988, 4.994688702, 5.041352327, 5.087800685, 5.134171568,
+          5.180495045, 5.226622605, 5.272111956, 5.318053907, 5.363778823, 5.409430901, 5.454823727,
+          5.499528757, 5.544629857, 5.589636379, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing,
+          2.229118694, 2.277335167, 2.325666769, 2.373708276, 2.42206123, 2.470149618, 2.518161652,
+          2.56646961, 2.61444905, 2.662479611, 2.710327303, 2.758486712, 2.806481023, 2.85431082,
+          2.902332663, 2.950299495, 2.998325296, 3.046153151, 3.0941149, 3.142136198, 3.189942878,
+          3.237962599, 3.285779914, 3.333796119, 3.381576836, 3.429589303, 3.477543548, 3.525430725,
+          3.57317743, 3.621174871, 3.66911135, 3.717094056, 3.764681203, 3.812644722, 3.860543685,
+          3.908221588, 3.956093416, 4.004000227, 4.051747881, 4.099319101, 4.147164184, 4.194935213,
+          4.242727391, 4.29010256, 4.337833588, 4.385528449, 4.433139177, 4.48083038, 4.527968978,
+          4.57549384, 4.622967593, 4.670344338, 4.717778595, 4.765077642, 4.811834162, 4.859073889,
+          4.906168093, 4.953146347, 5.000151324, 5.046500464, 5.09333141, 5.139960516, 5.186594735,
+          5.233053137, 5.279469056, 5.325097781, 5.371280849, 5.417336666, 5.463186743, 5.508937041,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing,
+          2.283775321, 2.331667639, 2.379793781, 2.427703062, 2.475827912, 2.523821502, 2.571617782,
+          2.619526433, 2.667549755, 2.715389662, 2.763070408, 2.810869993, 2.858748184, 2.906446428,
+          2.954338142, 3.002168738, 3.050064116, 3.097757617, 3.145596349, 3.193502589, 3.241187841,
+          3.289099853, 3.336953287, 3.384743461, 3.432420136, 3.480343795, 3.528210193, 3.576137207,
+          3.623686884, 3.671613101, 3.719479746, 3.767400961, 3.815023999, 3.862840189, 3.910690167,
+          3.958318149, 4.006152056, 4.054029939, 4.10184024, 4.149382635, 4.197215794, 4.244978029,
+          4.292770983, 4.340138449, 4.387883743, 4.435599826, 4.483235997, 4.530887402, 4.578127984,
+          4.625704068, 4.673237081, 4.720678564, 4.768187108, 4.815570905, 4.862403821, 4.909744272,
+          4.956951125, 5.004116937, 5.051183827, 5.097726663, 5.144640534, 5.191498704, 5.238238217,
+          5.28495036, 5.331495306, 5.37738012, 5.423784791, 5.47000541, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          2.337816823, 2.385614723, 2.43352418, 2.481345855, 2.529265812, 2.576892076, 2.624655109,
+          2.672371198, 2.720004865, 2.76771051, 2.815403526, 2.863055566, 2.910792229, 2.958341026,
+          3.006094961, 3.053788515, 3.101555796, 3.149116659, 3.19683335, 3.244488763, 3.292052812,
+          3.339858606, 3.387606944, 3.435427983, 3.48288482, 3.530719971, 3.578498323, 3.626344961,
+          3.673916617, 3.72166915, 3.769464997, 3.817323619, 3.864876255, 3.912735368, 3.960533242,
+          4.008107395, 4.055812874, 4.103658456, 4.151438532, 4.198948647, 4.246766481, 4.294516048,
+          4.342305692, 4.389660525, 4.437489449, 4.485219663, 4.532873592, 4.580552758, 4.627738687,
+          4.675428866, 4.723011489, 4.770507392, 4.818079548, 4.865536683, 4.912433589, 4.959862337,
+          5.0071685, 5.054437464, 5.101622192, 5.14827274, 5.195324129, 5.242324192, 5.289287084,
+          5.336099514, 5.382888662, 5.428941416, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          2.391571694, 2.439232856, 2.486922752, 2.53440369, 2.582266888, 2.629678859, 2.677056117,
+          2.724605074, 2.7722512, 2.819799315, 2.867165885, 2.914683194, 2.962285344, 3.009689196,
+          3.057310313, 3.104871675, 3.152515238, 3.199946153, 3.247542843, 3.295222221, 3.342543413,
+          3.390245564, 3.437890766, 3.485616594, 3.533086573, 3.58072676, 3.628417494, 3.676184155,
+          3.723667488, 3.771450046, 3.819079687, 3.86687522, 3.914356089, 3.9621611, 4.009905805,
+          4.057424651, 4.105172898, 4.152982315, 4.200727702, 4.248200323, 4.295997485, 4.343728431,
+          4.391508421, 4.438843313, 4.486600157, 4.53434037, 4.582077443, 4.629777255, 4.676973353,
+          4.724696676, 4.772320307, 4.819861411, 4.867487568, 4.915007777, 4.962023483, 5.00946322,
+          5.056921913, 5.104216177, 5.151569662, 5.198249622, 5.245486837, 5.292550567, 5.339652205,
+          5.38667987, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          2.444938034, 2.492270483, 2.539882205, 2.587138451, 2.634636581, 2.682026784, 2.729209731,
+          2.776578461, 2.823907952, 2.871329355, 2.918709371, 2.966077677, 3.013538795, 3.060795991,
+          3.108285539, 3.155582779, 3.2031043, 3.250406079, 3.297884291, 3.345453551, 3.392781343,
+          3.440382075, 3.48781192, 3.535444111, 3.582811974, 3.63047336, 3.677976953, 3.725664625,
+          3.773059921, 3.82077129, 3.868424543, 3.916156301, 3.963563714, 4.011226708, 4.05891709,
+          4.106378911, 4.154081824, 4.201854265, 4.249563767, 4.29699717, 4.344772025, 4.392556362,
+          4.440322578, 4.487632557, 4.535386607, 4.583129634, 4.63087153, 4.678585802, 4.725785006,
+          4.773534292, 4.821191349, 4.868769496, 4.916441036, 4.964015177, 5.01107167, 5.058580157,
+          5.106112959, 5.153488695, 5.200931973, 5.247758508, 5.295039176, 5.34228006, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing,
+          2.49771385, 2.54496563, 2.592210796, 2.639422512, 2.686719004, 2.733758452, 2.780792393,
+          2.828186268, 2.875354452, 2.922624064, 2.969701961, 3.016927747, 3.064253552, 3.111369272,
+          3.158732895, 3.206037606, 3.253440765, 3.300616979, 3.347859406, 3.395322661, 3.442536317,
+          3.490038734, 3.537483506, 3.584918122, 3.632185082, 3.679761746, 3.727280616, 3.774890534,
+          3.822104214, 3.869745482, 3.917328362, 3.964997496, 4.012331915, 4.060026179, 4.107660519,
+          4.15506293, 4.202717974, 4.25045058, 4.298120806, 4.345510906, 4.393259316, 4.440944239,
+          4.488695403, 4.536048629, 4.583795808, 4.631537169, 4.679209906, 4.727002159, 4.774198331,
+          4.821967274, 4.869651146, 4.917259193, 4.964968455, 5.012588448, 5.05967675, 5.107308438,
+          5.154842095, 5.202351086, 5.249811288, 5.296706878, 5.344106365, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing,
+          2.550155077, 2.597202455, 2.6442459, 2.691105012, 2.738263483, 2.78528156, 2.832154537,
+          2.879242473, 2.926263746, 2.973389623, 3.020313936, 3.067392329, 3.114590924, 3.161571712,
+          3.208814345, 3.255996346, 3.303284296, 3.350337154, 3.397588995, 3.4448369, 3.491938173,
+          3.539344614, 3.586692645, 3.63414446, 3.681312597, 3.728707431, 3.776143053, 3.82367738,
+          3.87089891, 3.918470884, 3.965983605, 4.013504403, 4.060766006, 4.108405793, 4.155985327,
+          4.203329138, 4.250937235, 4.298630827, 4.346336746, 4.393681559, 4.441401614, 4.489058879,
+          4.536790557, 4.584111093, 4.631848112, 4.679584134, 4.727253122, 4.775049123, 4.822236993,
+          4.870020128, 4.917725107, 4.965420885, 5.013097092, 5.060818647, 5.107867947, 5.155548894,
+          5.203203118, 5.250709122, 5.298306003, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing,
+          2.602156442, 2.648848487, 2.69573859, 2.742583562, 2.789578116, 2.836274457, 2.882976059,
+          2.929915914, 2.976913641, 3.023912824, 3.070699303, 3.117649742, 3.164715451, 3.211555152,
+          3.258552141, 3.305610179, 3.352783644, 3.399714402, 3.446856363, 3.494114792, 3.541105366,
+          3.588313145, 3.6355656, 3.682929703, 3.72999979, 3.777413402, 3.824767283, 3.872135306,
+          3.919272282, 3.966777558, 4.014222549, 4.061768722, 4.108957001, 4.156541918, 4.204065788,
+          4.251349484, 4.298909044, 4.346561747, 4.394152003, 4.44152506, 4.489215559, 4.536843568,
+          4.584553897, 4.631838768, 4.679563079, 4.727290842, 4.775019349, 4.82274856, 4.869923648,
+          4.917716317, 4.965437517, 5.013149764, 5.06085295, 5.108604929, 5.155734938, 5.20339608,
+          5.251098137, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing,
+          2.653612314, 2.700288234, 2.746988692, 2.793487045, 2.84033125, 2.88700403, 2.933560554,
+          2.98035908, 3.027083769, 3.073925455, 3.120547058, 3.167345211, 3.214271266, 3.260968064,
+          3.307965553, 3.354907489, 3.401977898, 3.448798965, 3.495844343, 3.542908898, 3.589799233,
+          3.637027449, 3.684193255, 3.731380397, 3.778357687, 3.825695245, 3.872971058, 3.920360602,
+          3.967414066, 4.01485376, 4.0622317, 4.109718138, 4.156833985, 4.204365278, 4.251834409,
+          4.299058353, 4.346569826, 4.394181915, 4.441730959, 4.488984186, 4.536717089, 4.58431493,
+          4.632002723, 4.679249664, 4.726959416, 4.774676696, 4.822394033, 4.870121323, 4.917344136,
+          4.965078166, 5.012874408, 5.060535478, 5.108322033, 5.156037589, 5.203177883, 5.250426097,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing,
+          2.704819772, 2.751136804, 2.797812982, 2.844165329, 2.890862649, 2.937227191, 2.983611865,
+          3.030253849, 3.076939104, 3.123630293, 3.170106443, 3.216782062, 3.263600201, 3.310179311,
+          3.357069777, 3.403907612, 3.450780982, 3.497491235, 3.544431584, 3.591502432, 3.638282973,
+          3.685320721, 3.732394499, 3.779596454, 3.826481846, 3.873746381, 3.920947719, 3.968181942,
+          4.01515589, 4.062534279, 4.10984903, 4.157279563, 4.20432613, 4.251807472, 4.299225328,
+          4.34646786, 4.393932262, 4.441504594, 4.489012963, 4.536219026, 4.583921323, 4.631488724,
+          4.67915343, 4.726360865, 4.774054846, 4.821760059, 4.869464088, 4.917187136, 4.964388453,
+          5.012126765, 5.059929556, 5.107600526, 5.155402584, 5.203202483, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing,
+          2.755466625, 2.801772903, 2.848141699, 2.894307995, 2.940841777, 2.987146299, 3.033346313,
+          3.079859803, 3.126328643, 3.17294204, 3.21934454, 3.265922605, 3.312622725, 3.359064485,
+          3.405832328, 3.452536286, 3.4992818, 3.545862812, 3.592695816, 3.639674303, 3.686353972,
+          3.733408587, 3.780397534, 3.827427678, 3.874219981, 3.92140922, 3.968533794, 4.015788385,
+          4.062681833, 4.109999545, 4.157252184, 4.204628007, 4.251605732, 4.299037685, 4.346404394,
+          4.393514155, 4.441008281, 4.488542228, 4.536011017, 4.583170351, 4.630842421, 4.678379704,
+          4.726021361, 4.77318837, 4.820865965, 4.868622757, 4.916247384, 4.963964463, 5.011141715,
+          5.058943546, 5.106688283, 5.154425675, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing,
+          2.805896805, 2.851857709, 2.898166937, 2.944118921, 2.990537274, 3.036655841, 3.082798361,
+          3.129200203, 3.175487276, 3.221902795, 3.268182437, 3.314543797, 3.361138256, 3.407449409,
+          3.454104874, 3.500720764, 3.547447618, 3.593930878, 3.640685187, 3.687574346, 3.734131557,
+          3.781056879, 3.827976236, 3.875055656, 3.921739015, 3.968813233, 4.0158899, 4.063092946,
+          4.109914007, 4.157175333, 4.204368235, 4.251691445, 4.298602006, 4.345986929, 4.393304772,
+          4.440358887, 4.487808964, 4.535306328, 4.582737073, 4.629850563, 4.677493362, 4.72500143,
+          4.772620651, 4.81974694, 4.867408101, 4.91514971, 4.962760469, 5.010531849, 5.057621704,
+          5.105421388, 5.15329622, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing,
+          2.855858673, 2.90161954, 2.947750382, 2.993673342, 3.039971067, 3.08583882, 3.131810773,
+          3.178091553, 3.224034942, 3.268840922, 3.315078671, 3.36134583, 3.407757073, 3.453909013,
+          3.500352801, 3.546722927, 3.593466806, 3.634661656, 3.680270921, 3.735150136, 3.781602513,
+          3.828468311, 3.875337477, 3.922263665, 3.968899184, 4.015961711, 4.062950695, 4.110055189,
+          4.156829726, 4.204053363, 4.251198495, 4.298476395, 4.34532368, 4.392664609, 4.43993602,
+          4.486936332, 4.534344341, 4.581807392, 4.629202174, 4.676339837, 4.723886176, 4.771366375,
+          4.819029409, 4.866050026, 4.913759188, 4.961421704, 5.009080709, 5.056780021, 5.103906053,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing,
+          2.905457505, 2.951176139, 2.997059818, 3.042781887, 3.088918398, 3.132716307, 3.178494006,
+          3.224924539, 3.270993691, 3.317204929, 3.363110243, 3.411013887, 3.45740937, 3.503551228,
+          3.550012601, 3.596389235, 3.642929205, 3.689164366, 3.735699224, 3.782419647, 3.828814937,
+          3.8756509, 3.922414887, 3.969247155, 4.015787256, 4.062775667, 4.109686852, 4.156832967,
+          4.203500102, 4.250659429, 4.29775066, 4.344986384, 4.391775519, 4.439077796, 4.486306874,
+          4.533328742, 4.580623787, 4.628054414, 4.675415125, 4.722508395, 4.770030498, 4.817551345,
+          4.865126983, 4.912109626, 4.959802154, 5.007452023, 5.055095531, 5.102954389, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing,
+          2.954694932, 3.000212997, 3.043748571, 3.089560172, 3.135574256, 3.181532013, 3.227223712,
+          3.274892522, 3.320828284, 3.366953793, 3.412755368, 3.458745826, 3.503432495, 3.549446132,
+          3.59596118, 3.642314895, 3.688762639, 3.739571286, 3.783944421, 3.830811335, 3.872010024,
+          3.9212864, missing, missing, missing, 4.107811396, 4.157387685, 4.203232288, 4.249905101,
+          4.296953859, 4.344067559, 4.391250154, 4.437972906, 4.485234512, 4.532423347, 4.579395827,
+          4.626656007, 4.674057508, 4.721454617, 4.768436402, 4.8160033, 4.863431762, 4.910990164,
+          4.957999295, 5.005612276, 5.053307164, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          3.001334686, 3.046949887, 3.092601974, 3.138029105, 3.185939514, 3.231394489, 3.276934122,
+          3.321653665, 3.367107431, 3.413164793, 3.458973869, 3.505477321, missing, missing,
+          missing, missing, missing, missing, missing, 3.875177474, 3.920646059, 3.965773447,
+          4.016331922, missing, missing, missing, missing, missing, missing, 4.343104884, 4.3900944,
+          4.437224325, 4.483918471, 4.531149175, 4.578369753, 4.625217452, 4.672513663, 4.719885989,
+          4.767186049, 4.814199998, 4.861679834, 4.909087901, 4.95669469, 5.003601935, 5.051152425,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing,
+          3.050172073, 3.095417554, 3.1429151, 3.188185176, 3.232292781, 3.277853727, 3.323335901,
+          3.369305931, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, 3.874852398, 3.92264535, 3.969271641, 4.016000319, 4.062601736,
+          4.110171379, missing, missing, missing, missing, missing, missing, 4.435058855,
+          4.483029143, 4.529642333, 4.576849062, 4.623999498, 4.670813493, 4.718072316, 4.765463221,
+          4.812758712, 4.859697676, 4.907167612, 4.954596499, 5.002159716, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing,
+          3.100434016, 3.145404082, 3.189296595, 3.234537926, 3.280407734, missing, missing,
+          missing, missing, missing, missing, 3.598533235, 3.647199048, 3.691877656, 3.73799591,
+          3.784029572, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, 4.247558403, 4.294202066, 4.341138951, 4.387601992, 4.434519566, missing,
+          4.528601417, 4.575248497, 4.622359248, 4.66944221, 4.716254747, 4.763470558, 4.81081107,
+          4.858043381, 4.905004546, 4.95248354, 4.999875525, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing,
+          3.146852151, 3.191914632, missing, missing, missing, missing, missing, 3.463522671,
+          3.510135602, 3.55585346, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, 4.573846147, 4.620385068, 4.667595334, 4.714700845,
+          4.763363206, 4.811338829, 4.854229778, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, 3.374988898, 3.420968337, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, 4.85418976, missing,
+          missing, 4.995608446, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing, missing, missing, missing, missing, missing, missing,
+          missing, missing, missing, missing};
+
+        struct LogTable
+        {
+            std::span<const double> aspectRatio;
+            std::span<const double> logLoad;
+            std::span<const double> logValues;
+        };
+
+        constexpr LogTable WNTable{WNAspectRatio, WNLogLoad, WNLogValues};
+        constexpr LogTable VNTable{VNAspectRatio, VNLogLoad, VNLogValues};
+
+        std::optional<double> tableValue(const double value)
+        {
+            return std::isnan(value) ? std::optional<double>() : value;
+        }
+
+        Table::Table2D<std::optional<double>> table2D(const LogTable & table)
+        {
+            std::vector<std::optional<double>> x(table.aspectRatio.begin(),
+                                                 table.aspectRatio.end());
+            std::vector<std::optional<double>> y(table.logLoad.begin(), table.logLoad.end());
+            std::vector<std::vector<std::optional<double>>> values;
+            for(size_t i = 0u; i < y.size(); ++i)
+            {
+                auto & row{values.emplace_back()};
+                for(size_t j = 0u; j < x.size(); ++j)
+                {
+                    row.push_back(tableValue(table.logValues[i * x.size() + j]));
+                }
+            }
+
+            return Table::Table2D{std::move(x), std::move(y), std::move(values)};
+        }
+
+        //! Interpolates the curves over the aspect ratio. Loads are taken out of the log space
+        //! once, so only the interpolated deflections need the exponent.
+        class CurveInterpolator
+        {
+        public:
+            explicit CurveInterpolator(const LogTable & table) : m_Table(table)
+            {
+                m_Load.reserve(table.logLoad.size());
+                for(const auto logLoad : table.logLoad)
+                {
+                    m_Load.push_back(std::exp(logLoad));
+                }
+            }
 
-        const std::vector<std::optional<double>> y{
-          -5,   -4.9, -4.8, -4.7, -4.6, -4.5, -4.4, -4.3, -4.2, -4.1, -4,   -3.9, -3.8, -3.7, -3.6,
-          -3.5, -3.4, -3.3, -3.2, -3.1, -3,   -2.9, -2.8, -2.7, -2.6, -2.5, -2.4, -2.3, -2.2, -2.1,
-          -2,   -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1,   -0.9, -0.8, -0.7, -0.6,
-          -0.5, -0.4, -0.3, -0.2, -0.1, 0,    0.1,  0.2,  0.3,  0.4,  0.5,  0.6,  0.7,  0.8,  0.9,
-          1,    1.1,  1.2,  1.3,  1.4,  1.5,  1.6,  1.7,  1.8,  1.9,  2,    2.1,  2.2,  2.3,  2.4,
-          2.5,  2.6,  2.7,  2.8,  2.9,  3,    3.1,  3.2,  3.3,  3.4,  3.5,  3.6,  3.7,  3.8,  3.9,
-          4,    4.1,  4.2,  4.3,  4.4,  4.5,  4.6,  4.7,  4.8,  4.9,  5};
+            [[nodiscard]] std::vector<Table::point> curve(const double aspectRatio) const
+            {
+                const auto & x{m_Table.aspectRatio};
+                const auto upperIt{std::lower_bound(x.begin(), x.end(), aspectRatio)};
+                const auto upperIndex{static_cast<size_t>(upperIt - x.begin())};
+                const auto lowIndex{upperIndex == 0u ? 0u : upperIndex - 1u};
+                // Aspect ratios above the table use its last column.
+                const auto highIndex{std::min(upperIndex, x.size() - 1u)};
+                const auto x1{x[lowIndex]};
+                const auto x2{x[highIndex]};
 
-        const std::vector<std::vector<std::optional<double>>> values{
-          {-4.781907584, -4.713365067, -4.645834221, -4.579370543, -4.513899017, -4.449501338,
-           -4.386130708, -4.323751239, -4.262396852, -4.202034265, -4.142693692, -4.084321188,
-           -4.026909425, -3.970485472, -3.914980899, -3.860420462, -3.806767586, -3.754044016,
-           -3.70219083,  -3.65119732,  -3.601083242, -3.551777572, -3.503298734, -3.455609029,
-           -3.408724767, -3.362575442, -3.317176617, -3.272491388, -3.228533761, -3.185234348,
-           -3.14260694,  -3.100616052, -3.059274454, -3.018514335, -2.978348707, -2.938761087,
-           -2.899712772, -2.861188986, -2.823185761, -2.78568922,  -2.748653906, -2.71208707,
-           -2.675959769, -2.640286175, -2.605002459, -2.570118127, -2.535624038, -2.501494789,
-           -2.467745627, -2.434316088, -2.401217422, -2.368442304, -2.335968685, -2.303790349,
-           -2.271918692, -2.240297732, -2.208940457, -2.17784161,  -2.146982844, -2.116378188,
-           -2.085981876, -2.055808721, -2.025842572, -1.996080153, -1.966514281, -1.937160738,
-           -1.907966983, -1.87895003,  -1.850103838, -1.821426194, -1.79292469,  -1.764556376,
-           -1.736337103, -1.708261982, -1.680326323, -1.652528854, -1.624858722, -1.597336441,
-           -1.56991474,  -1.542611718, -1.515423798, -1.488347206, -1.46137864,  -1.434514811,
-           -1.407775648, -1.381111334, -1.354542616, -1.328066658, -1.301680724, -1.275382177,
-           -1.249168469, -1.223037143, -1.19701107,  -1.171036869, -1.145138184, -1.119312874,
-           -1.093558867, -1.067874163, -1.042256823, -1.016704975, -0.991243473},
-          {-4.681908318, -4.61336587,  -4.545835095, -4.479371488, -4.413900035, -4.34950243,
-           -4.286131871, -4.223752473, -4.162398155, -4.102035634, -4.042695123, -3.984322677,
-           -3.926910968, -3.870487063, -3.814982531, -3.760422129, -3.706769281, -3.654045733,
-           -3.60219256,  -3.551199058, -3.501084981, -3.451779304, -3.403300453, -3.355610728,
-           -3.30872644,  -3.262577084, -3.217178224, -3.172492954, -3.128535284, -3.085235823,
-           -3.042608365, -3.000617425, -2.959275775, -2.9185156,   -2.878349917, -2.838762243,
-           -2.799713874, -2.761190034, -2.723186757, -2.685690166, -2.648654803, -2.612087919,
-           -2.575960574, -2.540286937, -2.505003181, -2.470118811, -2.435624686, -2.401495403,
-           -2.367746211, -2.334316642, -2.301217949, -2.268442807, -2.235969165, -2.203790807,
-           -2.171919131, -2.140298152, -2.108940861, -2.077841997, -2.046983217, -2.016378548,
-           -1.985982223, -1.955809056, -1.925842896, -1.896080467, -1.866514585, -1.837161032,
-           -1.807967268, -1.778950307, -1.750104107, -1.721426455, -1.692924943, -1.664556622,
-           -1.636337343, -1.608262215, -1.580326549, -1.552529074, -1.524858935, -1.49733665,
-           -1.469914943, -1.442611916, -1.415424015, -1.388347417, -1.361378845, -1.334515011,
-           -1.307775843, -1.281111524, -1.254542801, -1.228066838, -1.2016809,   -1.175382348,
-           -1.149168636, -1.123037305, -1.097011229, -1.071037024, -1.045138335, -1.019313021,
-           -0.993559011, -0.967874302, -0.942256959, -0.916705107, -0.891243603},
-          {-4.581909214, -4.51336685,  -4.445836161, -4.379372643, -4.313901279, -4.249503762,
-           -4.186133292, -4.123753981, -4.062399747, -4.002037306, -3.942696872, -3.884324497,
-           -3.826912851, -3.770489005, -3.714984523, -3.660424165, -3.606771351, -3.55404783,
-           -3.502194674, -3.451201181, -3.401087104, -3.351781419, -3.303302551, -3.255612802,
-           -3.208728484, -3.16257909,  -3.117180186, -3.072494867, -3.028537143, -2.985237625,
-           -2.942610106, -2.900619102, -2.859277387, -2.818517146, -2.778351396, -2.738763656,
-           -2.69971522,  -2.661191314, -2.623187973, -2.585691321, -2.548655898, -2.512088956,
-           -2.475961556, -2.440287868, -2.405004062, -2.370119646, -2.335625477, -2.301496154,
-           -2.267746924, -2.23431732,  -2.201218594, -2.168443421, -2.135969751, -2.103791366,
-           -2.071919667, -2.040298666, -2.008941353, -1.977842471, -1.946983672, -1.916378987,
-           -1.885982647, -1.855809465, -1.825843291, -1.796080849, -1.766514955, -1.737161391,
-           -1.707967616, -1.678950645, -1.650104435, -1.621426773, -1.592925253, -1.564556923,
-           -1.536337635, -1.508262499, -1.480326825, -1.452529342, -1.424859197, -1.397336905,
-           -1.36991519,  -1.342612157, -1.31542428,  -1.288347675, -1.261379096, -1.234515255,
-           -1.207776081, -1.181111756, -1.154543027, -1.128067058, -1.101681114, -1.075382557,
-           -1.049168839, -1.023037503, -0.997011423, -0.971037213, -0.945138519, -0.9193132,
-           -0.893559185, -0.867874472, -0.842257125, -0.816705269, -0.791243762},
-          {-4.481910309, -4.413368047, -4.345837464, -4.279374054, -4.213902798, -4.14950539,
-           -4.086135028, -4.023755823, -3.962401691, -3.902039348, -3.842699007, -3.784326719,
-           -3.726915152, -3.670491377, -3.614986957, -3.560426651, -3.50677388,  -3.454050391,
-           -3.402197257, -3.351203773, -3.301089697, -3.251784002, -3.203305114, -3.155615336,
-           -3.108730981, -3.062581541, -3.017182583, -2.972497203, -2.928539415, -2.885239826,
-           -2.842612232, -2.800621151, -2.759279357, -2.718519034, -2.678353202, -2.638765381,
-           -2.599716864, -2.561192878, -2.523189459, -2.485692731, -2.448657235, -2.412090223,
-           -2.375962756, -2.340289005, -2.305005139, -2.270120666, -2.235626444, -2.20149707,
-           -2.167747794, -2.134318147, -2.101219381, -2.068444171, -2.035970466, -2.00379205,
-           -1.971920322, -1.940299293, -1.908941955, -1.877843049, -1.846984229, -1.816379524,
-           -1.785983164, -1.755809965, -1.725843774, -1.696081316, -1.666515407, -1.63716183,
-           -1.607968042, -1.578951057, -1.550104835, -1.521427161, -1.492925631, -1.464557291,
-           -1.436337992, -1.408262846, -1.380327163, -1.35252967,  -1.324859516, -1.297337216,
-           -1.269915493, -1.242612451, -1.215424603, -1.188347989, -1.161379402, -1.134515553,
-           -1.107776372, -1.08111204,  -1.054543303, -1.028067327, -1.001681376, -0.975382812,
-           -0.949169088, -0.923037745, -0.89701166,  -0.871037444, -0.845138744, -0.819313419,
-           -0.793559399, -0.767874681, -0.742257328, -0.716705467, -0.691243956},
-          {-4.381911646, -4.31336951,  -4.245839055, -4.179375776, -4.113904653, -4.049507378,
-           -3.986137149, -3.923758072, -3.862404066, -3.802041843, -3.742701615, -3.684329433,
-           -3.626917963, -3.570494275, -3.51498993,  -3.460429688, -3.406776968, -3.354053518,
-           -3.30220041,  -3.25120694,  -3.201092865, -3.151787157, -3.103308245, -3.055618431,
-           -3.00873403,  -2.962584533, -2.91718551,  -2.872500057, -2.828542189, -2.785242514,
-           -2.742614829, -2.700623652, -2.659281762, -2.61852134,  -2.578355408, -2.538767488,
-           -2.499718872, -2.461194788, -2.423191274, -2.385694455, -2.348658869, -2.312091771,
-           -2.275964222, -2.240290394, -2.205006454, -2.170121912, -2.135627624, -2.10149819,
-           -2.067748858, -2.034319158, -2.001220343, -1.968445087, -1.93597134,  -1.903792885,
-           -1.871921121, -1.840300059, -1.80894269,  -1.777843756, -1.746984908, -1.716380179,
-           -1.685983796, -1.655810575, -1.625844364, -1.596081887, -1.566515959, -1.537162366,
-           -1.507968561, -1.478951561, -1.450105324, -1.421427636, -1.392926093, -1.364557739,
-           -1.336338428, -1.30826327,  -1.280327575, -1.252530071, -1.224859905, -1.197337596,
-           -1.169915863, -1.142612811, -1.115424998, -1.088348374, -1.061379776, -1.034515917,
-           -1.007776728, -0.981112386, -0.95454364,  -0.928067655, -0.901681696, -0.875383123,
-           -0.849169391, -0.823038041, -0.797011949, -0.771037725, -0.745139019, -0.719313687,
-           -0.69355966,  -0.667874935, -0.642257576, -0.616705708, -0.591244192},
-          {-4.281913279, -4.213371296, -4.145840999, -4.07937788,  -4.013906918, -3.949509807,
-           -3.886139738, -3.823760819, -3.762406966, -3.702044889, -3.642704801, -3.584332747,
-           -3.526921395, -3.470497814, -3.414993562, -3.360433397, -3.30678074,  -3.254057339,
-           -3.202204262, -3.151210808, -3.101096734, -3.051791011, -3.003312069, -2.955622211,
-           -2.908737755, -2.862588189, -2.817189085, -2.772503542, -2.728545578, -2.685245797,
-           -2.642618001, -2.600626708, -2.5592847,   -2.518524157, -2.478358102, -2.438770062,
-           -2.399721324, -2.361197121, -2.32319349,  -2.285696559, -2.248660864, -2.212093661,
-           -2.175966012, -2.140292091, -2.105008061, -2.070123433, -2.035629066, -2.001499557,
-           -1.967750157, -1.934320393, -1.901221517, -1.868446206, -1.835972407, -1.803793904,
-           -1.771922098, -1.740300995, -1.708943588, -1.677844618, -1.646985738, -1.61638098,
-           -1.585984569, -1.555811321, -1.525845085, -1.496082584, -1.466516634, -1.43716302,
-           -1.407969196, -1.378952176, -1.350105921, -1.321428216, -1.292926657, -1.264558287,
-           -1.23633896,  -1.208263787, -1.180328078, -1.15253056,  -1.124860381, -1.09733806,
-           -1.069916314, -1.04261325,  -1.01542548,  -0.988348843, -0.961380233, -0.934516362,
-           -0.907777162, -0.881112809, -0.854544052, -0.828068057, -0.801682087, -0.775383504,
-           -0.749169762, -0.723038402, -0.697012302, -0.67103807,  -0.645139354, -0.619314014,
-           -0.593559978, -0.567875245, -0.542257878, -0.516706003, -0.491244482},
-          {-4.181915274, -4.113373478, -4.045843372, -3.97938045,  -3.913909686, -3.849512773,
-           -3.786142901, -3.723764175, -3.662410509, -3.602048611, -3.542708693, -3.484336796,
-           -3.426925588, -3.370502136, -3.314997997, -3.260437927, -3.206785347, -3.154062005,
-           -3.102208967, -3.051215532, -3.00110146,  -2.951795718, -2.90331674,  -2.855626828,
-           -2.808742304, -2.762592653, -2.717193452, -2.672507799, -2.628549717, -2.585249807,
-           -2.542621875, -2.500630441, -2.459288289, -2.418527597, -2.378361393, -2.338773205,
-           -2.299724319, -2.26119997,  -2.223196197, -2.18569913,  -2.148663301, -2.11209597,
-           -2.075968198, -2.040294163, -2.005010022, -1.970125291, -1.935630827, -1.901501227,
-           -1.867751744, -1.8343219,   -1.801222952, -1.768447572, -1.735973711, -1.70379515,
-           -1.671923291, -1.640302138, -1.608944685, -1.577845672, -1.546986752, -1.516381958,
-           -1.485985512, -1.455812231, -1.425845965, -1.396083435, -1.366517458, -1.33716382,
-           -1.307969971, -1.278952928, -1.25010665,  -1.221428924, -1.192927346, -1.164558956,
-           -1.136339611, -1.108264419, -1.080328692, -1.052531158, -1.024860962, -0.997338626,
-           -0.969916865, -0.942613786, -0.915426069, -0.888349416, -0.861380791, -0.834516906,
-           -0.807777693, -0.781113325, -0.754544555, -0.728068546, -0.701682564, -0.675383969,
-           -0.649170215, -0.623038843, -0.597012734, -0.57103849,  -0.545139764, -0.519314413,
-           -0.493560368, -0.467875625, -0.442258248, -0.416706364, -0.391244835},
-          {-4.08191771,  -4.013376143, -3.945846271, -3.879383589, -3.813913066, -3.749516396,
-           -3.686146765, -3.623768273, -3.562414835, -3.502053156, -3.442713445, -3.384341741,
-           -3.326930709, -3.270507416, -3.215003413, -3.16044346,  -3.106790974, -3.054067704,
-           -3.002214713, -2.951221301, -2.901107231, -2.851801467, -2.803322444, -2.755632467,
-           -2.70874786,  -2.662598106, -2.617198785, -2.572512999, -2.528554772, -2.485254705,
-           -2.442626607, -2.400634999, -2.359292672, -2.318531799, -2.278365412, -2.238777044,
-           -2.199727977, -2.161203451, -2.123199503, -2.085702269, -2.048666277, -2.01209879,
-           -1.975970869, -1.940296693, -1.905012419, -1.870127561, -1.835632978, -1.801503267,
-           -1.767753682, -1.734323742, -1.701224704, -1.668449241, -1.635975303, -1.603796671,
-           -1.571924748, -1.540303534, -1.508946024, -1.477846959, -1.44698799,  -1.416383152,
-           -1.385986664, -1.355813343, -1.325847039, -1.296084475, -1.266518465, -1.237164797,
-           -1.207970917, -1.178953846, -1.150107541, -1.121429789, -1.092928187, -1.064559774,
-           -1.036340405, -1.008265192, -0.980329443, -0.952531888, -0.924861672, -0.897339318,
-           -0.869917539, -0.842614442, -0.815426789, -0.788350117, -0.761381473, -0.734517569,
-           -0.707778341, -0.681113956, -0.65454517,  -0.628069145, -0.601683147, -0.575384536,
-           -0.549170768, -0.523039382, -0.497013261, -0.471039004, -0.445140264, -0.419314901,
-           -0.393560843, -0.367876088, -0.3422587,   -0.316706804, -0.291245266},
-          {-3.981920685, -3.913379397, -3.845849813, -3.779387423, -3.713917195, -3.64952082,
-           -3.586151483, -3.523773279, -3.46242012,  -3.402058707, -3.34271925,  -3.284347781,
-           -3.226936963, -3.170513864, -3.115010029, -3.060450218, -3.006797846, -2.954074665,
-           -2.902221731, -2.851228348, -2.801114281, -2.751808489, -2.703329411, -2.655639354,
-           -2.608754645, -2.562604766, -2.5172053,   -2.472519349, -2.428560946, -2.385260687,
-           -2.342632386, -2.300640567, -2.259298025, -2.218536931, -2.178370322, -2.138781733,
-           -2.099732445, -2.061207701, -2.023203541, -1.985706104, -1.948669913, -1.912102235,
-           -1.875974131, -1.840299784, -1.805015345, -1.770130333, -1.735635605, -1.701505758,
-           -1.667756049, -1.634325991, -1.601226843, -1.56845128,  -1.535977248, -1.503798529,
-           -1.471926527, -1.440305239, -1.40894766,  -1.377848531, -1.346989503, -1.316384611,
-           -1.285988071, -1.255814702, -1.225848352, -1.196085745, -1.166519694, -1.137165989,
-           -1.107972074, -1.078954967, -1.050108629, -1.021430845, -0.992929215, -0.964560772,
-           -0.936341375, -0.908266135, -0.88033036,  -0.852532779, -0.824862539, -0.797340164,
-           -0.769918361, -0.742615242, -0.715427668, -0.688350972, -0.661382305, -0.63451838,
-           -0.607779132, -0.581114727, -0.55454592,  -0.528069876, -0.501683858, -0.47538523,
-           -0.449171443, -0.42304004,  -0.397013905, -0.371039631, -0.345140875, -0.319315496,
-           -0.293561423, -0.267876654, -0.242259251, -0.216707342, -0.191245793},
-          {-3.88192432,  -3.813383372, -3.745854138, -3.679392106, -3.613922237, -3.549526225,
-           -3.486157246, -3.423779393, -3.362426574, -3.302065487, -3.24272634,  -3.184355157,
-           -3.126944602, -3.070521739, -3.01501811,  -2.960458472, -2.90680624,  -2.854083166,
-           -2.802230303, -2.751236955, -2.701122891, -2.651817065, -2.603337921, -2.555647766,
-           -2.508762934, -2.4626129,   -2.417213256, -2.372527106, -2.328568488, -2.285267993,
-           -2.242639444, -2.200647368, -2.159304564, -2.118543199, -2.078376317, -2.03878746,
-           -1.999737903, -1.961212893, -1.923208474, -1.885710788, -1.848674353, -1.812106441,
-           -1.775978114, -1.740303559, -1.70501892,  -1.670133719, -1.635638813, -1.601508801,
-           -1.56775894,  -1.534328738, -1.501229457, -1.46845377,  -1.435979623, -1.403800798,
-           -1.3719287,   -1.340307321, -1.308949658, -1.277850451, -1.24699135,  -1.216386393,
-           -1.185989789, -1.155816361, -1.125849956, -1.096087296, -1.066521195, -1.037167446,
-           -1.007973486, -0.978956337, -0.950109958, -0.921432135, -0.89293047,  -0.864561992,
-           -0.83634256,  -0.808267286, -0.780331479, -0.752533868, -0.724863598, -0.697341197,
-           -0.669919366, -0.642616219, -0.615428741, -0.588352016, -0.561383322, -0.534519369,
-           -0.507780099, -0.481115668, -0.454546837, -0.428070768, -0.401684728, -0.375386077,
-           -0.349172268, -0.323040844, -0.297014691, -0.271040397, -0.245141622, -0.219316224,
-           -0.193562132, -0.167877345, -0.142259925, -0.116707998, -0.091246436},
-          {-3.781928759, -3.713388228, -3.64585942,  -3.579397825, -3.513928396, -3.449532825,
-           -3.386164285, -3.323786861, -3.262434458, -3.202073769, -3.142734999, -3.084364167,
-           -3.026953932, -2.970531358, -2.91502798,  -2.860468554, -2.806816492, -2.75409355,
-           -2.702240773, -2.651247467, -2.601133407, -2.551827539, -2.503348314, -2.45565804,
-           -2.408773057, -2.362622835, -2.317222973, -2.272536579, -2.228577698, -2.185276917,
-           -2.142648066, -2.100655674, -2.05931255,  -2.018550855, -1.978383641, -1.938794455,
-           -1.899744568, -1.861219234, -1.823214498, -1.785716508, -1.748679776, -1.712111579,
-           -1.67598298,  -1.64030817,  -1.605023286, -1.570137854, -1.535642732, -1.501512517,
-           -1.467762472, -1.434332094, -1.401232649, -1.368456811, -1.335982524, -1.303803569,
-           -1.271931355, -1.240309865, -1.208952099, -1.177852796, -1.146993606, -1.116388569,
-           -1.085991888, -1.055818387, -1.025851914, -0.99608919,  -0.966523029, -0.937169225,
-           -0.90797521,  -0.87895801,  -0.850111581, -0.821433711, -0.792932003, -0.764563481,
-           -0.736344007, -0.708268693, -0.680332847, -0.652535198, -0.624864892, -0.597342458,
-           -0.569920593, -0.542617413, -0.515430052, -0.488353292, -0.461384564, -0.434520578,
-           -0.40778128,  -0.381116818, -0.354547956, -0.328071859, -0.30168579,  -0.275387111,
-           -0.249173276, -0.223041825, -0.197015651, -0.171041333, -0.145142534, -0.119317112,
-           -0.093562998, -0.067878189, -0.042260747, -0.0167088,   0.008752778},
-          {-3.681934181, -3.613394158, -3.545865872, -3.47940481,  -3.413935918, -3.349540887,
-           -3.286172882, -3.223795981, -3.162444086, -3.102083883, -3.042745575, -2.984375171,
-           -2.926965327, -2.870543107, -2.815040034, -2.760480866, -2.706829013, -2.654106232,
-           -2.60225356,  -2.551260307, -2.50114625,  -2.451840332, -2.403361008, -2.355670588,
-           -2.30878542,  -2.26263497,  -2.217234842, -2.17254815,  -2.128588947, -2.085287816,
-           -2.042658595, -2.000665818, -1.959322304, -1.918560206, -1.878392585, -1.838802999,
-           -1.799752709, -1.761226979, -1.723221856, -1.685723495, -1.6486864,   -1.612117855,
-           -1.575988923, -1.540313802, -1.505028619, -1.470142905, -1.435647519, -1.401517057,
-           -1.367766784, -1.334336192, -1.301236548, -1.268460525, -1.235986067, -1.203806954,
-           -1.171934597, -1.140312971, -1.108955079, -1.07785566,  -1.046996362, -1.016391227,
-           -0.985994451, -0.955820862, -0.925854306, -0.896091504, -0.866525269, -0.837171398,
-           -0.807977317, -0.778960053, -0.750113564, -0.721435635, -0.692933876, -0.6645653,
-           -0.636345775, -0.608270411, -0.580334517, -0.552536822, -0.524866471, -0.497343998,
-           -0.469922092, -0.442618872, -0.415431653, -0.38835485,  -0.361386081, -0.334522055,
-           -0.307782722, -0.281118222, -0.254549323, -0.22807319,  -0.201687087, -0.175388374,
-           -0.149174506, -0.123043024, -0.097016824, -0.071042475, -0.045143647, -0.019318197,
-           0.006435944,  0.032120781,  0.057738248,  0.083290221,  0.108751818},
-          {-3.581940802, -3.513401401, -3.445873752, -3.379413342, -3.313945105, -3.249550734,
-           -3.186183383, -3.123807121, -3.062455846, -3.002096237, -2.942758493, -2.884388612,
-           -2.826979244, -2.770557456, -2.715054756, -2.660495905, -2.606844306, -2.554121721,
-           -2.502269177, -2.451275988, -2.401161937, -2.351855957, -2.303376512, -2.255685913,
-           -2.208800521, -2.16264979,  -2.117249338, -2.072562281, -2.028602687, -1.985301127,
-           -1.942671455, -1.900678208, -1.859334216, -1.818571626, -1.778403509, -1.738813434,
-           -1.699762652, -1.661236438, -1.623230842, -1.585732029, -1.54869449,  -1.51212552,
-           -1.475996182, -1.440320681, -1.405035132, -1.370149074, -1.335653365, -1.301522601,
-           -1.267772052, -1.234341198, -1.20124131,  -1.168465062, -1.135990395, -1.103811088,
-           -1.071938557, -1.040316765, -1.00895872,  -0.977859158, -0.946999727, -0.916394473,
-           -0.885997582, -0.855823885, -0.825857227, -0.796094329, -0.766528004, -0.737174053,
-           -0.70797989,  -0.678962548, -0.650115985, -0.621437986, -0.592936163, -0.564567522,
-           -0.536347934, -0.50827251,  -0.480336558, -0.452538806, -0.424868401, -0.397345879,
-           -0.369923922, -0.342620652, -0.315433608, -0.288356754, -0.261387933, -0.234523858,
-           -0.207784483, -0.181119937, -0.154550993, -0.128074816, -0.101688671, -0.075389917,
-           -0.049176009, -0.023044488, 0.002981744,  0.028956129,  0.054854993,  0.080680477,
-           0.106434653,  0.132119522,  0.157737021,  0.183289024,  0.208750645},
-          {-3.48194889,  -3.413410247, -3.345883377, -3.279423763, -3.213956326, -3.14956276,
-           -3.086196207, -3.023820726, -2.962470209, -2.902111325, -2.842774269, -2.784405027,
-           -2.726996243, -2.67057498,  -2.615072737, -2.560514272, -2.506862984, -2.454140638,
-           -2.402288251, -2.35129514,  -2.301181095, -2.25187504,  -2.203395447, -2.155704631,
-           -2.108818963, -2.06266789,  -2.017267042, -1.972579541, -1.928619467, -1.885317386,
-           -1.842687162, -1.800693341, -1.759348766, -1.718585575, -1.678416852, -1.638826178,
-           -1.599774796, -1.561247991, -1.523241818, -1.485742451, -1.448704372, -1.412134882,
-           -1.376005048, -1.340329082, -1.305043087, -1.270156609, -1.235660506, -1.201529373,
-           -1.167778486, -1.134347311, -1.101247127, -1.068470602, -1.03599568,  -1.003816138,
-           -0.971943393, -0.940321399, -0.908963166, -0.87786343,  -0.847003838, -0.816398438,
-           -0.786001406, -0.755827577, -0.725860795, -0.696097781, -0.666531345, -0.637177294,
-           -0.607983032, -0.578965596, -0.550118942, -0.521440857, -0.492938956, -0.464570235,
-           -0.436350571, -0.408275072, -0.380339049, -0.352541229, -0.324870757, -0.297348177,
-           -0.269926157, -0.242622828, -0.215435996, -0.188359078, -0.161390196, -0.134526061,
-           -0.107786634, -0.081122031, -0.054553033, -0.028076802, -0.001690605, 0.024608199,
-           0.050822155,  0.076953723,  0.102979995,  0.128954425,  0.154853332,  0.180678859,
-           0.206433075,  0.232117984,  0.257735522,  0.283287563,  0.308749214},
-          {-3.381958769, -3.313421052, -3.245895132, -3.17943649,  -3.113970032, -3.049577448,
-           -2.986211871, -2.923837343, -2.862487751, -2.802129752, -2.742793538, -2.684425075,
-           -2.627017003, -2.570596384, -2.515094698, -2.460536704, -2.406885796, -2.354163743,
-           -2.302311547, -2.25131853,  -2.201204494, -2.151898347, -2.103418573, -2.055727491,
-           -2.008841487, -1.962689996, -1.917288664, -1.87260062,  -1.828639962, -1.785337242,
-           -1.742706345, -1.700711823, -1.659366536, -1.618602611, -1.578433147, -1.538841744,
-           -1.499789629, -1.461262102, -1.423255223, -1.385755181, -1.34871644,  -1.312146316,
-           -1.276015876, -1.240339343, -1.205052803, -1.170165812, -1.135669227, -1.101537643,
-           -1.067786344, -1.034354778, -1.00125423,  -0.96847737,  -0.936002136, -0.903822305,
-           -0.8719493,   -0.840327059, -0.808968596, -0.777868648, -0.747008858, -0.71640328,
-           -0.686006076, -0.655832086, -0.625865153, -0.596101996, -0.566535426, -0.537181253,
-           -0.50798687,  -0.478969318, -0.450122554, -0.421444363, -0.392942368, -0.36457355,
-           -0.336353791, -0.308278203, -0.280342092, -0.252544188, -0.224873635, -0.197350983,
-           -0.169928887, -0.142625484, -0.115438913, -0.088361916, -0.061392959, -0.034528751,
-           -0.00778926,  0.018875411,  0.045444477,  0.071920772,  0.098307032,  0.124605897,
-           0.150819914,  0.176951539,  0.202977858,  0.228952343,  0.254851304,  0.280676882,
-           0.306431149,  0.332116106,  0.357733692,  0.383285779,  0.408747465},
-          {-3.281970834, -3.213434248, -3.14590949,  -3.079452034, -3.01398677,  -2.949595388,
-           -2.886231001, -2.823857637, -2.762509176, -2.702152258, -2.642817071, -2.58444956,
-           -2.527042358, -2.470622525, -2.415121519, -2.3605641,   -2.306913656, -2.25419196,
-           -2.202339998, -2.151347097, -2.101233071, -2.051926811, -2.003446817, -1.955755411,
-           -1.908868996, -1.862716995, -1.817315072, -1.772626365, -1.728664992, -1.685361493,
-           -1.642729774, -1.600734395, -1.559388239, -1.518623417, -1.47845305,  -1.438860755,
-           -1.399807744, -1.361279335, -1.323271596, -1.285770729, -1.24873118,  -1.212160281,
-           -1.176029101, -1.140351876, -1.10506467,  -1.070177052, -1.035679879, -1.001547745,
-           -0.967795942, -0.934363898, -0.901262906, -0.868485635, -0.83601002,  -0.803829837,
-           -0.771956515, -0.740333971, -0.708975229, -0.677875021, -0.647014989, -0.616409195,
-           -0.58601178,  -0.555837593, -0.525870475, -0.496107144, -0.466540409, -0.437186089,
-           -0.407991557, -0.378973864, -0.350126965, -0.321448645, -0.292946534, -0.264577597,
-           -0.236357724, -0.208282026, -0.180345809, -0.152547802, -0.12487715,  -0.097354411,
-           -0.069932222, -0.042628729, -0.015440241, 0.011634617,  0.038603667,  0.065467965,
-           0.092207532,  0.118872288,  0.145441435,  0.17191781,   0.198304147,  0.224603087,
-           0.250817176,  0.276948872,  0.302975249,  0.328949801,  0.354848826,  0.380674468,
-           0.406428796,  0.432113813,  0.457731457,  0.4832836,    0.50874533},
-          {-3.181985569, -3.113450365, -3.045927025, -2.979471019, -2.914007214, -2.849617298,
-           -2.786254366, -2.723882424, -2.662535342, -2.602179745, -2.542845812, -2.484479464,
-           -2.427073324, -2.37065445,  -2.315154275, -2.260597559, -2.206947681, -2.154226421,
-           -2.102374744, -2.051381985, -2.001267971, -1.951961574, -1.90348131,  -1.855789508,
-           -1.808902592, -1.762749968, -1.717347323, -1.672657806, -1.62869556,  -1.58539111,
-           -1.542758387, -1.500761963, -1.459414745, -1.418648827, -1.378477357, -1.338883973,
-           -1.299829868, -1.261300383, -1.223291593, -1.185789717, -1.148749182, -1.112177337,
-           -1.076045253, -1.040367182, -1.005079164, -0.970190779, -0.935692888, -0.901560082,
-           -0.867807664, -0.834375036, -0.801273503, -0.768495729, -0.73601965,  -0.703839036,
-           -0.671965326, -0.640342413, -0.608983329, -0.577882804, -0.547022478, -0.516416418,
-           -0.486018746, -0.455844319, -0.425876975, -0.396113431, -0.366546496, -0.337191994,
-           -0.307997281, -0.278979416, -0.250132353, -0.221453875, -0.192951623, -0.16458254,
-           -0.136362528, -0.108286694, -0.080350348, -0.052552216, -0.024881443, 0.002641404,
-           0.030063706,  0.057367309,  0.084555903,  0.111630383,  0.138599546,  0.165463953,
-           0.192203614,  0.218868473,  0.24543772,   0.271914192,  0.298300624,  0.324599655,
-           0.350813832,  0.376945615,  0.402972063,  0.428946696,  0.454845801,  0.480671519,
-           0.506425922,  0.532111013,  0.557728727,  0.583280939,  0.608742722},
-          {-3.082003567, -3.01347005,  -2.945948441, -2.879494206, -2.814032182, -2.749644057,
-           -2.686282901, -2.623912695, -2.562567299, -2.502213315, -2.442880913, -2.384515985,
-           -2.327111142, -2.270693439, -2.215194279, -2.16063842,  -2.106989234, -2.054268507,
-           -2.002417179, -1.951424592, -1.901310593, -1.852004028, -1.803523435, -1.755831149,
-           -1.708943621, -1.662790236, -1.61738671,  -1.572696204, -1.528732893, -1.485427281,
-           -1.442793332, -1.40079563,  -1.359447117, -1.318679861, -1.278507043, -1.238912329,
-           -1.199856889, -1.16132609,  -1.123316015, -1.085812909, -1.048771169, -1.012198168,
-           -0.97606498,  -0.940385876, -0.905096865, -0.870207546, -0.835708777, -0.80157515,
-           -0.767821981, -0.73438864,  -0.701286445, -0.668508058, -0.636031411, -0.603850272,
-           -0.571976087, -0.540352723, -0.508993222, -0.47789231,  -0.447031623, -0.416425239,
-           -0.386027254, -0.355852533, -0.325884914, -0.29612111,  -0.266553929, -0.237199206,
-           -0.208004272, -0.178986196, -0.150138932, -0.121460262, -0.092957837, -0.064588577,
-           -0.036368394, -0.008292396, 0.019644109,  0.047442394,  0.075113314,  0.102636292,
-           0.130058733,  0.15736247,   0.184551194,  0.211625213,  0.238594514,  0.265459054,
-           0.29219883,   0.318863814,  0.345433184,  0.371909774,  0.398296321,  0.424595463,
-           0.450809749,  0.476941637,  0.502968172,  0.528942905,  0.554842107,  0.580667919,
-           0.606422413,  0.632107592,  0.657725393,  0.68327769,   0.708739537},
-          {-2.982025547, -2.913494091, -2.845974598, -2.779522524, -2.714062675, -2.649676738,
-           -2.586317751, -2.523949665, -2.462606327, -2.402254312, -2.342923781, -2.284560586,
-           -2.227157327, -2.170741055, -2.115243132, -2.060688322, -2.00703998,  -1.954319904,
-           -1.902469,    -1.851476625, -1.801362643, -1.752055874, -1.703574879, -1.655882002,
-           -1.608993727, -1.562839412, -1.51743481,  -1.472743096, -1.428778485, -1.385471454,
-           -1.342836008, -1.300836747, -1.25948665,  -1.218717762, -1.178543298, -1.13894696,
-           -1.099889889, -1.061357484, -1.023345841, -0.985841232, -0.948798022, -0.912223609,
-           -0.876089073, -0.840408708, -0.805118485, -0.770228023, -0.735728183, -0.701593553,
-           -0.667839466, -0.634405254, -0.601302251, -0.568523115, -0.536045774, -0.503863993,
-           -0.471989229, -0.440365315, -0.409005304, -0.377903919, -0.347042792, -0.316436012,
-           -0.286037644, -0.255862565, -0.225894608, -0.196130487, -0.166563006, -0.137208014,
-           -0.10801281,  -0.078994476, -0.050146967, -0.021468062, 0.007034573,  0.03540405,
-           0.063624442,  0.09170064,   0.119637339,  0.14743581,   0.175106912,  0.202630049,
-           0.230052659,  0.25735656,   0.284545443,  0.3116189,    0.338588368,  0.365453071,
-           0.392192987,  0.418858126,  0.445427644,  0.471904379,  0.498291066,  0.524590345,
-           0.550804763,  0.576936779,  0.602963421,  0.628938275,  0.654837595,  0.680663522,
-           0.706418128,  0.732103416,  0.757721322,  0.783273721,  0.808735648},
-          {-2.882052392, -2.813523453, -2.746006542, -2.679557108, -2.614099916, -2.549716649,
-           -2.486360311, -2.423994815, -2.36265399,  -2.302304379, -2.242976131, -2.184615054,
-           -2.127213728, -2.070799203, -2.015302793, -1.960749261, -1.90710195,  -1.854382668,
-           -1.802532283, -1.751540165, -1.701426206, -1.652119186, -1.603637701, -1.555944102,
-           -1.509054914, -1.462899465, -1.41749355,  -1.372800361, -1.328834161, -1.285525398,
-           -1.242888124, -1.200886959, -1.15953493,  -1.118764047, -1.078587574, -1.038989253,
-           -0.999930191, -0.961395826, -0.923382268, -0.885875824, -0.848830817, -0.81225468,
-           -0.776118499, -0.740436593, -0.705144888, -0.670253032, -0.635751883, -0.601616029,
-           -0.56786082,  -0.534425545, -0.501321555, -0.468541505, -0.436063316, -0.403880751,
-           -0.37200528,  -0.340380693, -0.309020059, -0.277918096, -0.247056432, -0.216449169,
-           -0.186050333, -0.155874816, -0.125906447, -0.096141939, -0.066574092, -0.03721877,
-           -0.008023236, 0.020995412,  0.049843221,  0.078522412,  0.107025305,  0.135395047,
-           0.163615693,  0.191692137,  0.219629072,  0.247427771,  0.275099093,  0.302622425,
-           0.330045242,  0.357349343,  0.384538419,  0.41161119,   0.438580864,  0.465445766,
-           0.492185853,  0.518851179,  0.54542088,   0.571897791,  0.59828465,   0.624584095,
-           0.650798675,  0.676930848,  0.702957619,  0.728932622,  0.754832086,  0.780658154,
-           0.806412896,  0.832098316,  0.857716351,  0.883268876,  0.908730899},
-          {-2.782085178, -2.713559312, -2.646045555, -2.579599345, -2.514145397, -2.449765391,
-           -2.386412287, -2.324049952, -2.262712195, -2.20236552,  -2.143040061, -2.084681568,
-           -2.027282604, -1.97087021,  -1.915375647, -1.860823677, -1.807177624, -1.754459311,
-           -1.70260956,  -1.651617757, -1.601503823, -1.552196498, -1.503714414, -1.456019934,
-           -1.409129632, -1.362972797, -1.317565278, -1.272870289, -1.22890215,  -1.185591273,
-           -1.142951767, -1.100948277, -1.059593888, -1.018820571, -0.978641644, -0.939040902,
-           -0.899979408, -0.86144265,  -0.823426754, -0.785918069, -0.748870868, -0.712292627,
-           -0.676154435, -0.640470648, -0.605177135, -0.570283575, -0.535780828, -0.501643478,
-           -0.4678869,   -0.434450326, -0.40134513,  -0.368563963, -0.336084739, -0.303901217,
-           -0.272024881, -0.240399473, -0.209038078, -0.177935409, -0.147073089, -0.116465236,
-           -0.086065828, -0.055889776, -0.025920905, 0.003844077,  0.03341237,   0.062768096,
-           0.091964032,  0.120983063,  0.149831239,  0.17851078,   0.207013988,  0.235384052,
-           0.263605009,  0.291681752,  0.319618976,  0.347417954,  0.375089545,  0.402613115,
-           0.430036185,  0.45734053,   0.484529843,  0.511601777,  0.538571701,  0.565436846,
-           0.592177142,  0.618842697,  0.64541262,   0.671889747,  0.698276815,  0.724576464,
-           0.750791241,  0.776923605,  0.802950534,  0.828925719,  0.854825359,  0.880651598,
-           0.906406507,  0.932092089,  0.957710282,  0.983262959,  1.008725101},
-          {-2.682125219, -2.613603105, -2.5460932,   -2.479650926, -2.414200938, -2.349824915,
-           -2.28647576,  -2.224117285, -2.162783274, -2.102440183, -2.043118129, -1.984762791,
-           -1.927366708, -1.870956918, -1.815464608, -1.760914545, -1.707270027, -1.654552898,
-           -1.60270392,  -1.5517125,   -1.501598599, -1.452290901, -1.403808085, -1.35611253,
-           -1.309220868, -1.263062341, -1.217652864, -1.172955678, -1.128985171, -1.085671712,
-           -1.043029481, -1.001023154, -0.959665884, -0.918889594, -0.878707672, -0.839103975,
-           -0.800039511, -0.761499831, -0.72348108,  -0.685969659, -0.64891978,  -0.612338969,
-           -0.576198322, -0.540512238, -0.505216517, -0.470320876, -0.435816177, -0.401677001,
-           -0.36791875,  -0.33448059,  -0.301373921, -0.268591389, -0.236110901, -0.203926209,
-           -0.172048818, -0.140422407, -0.109060082, -0.077956552, -0.04709343,  -0.016484855,
-           0.013915251,  0.044091956,  0.074061441,  0.103827001,  0.13339584,   0.162752057,
-           0.191948486,  0.220967985,  0.249816608,  0.278496576,  0.307000167,  0.335370627,
-           0.363591963,  0.391669072,  0.419606648,  0.447405966,  0.475077886,  0.502601747,
-           0.530025125,  0.557329768,  0.58451937,   0.611590284,  0.638560514,  0.665425955,
-           0.692166506,  0.718832341,  0.745402535,  0.771879926,  0.798267249,  0.824567146,
-           0.850782164,  0.876914763,  0.902941884,  0.928917291,  0.954817146,  0.980643595,
-           1.006398707,  1.032084487,  1.057702871,  1.083255735,  1.108718021},
-          {-2.582174117, -2.513656587, -2.446151383, -2.379713917, -2.314268765, -2.249897603,
-           -2.186553269, -2.124199506, -2.062870069, -2.002531354, -1.943213455, -1.884861969,
-           -1.827469405, -1.771062792, -1.715573233, -1.661025496, -1.607382853, -1.554667168,
-           -1.502819133, -1.451828181, -1.401714319, -1.352406165, -1.303922456, -1.256225588,
-           -1.209332265, -1.163171674, -1.117759807, -1.073059938, -1.029086542, -0.985769931,
-           -0.943124374, -0.901114583, -0.859753796, -0.818973878, -0.778788299, -0.739180994,
-           -0.700112906, -0.661569659, -0.623547422, -0.58603266,  -0.548979512, -0.512395562,
-           -0.476251918, -0.440563028, -0.40526461,  -0.370366429, -0.335859346, -0.301717939,
-           -0.267957647, -0.234517549, -0.201409081, -0.168624882, -0.13614285,  -0.103956729,
-           -0.072078049, -0.040450413, -0.009086952, 0.022017631,  0.052881731,  0.083491188,
-           0.113892146,  0.144069649,  0.174039883,  0.203806149,  0.233375655,  0.262732473,
-           0.291929502,  0.320949573,  0.349798742,  0.378479233,  0.406983293,  0.435354234,
-           0.463576034,  0.491653589,  0.519591596,  0.547391329,  0.57506365,   0.602587866,
-           0.63001162,   0.657316628,  0.684506583,  0.711576252,  0.738546856,  0.765412659,
-           0.792153522,  0.818819698,  0.845390224,  0.871867936,  0.898255571,  0.924555771,
-           0.950771083,  0.976903967,  1.002931324,  1.028907001,  1.05480712,   1.080633823,
-           1.106389184,  1.132075205,  1.157693824,  1.183246916,  1.208709378},
-          {-2.482233833, -2.413721898, -2.346222435, -2.279790837, -2.214351589, -2.149986364,
-           -2.086647914, -2.024299904, -1.96297605,  -1.902642676, -1.843329849, -1.784983065,
-           -1.727594794, -1.671192059, -1.615705857, -1.561160959, -1.507520603, -1.454806681,
-           -1.402959797, -1.351969416, -1.3018556,   -1.25254689,  -1.20406209,  -1.15636362,
-           -1.10946827,  -1.063305159, -1.017890375, -0.973187232, -0.929210308, -0.885889852,
-           -0.843240236, -0.801226216, -0.759861137, -0.71907679,  -0.678886748, -0.639275039,
-           -0.600202527, -0.561654925, -0.523628434, -0.486109594, -0.449052452, -0.412464672,
-           -0.376317368, -0.340625053, -0.305323342, -0.270422058, -0.235912064, -0.201767933,
-           -0.168005146, -0.134562681, -0.101452016, -0.068665781, -0.036181864, -0.003993997,
-           0.027886258,  0.059515391,  0.090880238,  0.121986107,  0.152851403,  0.183461935,
-           0.213863936,  0.244042413,  0.274013563,  0.30378069,   0.33335101,   0.362708561,
-           0.391906324,  0.420927094,  0.44977693,   0.478458057,  0.50696269,   0.535334219,
-           0.563556585,  0.591634685,  0.619573217,  0.647373457,  0.675046269,  0.702570918,
-           0.729995132,  0.757300584,  0.78449097,   0.811559124,  0.838530183,  0.865396428,
-           0.892137671,  0.918804265,  0.945375194,  0.971853299,  0.998241315,  1.024541885,
-           1.050757556,  1.076890789,  1.102918434,  1.128894441,  1.15479488,   1.180621896,
-           1.206377559,  1.232063874,  1.25768278,   1.28323615,   1.308698828},
-          {-2.382306756, -2.313801651, -2.246309198, -2.179884764, -2.114452723, -2.050094743,
-           -1.986763478, -1.92442249,  -1.863105449, -1.802778594, -1.743471957, -1.68513091,
-           -1.627747879, -1.571349875, -1.51586777,  -1.461326336, -1.407688771, -1.354976998,
-           -1.303131518, -1.252141832, -1.202028074, -1.152718684, -1.104232553, -1.056532127,
-           -1.009634304, -0.963468118, -0.918049773, -0.873342635, -0.829361408, -0.786036257,
-           -0.743381688, -0.701362509, -0.659992192, -0.61920244,  -0.579006951, -0.539389866,
-           -0.500311955, -0.461759038, -0.423727353, -0.386203535, -0.34914152,  -0.312549062,
-           -0.276397291, -0.240700793, -0.205395061, -0.170489989, -0.13597644,  -0.101828982,
-           -0.068063148, -0.034617794, -0.001504445, 0.031284277,  0.063770498,  0.095960496,
-           0.127842675,  0.159473637,  0.190840178,  0.221947618,  0.252814375,  0.283426221,
-           0.313829493,  0.34400916,   0.373981428,  0.403749608,  0.433320922,  0.462679368,
-           0.491878027,  0.52089965,   0.549750299,  0.578432205,  0.606937536,  0.635309784,
-           0.663532841,  0.691611606,  0.71955078,   0.747351639,  0.775025048,  0.802550227,
-           0.829975002,  0.857280998,  0.884471909,  0.911538217,  0.938509832,  0.965376617,
-           0.992118325,  1.018785427,  1.04535685,   1.071835434,  1.098223915,  1.124524936,
-           1.150741045,  1.176874704,  1.2029027,    1.22887911,   1.254779941,  1.280607337,
-           1.30636337,   1.332050045,  1.3576693,    1.38322301,   1.40868595},
-          {-2.282395802, -2.213899036, -2.14641514,  -2.079999451, -2.014576207, -1.95022707,
-           -1.886904573, -1.824572154, -1.763263428, -1.702944527, -1.643645445, -1.585311398,
-           -1.527934759, -1.471542528, -1.41606542,  -1.361528211, -1.30789405,  -1.255184899,
-           -1.20334113,  -1.152352292, -1.102238602, -1.052928383, -1.004440627, -0.956737814,
-           -0.909836973, -0.863667034, -0.818244347, -0.773532334, -0.729545856, -0.686214979,
-           -0.643554366, -0.601528892, -0.560152184, -0.519355838, -0.479153702, -0.439530059,
-           -0.400445559, -0.361886155, -0.323848132, -0.286318238, -0.249250274, -0.212652107,
-           -0.176494881, -0.140793278, -0.105482637, -0.070572939, -0.036055049, -0.001903528,
-           0.031866026,  0.065314911,  0.098431538,  0.131223297,  0.163712332,  0.195904935,
-           0.227789463,  0.259422658,  0.290791268,  0.321900627,  0.352769168,  0.383382619,
-           0.413787445,  0.443968566,  0.473942198,  0.503711664,  0.533284192,  0.562643732,
-           0.591843484,  0.620866147,  0.649717791,  0.678400647,  0.70690683,   0.735279955,
-           0.763503855,  0.791583433,  0.81952339,   0.847325004,  0.874999144,  0.902524969,
-           0.929950429,  0.957257087,  0.984448641,  1.011528642,  1.038484997,  1.065352439,
-           1.092094714,  1.118762437,  1.145334463,  1.171813631,  1.19820268,   1.224504252,
-           1.250720896,  1.276855073,  1.302883498,  1.3288604,    1.354761709,  1.38058957,
-           1.406346054,  1.432033168,  1.457652849,  1.483206974,  1.508670234},
-          {-2.182504531, -2.114017944, -2.046544492, -1.980139476, -1.914726969, -1.850388624,
-           -1.787076826, -1.724754862, -1.663456282, -1.603147085, -1.543857218, -1.48553171,
-           -1.428162868, -1.371777678, -1.316306664, -1.261774608, -1.208144597, -1.155438642,
-           -1.103596959, -1.052609154, -1.002495546, -0.953184313, -0.904694575, -0.85698885,
-           -0.810084327, -0.763909812, -0.718481827, -0.673763868, -0.629770985, -0.586433124,
-           -0.543765139, -0.501731986, -0.460347482, -0.419543092, -0.379332848, -0.339701203,
-           -0.300608664, -0.262041345, -0.223995588, -0.18645828,  -0.149383057, -0.112777922,
-           -0.076614038, -0.040906202, -0.005589568, 0.029325778,  0.063848968,  0.09800545,
-           0.131779549,  0.165232745,  0.198353376,  0.231148845,  0.263641317,  0.295837101,
-           0.3277245,    0.359360423,  0.390731561,  0.421843263,  0.452713983,  0.483329396,
-           0.513736118,  0.543919014,  0.573894314,  0.603665349,  0.633239358,  0.662600233,
-           0.69180132,   0.720825255,  0.749678111,  0.778362127,  0.806869352,  0.835243547,
-           0.863468476,  0.891549046,  0.919489959,  0.947292495,  0.974967526,  1.00249414,
-           1.029920435,  1.057227903,  1.08442024,   1.111501,     1.138454693,  1.165322939,
-           1.192065905,  1.218734386,  1.245307147,  1.271787029,  1.29817677,   1.324479014,
-           1.35069631,   1.376831122,  1.402860069,  1.428837572,  1.454739464,  1.480567891,
-           1.506324926,  1.532012575,  1.557632777,  1.583187407,  1.608651059},
-          {-2.082637285, -2.014163122, -1.946702415, -1.880310423, -1.814911017, -1.750585839,
-           -1.687287094, -1.624977885, -1.563691681, -1.503394321, -1.444115691, -1.385800597,
-           -1.328441263, -1.272064657, -1.216601073, -1.162075298, -1.108450345, -1.055748286,
-           -1.003909145, -0.952922596, -0.902809086, -0.853496616, -0.805004459, -0.757295183,
-           -0.710386169, -0.664206073, -0.618771627, -0.574046418, -0.530045726, -0.486699347,
-           -0.444022374, -0.401979857, -0.360585847, -0.319771645, -0.279551513, -0.239910109,
-           -0.200807764, -0.162230791, -0.124175599, -0.086629245, -0.049545164, -0.012931525,
-           0.023240484,  0.058955927,  0.094279877,  0.129202118,  0.16373178,   0.19789432,
-           0.231673968,  0.26513243,   0.298257951,  0.331057952,  0.363554623,  0.395754292,
-           0.427645199,  0.459284455,  0.49065868,   0.521773245,  0.552646627,  0.583264434,
-           0.613673474,  0.643858537,  0.673835872,  0.703608823,  0.733184642,  0.762547147,
-           0.791749863,  0.820775349,  0.849629687,  0.878315117,  0.906823613,  0.935199114,
-           0.9634253,    0.991507079,  1.019449159,  1.047252821,  1.07492894,   1.102456517,
-           1.129883832,  1.157192287,  1.18438558,   1.211467267,  1.238417726,  1.265286951,
-           1.292030762,  1.318700167,  1.345273825,  1.371754576,  1.398145162,  1.424448226,
-           1.450666318,  1.476801903,  1.502831489,  1.528809723,  1.554712327,  1.580541445,
-           1.606299152,  1.631987454,  1.657608291,  1.683163538,  1.708627668},
-          {-1.982799359, -1.914340356, -1.846895201, -1.7805191,   -1.715135675, -1.65082656,
-           -1.587543735, -1.525250082, -1.463978969, -1.403696041, -1.344431113, -1.286128713,
-           -1.228780969, -1.172414825, -1.116960296, -1.062442175, -1.008823385, -0.95612607,
-           -0.904290023, -0.853305004, -0.80319161,  -0.753877629, -0.705382522, -0.657668915,
-           -0.610754427, -0.564567527, -0.519125207, -0.47439116,  -0.430380949, -0.387024188,
-           -0.344336257, -0.302282326, -0.260876727, -0.220050565, -0.179818377, -0.140165073,
-           -0.101050771, -0.062462025, -0.024395325, 0.013162063,  0.05025695,   0.086880963,
-           0.123062886,  0.158787613,  0.194120493,  0.229051151,  0.263588714,  0.297758651,
-           0.331545075,  0.365009968,  0.398141461,  0.430946998,  0.463448799,  0.495653215,
-           0.527548406,  0.559191733,  0.590569731,  0.621687793,  0.652564426,  0.683185158,
-           0.713597028,  0.743784737,  0.773764558,  0.803539849,  0.833117876,  0.862482371,
-           0.891687076,  0.920714455,  0.949570599,  0.978257757,  1.006767804,  1.035144899,
-           1.063372617,  1.091455873,  1.119399376,  1.147204411,  1.174881858,  1.202410609,
-           1.229839169,  1.257148829,  1.284343288,  1.311426106,  1.338400705,  1.365243062,
-           1.391987902,  1.418658434,  1.445233186,  1.471714999,  1.498106615,  1.524410678,
-           1.550629742,  1.576766269,  1.602796634,  1.628775761,  1.654679232,  1.680509194,
-           1.70626772,   1.731956818,  1.757578429,  1.783134429,  1.808599141},
-          {-1.882997211, -1.814556704, -1.74713052,  -1.680773801, -1.615409868, -1.551120339,
-           -1.487856927, -1.42558224,  -1.364329522, -1.304064186, -1.244815956, -1.186529026,
-           -1.129195402, -1.072842004, -1.017398503, -0.962889703, -0.909278416, -0.856586877,
-           -0.804754595, -0.753771433, -0.703658177, -0.654342352, -0.605843647, -0.558124762,
-           -0.511203603, -0.465008412, -0.419556497, -0.374811683, -0.330789873, -0.287420464,
-           -0.244719183, -0.202651344, -0.161231623, -0.120390887, -0.080144006, -0.040476198,
-           -0.001347322, 0.037255777,  0.075336507,  0.11290735,   0.150015416,  0.186652084,
-           0.222846102,  0.258582156,  0.293925933,  0.328866864,  0.363414072,  0.397593041,
-           0.43138774,   0.464860487,  0.497999275,  0.530811574,  0.563319641,  0.595529857,
-           0.627430282,  0.659078584,  0.690461189,  0.721583523,  0.752464127,  0.783088432,
-           0.813503758,  0.843694699,  0.873677554,  0.903455701,  0.933036425,  0.962403347,
-           0.991610479,  1.020640169,  1.049498518,  1.078187783,  1.106699722,  1.135078761,
-           1.16330835,   1.191393406,  1.219338646,  1.247145356,  1.274824422,  1.302354606,
-           1.329784685,  1.357095814,  1.384291697,  1.411375893,  1.438351829,  1.465189553,
-           1.491935649,  1.518607556,  1.545183641,  1.571666747,  1.598059619,  1.624364902,
-           1.650585149,  1.676722826,  1.70275414,   1.728734356,  1.754638885,  1.780469875,
-           1.8062294,    1.831919469,  1.857542023,  1.883098942,  1.908564364},
-          {-1.783238708, -1.714820761, -1.647417714, -1.58108463,  -1.515744461, -1.451478809,
-           -1.388239058, -1.325987483, -1.264757182, -1.204513277, -1.145285387, -1.087017296,
-           -1.029700867, -0.973362987, -0.917932912, -0.863435455, -0.809833298, -0.757148784,
-           -0.705321079, -0.654340173, -0.604227078, -0.554909002, -0.506405911, -0.458680595,
-           -0.41175131,  -0.365546023, -0.320082424, -0.275324498, -0.231288565, -0.187903754,
-           -0.145186215, -0.103101439, -0.06166452,  -0.020806031, 0.019458747,  0.059144223,
-           0.098290858,  0.136911447,  0.175009276,  0.212596519,  0.249720653,  0.286372751,
-           0.322581521,  0.358331394,  0.393688466,  0.428641934,  0.463200915,  0.497390909,
-           0.531195712,  0.56467805,   0.59782575,   0.630646309,  0.66316203,   0.695379331,
-           0.727286152,  0.758940531,  0.790328766,  0.821456318,  0.852341774,  0.882970443,
-           0.913389989,  0.943584876,  0.973571436,  1.003353069,  1.032937083,  1.062306969,
-           1.091517062,  1.12054957,   1.149410608,  1.178102444,  1.20661669,   1.234998101,
-           1.263229971,  1.291317224,  1.319264581,  1.347073333,  1.374754375,  1.402286307,
-           1.429718237,  1.457031159,  1.484228778,  1.511314656,  1.538292221,  1.565164773,
-           1.591871969,  1.618545551,  1.645123261,  1.671607945,  1.698002347,  1.724309116,
-           1.750530805,  1.776669883,  1.802702355,  1.828683898,  1.854589717,  1.880421958,
-           1.906182701,  1.931873954,  1.957497658,  1.983055695,  2.008521983},
-          {-1.683533437, -1.615142997, -1.547768157, -1.481463882, -1.416152677, -1.35191612,
-           -1.288705194, -1.226481772, -1.165278769, -1.105060959, -1.045857831, -0.987612671,
-           -0.930317166, -0.873998165, -0.81858442,  -0.764100758, -0.710509701, -0.657833724,
-           -0.606011578, -0.555033405, -0.504920496, -0.455599672, -0.407091239, -0.359358091,
-           -0.312418914, -0.26620134,  -0.220723521, -0.175949641, -0.131896522, -0.088492968,
-           -0.045755644, -0.003650257, 0.037807595,  0.078687692,  0.118974258,  0.158681246,
-           0.197849505,  0.236491396,  0.274610055,  0.312217282,  0.349360996,  0.386031904,
-           0.422258659,  0.458025384,  0.493398674,  0.528367438,  0.562940787,  0.59714424,
-           0.63096138,   0.664455431,  0.697614014,  0.730444663,  0.762969736,  0.795195695,
-           0.82711033,   0.858772135,  0.890167248,  0.921301176,  0.952192558,  0.982826557,
-           1.013251257,  1.043450961,  1.073442043,  1.103227931,  1.132815959,  1.162189462,
-           1.191403167,  1.220439113,  1.249303431,  1.2779984,    1.306515461,  1.334899763,
-           1.363134413,  1.391224344,  1.419174284,  1.446985526,  1.474668975,  1.502203039,
-           1.529637227,  1.556952334,  1.584152069,  1.611239998,  1.63821955,   1.665094028,
-           1.691842364,  1.718470026,  1.745049715,  1.77153632,   1.797932587,  1.824241165,
-           1.850464612,  1.876605396,  1.902639279,  1.928622438,  1.954529827,  1.980363595,
-           2.00612582,   2.031818514,  2.05744362,   2.083003018,  2.108470363},
-          {-1.583893067, -1.515536155, -1.448195689, -1.381926516, -1.316650591, -1.252449467,
-           -1.18927364,  -1.127084489, -1.065914709, -1.005728651, -0.946555645, -0.888338372,
-           -0.831068308, -0.774772257, -0.719378357, -0.664911454, -0.611333877, -0.558668264,
-           -0.506852859, -0.455877994, -0.405765297, -0.35644112,  -0.30792618,  -0.260183504,
-           -0.213232295, -0.166999777, -0.121504669, -0.076711389, -0.032637375, 0.010788969,
-           0.053550348,  0.095680801,  0.13716411,   0.178070489,  0.218383559,  0.25811672,
-           0.297311295,  0.335979114,  0.374123133,  0.411754693,  0.448922258,  0.485616083,
-           0.521864758,  0.557652027,  0.593045096,  0.628032519,  0.662623399,  0.696843279,
-           0.73067548,   0.764183835,  0.79735571,   0.830198686,  0.862735185,  0.894971721,
-           0.926895907,  0.958566784,  0.989970302,  1.021112019,  1.052010639,  1.082651151,
-           1.113082143,  1.143287729,  1.173284331,  1.20307541,   1.232668336,  1.262046249,
-           1.29126436,   1.320304497,  1.349172813,  1.377871602,  1.406392095,  1.434779921,
-           1.46301796,   1.491111154,  1.51906424,   1.546878517,  1.574564901,  1.602101563,
-           1.629538502,  1.656856272,  1.684058586,  1.711149013,  1.738130987,  1.765007813,
-           1.791758173,  1.818378085,  1.844960184,  1.871449128,  1.897847664,  1.924158446,
-           1.950384032,  1.976526893,  2.002562495,  2.028547622,  2.054456923,  2.080292548,
-           2.106056579,  2.131751027,  2.157377839,  2.182938896,  2.208407527},
-          {-1.484331792, -1.416015729, -1.348717132, -1.282490702, -1.217257728, -1.15309973,
-           -1.089966609, -1.027819146, -0.966689769, -0.906542311, -0.847405915, -0.789222526,
-           -0.731983364, -0.675715181, -0.62034537,  -0.565898803, -0.512337576, -0.459684525,
-           -0.407877284, -0.356906412, -0.306793952, -0.257465683, -0.208942826, -0.161188565,
-           -0.114222734, -0.067972061, -0.022455951, 0.022360893,  0.066460286,  0.109914311,
-           0.152704912,  0.194865815,  0.236380052,  0.277318368,  0.317663651,  0.35742863,
-           0.396655202,  0.435354555,  0.473529426,  0.511190599,  0.548387199,  0.585108931,
-           0.621384309,  0.657196613,  0.692613791,  0.727623969,  0.762236235,  0.796476161,
-           0.83032675,   0.863852569,  0.897040679,  0.929898714,  0.962449174,  0.994698636,
-           1.026634493,  1.058316458,  1.089730246,  1.120881479,  1.151788943,  1.182437408,
-           1.212876084,  1.243088849,  1.273092187,  1.3028896,    1.3324885,    1.361871793,
-           1.391095273,  1.420140519,  1.449013707,  1.477717151,  1.506241825,  1.534633944,
-           1.56287611,   1.59097328,   1.618930199,  1.646748172,  1.67443813,   1.701977957,
-           1.729418247,  1.756739262,  1.783944717,  1.811038188,  1.838023111,  1.864902798,
-           1.891655623,  1.918334897,  1.944851273,  1.971343062,  1.997744359,  2.024057822,
-           2.05028601,   2.076431399,  2.102469093,  2.128456614,  2.15436824,   2.180206125,
-           2.205972352,  2.231668935,  2.257297822,  2.282860896,  2.308331095},
-          {-1.384866868, -1.316600543, -1.249352912, -1.183178498, -1.117997774, -1.053892223,
-           -0.990811021, -0.92871422,  -0.867633927, -0.807533349, -0.748441398, -0.69029913,
-           -0.633097457, -0.576863068, -0.521522457, -0.467100531, -0.413559102, -0.360921255,
-           -0.309123879, -0.258157817, -0.208045612, -0.158712353, -0.11017987,  -0.062411539,
-           -0.015427959, 0.030844745,  0.076386336,  0.121231765,  0.165361947,  0.208849552,
-           0.251675605,  0.293873455,  0.335425226,  0.376402306,  0.416786697,  0.456590313,
-           0.495855752,  0.534593422,  0.572805793,  0.610502974,  0.647734892,  0.684490586,
-           0.720798472,  0.756641269,  0.792087825,  0.827125741,  0.861764089,  0.896028473,
-           0.929901504,  0.963448648,  0.996656587,  1.029533018,  1.062100537,  1.094365796,
-           1.126315919,  1.158011435,  1.189437773,  1.220600635,  1.251518902,  1.282177083,
-           1.312625141,  1.342846669,  1.372858226,  1.402663364,  1.432269548,  1.4616594,
-           1.490889423,  1.519940892,  1.548820015,  1.577529127,  1.606058893,  1.634456239,
-           1.66270343,   1.690805439,  1.718767023,  1.746589496,  1.774283805,  1.801827486,
-           1.829271856,  1.856596819,  1.8838061,    1.910903275,  1.93789179,   1.964774958,
-           1.991530786,  2.018213345,  2.044799763,  2.07121415,   2.097618804,  2.123935525,
-           2.150166877,  2.176315337,  2.202355577,  2.228346008,  2.25426046,   2.280101092,
-           2.305869988,  2.331569166,  2.357200574,  2.3827661,    2.408238206},
-          {-1.285519242, -1.217313439, -1.1501278,   -1.084016632, -1.018899415, -0.954857583,
-           -0.891839434, -0.829804135, -0.768783402, -0.708739683, -0.649701616, -0.591609181,
-           -0.534452917, -0.478259445, -0.42295417,  -0.368562045, -0.315044547, -0.262425059,
-           -0.210639578, -0.159679289, -0.109567345, -0.060228001, -0.011683826, 0.03610157,
-           0.083106665,  0.129406063,  0.174978521,  0.219858576,  0.26402605,   0.30755433,
-           0.350423329,  0.392665943,  0.434263196,  0.475287262,  0.515719067,  0.555569541,
-           0.594882133,  0.633666308,  0.671924212,  0.709665132,  0.746939973,  0.783736962,
-           0.820084396,  0.855964309,  0.891446643,  0.926518359,  0.961188505,  0.995482722,
-           1.029383141,  1.062956319,  1.096188476,  1.129087382,  1.161675747,  1.193960312,
-           1.225927875,  1.257639956,  1.289081633,  1.320258705,  1.35119017,   1.38186022,
-           1.412319732,  1.442551955,  1.472573537,  1.502388096,  1.532003157,  1.561401003,
-           1.590638996,  1.619698042,  1.648584389,  1.6773004,    1.705836363,  1.734240067,
-           1.762493373,  1.790601267,  1.818568527,  1.846396473,  1.874096074,  1.901644446,
-           1.929093778,  1.956423545,  1.983637478,  2.010739161,  2.037732044,  2.064619447,
-           2.091378931,  2.118065486,  2.144655781,  2.171152677,  2.197466368,  2.223787045,
-           2.250022238,  2.276174429,  2.302217763,  2.328211726,  2.354129611,  2.379973577,
-           2.405745715,  2.431448042,  2.457082513,  2.482651016,  2.508125441},
-          {-1.186314311, -1.118182088, -1.051071786, -0.98503744,  -0.919997327, -0.856032819,
-           -0.793091146, -0.731130403, -0.670181835, -0.610206974, -0.551234125, -0.493201971,
-           -0.436100608, -0.379956577, -0.324693973, -0.270337811, -0.216849166, -0.164251793,
-           -0.112480611, -0.061527225, -0.011415527, 0.037931232,  0.08648959,   0.134295654,
-           0.181326784,  0.227658468,  0.273268249,  0.318190167,  0.362402723,  0.405980181,
-           0.448901108,  0.491197857,  0.532850126,  0.573931044,  0.61442024,   0.654327451,
-           0.693697165,  0.732537702,  0.770850818,  0.808644805,  0.845971752,  0.882818902,
-           0.919214406,  0.955139462,  0.990665341,  1.025778218,  1.060487115,  1.094817708,
-           1.128751546,  1.162356503,  1.195618236,  1.228544601,  1.261158441,  1.293466606,
-           1.325455493,  1.357187823,  1.38864825,   1.41984269,   1.450790279,  1.481474829,
-           1.511948324,  1.542193597,  1.572227406,  1.602053448,  1.631679326,  1.661086908,
-           1.690334603,  1.719402869,  1.748298003,  1.777022403,  1.805565904,  1.833977337,
-           1.862238073,  1.890353122,  1.918327279,  1.946161877,  1.973867909,  2.001421984,
-           2.028877347,  2.056212952,  2.083432539,  2.110539701,  2.137537894,  2.164430445,
-           2.191194375,  2.217885787,  2.244480794,  2.270982262,  2.297392955,  2.323715538,
-           2.34984686,   2.376003574,  2.402050665,  2.428048912,  2.453970959,  2.47981897,
-           2.505595037,  2.531301184,  2.556939368,  2.582511482,  2.607988724},
-          {-1.087282817, -1.019239958, -0.952221103, -0.886279956, -0.821333328, -0.757462515,
-           -0.694613454, -0.632742941, -0.571881652, -0.511990014, -0.453095941, -0.39513655,
-           -0.338101409, -0.282016973, -0.226805764, -0.172492883, -0.119038927, -0.066468106,
-           -0.01471405,  0.036231125,  0.086342629,  0.13569842,   0.184273954,  0.232104999,
-           0.279167567,  0.325538212,  0.371193021,  0.416165432,  0.460432365,  0.504069141,
-           0.547052714,  0.589414786,  0.631133459,  0.672283021,  0.712841541,  0.752817318,
-           0.7922561,    0.831164827,  0.869544784,  0.907403057,  0.944793174,  0.981701179,
-           1.018155048,  1.054134958,  1.089713789,  1.124876763,  1.159632855,  1.194007787,
-           1.227982387,  1.261626131,  1.294923981,  1.327883894,  1.360528871,  1.392865888,
-           1.424880852,  1.456637941,  1.488121292,  1.519336959,  1.550304251,  1.581006515,
-           1.611497079,  1.641758273,  1.671806991,  1.701647024,  1.731286074,  1.760705511,
-           1.789965006,  1.819044482,  1.847950295,  1.876684886,  1.905237546,  1.933658366,
-           1.961928124,  1.990051858,  2.018034388,  2.045877061,  2.073590901,  2.101151902,
-           2.128614587,  2.15595728,   2.183183732,  2.210297546,  2.237302186,  2.264200987,
-           2.29097032,   2.317667628,  2.344268356,  2.370775377,  2.397191458,  2.423519271,
-           2.449761394,  2.475796731,  2.501848378,  2.527851812,  2.553778898,  2.579631806,
-           2.605412632,  2.631123404,  2.656766083,  2.682342568,  2.707823228},
-          {-0.988461892, -0.92052743,  -0.853619423, -0.78779117,  -0.722957701, -0.659200219,
-           -0.596463091, -0.534701547, -0.473945581, -0.414154294, -0.355355129, -0.297483329,
-           -0.24052784,  -0.184515023, -0.12936552,  -0.075104547, -0.021692144, 0.03084692,
-           0.082580558,  0.133516027,  0.18362745,   0.232994232,  0.281590526,  0.329451692,
-           0.376552122,  0.422969656,  0.46867863,   0.513711773,  0.558044105,  0.601752228,
-           0.644811162,  0.68725184,   0.729050445,  0.770282676,  0.810924725,  0.850983166,
-           0.890505271,  0.929496323,  0.967957039,  1.005893047,  1.043359616,  1.08034134,
-           1.116865976,  1.152912463,  1.188555623,  1.223779514,  1.258593051,  1.293021998,
-           1.327046304,  1.360737376,  1.394079327,  1.427080227,  1.459763262,  1.492135555,
-           1.524182418,  1.555969785,  1.587481167,  1.618722785,  1.649714153,  1.680438061,
-           1.71094946,   1.741230072,  1.771296961,  1.801154036,  1.830809116,  1.860242977,
-           1.889516813,  1.918609906,  1.947528683,  1.976275642,  2.004839419,  2.033271623,
-           2.06155232,   2.089686585,  2.117679266,  2.145531729,  2.173255035,  2.200824439,
-           2.228296,     2.255647287,  2.282882062,  2.310003941,  2.337016399,  2.363922779,
-           2.390698669,  2.417403128,  2.444010794,  2.470524547,  2.496947163,  2.523281319,
-           2.5495296,    2.575694499,  2.601748369,  2.627613652,  2.653546828,  2.679405654,
-           2.70519223,   2.730908592,  2.756556705,  2.782138471,  2.807623274},
-          {-0.889896274, -0.822093089, -0.755319218, -0.689627461, -0.624930686, -0.56130998,
-           -0.498707816, -0.437077537, -0.37644832,  -0.316777675, -0.258092499, -0.200325792,
-           -0.143465768, -0.087538699, -0.032462988, 0.021735988,  0.07509884,   0.12760011,
-           0.17930954,   0.230233625,  0.280345174,  0.329725317,  0.378346642,  0.426244018,
-           0.473389898,  0.519863668,  0.565637575,  0.610743505,  0.655154211,  0.698947847,
-           0.742097128,  0.784632072,  0.826526578,  0.867858047,  0.908600432,  0.948758239,
-           0.988380587,  1.027470767,  1.066028819,  1.104058611,  1.141617518,  1.178688377,
-           1.21529868,   1.251425852,  1.287147066,  1.322444957,  1.357328355,  1.391823063,
-           1.425907951,  1.459656755,  1.493052546,  1.52610352,   1.558833078,  1.591248508,
-           1.623334398,  1.655158804,  1.686704469,  1.717977816,  1.748998609,  1.779748965,
-           1.810285793,  1.840590086,  1.870679115,  1.900556934,  1.930231509,  1.959682907,
-           1.988974157,  2.018083769,  2.047018266,  2.075780214,  2.104357467,  2.132803456,
-           2.161097398,  2.18924441,   2.217249379,  2.24511369,   2.272848453,  2.300428036,
-           2.327910341,  2.35527203,   2.382516881,  2.409648523,  2.436670445,  2.463586001,
-           2.490369839,  2.517082956,  2.543699022,  2.570220926,  2.596651453,  2.622993289,
-           2.649249026,  2.675421166,  2.701481059,  2.727493915,  2.753267044,  2.779133005,
-           2.804926517,  2.830649619,  2.856304283,  2.88189242,   2.907382233},
-          {-0.791639695, -0.72399519, -0.657383293, -0.591856188, -0.527324122, -0.463868041,
-           -0.401428131, -0.33995547, -0.279478266, -0.219952135, -0.161403334, -0.103762198,
-           -0.047016095, 0.008808784, 0.063796682,  0.117921998,  0.171226091,  0.223682654,
-           0.275363585,  0.326274452, 0.376386479,  0.425782842,  0.474434252,  0.522374994,
-           0.569575213,  0.616116144, 0.661967552,  0.707160335,  0.751664555,  0.795560237,
-           0.838817363,  0.881464883, 0.923473975,  0.964924103,  1.005786555,  1.046063373,
-           1.085805904,  1.125015063, 1.163690078,  1.201832706,  1.239502854,  1.276681244,
-           1.313395036,  1.34961982,  1.385435594,  1.420823262,  1.45579153,   1.490366233,
-           1.524524914,  1.558344112, 1.591805618,  1.624917762,  1.65770419,   1.69017238,
-           1.722306031,  1.754175753, 1.78576336,   1.817075512,  1.848132271,  1.878914949,
-           1.90948281,   1.939815976, 1.969931969,  1.999835025,  2.029533292,  2.059005995,
-           2.088318362,  2.117447991, 2.14640152,   2.175181603,  2.203775164,  2.232237817,
-           2.260547764,  2.288710177, 2.316729989,  2.344608612,  2.372357215,  2.399949106,
-           2.427444389,  2.454818645, 2.48207567,   2.509219109,  2.536252466,  2.56317911,
-           2.589972565,  2.616696143, 2.64332236,   2.669854115,  2.696294202,  2.722645319,
-           2.748910066,  2.775090956, 2.801158143,  2.827179284,  2.853123572,  2.878993194,
-           2.904607032,  2.93033824,  2.956000784,  2.981596581,  3.007092443},
-          {-0.69375643,  -0.626303278, -0.559886463, -0.494557406, -0.430223191, -0.366964584,
-           -0.304719027, -0.243434889, -0.183139231, -0.123785427, -0.065398999, -0.007907137,
-           0.048703761,  0.104407555,  0.159291593,  0.213329959,  0.26656486,   0.318968938,
-           0.370616618,  0.421512332,  0.471625403,  0.521041414,  0.569728845,  0.617721283,
-           0.664986139,  0.711606855,  0.757550264,  0.802846119,  0.847461308,  0.891478109,
-           0.934863283,  0.977644545,  1.019789855,  1.061381173,  1.102386631,  1.142805352,
-           1.182691366,  1.222042762,  1.260857809,  1.299135729,  1.336939475,  1.37424722,
-           1.41108572,   1.447428333,  1.483358447,  1.518854853,  1.553926089,  1.588597998,
-           1.622846494,  1.656751475,  1.690293158,  1.723480015,  1.756335959,  1.788868683,
-           1.8210608,    1.852985983,  1.884624914,  1.915984534,  1.947085263,  1.97790745,
-           2.008513183,  2.038881544,  2.069030364,  2.098964102,  2.128691137,  2.158189695,
-           2.187527637,  2.216681483,  2.245658014,  2.274459997,  2.303073257,  2.331556008,
-           2.359885252,  2.388066228,  2.416103928,  2.4439998,    2.471765079,  2.499371819,
-           2.526882743,  2.554272145,  2.581543842,  2.6087015,    2.635748642,  2.662688654,
-           2.689493721,  2.716229914,  2.742868369,  2.769411999,  2.795863614,  2.82222592,
-           2.848501531,  2.87469297,   2.900768971,  2.926800101,  2.952754093,  2.978633143,
-           3.004439374,  3.029965036,  3.055637028,  3.081242009,  3.106745156},
-          {-0.596322994, -0.529099921, -0.462917307, -0.397825632, -0.333728166, -0.270705451,
-           -0.208691645, -0.147631892, -0.087551916, -0.028402454, 0.029791803,  0.087107346,
-           0.143558863,  0.199120213,  0.253882348,  0.307818912,  0.360973046,  0.413316098,
-           0.464925413,  0.515804043,  0.565919037,  0.615358787,  0.664089127,  0.712142829,
-           0.759484087,  0.806198955,  0.852250844,  0.897668186,  0.94241416,   0.98657375,
-           1.030109953,  1.073049074,  1.115355305,  1.157113605,  1.198288403,  1.238875387,
-           1.278931808,  1.318452417,  1.357434349,  1.395873807,  1.433837385,  1.471300202,
-           1.50828851,   1.544772966,  1.580841005,  1.61646885,   1.651664797,  1.686454663,
-           1.720812359,  1.754821793,  1.788461247,  1.821739326,  1.854680239,  1.887291902,
-           1.919555604,  1.951548677,  1.983250432,  2.014668137,  2.045822635,  2.076693127,
-           2.107345076,  2.13775633,   2.167945098,  2.197916117,  2.227678047,  2.25720795,
-           2.286576823,  2.315759912,  2.344764188,  2.373592558,  2.402229559,  2.430736488,
-           2.459088933,  2.487292221,  2.515351418,  2.543268012,  2.571053329,  2.598677935,
-           2.626207654,  2.653615255,  2.680904586,  2.708079336,  2.735143049,  2.762099131,
-           2.788918187,  2.815669544,  2.842322713,  2.868880623,  2.895346097,  2.921721857,
-           2.948010531,  2.974214654,  3.000301282,  3.02634442,   3.052310078,  3.078200463,
-           3.104017708,  3.129763876,  3.155440962,  3.180818625,  3.206330518},
-          {-0.4994299,   -0.432482472, -0.366579907, -0.301771521, -0.237955999, -0.175213608,
-           -0.113474592, -0.052680289, 0.007145123,  0.066053979,  0.124022499,  0.181131438,
-           0.237396671,  0.292791959,  0.347412387,  0.401230978,  0.454291877,  0.506564825,
-           0.558130505,  0.608990294,  0.659108532,  0.708576856,  0.75735799,   0.805483753,
-           0.852914597,  0.89973965,   0.945918359,  0.99147767,   1.036376473,  1.080702979,
-           1.124415845,  1.16753979,   1.210034634,  1.251988935,  1.293362816,  1.334147957,
-           1.374405454,  1.414126153,  1.453305858,  1.491937188,  1.530091079,  1.567738995,
-           1.604906572,  1.641561195,  1.677795115,  1.713581428,  1.748928093,  1.78386084,
-           1.818351116,  1.852487594,  1.886246178,  1.91963558,   1.952680316,  1.985388532,
-           2.017739896,  2.049816094,  2.081594772,  2.113083574,  2.144303843,  2.175233417,
-           2.205941771,  2.236405294,  2.266642656,  2.296658941,  2.326463162,  2.356031024,
-           2.385437238,  2.414655573,  2.443693235,  2.472553315,  2.501218852,  2.529754777,
-           2.558135028,  2.586365044,  2.614449982,  2.642391389,  2.670200696,  2.697846728,
-           2.72539895,   2.752828346,  2.780138796,  2.807334018,  2.834417582,  2.861392918,
-           2.888228775,  2.914998302,  2.941669104,  2.968244126,  2.994726209,  3.021118092,
-           3.04742242,   3.073641743,  3.099741147,  3.125798675,  3.151778311,  3.177682278,
-           3.20351272,   3.229271714,  3.254961267,  3.280315264,  3.305837622},
-          {-0.403183389, -0.336564717, -0.270995372, -0.206523227, -0.143041479, -0.080630058,
-           -0.019214578, 0.041268079,  0.100795496,  0.159423535,  0.217129384,  0.273998665,
-           0.330048502,  0.385252395,  0.439710095,  0.493393747,  0.546348523,  0.598542178,
-           0.65005914,   0.700898757,  0.751022169,  0.800524707,  0.849365477,  0.897575203,
-           0.945110025,  0.992062668,  1.038388048,  1.084111476,  1.129186943,  1.173706503,
-           1.21762387,   1.260962026,  1.30367578,   1.345857986,  1.38746382,   1.428480336,
-           1.468973204,  1.508928731,  1.548341186,  1.587198956,  1.625578122,  1.663445804,
-           1.700826876,  1.737684775,  1.774117444,  1.810094188,  1.845622489,  1.880727899,
-           1.915378834,  1.949669596,  1.983573163,  2.017098303,  2.050269834,  2.083096113,
-           2.115554829,  2.147732821,  2.179605712,  2.21118157,   2.242482319,  2.273484187,
-           2.304261394,  2.334788612,  2.365085075,  2.395156293,  2.425011716,  2.454625497,
-           2.484076713,  2.513337435,  2.542415168,  2.57131324,   2.600012974,  2.628583547,
-           2.656996994,  2.685258897,  2.713374532,  2.741345522,  2.769183428,  2.796855054,
-           2.824434105,  2.851889489,  2.879225126,  2.906444769,  2.933552017,  2.960550326,
-           2.987406288,  3.014197501,  3.040889346,  3.067484793,  3.0939867,    3.120397829,
-           3.146720842,  3.172958308,  3.199073022,  3.225147724,  3.251144044,  3.277064218,
-           3.30291041,   3.32868471,   3.354389139,  3.380025653,  3.405254627},
-          {-0.307706903, -0.241478151, -0.176302853, -0.112227095, -0.049137549, 0.012886273,
-           0.073924179,  0.134044452,  0.193226631,  0.251530559,  0.308934395,  0.365529216,
-           0.421333379,  0.476319876,  0.530593598,  0.579965289,  0.632790942,  0.684892486,
-           0.736358395,  0.787184437,  0.837326765,  0.886885358,  0.935814239,  0.98414284,
-           1.031821684,  1.078948928,  1.129486109,  1.175396654,  1.220673556,  1.265413407,
-           1.309564394,  1.353147662,  1.396112362,  1.438556456,  1.480429516,  1.52171333,
-           1.562478968,  1.602707533,  1.642391533,  1.681514412,  1.720158293,  1.75828517,
-           1.795918977,  1.8330184,    1.869688066,  1.905892694,  1.941639096,  1.976952509,
-           2.01179762,   2.046275343,  2.080355055,  2.114045487,  2.147371721,  2.180342284,
-           2.212932437,  2.245235082,  2.277223383,  2.308905876,  2.340305149,  2.37139553,
-           2.402256818,  2.432861672,  2.463230011,  2.493367868,  2.523285237,  2.55295451,
-           2.58245987,   2.611771448,  2.640897141,  2.669840582,  2.698581154,  2.727192956,
-           2.755645855,  2.78394562,   2.812097682,  2.840103762,  2.867975588,  2.89567764,
-           2.923288511,  2.950774725,  2.978140249,  3.005388876,  3.03252424,   3.059549829,
-           3.086429744,  3.113246713,  3.139963556,  3.166583265,  3.193108724,  3.219542717,
-           3.245887928,  3.272146949,  3.298279936,  3.324375037,  3.350391173,  3.3763306,
-           3.402195499,  3.427987977,  3.453710076,  3.479019343,  3.504568963},
-          {-0.213142015, -0.147372512, -0.082659603, -0.019047172, 0.04358582,  0.105160355,
-           0.16576253,   0.225466516,  0.284253958,  0.337962841,  0.394972579, 0.467417244,
-           0.523185289,  0.578131509,  0.632363306,  0.685853576,  0.738650475, 0.790720678,
-           0.842154916,  0.8929509,    0.943066291,  0.99260192,   1.041512281, 1.089826497,
-           1.137494666,  1.184613758,  1.231131939,  1.277071363,  1.306468147, 1.35148142,
-           1.395925709,  1.439821264,  1.483110759,  1.529908762,  1.572085356, 1.613673867,
-           1.654751684,  1.695294035,  1.73529144,   1.77472162,   1.813673739, 1.85210378,
-           1.890034527,  1.927418978,  1.964369535,  2.000845394,  2.036852441, 2.072415393,
-           2.107494361,  2.142197959,  2.176491142,  2.210382456,  2.243897162, 2.277043865,
-           2.309794846,  2.342250091,  2.374379777,  2.406192928,  2.437712874, 2.468911707,
-           2.499875735,  2.530575271,  2.561031053,  2.591249752,  2.621242036, 2.650978326,
-           2.680548724,  2.709921189,  2.739104117,  2.768101546,  2.796890702, 2.825551334,
-           2.854050878,  2.88239535,   2.910590386,  2.93863784,   2.966549648, 2.994287661,
-           3.021936041,  3.049458604,  3.076859376,  3.104142196,  3.131310741, 3.158368533,
-           3.185276841,  3.212124225,  3.238870592,  3.265518962,  3.292072245, 3.318533249,
-           3.344904687,  3.371189174,  3.397343864,  3.423463064,  3.449502607, 3.475464774,
-           3.501351768,  3.526763456,  3.552516636,  3.578200537,  3.603767605},
-          {-0.119648325, -0.054415007, 0.009760575, 0.072837237, 0.134945037, 0.196005523,
-           0.251811911,  0.327377651,  0.386113878, 0.44398409,  0.500969632, 0.557171035,
-           0.612610931,  0.667264259,  0.721245872, 0.774527711, 0.827159821, 0.879106125,
-           0.930463313,  0.981226165,  1.031347556, 1.080934033, 1.129934553, 1.178376493,
-           1.226203269,  1.273517202,  1.320259373, 1.366449227, 1.412025847, 1.457090677,
-           1.501582295,  1.54551745,   1.588836195, 1.615458188, 1.658004448, 1.699974165,
-           1.741454104,  1.786507576,  1.826861842, 1.866643815, 1.905950767, 1.944731717,
-           1.983008038,  2.020725963,  2.058006851, 2.094803281, 2.131119871, 2.166980539,
-           2.202339788,  2.23731513,   2.271866098, 2.306000823, 2.339744598, 2.373105943,
-           2.406053479,  2.438695405,  2.470998253, 2.502971525, 2.534639352, 2.565971186,
-           2.597060878,  2.627875999,  2.658438255, 2.688755088, 2.718837987, 2.74865521,
-           2.778303655,  2.807748884,  2.836999936, 2.866061385, 2.894908113, 2.923626283,
-           2.952180658,  2.980577585,  3.008822975, 3.036918866, 3.064877461, 3.092657682,
-           3.120349949,  3.147915055,  3.175357095, 3.202679968, 3.229887396, 3.25698294,
-           3.28392469,   3.310807752,  3.33758876,  3.364270763, 3.390856701, 3.417349411,
-           3.443751633,  3.470066013,  3.496246338, 3.52239382,  3.547986218, 3.57398724,
-           3.599911984,  3.625762616,  3.651541229, 3.677249849, 3.702837373},
-          {-0.027401645, 0.037212562, 0.100771395, 0.158933949, 0.236866065, 0.297861625,
-           0.357878059,  0.416998436, 0.475209207, 0.532583199, 0.589103714, 0.644880151,
-           0.699937603,  0.735047701, 0.78871856,  0.841768181, 0.894241772, 0.946091828,
-           0.997418067,  1.048206474, 1.098399425, 1.148110005, 1.197278232, 1.245930206,
-           1.294000972,  1.341604039, 1.388673462, 1.435229797, 1.48120446,  1.526714204,
-           1.589901743,  1.634215284, 1.677920072, 1.72112682,  1.76376762,  1.80580835,
-           1.847333966,  1.888310391, 1.91258651,  1.952820852, 1.99260045,  2.03598594,
-           2.074659606,  2.112763397, 2.150428864, 2.18760073,  2.224424141, 2.260819175,
-           2.296713838,  2.332210858, 2.367237146, 2.401800383, 2.43592744,  2.466446644,
-           2.499808807,  2.532839163, 2.565499116, 2.597798954, 2.629764444, 2.661362814,
-           2.692697616,  2.723734219, 2.754496628, 2.784994226, 2.815240518, 2.845202743,
-           2.874985693,  2.904553472, 2.93322054,  2.962411841, 2.991374083, 3.020202537,
-           3.048859378,  3.077352173, 3.105687897, 3.133869416, 3.161909853, 3.189764943,
-           3.21753312,   3.245171737, 3.272685168, 3.300077511, 3.327352619, 3.354514142,
-           3.381516205,  3.408462068, 3.435304268, 3.462045862, 3.4886898,   3.515238931,
-           3.541696012,  3.568063711, 3.594291598, 3.620489526, 3.646605545, 3.672642004,
-           3.698601174,  3.724485252, 3.750296365, 3.77603657,  3.801651086},
-          {0.06341047,  0.122964046, 0.202660976, 0.265029713, 0.32640874,  0.386720392,
-           0.446068729, 0.504546239, 0.542678257, 0.5993564,   0.655287504, 0.710581952,
-           0.765255153, 0.819268661, 0.87274451,  0.925639551, 0.977998185, 1.029768106,
-           1.081052547, 1.131833669, 1.182048632, 1.231815223, 1.28106845,  1.329833556,
-           1.378040266, 1.425808162, 1.473066245, 1.519834589, 1.566039133, 1.611804153,
-           1.657055589, 1.701811308, 1.745995898, 1.789739122, 1.832965574, 1.894172891,
-           1.937413327, 1.959819269, 2.001204752, 2.042056856, 2.08246529,  2.128833819,
-           2.168568047, 2.2076659,   2.246245998, 2.277083552, 2.314527527, 2.351474786,
-           2.387858893, 2.423812782, 2.459279844, 2.494265597, 2.525884978, 2.560065426,
-           2.593770151, 2.627129158, 2.660097087, 2.692684012, 2.72491614,  2.756756031,
-           2.788318226, 2.81865144,  2.849661325, 2.880386715, 2.910841785, 2.940989407,
-           2.970946518, 3.000672834, 3.030180383, 3.059476446, 3.088531616, 3.117449564,
-           3.14618962,  3.17476024,  3.203169196, 3.231419986, 3.259526466, 3.287441235,
-           3.315270377, 3.342967908, 3.370538459, 3.39798632,  3.425315486, 3.4525297,
-           3.479579296, 3.506575373, 3.533466539, 3.560255865, 3.586946304, 3.613540713,
-           3.640041857, 3.666452416, 3.692717877, 3.718956418, 3.745111907, 3.771186719,
-           3.797183155, 3.823103445, 3.848949748, 3.874724153, 3.900367497},
-          {0.165275876, 0.229059612, 0.291743994, 0.353293394, 0.413862412, 0.453723486,
-           0.512142309, 0.569830228, 0.62676913,  0.68303416,  0.738597016, 0.793571366,
-           0.847970192, 0.90175058,  0.955037822, 1.007784059, 1.060032568, 1.111725906,
-           1.162970695, 1.213745238, 1.263981401, 1.313801846, 1.363136623, 1.412010408,
-           1.460347736, 1.508274696, 1.55571545,  1.602690044, 1.649119154, 1.695216031,
-           1.740887848, 1.784525362, 1.82907619,  1.873217686, 1.916862294, 1.959991188,
-           2.002694183, 2.058416381, 2.101404085, 2.131852585, 2.17311565,  2.213876751,
-           2.254123094, 2.293752346, 2.332898143, 2.365648644, 2.403612913, 2.441078967,
-           2.477968213, 2.514427053, 2.550386661, 2.583155386, 2.618201772, 2.652799912,
-           2.686896756, 2.720634849, 2.753960643, 2.78688341,  2.818350868, 2.850535323,
-           2.882429582, 2.913985449, 2.94522791,  2.976167148, 3.006818223, 3.037140541,
-           3.067261489, 3.097137175, 3.126780901, 3.156201157, 3.185366085, 3.214175594,
-           3.24302632,  3.271698134, 3.300200096, 3.328536831, 3.356723484, 3.38470964,
-           3.412610227, 3.440375948, 3.468012056, 3.495523329, 3.522914137, 3.550188495,
-           3.577292644, 3.604346427, 3.631294145, 3.658138879, 3.68488357,  3.711531041,
-           3.738084023, 3.764545164, 3.790855298, 3.817141959, 3.843344264, 3.869464595,
-           3.895505269, 3.921468543, 3.947356604, 3.973171579, 3.998849369},
-          {0.254094746, 0.316929031, 0.378658377, 0.419386948, 0.478924987, 0.537566316,
-           0.595429606, 0.652614209, 0.70909943,  0.764960856, 0.820166058, 0.874831027,
-           0.928965545, 0.98252158,  1.0356273,   1.088229814, 1.140371217, 1.191988833,
-           1.24319276,  1.293957628, 1.344210087, 1.394077988, 1.443486564, 1.492460291,
-           1.54099996,  1.589211954, 1.636954719, 1.682942935, 1.72965828,  1.775988373,
-           1.821864042, 1.867325883, 1.91222476,  1.956605263, 2.000583528, 2.044134149,
-           2.085743543, 2.137327065, 2.180665243, 2.223420951, 2.256599988, 2.29784598,
-           2.338614736, 2.37879043,  2.418521384, 2.452912389, 2.49142282,  2.529440404,
-           2.566873048, 2.603881048, 2.637881695, 2.673876699, 2.70940909,  2.74447844,
-           2.779021627, 2.813194838, 2.845713485, 2.879073489, 2.912041539, 2.944563355,
-           2.976780095, 3.008636319, 3.040157453, 3.07135396,  3.101797166, 3.13236748,
-           3.162722776, 3.192813089, 3.222652538, 3.25225054,  3.281571782, 3.310740586,
-           3.339709469, 3.368489518, 3.397091049, 3.425519793, 3.453792173, 3.481854778,
-           3.509831367, 3.53766937,  3.565374696, 3.592952666, 3.620408081, 3.647745281,
-           3.674906547, 3.702020371, 3.729026865, 3.755929159, 3.782730208, 3.809432826,
-           3.83603972,  3.862553509, 3.888910437, 3.915247266, 3.941498418, 3.967666275,
-           3.993753164, 4.019761358, 4.045693073, 4.071550465, 4.097264568},
-          {0.320968502, 0.382466466, 0.443054545, 0.502704417, 0.561596289, 0.619641158,
-           0.676960969, 0.733656564, 0.789703057, 0.845175225, 0.900035472, 0.95440142,
-           1.008279275, 1.061615645, 1.114541668, 1.16699951,  1.219030438, 1.270566747,
-           1.321722462, 1.372468928, 1.422832154, 1.472865371, 1.522456906, 1.571770032,
-           1.619162252, 1.667453825, 1.715316975, 1.762810519, 1.809812215, 1.856252543,
-           1.902185193, 1.946816953, 1.991797692, 2.03645357,  2.080722389, 2.138626337,
-           2.168140681, 2.215910666, 2.259558871, 2.302709217, 2.345470906, 2.380557002,
-           2.421835804, 2.462551168, 2.502866956, 2.542665472, 2.577768406, 2.616363543,
-           2.654371842, 2.691968399, 2.726715323, 2.763255332, 2.799325043, 2.83492043,
-           2.869966586, 2.903317614, 2.937556348, 2.971360713, 3.004752812, 3.037669282,
-           3.069577389, 3.101823573, 3.133715341, 3.165261626, 3.196477172, 3.227309353,
-           3.257911947, 3.288229096, 3.318275902, 3.347840994, 3.377352334, 3.406699805,
-           3.435830887, 3.464757963, 3.49349274,  3.522042299, 3.550424747, 3.578583651,
-           3.606653106, 3.634577244, 3.662363174, 3.690017286, 3.717545297, 3.744952317,
-           3.772176748, 3.799356606, 3.826427768, 3.853393584, 3.880257131, 3.907021267,
-           3.933688683, 3.960261947, 3.986672182, 4.013066279, 4.039373426, 4.065595938,
-           4.091736096, 4.117796146, 4.143778293, 4.169684702, 4.195440987},
-          {0.404749574, 0.465450628, 0.525296719, 0.58425779,  0.642519823, 0.699986531,
-           0.756781034, 0.813003924, 0.868624787, 0.92371681,  0.978236776, 1.032303992,
-           1.085921442, 1.139030743, 1.191766866, 1.244067584, 1.296030999, 1.347610829,
-           1.39883673,  1.449776225, 1.5003462,   1.54900501,  1.598602701, 1.647859514,
-           1.696691538, 1.74523867,  1.793024036, 1.840289324, 1.886507045, 1.933030104,
-           1.979140733, 2.024911715, 2.070294275, 2.115499884, 2.159598663, 2.211667326,
-           2.25737338,  2.293798212, 2.337705215, 2.381185297, 2.424369087, 2.467109178,
-           2.503594255, 2.544828287, 2.585714,    2.626119694, 2.662479195, 2.701668062,
-           2.740275137, 2.778491557, 2.813988814, 2.851116267, 2.887771158, 2.923945314,
-           2.958166224, 2.993379466, 3.028140589, 3.062450247, 3.095486694, 3.128872723,
-           3.161935599, 3.194597845, 3.226882927, 3.258798906, 3.28991309,  3.321086347,
-           3.352017181, 3.38264046,  3.41297114,  3.443019676, 3.472741288, 3.502286502,
-           3.531597509, 3.56068806,  3.589451923, 3.618151213, 3.646669631, 3.67494718,
-           3.703129457, 3.731156832, 3.759037829, 3.786780174, 3.814390818, 3.841875974,
-           3.869170381, 3.896422193, 3.923563205, 3.950597264, 3.977527798, 4.004357888,
-           4.031090342, 4.057727754, 4.084195939, 4.110652361, 4.137020737, 4.163303275,
-           4.189502158, 4.215619547, 4.241657588, 4.267618405, 4.29342185},
-          {0.486756357, 0.546675238, 0.605798987, 0.664092567, 0.721744834, 0.778649759,
-           0.834929875, 0.890684543, 0.945877418, 1.000580471, 1.054745455, 1.108494664,
-           1.161829137, 1.214779531, 1.26744784,  1.319713039, 1.37187059,  1.423701078,
-           1.475220199, 1.526365539, 1.574286435, 1.624439901, 1.674274151, 1.723537632,
-           1.771948851, 1.819573943, 1.867403903, 1.914802319, 1.96173356,  2.008443413,
-           2.055092492, 2.101043046, 2.146577502, 2.191916324, 2.236987755, 2.285143481,
-           2.330806227, 2.376244649, 2.42137461,  2.458596534, 2.502128309, 2.545293777,
-           2.588068391, 2.625473362, 2.666899721, 2.707890078, 2.745420338, 2.785206434,
-           2.824422969, 2.863278612, 2.899551519, 2.937300431, 2.974581025, 3.009998305,
-           3.046159192, 3.08196228,  3.117302844, 3.151236557, 3.185656118, 3.219552118,
-           3.253116061, 3.28625793,  3.318401117, 3.350768105, 3.382761011, 3.414308669,
-           3.445598693, 3.476220663, 3.506883655, 3.53724197,  3.567243267, 3.597054568,
-           3.626609994, 3.655924017, 3.68501074,  3.713879636, 3.742552153, 3.770876174,
-           3.799197933, 3.82735211,  3.855348692, 3.883196874, 3.910905038, 3.938480762,
-           3.965855243, 3.993187538, 4.020405467, 4.047513731, 4.074516444, 4.101417214,
-           4.128219216, 4.154925274, 4.181455854, 4.207979427, 4.234414117, 4.260762026,
-           4.287025203, 4.313205673, 4.339305454, 4.365326567, 4.391182704},
-          {0.567028772, 0.626188976, 0.684611429, 0.74225269,  0.799302124, 0.855642437,
-           0.911395351, 0.966659897, 1.021395164, 1.075674122, 1.129524502, 1.183056534,
-           1.236208003, 1.289346981, 1.34246658,  1.395303642, 1.44784528,  1.499852606,
-           1.550945138, 1.597685688, 1.648393977, 1.698330883, 1.747383593, 1.795851455,
-           1.844375138, 1.892511336, 1.94024068,  1.988521623, 2.035599478, 2.082412407,
-           2.128914658, 2.175188486, 2.22117636,  2.267115461, 2.318252995, 2.365377189,
-           2.404092137, 2.449516184, 2.494734915, 2.53960803,  2.578604459, 2.622115504,
-           2.665309597, 2.70801391,  2.746325662, 2.787862604, 2.82897531,  2.866874367,
-           2.906696383, 2.946195532, 2.983281341, 3.021673993, 3.059609752, 3.0956863,
-           3.132473364, 3.168912778, 3.203896725, 3.23935614,  3.274370158, 3.308835298,
-           3.342252347, 3.375935038, 3.409205496, 3.442067492, 3.474055001, 3.506050362,
-           3.53777877,  3.569153131, 3.600187603, 3.630608771, 3.660939294, 3.691066694,
-           3.72091535,  3.750500109, 3.779835656, 3.808932091, 3.837812147, 3.866406546,
-           3.894887924, 3.923108005, 3.951247094, 3.979224923, 4.007051351, 4.034735435,
-           4.062204689, 4.089630038, 4.116935209, 4.144126092, 4.171207854, 4.198184997,
-           4.225061424, 4.251840518, 4.278437573, 4.305032482, 4.33153786,  4.357955808,
-           4.384288289, 4.410537187, 4.436704352, 4.462791629, 4.488706142},
-          {0.645616221, 0.704031537, 0.761755034, 0.818732815, 0.875154836, 0.930893559,
-           0.986072874, 1.040826491, 1.095165957, 1.149064198, 1.20291288,  1.25712216,
-           1.311261153, 1.365185453, 1.418885897, 1.471304091, 1.522359054, 1.567828921,
-           1.619735733, 1.670389648, 1.719854993, 1.768796109, 1.818076301, 1.866852353,
-           1.915101376, 1.964480034, 2.012366411, 2.059895468, 2.107026904, 2.154025412,
-           2.200863503, 2.248294482, 2.294301622, 2.340206976, 2.387807646, 2.434479043,
-           2.481212663, 2.527866822, 2.567498129, 2.612446972, 2.657308655, 2.697515044,
-           2.741043997, 2.784142943, 2.823956471, 2.865989453, 2.907648,    2.946617308,
-           2.987025909, 3.027156364, 3.06509176,  3.104136334, 3.142742704, 3.179537573,
-           3.216980241, 3.254092571, 3.289705415, 3.325817184, 3.361477615, 3.395791288,
-           3.43051958,  3.464800119, 3.498082677, 3.531499893, 3.564504239, 3.596998867,
-           3.628813717, 3.660658408, 3.692140811, 3.723269569, 3.753973393, 3.784210512,
-           3.814405628, 3.844312869, 3.873947267, 3.903319287, 3.932452742, 3.961271395,
-           3.9899649,   4.018456816, 4.046676182, 4.074813784, 4.102785482, 4.130601812,
-           4.158186136, 4.185722506, 4.213130076, 4.240416146, 4.267587213, 4.294648995,
-           4.321606484, 4.348463993, 4.375131975, 4.401802182, 4.428381984, 4.454873745,
-           4.481279542, 4.507601247, 4.533840602, 4.559999282, 4.585977488},
-          {0.722532712, 0.780184555, 0.837172987, 0.893435716, 0.949168575, 1.008261593,
-           1.06436749,  1.119940472, 1.168164357, 1.223395372, 1.278662077, 1.334015795,
-           1.388444903, 1.440818124, 1.491508537, 1.535837846, 1.588831027, 1.640192321,
-           1.690164179, 1.739064705, 1.788833116, 1.838212242, 1.887053906, 1.935507063,
-           1.985793275, 2.033941232, 2.081727939, 2.129272136, 2.176562144, 2.225399259,
-           2.272185626, 2.318792941, 2.365162463, 2.411566568, 2.457926876, 2.504181635,
-           2.550534526, 2.59688347,  2.643171348, 2.684477543, 2.729408902, 2.774157664,
-           2.815280032, 2.858687259, 2.901970894, 2.942285029, 2.984431577, 3.026245437,
-           3.065394186, 3.106128089, 3.144934682, 3.184624167, 3.223900816, 3.261460234,
-           3.299574865, 3.337384092, 3.373684382, 3.410485959, 3.446045082, 3.481759708,
-           3.517153831, 3.551460829, 3.585932691, 3.61996696,  3.653569767, 3.686142776,
-           3.718914519, 3.751287149, 3.782921324, 3.814533653, 3.845684801, 3.876605803,
-           3.907196779, 3.93724928,  3.967238338, 3.996939711, 4.026378136, 4.055468794,
-           4.084421089, 4.113149738, 4.141568822, 4.169902778, 4.198053131, 4.22603188,
-           4.25375749,  4.281428833, 4.308959667, 4.336358824, 4.363634289, 4.390793207,
-           4.417841912, 4.444785952, 4.471531224, 4.498281846, 4.524940212, 4.55150932,
-           4.577991706, 4.604389528, 4.630704653, 4.656938744, 4.682984955},
-          {0.797709226, 0.854533584, 0.914045489, 0.971349467, 1.028567313, 1.082618297,
-           1.132063886, 1.188401782, 1.245079689, 1.292421654, 1.345658339, 1.398348365,
-           1.458802976, 1.501828789, 1.55604501,  1.608386756, 1.65888572,  1.707805537,
-           1.75715478,  1.807157286, 1.856468627, 1.905340645, 1.956521268, 2.00525235,
-           2.053475965, 2.101460597, 2.149209238, 2.199283438, 2.246544746, 2.293681057,
-           2.340658316, 2.387587748, 2.434414819, 2.481430601, 2.528547221, 2.575686003,
-           2.623052349, 2.666040025, 2.712046988, 2.75790438,  2.800576113, 2.845379316,
-           2.890047387, 2.931711711, 2.975291918, 3.018631588, 3.059387422, 3.101677931,
-           3.141829937, 3.18297959,  3.223827732, 3.262923349, 3.302786845, 3.342334944,
-           3.380014731, 3.418502537, 3.455645614, 3.493160456, 3.529443695, 3.565864122,
-           3.60199012,  3.636938114, 3.672049203, 3.706857441, 3.740614876, 3.774366521,
-           3.807340885, 3.840357909, 3.87257925,  3.904769279, 3.936159637, 3.967600735,
-           3.998682184, 4.029199188, 4.059613295, 4.089709683, 4.119514056, 4.148932583,
-           4.178061617, 4.207085325, 4.235874912, 4.264445241, 4.292810639, 4.320984803,
-           4.348881162, 4.37671433,  4.404392442, 4.431925989, 4.45932456,  4.48659683,
-           4.513750574, 4.540792688, 4.567624748, 4.594463287, 4.621205975, 4.647856716,
-           4.674418825, 4.700895098, 4.727287899, 4.753599235, 4.779715821},
-          {0.874797077, 0.932977446, 0.991222311, 1.03804765,  1.094950221, 1.152394836,
-           1.201842241, 1.25620054,  1.309921923, 1.362914631, 1.424399769, 1.46629317,
-           1.521874453, 1.575273211, 1.62644553,  1.675572701, 1.723320326, 1.773857894,
-           1.823855094, 1.873231713, 1.921976003, 1.974109685, 2.022935996, 2.071351803,
-           2.119341708, 2.16722513,  2.218187213, 2.265770838, 2.313034572, 2.360288705,
-           2.407516231, 2.454846175, 2.502224283, 2.54968077,  2.596254144, 2.642769035,
-           2.68947647,  2.736135375, 2.78284149,  2.826211311, 2.871945192, 2.917713827,
-           2.960271046, 3.004836292, 3.047140293, 3.090931758, 3.132711256, 3.175617864,
-           3.21659089,  3.258623627, 3.299022126, 3.340064087, 3.379752528, 3.41984925,
-           3.458495541, 3.497709617, 3.535696182, 3.57414872,  3.611273339, 3.647863567,
-           3.684831816, 3.720659881, 3.756100545, 3.791606416, 3.826155591, 3.860579563,
-           3.894274385, 3.927588778, 3.960823255, 3.993324702, 4.025586696, 4.057342459,
-           4.088965926, 4.120218068, 4.150914943, 4.181468458, 4.211701583, 4.241362141,
-           4.271006066, 4.300372641, 4.329477925, 4.358245393, 4.386883491, 4.41530679,
-           4.443421262, 4.471461608, 4.499327866, 4.527032238, 4.554586059, 4.581999752,
-           4.609282809, 4.636443791, 4.663379585, 4.690321,    4.717160457, 4.743903082,
-           4.770553261, 4.797114718, 4.82359059,  4.849983513, 4.876173752},
-          {0.951902546, 0.998943958, 1.056685096, 1.115292304, 1.164115205, 1.218958847,
-           1.273074992, 1.326197494, 1.388536098, 1.429532641, 1.486487885, 1.53085608,
-           1.583189516, 1.635379992, 1.6902227,   1.738637186, 1.78936962,  1.839324717,
-           1.888647528, 1.937382203, 1.990293491, 2.039210541, 2.087656838, 2.135774279,
-           2.183586537, 2.235447982, 2.283164724, 2.330674654, 2.377963347, 2.425374776,
-           2.472975915, 2.522434973, 2.569073517, 2.615959304, 2.662992665, 2.710279583,
-           2.756533681, 2.803047655, 2.849820084, 2.894593259, 2.940528868, 2.984934596,
-           3.030128916, 3.075045786, 3.118225832, 3.162590467, 3.204937178, 3.247397477,
-           3.290224866, 3.331769254, 3.373922841, 3.414709243, 3.45525026,  3.496351231,
-           3.535801659, 3.575065594, 3.613934447, 3.652383564, 3.691053603, 3.72840878,
-           3.765520751, 3.802197371, 3.838939527, 3.874696636, 3.910028478, 3.944766765,
-           3.979611173, 4.013634769, 4.047249473, 4.080731108, 4.113351975, 4.145995054,
-           4.177984947, 4.2096154,   4.241069769, 4.271979702, 4.302715021, 4.332979484,
-           4.362929231, 4.392709197, 4.422198521, 4.451319237, 4.480283325, 4.509005632,
-           4.53738296,  4.565673179, 4.593714213, 4.621630145, 4.64937585,  4.676963545,
-           4.704404557, 4.731709282, 4.758769499, 4.785832033, 4.812783546, 4.839630727,
-           4.866379393, 4.893034544, 4.919600432, 4.946080634, 4.972349264},
-          {1.01737696,  1.069452916, 1.125281193, 1.180653841, 1.235307366, 1.288403336,
-           1.340023908, 1.391759575, 1.440155046, 1.49207181,  1.544533698, 1.597162363,
-           1.649590659, 1.702748889, 1.753014718, 1.803836581, 1.853931075, 1.903154899,
-           1.951725042, 2.00540509,  2.05428406,  2.102771578, 2.1508574,   2.198723961,
-           2.251302343, 2.299516759, 2.346858424, 2.394073286, 2.441319097, 2.492027768,
-           2.538898292, 2.585932312, 2.635288573, 2.681865892, 2.728580538, 2.775553226,
-           2.822866978, 2.869307687, 2.915943942, 2.961686905, 3.007998805, 3.052939443,
-           3.09869922,  3.142769095, 3.186920806, 3.231409052, 3.274722261, 3.318773712,
-           3.361295183, 3.403694895, 3.445744602, 3.487415324, 3.529511107, 3.570338267,
-           3.610588134, 3.650637287, 3.690276789, 3.729489053, 3.768286103, 3.806465329,
-           3.844402174, 3.882375059, 3.919386991, 3.955957117, 3.992084377, 4.027582054,
-           4.062833829, 4.097647177, 4.132321178, 4.166232814, 4.199557347, 4.232652837,
-           4.265558306, 4.29782963,  4.329720304, 4.361399103, 4.392541521, 4.423330903,
-           4.453791526, 4.484053452, 4.513885808, 4.543527278, 4.572880589, 4.601882889,
-           4.630583808, 4.659183676, 4.687504906, 4.715678063, 4.743657416, 4.771456915,
-           4.799089719, 4.826568126, 4.853778043, 4.880984425, 4.908067324, 4.935035262,
-           4.961895792, 4.988655529, 5.015320192, 5.041894666, 5.068247299},
-          {1.085450327, 1.141326114, 1.188153582, 1.241815174, 1.300826965, 1.35339854,
-           1.400339227, 1.456834704, 1.508653508, 1.557642751, 1.610352478, 1.662856576,
-           1.715028322, 1.76663452,  1.817672234, 1.867856974, 1.917138159, 1.969876203,
-           2.019453895, 2.068486393, 2.116904769, 2.165446904, 2.21778498,  2.266085591,
-           2.313436406, 2.360528986, 2.412274402, 2.459514466, 2.506224422, 2.557047074,
-           2.603911277, 2.650548555, 2.697294444, 2.746749236, 2.793291956, 2.841694063,
-           2.887960585, 2.935556035, 2.981520042, 3.027475508, 3.073768631, 3.119590032,
-           3.164988955, 3.209826138, 3.255061933, 3.299467638, 3.343538974, 3.387279487,
-           3.4304707,   3.473508459, 3.516187932, 3.558492069, 3.601031205, 3.642578907,
-           3.683535835, 3.724310721, 3.76468453,  3.804639733, 3.844189054, 3.88311144,
-           3.921813791, 3.960071358, 3.997897499, 4.035279053, 4.072213159, 4.108491375,
-           4.144535064, 4.180129609, 4.215276971, 4.249973104, 4.284041776, 4.31788197,
-           4.351295391, 4.38449134,  4.41705657,  4.449218155, 4.481000188, 4.512381962,
-           4.54342156,  4.574115383, 4.604584031, 4.634614985, 4.664433137, 4.693865719,
-           4.722952861, 4.751925057, 4.780583326, 4.809069959, 4.8373354,   4.865395091,
-           4.893226843, 4.920922893, 4.948320316, 4.97570564,  5.002950549, 5.030065563,
-           5.057060206, 5.083942999, 5.110721477, 5.137402212, 5.163848071},
-          {1.147536557, 1.201480212, 1.269697585, 1.314571668, 1.365119445, 1.417658128,
-           1.469509561, 1.52115649,  1.570068451, 1.622911547, 1.675492758, 1.727889639,
-           1.779439643, 1.830849128, 1.882057783, 1.931718849, 1.982490851, 2.032903136,
-           2.083168457, 2.132742259, 2.182641548, 2.23229411,  2.281634926, 2.330988339,
-           2.379803968, 2.429135494, 2.477827867, 2.526003422, 2.573571459, 2.623052127,
-           2.670445316, 2.717447373, 2.76406006,  2.813009769, 2.859458302, 2.907486759,
-           2.953627282, 3.001058795, 3.046935343, 3.092623858, 3.139152367, 3.185262539,
-           3.230797099, 3.276090677, 3.321236635, 3.366049086, 3.410521012, 3.454684952,
-           3.498322195, 3.541846294, 3.585465741, 3.628333038, 3.670866479, 3.713045105,
-           3.754641639, 3.795608605, 3.836675037, 3.877343734, 3.917626979, 3.957285432,
-           3.996755292, 4.035793523, 4.074412334, 4.112595172, 4.150336396, 4.187404319,
-           4.223933891, 4.260350586, 4.29631565,  4.331821428, 4.36666715,  4.401294323,
-           4.435478784, 4.469226231, 4.502543699, 4.535432818, 4.567916696, 4.599954556,
-           4.631642963, 4.662954558, 4.693902834, 4.72460534,  4.754857766, 4.78479207,
-           4.814334269, 4.843677487, 4.872811614, 4.901619978, 4.930238357, 4.958621493,
-           4.986785464, 5.014709389, 5.042338745, 5.069945358, 5.0973902,   5.124685805,
-           5.151843759, 5.178874651, 5.205788053, 5.23259251,  5.259145342},
-          {1.226591836, 1.275507738, 1.325108656, 1.377804315, 1.429863078, 1.481475047,
-           1.529039385, 1.581991163, 1.634876144, 1.687783206, 1.739815431, 1.791492086,
-           1.843051756, 1.892450976, 1.943396226, 1.994261056, 2.044958135, 2.094398501,
-           2.144845318, 2.194094886, 2.244002595, 2.293836716, 2.343057862, 2.392545528,
-           2.441628703, 2.490786394, 2.539794669, 2.588608493, 2.637127591, 2.685601565,
-           2.73371551,  2.781816817, 2.829429762, 2.87706069,  2.924370396, 2.971191332,
-           3.018324949, 3.064862166, 3.11158027,  3.157642408, 3.203959307, 3.249710728,
-           3.295604438, 3.3410188,   3.386352818, 3.431412638, 3.476184991, 3.520696968,
-           3.564712856, 3.608920509, 3.652607488, 3.695974323, 3.738685295, 3.781401899,
-           3.82355739,  3.865607742, 3.907307134, 3.948633424, 3.989599304, 4.02994699,
-           4.070143034, 4.109541918, 4.148920889, 4.187881037, 4.226414112, 4.264264801,
-           4.301614419, 4.338841613, 4.375620596, 4.411939956, 4.447325403, 4.482768324,
-           4.517760544, 4.552304572, 4.5864044,   4.620058292, 4.653287712, 4.685877085,
-           4.718280061, 4.750279198, 4.78188629,  4.813114122, 4.843976358, 4.874578384,
-           4.90455629,  4.93441146,  4.964030161, 4.993283326, 5.022320579, 5.051038744,
-           5.079562332, 5.107811535, 5.135727149, 5.16360819,  5.191301694, 5.218797241,
-           5.246160934, 5.273377488, 5.300458574, 5.327414856, 5.354097341},
-          {1.284552941, 1.337393651, 1.389542222, 1.441231748, 1.49292277,  1.540659878,
-           1.593504651, 1.646600111, 1.699613528, 1.751358746, 1.802978007, 1.852469837,
-           1.903451797, 1.954333955, 2.004272932, 2.05513,     2.105868777, 2.154887027,
-           2.205181219, 2.254610507, 2.30444398,  2.35431344,  2.403558529, 2.45309291,
-           2.502217799, 2.551454549, 2.600433028, 2.649163503, 2.697809352, 2.746407661,
-           2.794516716, 2.84275218,  2.890338403, 2.938177625, 2.98557946,  3.032836385,
-           3.079943936, 3.126957961, 3.173769698, 3.220237424, 3.266665261, 3.312850774,
-           3.358869746, 3.404457084, 3.450021393, 3.495352823, 3.540430708, 3.58527946,
-           3.629650144, 3.6739891,   3.7180601,   3.761841216, 3.805352561, 3.848570566,
-           3.891242244, 3.933848603, 3.976131476, 4.018067733, 4.059671375, 4.100321615,
-           4.141192055, 4.181674632, 4.221781042, 4.26115994,  4.30045366,  4.339062923,
-           4.377230835, 4.415260172, 4.452852321, 4.489736192, 4.52617461,  4.562440848,
-           4.598255291, 4.633408662, 4.668326594, 4.702788258, 4.73681302,  4.770154674,
-           4.803170701, 4.835919107, 4.868251668, 4.900178889, 4.931712456, 4.962865122,
-           4.993438421, 5.023964822, 5.054062757, 5.083838657, 5.113370789, 5.142543777,
-           5.171444244, 5.20013307,  5.228353571, 5.256572346, 5.28457393,  5.312345243,
-           5.33996256,  5.367408246, 5.394695983, 5.421821753, 5.448664427},
-          {1.348723073, 1.400558703, 1.452301763, 1.499171904, 1.552017937, 1.604968266,
-           1.65897642,  1.710664902, 1.762149146, 1.811935885, 1.862696216, 1.913712851,
-           1.964110033, 2.014998023, 2.064521545, 2.114899907, 2.165383142, 2.214756036,
-           2.264878534, 2.314420129, 2.364127689, 2.4137464,   2.463305286, 2.512749948,
-           2.561975384, 2.611080687, 2.660168508, 2.708820873, 2.757523955, 2.805752581,
-           2.854277078, 2.902180029, 2.950241823, 2.997884933, 3.045637192, 3.092968881,
-           3.140299015, 3.187492797, 3.234646396, 3.28129835,  3.327936053, 3.37436214,
-           3.420609332, 3.466441603, 3.512282828, 3.557910908, 3.603302488, 3.648483818,
-           3.693195423, 3.737905003, 3.782367114, 3.826559684, 3.870505626, 3.914181232,
-           3.957322072, 4.000434789, 4.043249814, 4.085743746, 4.127648957, 4.169223112,
-           4.210728469, 4.251870851, 4.292363791, 4.33276913,  4.37279114,  4.411841203,
-           4.451065174, 4.48987668,  4.527998241, 4.565946047, 4.602934936, 4.640026828,
-           4.676673512, 4.712658864, 4.748408944, 4.783699202, 4.818368036, 4.852500769,
-           4.886473822, 4.919861842, 4.952968047, 4.985648339, 5.017911779, 5.049768761,
-           5.080990443, 5.112083835, 5.142808224, 5.173178167, 5.20320894,  5.232916386,
-           5.262373497, 5.291476907, 5.320107743, 5.348732615, 5.377069633, 5.405215117,
-           5.433114366, 5.460846133, 5.4883929,   5.515749056, 5.542790407},
-          {1.411355395, 1.463099508, 1.510474485, 1.563223178, 1.61824695,  1.669681538,
-           1.720077774, 1.770908936, 1.821531221, 1.872575264, 1.923431233, 1.974364266,
-           2.0239023,   2.074217539, 2.124781657, 2.174379071, 2.224544394, 2.274023573,
-           2.323883987, 2.37366523,  2.423217331, 2.472897005, 2.522371797, 2.571789714,
-           2.620790374, 2.669966401, 2.718655962, 2.767590261, 2.81580894,  2.864501792,
-           2.912578152, 2.961019072, 3.009062896, 3.056922318, 3.104670346, 3.152166457,
-           3.199661368, 3.247022432, 3.294198158, 3.341045669, 3.387901203, 3.43456141,
-           3.481060591, 3.527150443, 3.573271763, 3.6191927,   3.664889177, 3.710390571,
-           3.755426711, 3.800487018, 3.845316201, 3.889891809, 3.934239733, 3.978336193,
-           4.021905516, 4.06548025,  4.108779688, 4.151780575, 4.194270007, 4.236387642,
-           4.278476169, 4.320226508, 4.361391886, 4.402455504, 4.443160839, 4.482920516,
-           4.522872038, 4.56218101,  4.601333294, 4.640065542, 4.677830244, 4.715734756,
-           4.752983467, 4.790014388, 4.826399533, 4.862531363, 4.898042458, 4.932983723,
-           4.967791392, 5.001996676, 5.035915811, 5.069394569, 5.102313809, 5.134938129,
-           5.166872607, 5.198686764, 5.230104498, 5.261054704, 5.291725316, 5.322040213,
-           5.352078339, 5.381721948, 5.41083286,  5.439889586, 5.468714115, 5.49723185,
-           5.525508232, 5.553590089, 5.581428473, 5.609097506, 5.636385879},
-          {1.469275444, 1.521801636, 1.577233467, 1.628520258, 1.679114916, 1.729855596,
-           1.779955567, 1.831078181, 1.882379377, 1.932513411, 1.982853492, 2.033231373,
-           2.083334028, 2.133459098, 2.18327469,  2.233186422, 2.283131372, 2.332829553,
-           2.382490273, 2.432327905, 2.481945678, 2.531415039, 2.580771601, 2.630093322,
-           2.678920494, 2.728042077, 2.77661063,  2.825520069, 2.873705364, 2.922411669,
-           2.970440133, 3.018691913, 3.066951984, 3.114971208, 3.162861408, 3.210483435,
-           3.258106217, 3.30560445,  3.352930378, 3.399940213, 3.446982258, 3.493844607,
-           3.540563023, 3.586878032, 3.633248491, 3.679433749, 3.725409035, 3.771206654,
-           3.816544791, 3.861934554, 3.90698764,  3.95192079,  3.996642968, 4.041129844,
-           4.085093949, 4.129093893, 4.172837422, 4.21630135,  4.259508322, 4.301939074,
-           4.344560917, 4.386867307, 4.428876296, 4.470330706, 4.511668035, 4.552329974,
-           4.592732969, 4.632999085, 4.67265258,  4.712132695, 4.750657704, 4.789348578,
-           4.827409097, 4.86525652,  4.902472062, 4.939440299, 4.975791275, 5.0115477,
-           5.047036229, 5.082245451, 5.116855434, 5.151171079, 5.184910789, 5.218346174,
-           5.251040208, 5.283523055, 5.31570029,  5.347469008, 5.378840459, 5.409827106,
-           5.440442498, 5.470701137, 5.500363367, 5.529969486, 5.559265625, 5.588268577,
-           5.616995321, 5.645499136, 5.673719967, 5.701715484, 5.729310991},
-          {1.536137343, 1.587545429, 1.63788434,  1.688388554, 1.73840779,  1.789589075,
-           1.841324771, 1.891248291, 1.941662081, 1.991963074, 2.042126759, 2.092305363,
-           2.142062088, 2.191939005, 2.241893189, 2.291634434, 2.341547892, 2.391098487,
-           2.440882557, 2.490425636, 2.539836787, 2.589080982, 2.638381843, 2.687261124,
-           2.736266872, 2.784873075, 2.83380021,  2.882265267, 2.930758461, 2.979231778,
-           3.027626988, 3.076157401, 3.124201916, 3.172318401, 3.220291012, 3.26799177,
-           3.315707837, 3.363137176, 3.410597202, 3.457754895, 3.504967708, 3.552013892,
-           3.598931019, 3.645448934, 3.692045875, 3.73847255,  3.784703259, 3.83077287,
-           3.876386885, 3.922078071, 3.967569331, 4.012836073, 4.057793491, 4.10264411,
-           4.14697451,  4.191369579, 4.235524673, 4.279416214, 4.323070065, 4.366151576,
-           4.409109168, 4.45192555,  4.494467593, 4.536710138, 4.578444503, 4.619692073,
-           4.660967332, 4.701688549, 4.74225711,  4.782239007, 4.821691604, 4.861138122,
-           4.899975868, 4.93861607,  4.976637742, 5.014236689, 5.051606037, 5.087993761,
-           5.124501063, 5.160398243, 5.196015155, 5.23103266,  5.265754674, 5.299894703,
-           5.333383733, 5.36667615,  5.399656121, 5.432106996, 5.46424516,  5.495974086,
-           5.527304867, 5.558175284, 5.588463363, 5.618700152, 5.648593331, 5.678158805,
-           5.707413029, 5.736372844, 5.765093662, 5.7935116,   5.821445731},
-          {1.596611983, 1.646888822, 1.696761987, 1.749114905, 1.800256103, 1.849929691,
-           1.900298167, 1.950681176, 2.000781749, 2.050989082, 2.100560135, 2.150586527,
-           2.200366121, 2.250057598, 2.299878129, 2.349563045, 2.39934135,  2.448818693,
-           2.498379801, 2.547712268, 2.597012108, 2.6459906,   2.695230871, 2.743948172,
-           2.792866509, 2.841446492, 2.890201637, 2.938810007, 2.987247106, 3.035788956,
-           3.084371472, 3.13257769,  3.180649242, 3.228792294, 3.276800678, 3.324552551,
-           3.372345669, 3.420054042, 3.467623114, 3.514898427, 3.56224889,  3.609444523,
-           3.656526428, 3.703214116, 3.749879723, 3.796518745, 3.842976555, 3.889290589,
-           3.935153236, 3.981119711, 4.026901384, 4.072472198, 4.117866007, 4.16305602,
-           4.207728701, 4.252495936, 4.29692372,  4.341213946, 4.385283964, 4.428783837,
-           4.472359522, 4.515657832, 4.558703226, 4.601308706, 4.64377568,  4.685573487,
-           4.727442114, 4.768803836, 4.810013574, 4.850870352, 4.890795615, 4.930953819,
-           4.970540781, 5.009936436, 5.04874405,  5.087327484, 5.12532237,  5.162682575,
-           5.199850037, 5.23659389,  5.273066593, 5.308939584, 5.344524326, 5.379517595,
-           5.41382436,  5.447956935, 5.481659324, 5.515043117, 5.547991959, 5.580413629,
-           5.612519141, 5.644130542, 5.675102273, 5.706035484, 5.73659441,  5.766793351,
-           5.796592307, 5.826122448, 5.855340087, 5.88430323,  5.912671361},
-          {1.655332627, 1.706041502, 1.757977448, 1.808515772, 1.859034075, 1.909007787,
-           1.959251962, 2.008875557, 2.058963727, 2.108736786, 2.158571997, 2.208361453,
-           2.258029697, 2.307669677, 2.357329936, 2.406883852, 2.456489173, 2.505732087,
-           2.55518775,  2.604228788, 2.653440389, 2.702229832, 2.751335151, 2.799987494,
-           2.848695196, 2.897394378, 2.946080343, 2.99492929,  3.043352986, 3.091886427,
-           3.140143935, 3.188490213, 3.236557433, 3.284720943, 3.332765693, 3.380565622,
-           3.428425732, 3.476215577, 3.523876191, 3.571248767, 3.618715179, 3.665905808,
-           3.713129965, 3.75996451,  3.806928326, 3.85375302,  3.900410102, 3.946940174,
-           3.993022509, 4.039127752, 4.085172842, 4.131021278, 4.176709732, 4.222209772,
-           4.267193912, 4.312301516, 4.357200925, 4.401866407, 4.446329651, 4.490224472,
-           4.534227452, 4.577969561, 4.621478404, 4.664589985, 4.707562187, 4.749865458,
-           4.792280922, 4.834400438, 4.87604276,  4.917514699, 4.958256123, 4.998904435,
-           5.039378441, 5.079493568, 5.119046369, 5.158391142, 5.197168875, 5.235117002,
-           5.273278118, 5.310848958, 5.348165347, 5.384885331, 5.421177415, 5.457182373,
-           5.492173167, 5.527306211, 5.561860569, 5.595980997, 5.629781147, 5.663033183,
-           5.69596145,  5.728367185, 5.760077286, 5.791770602, 5.822987254, 5.853895942,
-           5.884429191, 5.914601205, 5.944373455, 5.973873763, 6.002752612},
-          {1.716637475, 1.767156693, 1.817609317, 1.867480844, 1.917838068, 1.96725026,
-           2.01729801,  2.066869995, 2.116754023, 2.166297612, 2.215968945, 2.26551605,
-           2.315186828, 2.364586587, 2.414173043, 2.463501726, 2.512993933, 2.561957277,
-           2.611278785, 2.660125994, 2.709170476, 2.757839802, 2.806729859, 2.855445153,
-           2.904306813, 2.953001677, 3.001655827, 3.05029985,  3.098701424, 3.147199289,
-           3.195583825, 3.243728857, 3.291793059, 3.339976383, 3.38805269,  3.435891407,
-           3.483805622, 3.531661153, 3.57939534,  3.626711942, 3.67427519,  3.72170517,
-           3.769051491, 3.816011052, 3.863123969, 3.910111502, 3.956831155, 4.003553012,
-           4.049829704, 4.096264634, 4.142545729, 4.188644146, 4.234599853, 4.280382931,
-           4.325651736, 4.371074172, 4.416304405, 4.461315311, 4.506141577, 4.550400227,
-           4.594798845, 4.638951936, 4.682890218, 4.726586706, 4.770033527, 4.81281034,
-           4.855601187, 4.898247155, 4.940608215, 4.982659129, 5.023978502, 5.065267313,
-           5.106390584, 5.147178442, 5.18744047,  5.227503165, 5.267032781, 5.30588968,
-           5.344661955, 5.383207999, 5.421174508, 5.458894572, 5.496025265, 5.532733418,
-           5.568692944, 5.604551953, 5.63997708,  5.675095076, 5.709639893, 5.743867241,
-           5.777536234, 5.810777086, 5.843269269, 5.875683811, 5.907772816, 5.939370228,
-           5.970649625, 6.00153929,  6.031989819, 6.062144745, 6.091601828},
-          {1.776196542, 1.8260384,   1.876291973, 1.925599507, 1.975808081, 2.025081151,
-           2.074855911, 2.124252246, 2.173948245, 2.223381656, 2.272875037, 2.322255941,
-           2.371784005, 2.420983621, 2.470431416, 2.519506627, 2.568829819, 2.617580026,
-           2.666732476, 2.715403643, 2.76418676,  2.813281347, 2.861906325, 2.910632821,
-           2.959196492, 3.007896449, 3.056508555, 3.105089992, 3.153420439, 3.201866786,
-           3.250215466, 3.298352933, 3.346411196, 3.394607292, 3.442704302, 3.490567872,
-           3.538520406, 3.586424886, 3.634081369, 3.681593021, 3.729236536, 3.77675686,
-           3.82420749,  3.871272607, 3.918400769, 3.965530369, 4.012515972, 4.059405778,
-           4.105851695, 4.15248262,  4.198974239, 4.245296309, 4.291492461, 4.337531286,
-           4.383056725, 4.428766084, 4.474299032, 4.519626974, 4.564787841, 4.609381437,
-           4.654146791, 4.698681424, 4.743019212, 4.787131916, 4.831012,    4.874218992,
-           4.917617458, 4.960759456, 5.003636452, 5.046222563, 5.088075148, 5.130112158,
-           5.171688858, 5.213102487, 5.254193145, 5.294767175, 5.335172382, 5.374722538,
-           5.414244573, 5.453559733, 5.492315073, 5.530843126, 5.568796222, 5.606340437,
-           5.643110028, 5.679827318, 5.716117911, 5.752114774, 5.787532414, 5.822514689,
-           5.857180071, 5.891282924, 5.924588559, 5.957844276, 5.990675567, 6.023176638,
-           6.055171267, 6.086840816, 6.118035569, 6.148915695, 6.179018533},
-          {1.834091216, 1.884081834, 1.934214222, 1.983302829, 2.033184556, 2.08233387,
-           2.131898707, 2.181171992, 2.230652694, 2.279949366, 2.329269658, 2.378476519,
-           2.427848642, 2.4768135,   2.526068205, 2.574929013, 2.62408599,  2.672643027,
-           2.721475119, 2.770546013, 2.819049214, 2.867743016, 2.916430679, 2.965139113,
-           3.013635027, 3.062251045, 3.110775061, 3.159282166, 3.207547483, 3.255952724,
-           3.304272027, 3.352574688, 3.400452819, 3.448649622, 3.496753324, 3.544626416,
-           3.592601745, 3.640540036, 3.688240956, 3.735798833, 3.783507641, 3.83110229,
-           3.878640327, 3.925792616, 3.97303293,  4.020284404, 4.067402202, 4.114438758,
-           4.161031444, 4.207835469, 4.254513844, 4.301034851, 4.34744614,  4.393714774,
-           4.43947004,  4.48543942,  4.531247844, 4.576865213, 4.622333047, 4.667233678,
-           4.71233796,  4.75722611,  4.801935339, 4.846435923, 4.890820279, 4.934429934,
-           4.97826984,  5.021871479, 5.065226774, 5.108308981, 5.150654548, 5.193229072,
-           5.235522396, 5.27752501,  5.319227084, 5.360443771, 5.401506723, 5.441705304,
-           5.481939847, 5.521981512, 5.561659784, 5.600790979, 5.63953966,  5.678055231,
-           5.715450238, 5.753165677, 5.790304847, 5.827023343, 5.863456273, 5.899310618,
-           5.934731661, 5.969841347, 6.003856928, 6.037987534, 6.071790024, 6.105048705,
-           6.137976394, 6.170382471, 6.202377002, 6.234044071, 6.264853084},
-          {1.892757995,
-           1.941695593,
-           1.991447716,
-           2.040457706,
-           2.090124584,
-           2.139128617,
-           2.188439225,
-           2.237835655,
-           2.286877975,
-           2.336220803,
-           2.385170108,
-           2.434384733,
-           2.48335331,
-           2.532385805,
-           2.581168412,
-           2.630193376,
-           2.678691281,
-           2.727477536,
-           2.77607989,
-           2.82473681,
-           2.873243613,
-           2.921921962,
-           2.970531688,
-           3.019142651,
-           3.067529944,
-           3.116054457,
-           3.164499719,
-           3.212944852,
-           3.261151938,
-           3.309516348,
-           3.357800946,
-           3.40607916,
-           3.453943989,
-           3.502129226,
-           3.550226566,
-           3.598095893,
-           3.646081218,
-           3.694040958,
-           3.741776435,
-           3.789367077,
-           3.837127123,
-           3.88478096,
-           3.932390543,
-           3.979612913,
-           4.026950074,
-           4.074305517,
-           4.121536772,
-           4.168700717,
-           4.21541959,
-           4.26237569,
-           4.309218953,
-           4.355916075,
-           4.402519039,
-           4.448993267,
-           4.494953155,
-           4.541157012,
-           4.587214806,
-           4.633094909,
-           4.678842786,
-           4.72402318,
-           4.769527445,
-           4.814740692,
-           4.859793234,
-           4.904653802,
-           4.949315241,
-           4.993390903,
-           5.037640237,
-           5.081668744,
-           5.125468667,
-           5.169012152,
-           5.211815014,
-           5.255011332,
-           5.297829794,
-           5.340378326,
-           5.382647668,
-           5.424465558,
-           5.466141002,
-           5.506942963,
-           5.548002549,
-           5.588732554,
-           5.628955081,
-           5.668987024,
-           5.708490445,
-           5.7477828,
-           5.785929221,
-           5.824460366,
-           5.862428628,
-           5.900144868,
-           5.937286287,
-           5.97400802,
-           6.010445224,
-           6.046304408,
-           6.081149413,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {1.949890526,
-           1.998753712,
-           2.048308318,
-           2.097154637,
-           2.146541819,
-           2.195717632,
-           2.244513489,
-           2.293746222,
-           2.342640618,
-           2.391784424,
-           2.44054093,
-           2.48956631,
-           2.538301603,
-           2.587146232,
-           2.635648636,
-           2.684456965,
-           2.733006923,
-           2.78176062,
-           2.830243495,
-           2.878825504,
-           2.927242325,
-           2.975815166,
-           3.02431549,
-           3.072823984,
-           3.121109872,
-           3.169551223,
-           3.2179204,
-           3.266124669,
-           3.31426767,
-           3.362583405,
-           3.410824201,
-           3.459068148,
-           3.507044496,
-           3.555070026,
-           3.603150665,
-           3.651005887,
-           3.698991027,
-           3.746961817,
-           3.794722242,
-           3.842333202,
-           3.890131531,
-           3.937830697,
-           3.98549745,
-           4.032774489,
-           4.080194685,
-           4.127637998,
-           4.174965764,
-           4.222239542,
-           4.269065893,
-           4.316154978,
-           4.363143268,
-           4.409995734,
-           4.456768948,
-           4.503426544,
-           4.54956778,
-           4.59598235,
-           4.642351275,
-           4.688467302,
-           4.734467962,
-           4.779900275,
-           4.825599574,
-           4.871196979,
-           4.916564183,
-           4.961755631,
-           5.006764393,
-           5.051176831,
-           5.095805665,
-           5.140230615,
-           5.184444162,
-           5.228516531,
-           5.271746109,
-           5.315290368,
-           5.358592127,
-           5.401642919,
-           5.444559419,
-           5.4870686,
-           5.529319559,
-           5.570687521,
-           5.61221832,
-           5.653584197,
-           5.694632844,
-           5.73535376,
-           5.775573682,
-           5.815600668,
-           5.85462671,
-           5.893774035,
-           5.93270347,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.006697867,
-           2.055407773,
-           2.104624007,
-           2.153683282,
-           2.202496543,
-           2.251488403,
-           2.300156099,
-           2.349169503,
-           2.397895807,
-           2.446847014,
-           2.495373954,
-           2.544193433,
-           2.593036239,
-           2.641279583,
-           2.690138421,
-           2.738525906,
-           2.786980407,
-           2.835314426,
-           2.883774703,
-           2.932278029,
-           2.980583302,
-           3.029041663,
-           3.077427956,
-           3.125835776,
-           3.174024665,
-           3.222386607,
-           3.270680518,
-           3.318993049,
-           3.366909602,
-           3.415169846,
-           3.463359331,
-           3.511560911,
-           3.559491511,
-           3.607497521,
-           3.6555534,
-           3.703386077,
-           3.751362232,
-           3.799334706,
-           3.847221045,
-           3.894730652,
-           3.942555764,
-           3.990288016,
-           4.037999302,
-           4.085317416,
-           4.132902873,
-           4.180418799,
-           4.227826872,
-           4.275193589,
-           4.322109283,
-           4.369312881,
-           4.416426926,
-           4.463414523,
-           4.510337068,
-           4.557156275,
-           4.60345594,
-           4.650057829,
-           4.696541189,
-           4.742871089,
-           4.789183441,
-           4.834842353,
-           4.88079909,
-           4.926664066,
-           4.972318813,
-           5.017813464,
-           5.063141359,
-           5.107862017,
-           5.152841702,
-           5.197722258,
-           5.242319488,
-           5.286691844,
-           5.330410361,
-           5.374389764,
-           5.418144877,
-           5.461667597,
-           5.505061914,
-           5.54807827,
-           5.590857897,
-           5.632744935,
-           5.674994308,
-           5.716958608,
-           5.75862801,
-           5.799992412,
-           5.840886728,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.062942212,
-           2.111523614,
-           2.160481352,
-           2.209337663,
-           2.25804831,
-           2.306796805,
-           2.355309215,
-           2.404120695,
-           2.452873319,
-           2.501384676,
-           2.550001151,
-           2.598273165,
-           2.64701887,
-           2.695235629,
-           2.743601341,
-           2.791921725,
-           2.840547263,
-           2.888760328,
-           2.937099926,
-           2.985481844,
-           3.033658845,
-           3.082002994,
-           3.130103516,
-           3.178416247,
-           3.226507468,
-           3.274785349,
-           3.32299771,
-           3.371237548,
-           3.419232426,
-           3.467293954,
-           3.515426056,
-           3.563578912,
-           3.611456842,
-           3.659555174,
-           3.707461539,
-           3.755264256,
-           3.803223552,
-           3.851189363,
-           3.899074011,
-           3.946692976,
-           3.994433219,
-           4.042187949,
-           4.089932816,
-           4.137280086,
-           4.184916996,
-           4.232493607,
-           4.279969382,
-           4.327416056,
-           4.374407256,
-           4.421711286,
-           4.468936397,
-           4.516043642,
-           4.563099491,
-           4.610063556,
-           4.656584024,
-           4.703353068,
-           4.750016142,
-           4.796536485,
-           4.843051928,
-           4.888914082,
-           4.935104119,
-           4.981210601,
-           5.027127375,
-           5.07289902,
-           5.118598223,
-           5.163520589,
-           5.208905074,
-           5.254035098,
-           5.298987035,
-           5.343813042,
-           5.387799859,
-           5.432272783,
-           5.476448497,
-           5.520409593,
-           5.564248539,
-           5.607736654,
-           5.651008483,
-           5.693494986,
-           5.736281108,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.118741671,
-           2.167467171,
-           2.215954137,
-           2.264550953,
-           2.313125716,
-           2.361656426,
-           2.410169829,
-           2.458595355,
-           2.507136153,
-           2.555666882,
-           2.603873637,
-           2.652120354,
-           2.700397212,
-           2.748754998,
-           2.796990618,
-           2.845191882,
-           2.893473689,
-           2.941576335,
-           2.989794926,
-           3.038054319,
-           3.086105161,
-           3.13434039,
-           3.182514019,
-           3.23072855,
-           3.278717173,
-           3.32675667,
-           3.374884388,
-           3.423048662,
-           3.470963977,
-           3.519098996,
-           3.567044232,
-           3.615143586,
-           3.662963455,
-           3.711020736,
-           3.759007771,
-           3.806665843,
-           3.854601507,
-           3.902553541,
-           3.950428727,
-           3.998038636,
-           4.045888166,
-           4.093655382,
-           4.141332316,
-           4.188698241,
-           4.236375974,
-           4.284002033,
-           4.331533535,
-           4.379047727,
-           4.426100978,
-           4.47357245,
-           4.520892477,
-           4.568102356,
-           4.615273852,
-           4.662364357,
-           4.708925955,
-           4.755921655,
-           4.802745366,
-           4.849436156,
-           4.896133296,
-           4.942177171,
-           4.98857821,
-           5.034902468,
-           5.081057415,
-           5.127156912,
-           5.173041689,
-           5.218301294,
-           5.263898618,
-           5.309340231,
-           5.354695991,
-           5.399777345,
-           5.444179388,
-           5.48902044,
-           5.533585785,
-           5.577953608,
-           5.622206512,
-           5.666136954,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.174158011,
-           2.222610971,
-           2.270963547,
-           2.319332625,
-           2.367901379,
-           2.416086215,
-           2.464379148,
-           2.512757487,
-           2.560960135,
-           2.609177606,
-           2.657449332,
-           2.705522159,
-           2.753649546,
-           2.80161447,
-           2.849759666,
-           2.898046299,
-           2.946198765,
-           2.994162768,
-           3.042081426,
-           3.090220641,
-           3.138149605,
-           3.186277742,
-           3.2343454,
-           3.282461062,
-           3.330345971,
-           3.37844716,
-           3.426355408,
-           3.474441904,
-           3.522274186,
-           3.570341548,
-           3.618346168,
-           3.66627455,
-           3.714032051,
-           3.76204409,
-           3.809989006,
-           3.857713158,
-           3.905520539,
-           3.953452836,
-           4.001311973,
-           4.048905623,
-           4.096756054,
-           4.144528606,
-           4.192312274,
-           4.239686339,
-           4.287394217,
-           4.335058388,
-           4.382633505,
-           4.430202557,
-           4.477304059,
-           4.524767534,
-           4.572171278,
-           4.619547326,
-           4.666819925,
-           4.714021625,
-           4.760688129,
-           4.807813435,
-           4.85478037,
-           4.901623298,
-           4.948482988,
-           4.994688702,
-           5.041352327,
-           5.087800685,
-           5.134171568,
-           5.180495045,
-           5.226622605,
-           5.272111956,
-           5.318053907,
-           5.363778823,
-           5.409430901,
-           5.454823727,
-           5.499528757,
-           5.544629857,
-           5.589636379,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.229118694,
-           2.277335167,
-           2.325666769,
-           2.373708276,
-           2.42206123,
-           2.470149618,
-           2.518161652,
-           2.56646961,
-           2.61444905,
-           2.662479611,
-           2.710327303,
-           2.758486712,
-           2.806481023,
-           2.85431082,
-           2.902332663,
-           2.950299495,
-           2.998325296,
-           3.046153151,
-           3.0941149,
-           3.142136198,
-           3.189942878,
-           3.237962599,
-           3.285779914,
-           3.333796119,
-           3.381576836,
-           3.429589303,
-           3.477543548,
-           3.525430725,
-           3.57317743,
-           3.621174871,
-           3.66911135,
-           3.717094056,
-           3.764681203,
-           3.812644722,
-           3.860543685,
-           3.908221588,
-           3.956093416,
-           4.004000227,
-           4.051747881,
-           4.099319101,
-           4.147164184,
-           4.194935213,
-           4.242727391,
-           4.29010256,
-           4.337833588,
-           4.385528449,
-           4.433139177,
-           4.48083038,
-           4.527968978,
-           4.57549384,
-           4.622967593,
-           4.670344338,
-           4.717778595,
-           4.765077642,
-           4.811834162,
-           4.859073889,
-           4.906168093,
-           4.953146347,
-           5.000151324,
-           5.046500464,
-           5.09333141,
-           5.139960516,
-           5.186594735,
-           5.233053137,
-           5.279469056,
-           5.325097781,
-           5.371280849,
-           5.417336666,
-           5.463186743,
-           5.508937041,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.283775321,
-           2.331667639,
-           2.379793781,
-           2.427703062,
-           2.475827912,
-           2.523821502,
-           2.571617782,
-           2.619526433,
-           2.667549755,
-           2.715389662,
-           2.763070408,
-           2.810869993,
-           2.858748184,
-           2.906446428,
-           2.954338142,
-           3.002168738,
-           3.050064116,
-           3.097757617,
-           3.145596349,
-           3.193502589,
-           3.241187841,
-           3.289099853,
-           3.336953287,
-           3.384743461,
-           3.432420136,
-           3.480343795,
-           3.528210193,
-           3.576137207,
-           3.623686884,
-           3.671613101,
-           3.719479746,
-           3.767400961,
-           3.815023999,
-           3.862840189,
-           3.910690167,
-           3.958318149,
-           4.006152056,
-           4.054029939,
-           4.10184024,
-           4.149382635,
-           4.197215794,
-           4.244978029,
-           4.292770983,
-           4.340138449,
-           4.387883743,
-           4.435599826,
-           4.483235997,
-           4.530887402,
-           4.578127984,
-           4.625704068,
-           4.673237081,
-           4.720678564,
-           4.768187108,
-           4.815570905,
-           4.862403821,
-           4.909744272,
-           4.956951125,
-           5.004116937,
-           5.051183827,
-           5.097726663,
-           5.144640534,
-           5.191498704,
-           5.238238217,
-           5.28495036,
-           5.331495306,
-           5.37738012,
-           5.423784791,
-           5.47000541,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.337816823,
-           2.385614723,
-           2.43352418,
-           2.481345855,
-           2.529265812,
-           2.576892076,
-           2.624655109,
-           2.672371198,
-           2.720004865,
-           2.76771051,
-           2.815403526,
-           2.863055566,
-           2.910792229,
-           2.958341026,
-           3.006094961,
-           3.053788515,
-           3.101555796,
-           3.149116659,
-           3.19683335,
-           3.244488763,
-           3.292052812,
-           3.339858606,
-           3.387606944,
-           3.435427983,
-           3.48288482,
-           3.530719971,
-           3.578498323,
-           3.626344961,
-           3.673916617,
-           3.72166915,
-           3.769464997,
-           3.817323619,
-           3.864876255,
-           3.912735368,
-           3.960533242,
-           4.008107395,
-           4.055812874,
-           4.103658456,
-           4.151438532,
-           4.198948647,
-           4.246766481,
-           4.294516048,
-           4.342305692,
-           4.389660525,
-           4.437489449,
-           4.485219663,
-           4.532873592,
-           4.580552758,
-           4.627738687,
-           4.675428866,
-           4.723011489,
-           4.770507392,
-           4.818079548,
-           4.865536683,
-           4.912433589,
-           4.959862337,
-           5.0071685,
-           5.054437464,
-           5.101622192,
-           5.14827274,
-           5.195324129,
-           5.242324192,
-           5.289287084,
-           5.336099514,
-           5.382888662,
-           5.428941416,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.391571694,
-           2.439232856,
-           2.486922752,
-           2.53440369,
-           2.582266888,
-           2.629678859,
-           2.677056117,
-           2.724605074,
-           2.7722512,
-           2.819799315,
-           2.867165885,
-           2.914683194,
-           2.962285344,
-           3.009689196,
-           3.057310313,
-           3.104871675,
-           3.152515238,
-           3.199946153,
-           3.247542843,
-           3.295222221,
-           3.342543413,
-           3.390245564,
-           3.437890766,
-           3.485616594,
-           3.533086573,
-           3.58072676,
-           3.628417494,
-           3.676184155,
-           3.723667488,
-           3.771450046,
-           3.819079687,
-           3.86687522,
-           3.914356089,
-           3.9621611,
-           4.009905805,
-           4.057424651,
-           4.105172898,
-           4.152982315,
-           4.200727702,
-           4.248200323,
-           4.295997485,
-           4.343728431,
-           4.391508421,
-           4.438843313,
-           4.486600157,
-           4.53434037,
-           4.582077443,
-           4.629777255,
-           4.676973353,
-           4.724696676,
-           4.772320307,
-           4.819861411,
-           4.867487568,
-           4.915007777,
-           4.962023483,
-           5.00946322,
-           5.056921913,
-           5.104216177,
-           5.151569662,
-           5.198249622,
-           5.245486837,
-           5.292550567,
-           5.339652205,
-           5.38667987,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.444938034,
-           2.492270483,
-           2.539882205,
-           2.587138451,
-           2.634636581,
-           2.682026784,
-           2.729209731,
-           2.776578461,
-           2.823907952,
-           2.871329355,
-           2.918709371,
-           2.966077677,
-           3.013538795,
-           3.060795991,
-           3.108285539,
-           3.155582779,
-           3.2031043,
-           3.250406079,
-           3.297884291,
-           3.345453551,
-           3.392781343,
-           3.440382075,
-           3.48781192,
-           3.535444111,
-           3.582811974,
-           3.63047336,
-           3.677976953,
-           3.725664625,
-           3.773059921,
-           3.82077129,
-           3.868424543,
-           3.916156301,
-           3.963563714,
-           4.011226708,
-           4.05891709,
-           4.106378911,
-           4.154081824,
-           4.201854265,
-           4.249563767,
-           4.29699717,
-           4.344772025,
-           4.392556362,
-           4.440322578,
-           4.487632557,
-           4.535386607,
-           4.583129634,
-           4.63087153,
-           4.678585802,
-           4.725785006,
-           4.773534292,
-           4.821191349,
-           4.868769496,
-           4.916441036,
-           4.964015177,
-           5.01107167,
-           5.058580157,
-           5.106112959,
-           5.153488695,
-           5.200931973,
-           5.247758508,
-           5.295039176,
-           5.34228006,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.49771385,
-           2.54496563,
-           2.592210796,
-           2.639422512,
-           2.686719004,
-           2.733758452,
-           2.780792393,
-           2.828186268,
-           2.875354452,
-           2.922624064,
-           2.969701961,
-           3.016927747,
-           3.064253552,
-           3.111369272,
-           3.158732895,
-           3.206037606,
-           3.253440765,
-           3.300616979,
-           3.347859406,
-           3.395322661,
-           3.442536317,
-           3.490038734,
-           3.537483506,
-           3.584918122,
-           3.632185082,
-           3.679761746,
-           3.727280616,
-           3.774890534,
-           3.822104214,
-           3.869745482,
-           3.917328362,
-           3.964997496,
-           4.012331915,
-           4.060026179,
-           4.107660519,
-           4.15506293,
-           4.202717974,
-           4.25045058,
-           4.298120806,
-           4.345510906,
-           4.393259316,
-           4.440944239,
-           4.488695403,
-           4.536048629,
-           4.583795808,
-           4.631537169,
-           4.679209906,
-           4.727002159,
-           4.774198331,
-           4.821967274,
-           4.869651146,
-           4.917259193,
-           4.964968455,
-           5.012588448,
-           5.05967675,
-           5.107308438,
-           5.154842095,
-           5.202351086,
-           5.249811288,
-           5.296706878,
-           5.344106365,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.550155077,
-           2.597202455,
-           2.6442459,
-           2.691105012,
-           2.738263483,
-           2.78528156,
-           2.832154537,
-           2.879242473,
-           2.926263746,
-           2.973389623,
-           3.020313936,
-           3.067392329,
-           3.114590924,
-           3.161571712,
-           3.208814345,
-           3.255996346,
-           3.303284296,
-           3.350337154,
-           3.397588995,
-           3.4448369,
-           3.491938173,
-           3.539344614,
-           3.586692645,
-           3.63414446,
-           3.681312597,
-           3.728707431,
-           3.776143053,
-           3.82367738,
-           3.87089891,
-           3.918470884,
-           3.965983605,
-           4.013504403,
-           4.060766006,
-           4.108405793,
-           4.155985327,
-           4.203329138,
-           4.250937235,
-           4.298630827,
-           4.346336746,
-           4.393681559,
-           4.441401614,
-           4.489058879,
-           4.536790557,
-           4.584111093,
-           4.631848112,
-           4.679584134,
-           4.727253122,
-           4.775049123,
-           4.822236993,
-           4.870020128,
-           4.917725107,
-           4.965420885,
-           5.013097092,
-           5.060818647,
-           5.107867947,
-           5.155548894,
-           5.203203118,
-           5.250709122,
-           5.298306003,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.602156442,
-           2.648848487,
-           2.69573859,
-           2.742583562,
-           2.789578116,
-           2.836274457,
-           2.882976059,
-           2.929915914,
-           2.976913641,
-           3.023912824,
-           3.070699303,
-           3.117649742,
-           3.164715451,
-           3.211555152,
-           3.258552141,
-           3.305610179,
-           3.352783644,
-           3.399714402,
-           3.446856363,
-           3.494114792,
-           3.541105366,
-           3.588313145,
-           3.6355656,
-           3.682929703,
-           3.72999979,
-           3.777413402,
-           3.824767283,
-           3.872135306,
-           3.919272282,
-           3.966777558,
-           4.014222549,
-           4.061768722,
-           4.108957001,
-           4.156541918,
-           4.204065788,
-           4.251349484,
-           4.298909044,
-           4.346561747,
-           4.394152003,
-           4.44152506,
-           4.489215559,
-           4.536843568,
-           4.584553897,
-           4.631838768,
-           4.679563079,
-           4.727290842,
-           4.775019349,
-           4.82274856,
-           4.869923648,
-           4.917716317,
-           4.965437517,
-           5.013149764,
-           5.06085295,
-           5.108604929,
-           5.155734938,
-           5.20339608,
-           5.251098137,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.653612314,
-           2.700288234,
-           2.746988692,
-           2.793487045,
-           2.84033125,
-           2.88700403,
-           2.933560554,
-           2.98035908,
-           3.027083769,
-           3.073925455,
-           3.120547058,
-           3.167345211,
-           3.214271266,
-           3.260968064,
-           3.307965553,
-           3.354907489,
-           3.401977898,
-           3.448798965,
-           3.495844343,
-           3.542908898,
-           3.589799233,
-           3.637027449,
-           3.684193255,
-           3.731380397,
-           3.778357687,
-           3.825695245,
-           3.872971058,
-           3.920360602,
-           3.967414066,
-           4.01485376,
-           4.0622317,
-           4.109718138,
-           4.156833985,
-           4.204365278,
-           4.251834409,
-           4.299058353,
-           4.346569826,
-           4.394181915,
-           4.441730959,
-           4.488984186,
-           4.536717089,
-           4.58431493,
-           4.632002723,
-           4.679249664,
-           4.726959416,
-           4.774676696,
-           4.822394033,
-           4.870121323,
-           4.917344136,
-           4.965078166,
-           5.012874408,
-           5.060535478,
-           5.108322033,
-           5.156037589,
-           5.203177883,
-           5.250426097,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.704819772,
-           2.751136804,
-           2.797812982,
-           2.844165329,
-           2.890862649,
-           2.937227191,
-           2.983611865,
-           3.030253849,
-           3.076939104,
-           3.123630293,
-           3.170106443,
-           3.216782062,
-           3.263600201,
-           3.310179311,
-           3.357069777,
-           3.403907612,
-           3.450780982,
-           3.497491235,
-           3.544431584,
-           3.591502432,
-           3.638282973,
-           3.685320721,
-           3.732394499,
-           3.779596454,
-           3.826481846,
-           3.873746381,
-           3.920947719,
-           3.968181942,
-           4.01515589,
-           4.062534279,
-           4.10984903,
-           4.157279563,
-           4.20432613,
-           4.251807472,
-           4.299225328,
-           4.34646786,
-           4.393932262,
-           4.441504594,
-           4.489012963,
-           4.536219026,
-           4.583921323,
-           4.631488724,
-           4.67915343,
-           4.726360865,
-           4.774054846,
-           4.821760059,
-           4.869464088,
-           4.917187136,
-           4.964388453,
-           5.012126765,
-           5.059929556,
-           5.107600526,
-           5.155402584,
-           5.203202483,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.755466625,
-           2.801772903,
-           2.848141699,
-           2.894307995,
-           2.940841777,
-           2.987146299,
-           3.033346313,
-           3.079859803,
-           3.126328643,
-           3.17294204,
-           3.21934454,
-           3.265922605,
-           3.312622725,
-           3.359064485,
-           3.405832328,
-           3.452536286,
-           3.4992818,
-           3.545862812,
-           3.592695816,
-           3.639674303,
-           3.686353972,
-           3.733408587,
-           3.780397534,
-           3.827427678,
-           3.874219981,
-           3.92140922,
-           3.968533794,
-           4.015788385,
-           4.062681833,
-           4.109999545,
-           4.157252184,
-           4.204628007,
-           4.251605732,
-           4.299037685,
-           4.346404394,
-           4.393514155,
-           4.441008281,
-           4.488542228,
-           4.536011017,
-           4.583170351,
-           4.630842421,
-           4.678379704,
-           4.726021361,
-           4.77318837,
-           4.820865965,
-           4.868622757,
-           4.916247384,
-           4.963964463,
-           5.011141715,
-           5.058943546,
-           5.106688283,
-           5.154425675,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.805896805,
-           2.851857709,
-           2.898166937,
-           2.944118921,
-           2.990537274,
-           3.036655841,
-           3.082798361,
-           3.129200203,
-           3.175487276,
-           3.221902795,
-           3.268182437,
-           3.314543797,
-           3.361138256,
-           3.407449409,
-           3.454104874,
-           3.500720764,
-           3.547447618,
-           3.593930878,
-           3.640685187,
-           3.687574346,
-           3.734131557,
-           3.781056879,
-           3.827976236,
-           3.875055656,
-           3.921739015,
-           3.968813233,
-           4.0158899,
-           4.063092946,
-           4.109914007,
-           4.157175333,
-           4.204368235,
-           4.251691445,
-           4.298602006,
-           4.345986929,
-           4.393304772,
-           4.440358887,
-           4.487808964,
-           4.535306328,
-           4.582737073,
-           4.629850563,
-           4.677493362,
-           4.72500143,
-           4.772620651,
-           4.81974694,
-           4.867408101,
-           4.91514971,
-           4.962760469,
-           5.010531849,
-           5.057621704,
-           5.105421388,
-           5.15329622,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.855858673,
-           2.90161954,
-           2.947750382,
-           2.993673342,
-           3.039971067,
-           3.08583882,
-           3.131810773,
-           3.178091553,
-           3.224034942,
-           3.268840922,
-           3.315078671,
-           3.36134583,
-           3.407757073,
-           3.453909013,
-           3.500352801,
-           3.546722927,
-           3.593466806,
-           3.634661656,
-           3.680270921,
-           3.735150136,
-           3.781602513,
-           3.828468311,
-           3.875337477,
-           3.922263665,
-           3.968899184,
-           4.015961711,
-           4.062950695,
-           4.110055189,
-           4.156829726,
-           4.204053363,
-           4.251198495,
-           4.298476395,
-           4.34532368,
-           4.392664609,
-           4.43993602,
-           4.486936332,
-           4.534344341,
-           4.581807392,
-           4.629202174,
-           4.676339837,
-           4.723886176,
-           4.771366375,
-           4.819029409,
-           4.866050026,
-           4.913759188,
-           4.961421704,
-           5.009080709,
-           5.056780021,
-           5.103906053,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.905457505,
-           2.951176139,
-           2.997059818,
-           3.042781887,
-           3.088918398,
-           3.132716307,
-           3.178494006,
-           3.224924539,
-           3.270993691,
-           3.317204929,
-           3.363110243,
-           3.411013887,
-           3.45740937,
-           3.503551228,
-           3.550012601,
-           3.596389235,
-           3.642929205,
-           3.689164366,
-           3.735699224,
-           3.782419647,
-           3.828814937,
-           3.8756509,
-           3.922414887,
-           3.969247155,
-           4.015787256,
-           4.062775667,
-           4.109686852,
-           4.156832967,
-           4.203500102,
-           4.250659429,
-           4.29775066,
-           4.344986384,
-           4.391775519,
-           4.439077796,
-           4.486306874,
-           4.533328742,
-           4.580623787,
-           4.628054414,
-           4.675415125,
-           4.722508395,
-           4.770030498,
-           4.817551345,
-           4.865126983,
-           4.912109626,
-           4.959802154,
-           5.007452023,
-           5.055095531,
-           5.102954389,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {2.954694932,
-           3.000212997,
-           3.043748571,
-           3.089560172,
-           3.135574256,
-           3.181532013,
-           3.227223712,
-           3.274892522,
-           3.320828284,
-           3.366953793,
-           3.412755368,
-           3.458745826,
-           3.503432495,
-           3.549446132,
-           3.59596118,
-           3.642314895,
-           3.688762639,
-           3.739571286,
-           3.783944421,
-           3.830811335,
-           3.872010024,
-           3.9212864,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           4.107811396,
-           4.157387685,
-           4.203232288,
-           4.249905101,
-           4.296953859,
-           4.344067559,
-           4.391250154,
-           4.437972906,
-           4.485234512,
-           4.532423347,
-           4.579395827,
-           4.626656007,
-           4.674057508,
-           4.721454617,
-           4.768436402,
-           4.8160033,
-           4.863431762,
-           4.910990164,
-           4.957999295,
-           5.005612276,
-           5.053307164,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {3.001334686,
-           3.046949887,
-           3.092601974,
-           3.138029105,
-           3.185939514,
-           3.231394489,
-           3.276934122,
-           3.321653665,
-           3.367107431,
-           3.413164793,
-           3.458973869,
-           3.505477321,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           3.875177474,
-           3.920646059,
-           3.965773447,
-           4.016331922,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           4.343104884,
-           4.3900944,
-           4.437224325,
-           4.483918471,
-           4.531149175,
-           4.578369753,
-           4.625217452,
-           4.672513663,
-           4.719885989,
-           4.767186049,
-           4.814199998,
-           4.861679834,
-           4.909087901,
-           4.95669469,
-           5.003601935,
-           5.051152425,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {3.050172073,
-           3.095417554,
-           3.1429151,
-           3.188185176,
-           3.232292781,
-           3.277853727,
-           3.323335901,
-           3.369305931,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           3.874852398,
-           3.92264535,
-           3.969271641,
-           4.016000319,
-           4.062601736,
-           4.110171379,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           4.435058855,
-           4.483029143,
-           4.529642333,
-           4.576849062,
-           4.623999498,
-           4.670813493,
-           4.718072316,
-           4.765463221,
-           4.812758712,
-           4.859697676,
-           4.907167612,
-           4.954596499,
-           5.002159716,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {3.100434016,
-           3.145404082,
-           3.189296595,
-           3.234537926,
-           3.280407734,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           3.598533235,
-           3.647199048,
-           3.691877656,
-           3.73799591,
-           3.784029572,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           4.247558403,
-           4.294202066,
-           4.341138951,
-           4.387601992,
-           4.434519566,
-           std::optional<double>(),
-           4.528601417,
-           4.575248497,
-           4.622359248,
-           4.66944221,
-           4.716254747,
-           4.763470558,
-           4.81081107,
-           4.858043381,
-           4.905004546,
-           4.95248354,
-           4.999875525,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {3.146852151,
-           3.191914632,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           3.463522671,
-           3.510135602,
-           3.55585346,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           4.573846147,
-           4.620385068,
-           4.667595334,
-           4.714700845,
-           4.763363206,
-           4.811338829,
-           4.854229778,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()},
-          {std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           3.374988898,
-           3.420968337,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           4.85418976,
-           std::optional<double>(),
-           std::optional<double>(),
-           4.995608446,
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>(),
-           std::optional<double>()}};
+                std::vector<Table::point> result;
+                result.reserve(m_Load.size() + 1u);
+                // Provided tables do not include zero points and they are used for deflection
+                // calculations.
+                result.emplace_back(0.0, 0.0);
+                for(size_t i = 0u; i < m_Load.size(); ++i)
+                {
+                    const auto y1{m_Table.logValues[i * x.size() + lowIndex]};
+                    const auto y2{m_Table.logValues[i * x.size() + highIndex]};
+                    if(std::isnan(y1) || std::isnan(y2))
+                    {
+                        result.emplace_back(m_Load[i], std::optional<double>());
+                        continue;
+                    }
+                    const auto value{x1 != x2 ? y1 + (y2 - y1) / (x2 - x1) * (aspectRatio - x1)
+                                              : y1};
+                    result.emplace_back(m_Load[i], std::exp(value));
+                }
 
-        Table::Table2D table{x, y, values};
+                return result;
+            }
 
-        return table;
+        private:
+            LogTable m_Table;
+            std::vector<double> m_Load;
+        };
+
+        const CurveInterpolator & wnInterpolator()
+        {
+            static const CurveInterpolator interpolator{WNTable};
+            return interpolator;
+        }
+
+        const CurveInterpolator & vnInterpolator()
+        {
+            static const CurveInterpolator interpolator{VNTable};
+            return interpolator;
+        }
+    }   // namespace
+
+    Table::Table2D<std::optional<double>> getWNData()
+    {
+        return table2D(WNTable);
+    }
+
+    Table::Table2D<std::optional<double>> getVNData()
+    {
+        return table2D(VNTable);
+    }
+
+    std::vector<Table::point> getWNCurve(const double aspectRatio)
+    {
+        return wnInterpolator().curve(aspectRatio);
+    }
+
+    std::vector<Table::point> getVNCurve(const double aspectRatio)
+    {
+        return vnInterpolator().curve(aspectRatio);
     }
 }   // namespace DeflectionData
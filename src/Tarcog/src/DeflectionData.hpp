@@ -1,6 +1,7 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 
 #include <WCECommon.hpp>
 
@@ -13,4 +14,12 @@ namespace DeflectionData
     //! Hard coded data used in the deflection calculations. This table is only valid for the
     //! Poisson's ratio equal 0.22.
     Table::Table2D<std::optional<double>> getVNData();
+
+    //! Load and deflection curve from getWNData interpolated to the given aspect ratio and taken
+    //! out of the log space. The curve starts at the origin.
+    std::vector<Table::point> getWNCurve(double aspectRatio);
+
+    //! Load and deflection curve from getVNData interpolated to the given aspect ratio and taken
+    //! out of the log space. The curve starts at the origin.
+    std::vector<Table::point> getVNCurve(double aspectRatio);
 }   // namespace DeflectionData
@@ -39,41 +39,9 @@ namespace Deflection
         m_PsLoaded(getPsLoaded(m_Layer, m_Theta)),
         m_Pcs(calcPcs(m_ShortDimension, m_Layer)),
         m_Vcs(calcVcs(m_ShortDimension, m_Layer)),
-        m_PnVns(Table::columnInterpolation(DeflectionData::getVNData(),
-                                           m_LongDimension / m_ShortDimension)),
-        m_PnWns(Table::columnInterpolation(DeflectionData::getWNData(),
-                                           m_LongDimension / m_ShortDimension))
-    {
-        for(auto & val : m_PnVns)
-        {
-            if(val.x.has_value())
-            {
-                val.x = std::exp(val.x.value());
-            }
-
-            if(val.y.has_value())
-            {
-                val.y = std::exp(val.y.value());
-            }
-        }
-        // Provided tables do not include zero points and they are used for deflection calculations.
-        m_PnVns.insert(m_PnVns.begin(), {0, 0});
-
-        for(auto & val : m_PnWns)
-        {
-            if(val.x.has_value())
-            {
-                val.x = std::exp(val.x.value());
-            }
-
-            if(val.y.has_value())
-            {
-                val.y = std::exp(val.y.value());
-            }
-        }
-        // Provided tables do not include zero points and they are used for deflection calculations.
-        m_PnWns.insert(m_PnWns.begin(), {0, 0});
-    }
+        m_PnVns(DeflectionData::getVNCurve(m_LongDimension / m_ShortDimension)),
+        m_PnWns(DeflectionData::getWNCurve(m_LongDimension / m_ShortDimension))
+    {}
 
     [[maybe_unused]] void DeflectionE1300::setExteriorPressure(const double pressure)
     {
@@ -182,6 +150,11 @@ namespace Deflection
         return m_DeflectionResults;
     }
 
+    size_t DeflectionE1300::numberOfEvaluations() const
+    {
+        return m_NumberOfEvaluations;
+    }
+
     double DeflectionE1300::DP1pGuess(double Pdiff, const std::vector<LayerData> & layer)
     {
         double result{0.01};
@@ -199,6 +172,7 @@ namespace Deflection
 
     DeflectionResults DeflectionE1300::nIGU_Li(size_t index, double PasiLoaded, double dpCoeff)
     {
+        ++m_NumberOfEvaluations;
         std::vector<double> DPs;
 
         auto j{index + 1u};
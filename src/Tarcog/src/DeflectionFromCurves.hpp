@@ -81,6 +81,9 @@ namespace Deflection
 
         DeflectionResults results();
 
+        //! Number of pane load evaluations made by all calculations so far.
+        [[nodiscard]] size_t numberOfEvaluations() const;
+
     private:
         static std::vector<double> getPsWeight(const std::vector<LayerData> & layer, double theta);
         [[nodiscard]] std::vector<double> getPsLoaded(const std::vector<LayerData> & layer,
@@ -115,6 +118,7 @@ namespace Deflection
 
         bool m_ResultsCalculated{false};
         DeflectionResults m_DeflectionResults;
+        size_t m_NumberOfEvaluations{0u};
 
         DeflectionResults calculateResults();
     };
@@ -79,6 +79,26 @@ namespace Tarcog::ISO15099
         //
     }
 
+    void CEnvironment::appendToHash(FenestrationCommon::StableHash & hash) const
+    {
+        const auto & airflow{gasSpecification.airflowProperties};
+        hash.add(gasSpecification.pressure).add(airflow.airSpeed);
+        hash.add(airflow.airVerticalDirection).add(airflow.airHorizontalDirection);
+        hash.add(airflow.isVentilationForced);
+        hash.add(m_DirectSolarRadiation).add(m_Emissivity);
+        hash.add(m_HCoefficientModel).add(m_HInput);
+        hash.add(m_IRCalculatedOutside);
+        if(m_IRCalculatedOutside)
+        {
+            hash.add(getIRFromEnvironment());
+        }
+    }
+
+    void hashAppend(FenestrationCommon::StableHash & hash, const CEnvironment & environment)
+    {
+        environment.appendToHash(hash);
+    }
+
     void CEnvironment::calculateRadiationFlow()
     {
         // In case of environments, there is no need to calculate radiation
@@ -39,6 +39,10 @@ namespace Tarcog::ISO15099
 
         [[nodiscard]] double getPressure() const;
 
+        //! Adds boundary conditions to the cache key. Overrides add the conditions specific to
+        //! the side of the environment and have to call the base.
+        virtual void appendToHash(FenestrationCommon::StableHash & hash) const;
+
     protected:
         void calculateRadiationFlow() override;
         void calculateConvectionOrConductionFlow() override;
@@ -61,4 +65,6 @@ namespace Tarcog::ISO15099
         GasSpecification gasSpecification;
     };
 
+    void hashAppend(FenestrationCommon::StableHash & hash, const CEnvironment & environment);
+
 }   // namespace Tarcog::ISO15099
@@ -1,4 +1,5 @@
 #include "GasSpecification.hpp"
+#include "SolverTelemetry.hpp"
 
 namespace Tarcog::ISO15099
 {
@@ -6,4 +7,10 @@ namespace Tarcog::ISO15099
     {
         gas.setTemperatureAndPressure(temperature, pressure);
     }
+
+    Gases::GasProperties GasSpecification::properties(const double alpha1, const double alpha2)
+    {
+        ScopedSolverTimer timer(&SolverPhaseTimes::gasProperties);
+        return gas.getGasProperties(alpha1, alpha2);
+    }
 }   // namespace Tarcog::ISO15099
@@ -12,6 +12,12 @@ namespace Tarcog::ISO15099
 
         void setTemperature(double temperature);
 
+        //! Gas properties at the current temperature and pressure. Time spent here is recorded
+        //! by the solver telemetry.
+        [[nodiscard]] Gases::GasProperties
+          properties(double alpha1 = Gases::DefaultSurfaceAccommodation,
+                     double alpha2 = Gases::DefaultSurfaceAccommodation);
+
         double pressure{Gases::DefaultPressure};
         AirflowProperties airflowProperties{};
 
@@ -17,7 +17,7 @@ namespace Tarcog::ISO15099
 
     std::vector<double> CHeatFlowBalance::calcBalanceMatrix()
     {
-        auto aSolidLayers = m_IGU.getSolidLayers();
+        const auto & aSolidLayers = m_IGU.getSolidLayers();
         m_MatrixA.setZeros();
         std::fill(m_VectorB.begin(), m_VectorB.end(), 0);
         for(size_t i = 0; i < aSolidLayers.size(); ++i)
@@ -40,6 +40,11 @@ namespace Tarcog::ISO15099
         m_Tilt = t_IGU.m_Tilt;
 
         m_Layers.clear();
+        m_SolidLayers.clear();
+        m_GapLayers.clear();
+        m_Layers.reserve(t_IGU.m_Layers.size());
+        m_SolidLayers.reserve(t_IGU.m_SolidLayers.size());
+        m_GapLayers.reserve(t_IGU.m_GapLayers.size());
         for(auto & layer : t_IGU.m_Layers)
         {
             const auto aLayer{layer->clone()};
@@ -53,7 +58,7 @@ namespace Tarcog::ISO15099
 
     CIGU::~CIGU()
     {
-        auto layers = getSolidLayers();
+        const auto & layers = getSolidLayers();
         for(std::shared_ptr<CBaseLayer> layer : layers)
         {
             layer->tearDownConnections();
@@ -69,6 +74,7 @@ namespace Tarcog::ISO15099
             if(!t_Layer->isGapLayer())
             {
                 m_Layers.push_back(t_Layer);
+                storeByType(t_Layer);
             }
             else
             {
@@ -81,6 +87,7 @@ namespace Tarcog::ISO15099
             if(t_Layer->isGapLayer() != lastLayer->isGapLayer())
             {
                 m_Layers.push_back(t_Layer);
+                storeByType(t_Layer);
                 lastLayer->connectToBackSide(t_Layer);
             }
             else
@@ -98,6 +105,18 @@ namespace Tarcog::ISO15099
         t_Layer->setHeight(m_Height);
     }
 
+    void CIGU::storeByType(const std::shared_ptr<CBaseLayer> & t_Layer)
+    {
+        if(t_Layer->isGapLayer())
+        {
+            m_GapLayers.push_back(std::static_pointer_cast<CIGUGapLayer>(t_Layer));
+        }
+        else
+        {
+            m_SolidLayers.push_back(std::static_pointer_cast<CIGUSolidLayer>(t_Layer));
+        }
+    }
+
     void CIGU::addLayers(const std::initializer_list<std::shared_ptr<CBaseLayer>> & layers)
     {
         for(const auto & layer : layers)
@@ -150,7 +169,7 @@ namespace Tarcog::ISO15099
 
     void CIGU::setSolarRadiation(double const t_SolarRadiation) const
     {
-        auto layers = getSolidLayers();
+        const auto & layers = getSolidLayers();
         for(auto & layer : layers)
         {
             layer->setSolarRadiation(t_SolarRadiation);
@@ -176,7 +195,7 @@ namespace Tarcog::ISO15099
     {
         std::vector<double> aState;
 
-        auto layers = getSolidLayers();
+        const auto & layers = getSolidLayers();
         for(auto & layer : layers)
         {
             // State must be filled in this exact order.
@@ -192,7 +211,7 @@ namespace Tarcog::ISO15099
     void CIGU::setState(const std::vector<double> & t_State) const
     {
         size_t i = 0;
-        auto layers = getSolidLayers();
+        const auto & layers = getSolidLayers();
         for(const auto & aLayer : layers)
         {
             const auto Tf = t_State[4 * i];
@@ -208,7 +227,7 @@ namespace Tarcog::ISO15099
     {
         std::vector<double> aTemperatures;
 
-        auto layers = getSolidLayers();
+        const auto & layers = getSolidLayers();
         for(auto & layer : layers)
         {
             for(auto aSide : FenestrationCommon::allSides())
@@ -224,7 +243,7 @@ namespace Tarcog::ISO15099
     {
         std::vector<double> aRadiosities;
 
-        auto layers = getSolidLayers();
+        const auto & layers = getSolidLayers();
         for(auto & layer : layers)
         {
             for(auto aSide : FenestrationCommon::allSides())
@@ -240,7 +259,7 @@ namespace Tarcog::ISO15099
     {
         std::vector<double> aMaxDeflections;
 
-        auto layers = getSolidLayers();
+        const auto & layers = getSolidLayers();
         for(auto & layer : layers)
         {
             aMaxDeflections.push_back(layer->getMaxDeflection());
@@ -253,7 +272,7 @@ namespace Tarcog::ISO15099
     {
         std::vector<double> aMeanDeflections;
 
-        auto layers = getSolidLayers();
+        const auto & layers = getSolidLayers();
         for(auto & layer : layers)
         {
             aMeanDeflections.push_back(layer->getMeanDeflection());
@@ -265,7 +284,7 @@ namespace Tarcog::ISO15099
     std::vector<double> CIGU::getMaxGapWidth() const
     {
         std::vector<double> aMaxWidths;
-        auto gaps = getGapLayers();
+        const auto & gaps = getGapLayers();
         for(auto const & layer : gaps)
         {
             aMaxWidths.push_back(layer->getMaxDeflection());
@@ -278,7 +297,7 @@ namespace Tarcog::ISO15099
     {
         std::vector<double> aMeanWidths;
 
-        auto gaps = getGapLayers();
+        const auto & gaps = getGapLayers();
         for(auto const & layer : gaps)
         {
             aMeanWidths.push_back(layer->getMeanDeflection());
@@ -291,7 +310,7 @@ namespace Tarcog::ISO15099
     {
         std::vector<double> aPressures;
 
-        auto gaps = getGapLayers();
+        const auto & gaps = getGapLayers();
         for(auto const & layer : gaps)
         {
             aPressures.push_back(layer->getPressure());
@@ -379,7 +398,7 @@ namespace Tarcog::ISO15099
         else
         {
             size_t Index = 0;
-            auto layers = getSolidLayers();
+            const auto & layers = getSolidLayers();
             for(auto & aLayer : layers)
             {
                 for(auto aSide : FenestrationCommon::allSides())
@@ -400,14 +419,14 @@ namespace Tarcog::ISO15099
         // Since user might have called IGU previously with different deflection properties
         resetSurfaceDeflections();
         std::vector<Deflection::LayerData> layerData;
-        auto layers = getSolidLayers();
+        const auto & layers = getSolidLayers();
         for(auto & layer : layers)
         {
             layerData.emplace_back(layer->getThickness(), layer->density(), layer->youngsModulus());
         }
 
         std::vector<Deflection::GapData> gapData;
-        auto gaps = getGapLayers();
+        const auto & gaps = getGapLayers();
         for(auto const & gap : gaps)
         {
             gap->setManufacturingConditions(t_Tini, t_Pini);
@@ -445,7 +464,7 @@ namespace Tarcog::ISO15099
 
         for(auto idx = 0u; idx < getNumOfLayers(); ++idx)
         {
-            auto aLayer = getSolidLayers()[idx];
+            const auto & aLayer = getSolidLayers()[idx];
             if(!aLayer->hasMeasuredDeflection())
             {
                 const auto LDefNMean = deflectionRatio * LDefMax[idx];
@@ -459,7 +478,7 @@ namespace Tarcog::ISO15099
     {
         if(m_DeflectionFromE1300Curves.has_value())
         {
-            const auto gapLayers{getGapLayers()};
+            const auto & gapLayers{getGapLayers()};
             std::vector<double> gapTemperatures(gapLayers.size());
             for(size_t i = 0u; i < gapTemperatures.size(); ++i)
             {
@@ -473,7 +492,7 @@ namespace Tarcog::ISO15099
             // actually doing this.
             const auto deflectionRatio = Ldmean() / Ldmax();
 
-            auto solidLayers{getSolidLayers()};
+            const auto & solidLayers{getSolidLayers()};
 
             assert(deflectionResults.deflection.size() == solidLayers.size());
 
@@ -542,30 +561,14 @@ namespace Tarcog::ISO15099
         return coeff * totalSum;
     }
 
-    std::vector<std::shared_ptr<CIGUSolidLayer>> CIGU::getSolidLayers() const
+    const std::vector<std::shared_ptr<CIGUSolidLayer>> & CIGU::getSolidLayers() const
     {
-        std::vector<std::shared_ptr<CIGUSolidLayer>> aVect;
-        for(auto const & aLayer : m_Layers)
-        {
-            if(!aLayer->isGapLayer())
-            {
-                aVect.push_back(std::static_pointer_cast<CIGUSolidLayer>(aLayer));
-            }
-        }
-        return aVect;
+        return m_SolidLayers;
     }
 
-    std::vector<std::shared_ptr<CIGUGapLayer>> CIGU::getGapLayers() const
+    const std::vector<std::shared_ptr<CIGUGapLayer>> & CIGU::getGapLayers() const
     {
-        std::vector<std::shared_ptr<CIGUGapLayer>> aVect;
-        for(auto const & aLayer : m_Layers)
-        {
-            if(aLayer->isGapLayer())
-            {
-                aVect.push_back(std::static_pointer_cast<CIGUGapLayer>(aLayer));
-            }
-        }
-        return aVect;
+        return m_GapLayers;
     }
 
     std::vector<std::shared_ptr<CBaseLayer>> CIGU::getLayers() const
@@ -575,7 +578,7 @@ namespace Tarcog::ISO15099
 
     void CIGU::setAbsorptances(const std::vector<double> & absorptances, double solarRadiation)
     {
-        auto solidLayers = getSolidLayers();
+        const auto & solidLayers = getSolidLayers();
         if(solidLayers.size() != absorptances.size())
         {
             throw std::runtime_error(
@@ -608,10 +611,28 @@ namespace Tarcog::ISO15099
             layer->precalculateState();
         }
     }
+
+    size_t CIGU::getAirflowIterations() const
+    {
+        size_t result{0u};
+        for(const auto & gap : m_GapLayers)
+        {
+            result += gap->airflowIterations();
+        }
+        return result;
+    }
+
+    size_t CIGU::getDeflectionEvaluations() const
+    {
+        return m_DeflectionFromE1300Curves.has_value()
+                 ? m_DeflectionFromE1300Curves->numberOfEvaluations()
+                 : 0u;
+    }
+
     void CIGU::setSolidLayerConductivities(
       const std::vector<double> & t_SolidLayerThermalConductivities)
     {
-        auto solidLayer = getSolidLayers();
+        const auto & solidLayer = getSolidLayers();
 
         if(t_SolidLayerThermalConductivities.size() != getSolidLayers().size())
         {
@@ -628,7 +649,7 @@ namespace Tarcog::ISO15099
     void CIGU::setSolidLayerConductivity(size_t t_LayerIndex,
                                          double t_SolidLayerThermalConductivity)
     {
-        auto solidLayer = getSolidLayers();
+        const auto & solidLayer = getSolidLayers();
 
         if(t_LayerIndex >= getSolidLayers().size())
         {
@@ -643,7 +664,7 @@ namespace Tarcog::ISO15099
       CIGU::calculateDeflectionNumerator(const std::vector<double> & t_MeasuredDeflections) const
     {
         auto numerator = 0.0;
-        const auto solidLayers = getSolidLayers();
+        const auto & solidLayers = getSolidLayers();
         for(size_t idx = 0; idx < t_MeasuredDeflections.size(); ++idx)
         {
             auto SumL = 0.0;
@@ -696,4 +717,39 @@ namespace Tarcog::ISO15099
         }
     }
 
+    void hashAppend(FenestrationCommon::StableHash & hash, const CIGU & igu)
+    {
+        hash.add(igu.m_Width).add(igu.m_Height).add(igu.m_Tilt);
+        hash.add(igu.m_Layers.size());
+        for(const auto & layer : igu.m_Layers)
+        {
+            hash.add(layer->isGapLayer()).add(layer->isShadeLayer()).add(layer->isVentilated());
+            hash.add(layer->getThickness());
+            if(layer->isGapLayer())
+            {
+                const auto gap{std::static_pointer_cast<CIGUGapLayer>(layer)};
+                const auto gas{gap->getGasSpecification()};
+                const auto & airflow{gas.airflowProperties};
+                hash.add(gas.pressure).add(airflow.airSpeed);
+                hash.add(airflow.airVerticalDirection).add(airflow.airHorizontalDirection);
+                hash.add(airflow.isVentilationForced);
+                hashAppend(hash, gas.gas);
+            }
+            else
+            {
+                const auto solid{std::static_pointer_cast<CIGUSolidLayer>(layer)};
+                hash.add(solid->getConductance()).add(solid->getSolarAbsorptance());
+                hash.add(solid->youngsModulus()).add(solid->density());
+                hash.add(solid->hasMeasuredDeflection());
+                for(const auto side : FenestrationCommon::allSides())
+                {
+                    const auto surface{solid->getSurface(side)};
+                    hash.add(surface->getEmissivity()).add(surface->getTransmittance());
+                }
+            }
+        }
+        hash.add(igu.m_DeflectionFromE1300Curves.has_value());
+        hash.add(igu.m_DeflectionAppliedLoad);
+    }
+
 }   // namespace Tarcog::ISO15099
@@ -5,6 +5,10 @@
 
 #include "DeflectionFromCurves.hpp"
 
+namespace FenestrationCommon
+{
+    class StableHash;
+}
 
 namespace Tarcog::ISO15099
 {
@@ -18,7 +22,11 @@ namespace Tarcog::ISO15099
     {
     public:
         CIGU(double t_Width = 1, double t_Height = 1, double t_Tilt = 90);
+
+        friend void hashAppend(FenestrationCommon::StableHash & hash, const CIGU & igu);
         CIGU(CIGU const & t_IGU);
+        //! Takes over the layers without cloning them.
+        CIGU(CIGU && t_IGU) = default;
         CIGU & operator=(CIGU const & t_IGU);
         ~CIGU();
 
@@ -27,8 +35,10 @@ namespace Tarcog::ISO15099
 
         void setAbsorptances(const std::vector<double> & absorptances, double solarRadiation);
 
-        [[nodiscard]] std::vector<std::shared_ptr<CIGUSolidLayer>> getSolidLayers() const;
-        [[nodiscard]] std::vector<std::shared_ptr<CIGUGapLayer>> getGapLayers() const;
+        //! Solid layers in their order in the IGU, from outdoor to indoor.
+        [[nodiscard]] const std::vector<std::shared_ptr<CIGUSolidLayer>> & getSolidLayers() const;
+        //! Gap layers in their order in the IGU, from outdoor to indoor.
+        [[nodiscard]] const std::vector<std::shared_ptr<CIGUGapLayer>> & getGapLayers() const;
         [[nodiscard]] std::vector<std::shared_ptr<CBaseLayer>> getLayers() const;
 
         void setTilt(double t_Tilt);
@@ -83,11 +93,19 @@ namespace Tarcog::ISO15099
 
         void precalculateLayerStates();
 
+        //! Airflow iteration steps made by all gaps so far.
+        [[nodiscard]] size_t getAirflowIterations() const;
+        //! Pane load evaluations made by the deflection model so far. Zero without the model.
+        [[nodiscard]] size_t getDeflectionEvaluations() const;
+
         void setSolidLayerConductivities(
           const std::vector<double> & t_SolidLayerThermalConductivities);
         void setSolidLayerConductivity(size_t t_LayerIndex, double t_SolidLayerThermalConductivity);
 
     private:
+        // Adds layer to the solid or gap array
+        void storeByType(const std::shared_ptr<CBaseLayer> & t_Layer);
+
         // Check if layer needs to be decorated with another object
         void checkForLayerUpgrades(const std::shared_ptr<CBaseLayer> & t_Layer);
 
@@ -99,6 +117,11 @@ namespace Tarcog::ISO15099
 
         std::vector<std::shared_ptr<CBaseLayer>> m_Layers;
 
+        //! The same layers split by type and indexed by position, so the solver can walk them
+        //! on every iteration without casting or allocating.
+        std::vector<std::shared_ptr<CIGUSolidLayer>> m_SolidLayers;
+        std::vector<std::shared_ptr<CIGUGapLayer>> m_GapLayers;
+
         double m_Width;    // meters
         double m_Height;   // meters
         double m_Tilt;     // degrees
@@ -120,4 +143,9 @@ namespace Tarcog::ISO15099
         std::vector<double> m_DeflectionAppliedLoad;
     };
 
+    //! Adds dimensions and the thermal description of every layer to the cache key. Gaps add
+    //! their gas, pressure and airflow settings. Deflection adds only whether it is enabled and
+    //! the applied load, so keys of deflected IGUs must include the deflection inputs as well.
+    void hashAppend(FenestrationCommon::StableHash & hash, const CIGU & igu);
+
 }   // namespace Tarcog::ISO15099
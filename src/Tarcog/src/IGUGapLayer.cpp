@@ -190,7 +190,7 @@ namespace Tarcog::ISO15099
         if(!FenestrationCommon::isVacuum(gasSpecification.pressure))
         {
             using ConstantsData::GRAVITYCONSTANT;
-            const auto aProperties = gasSpecification.gas.getGasProperties();
+            const auto aProperties = gasSpecification.properties();
             const auto deltaTemp =
               std::abs(surfaceTemperature(Side::Back) - surfaceTemperature(Side::Front));
 
@@ -273,8 +273,8 @@ namespace Tarcog::ISO15099
 
     double CIGUGapLayer::calculateConvectiveConductiveCoefficient()
     {
-        auto gasProperties = gasSpecification.gas.getGasProperties(m_AccommodationCoefficient1,
-                                                                   m_AccommodationCoefficient2);
+        auto gasProperties =
+          gasSpecification.properties(m_AccommodationCoefficient1, m_AccommodationCoefficient2);
         if(!FenestrationCommon::isVacuum(gasSpecification.pressure))
         {
             CNusseltNumber nusseltNumber{};
@@ -424,18 +424,18 @@ namespace Tarcog::ISO15099
 
     double CIGUGapLayer::bernoullyPressureTerm()
     {
-        return 0.5 * gasSpecification.gas.getGasProperties().m_Density;
+        return 0.5 * gasSpecification.properties().m_Density;
     }
 
     double CIGUGapLayer::hagenPressureTerm()
     {
-        return 12 * gasSpecification.gas.getGasProperties().m_Viscosity * m_Height
+        return 12 * gasSpecification.properties().m_Viscosity * m_Height
                / pow(getThickness(), 2);
     }
 
     double CIGUGapLayer::pressureLossTerm()
     {
-        return 0.5 * gasSpecification.gas.getGasProperties().m_Density * (m_Zin + m_Zout);
+        return 0.5 * gasSpecification.properties().m_Density * (m_Zin + m_Zout);
     }
 
     double CIGUGapLayer::betaCoeff()
@@ -464,7 +464,7 @@ namespace Tarcog::ISO15099
     {
         if(!FenestrationCommon::isEqual(m_ConductiveConvectiveCoeff, 0.0))
         {
-            const auto aProperties = gasSpecification.gas.getGasProperties();
+            const auto aProperties = gasSpecification.properties();
             return aProperties.m_Density * aProperties.m_SpecificHeat * getThickness()
                    * gasSpecification.airflowProperties.airSpeed
                    / (4 * m_ConductiveConvectiveCoeff);
@@ -483,7 +483,7 @@ namespace Tarcog::ISO15099
 
     double CIGUGapLayer::ventilatedHeatGain()
     {
-        const auto aProperties = gasSpecification.gas.getGasProperties();
+        const auto aProperties = gasSpecification.properties();
         return aProperties.m_Density * aProperties.m_SpecificHeat
                * gasSpecification.airflowProperties.airSpeed * getThickness()
                * (m_VentState.inletTemperature - m_VentState.outletTemperature) / m_Height;
@@ -605,6 +605,7 @@ namespace Tarcog::ISO15099
         double lastDelta = std::numeric_limits<double>::max();
 
         auto step = [&](Helper::RelaxationState & stateRef) -> std::pair<double, bool> {
+            ++m_AirflowIterations;
             const double TgapOutOld = performIterationStep(stateRef.relaxationParameter, TgapOut);
 
             double delta = std::abs(TgapOut - TgapOutOld);
@@ -647,6 +648,7 @@ namespace Tarcog::ISO15099
         double lastDelta = std::numeric_limits<double>::max();
 
         auto step = [&](Helper::RelaxationState & stateRef) -> std::pair<double, bool> {
+            ++m_AirflowIterations;
             adjustTemperatures(adjacentGap);
             auto previous = current;
             current = calculateInletAndOutletTemperaturesWithTheAdjacentGap(
@@ -667,6 +669,11 @@ namespace Tarcog::ISO15099
         Helper::iterateUntilConverged(state, lastDelta, step);
     }
 
+    size_t CIGUGapLayer::airflowIterations() const
+    {
+        return m_AirflowIterations;
+    }
+
     void CIGUGapLayer::precalculateState()
     {
         if(m_IsVentilated && m_ForcedVentilation.has_value())
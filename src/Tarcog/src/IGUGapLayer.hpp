@@ -98,6 +98,9 @@ namespace Tarcog
 
             double averageLayerTemperature() override;
 
+            //! Number of airflow iteration steps made by this gap so far.
+            [[nodiscard]] size_t airflowIterations() const;
+
         private:
             void calculateConvectionOrConductionFlow() override;
 
@@ -166,6 +169,7 @@ namespace Tarcog
             double m_Zin{0};
             double m_Zout{0};
             std::optional<ForcedVentilation> m_ForcedVentilation;
+            size_t m_AirflowIterations{0u};
         };
 
     }   // namespace ISO15099
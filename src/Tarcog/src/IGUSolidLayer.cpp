@@ -247,7 +247,7 @@ namespace Tarcog::ISO15099
             {
                 auto gasSpec{layer->getGasSpecification()};
                 gasSpec.setTemperature(temperature);
-                return gasSpec.gas.getGasProperties().m_ThermalConductivity;
+                return gasSpec.properties().m_ThermalConductivity;
             }
             return std::nullopt;
         }
@@ -57,6 +57,13 @@ namespace Tarcog::ISO15099
         return std::make_shared<CIndoorEnvironment>(*this);
     }
 
+    void CIndoorEnvironment::appendToHash(FenestrationCommon::StableHash & hash) const
+    {
+        hash.add(std::string_view("Indoor"));
+        CEnvironment::appendToHash(hash);
+        hash.add(surfaceTemperature(Side::Back)).add(m_RoomRadiationTemperature);
+    }
+
     double CIndoorEnvironment::getAirTemperature()
     {
         return surfaceTemperature(Side::Back);
@@ -84,7 +91,7 @@ namespace Tarcog::ISO15099
             tMean = 0.1;
         const auto deltaTemp = std::abs(surfaceTemperature(Side::Front) - getAirTemperature());
         gasSpecification.setTemperature(tMean);
-        const auto aProperties = gasSpecification.gas.getGasProperties();
+        const auto aProperties = gasSpecification.properties();
         const auto gr = GRAVITYCONSTANT * pow(m_Height, 3) * deltaTemp
                         * pow(aProperties.m_Density, 2) / (tMean * pow(aProperties.m_Viscosity, 2));
         const auto RaCrit = 2.5e5 * pow(exp(0.72 * m_Tilt) / sin(tiltRadians), 0.2);
@@ -19,6 +19,8 @@ namespace Tarcog::ISO15099
         std::shared_ptr<CBaseLayer> clone() const override;
         std::shared_ptr<CEnvironment> cloneEnvironment() const override;
 
+        void appendToHash(FenestrationCommon::StableHash & hash) const override;
+
     private:
         double getAirTemperature() override;
         double calculateIRFromVariables() override;
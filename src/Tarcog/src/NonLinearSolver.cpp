@@ -1,6 +1,11 @@
 #include <cassert>
+#include <cmath>
 #include <limits>
+#include <numeric>
 #include <algorithm>
+#include <utility>
+
+#include <WCECommon.hpp>
 
 #include "NonLinearSolver.hpp"
 #include "TarcogConstants.hpp"
@@ -8,13 +13,16 @@
 namespace Tarcog::ISO15099
 {
 
-    CNonLinearSolver::CNonLinearSolver(CIGU & t_IGU, const size_t numberOfIterations) :
+    CNonLinearSolver::CNonLinearSolver(CIGU & t_IGU,
+                                       const size_t numberOfIterations,
+                                       const SolverMethod method) :
         m_IGU(t_IGU),
         m_QBalance(m_IGU),
         m_Tolerance(IterationConstants::CONVERGENCE_TOLERANCE),
         m_Iterations(numberOfIterations),
         m_RelaxParam(IterationConstants::RELAXATION_PARAMETER_MAX),
-        m_SolutionTolerance(std::numeric_limits<double>::infinity())
+        m_SolutionTolerance(std::numeric_limits<double>::infinity()),
+        m_Method(method)
     {}
 
     void CNonLinearSolver::initialize()
@@ -25,21 +33,37 @@ namespace Tarcog::ISO15099
         m_SolutionTolerance = std::numeric_limits<double>::infinity();
         m_Iterations = 0;
         m_RelaxParam = IterationConstants::RELAXATION_PARAMETER_MAX;
+        m_Counters = {};
+        clearAndersonHistory();
     }
 
     double CNonLinearSolver::performIteration()
     {
         // 1) Compute candidate solution
-        auto aSolution = m_QBalance.calcBalanceMatrix();
+        std::vector<double> aSolution;
+        {
+            ScopedSolverTimer timer(&SolverPhaseTimes::balanceMatrix);
+            aSolution = m_QBalance.calcBalanceMatrix();
+        }
 
         // 2) Precalculate and measure tolerance
-        m_IGU.precalculateLayerStates();
+        {
+            ScopedSolverTimer timer(&SolverPhaseTimes::layerStates);
+            m_IGU.precalculateLayerStates();
+        }
         double tol = calculateTolerance(aSolution);
+        if(auto * telemetry = activeSolverTelemetry())
+        {
+            telemetry->iterations.push_back({m_Counters.outerIterations, tol, m_RelaxParam});
+        }
 
         // 3) Apply relaxation update
         estimateNewState(aSolution);
         m_IGU.setState(m_IGUState);
-        m_IGU.updateDeflectionState();
+        {
+            ScopedSolverTimer timer(&SolverPhaseTimes::deflection);
+            m_IGU.updateDeflectionState();
+        }
 
         return tol;
     }
@@ -62,6 +86,11 @@ namespace Tarcog::ISO15099
             m_RelaxParam -= IterationConstants::RELAXATION_PARAMETER_STEP;
             m_IGU.setState(m_initialState);
             m_IGUState = m_initialState;
+            clearAndersonHistory();
+            if(auto * telemetry = activeSolverTelemetry())
+            {
+                telemetry->restarts.push_back({m_Counters.outerIterations, m_RelaxParam});
+            }
         }
     }
 
@@ -72,12 +101,39 @@ namespace Tarcog::ISO15099
     }
 
     void CNonLinearSolver::solve()
+    {
+        if(m_TelemetryHook)
+        {
+            solveWithTelemetry();
+            return;
+        }
+        iterate();
+    }
+
+    void CNonLinearSolver::solveWithTelemetry()
+    {
+        SolverTelemetry telemetry;
+        {
+            ScopedTelemetryRecording recording(telemetry);
+            ScopedSolverTimer timer(&SolverPhaseTimes::total);
+            iterate();
+        }
+        telemetry.counters = m_Counters;
+        telemetry.solutionTolerance = m_SolutionTolerance;
+        telemetry.toleranceAchieved = isToleranceAchieved();
+        m_TelemetryHook(telemetry);
+    }
+
+    void CNonLinearSolver::iterate()
     {
         initialize();
+        const auto airflowIterations{m_IGU.getAirflowIterations()};
+        const auto deflectionEvaluations{m_IGU.getDeflectionEvaluations()};
 
         while(true)
         {
             ++m_Iterations;
+            ++m_Counters.outerIterations;
             double tol = performIteration();
             updateBestSolution(tol);
             resetIfNeeded();
@@ -87,6 +143,9 @@ namespace Tarcog::ISO15099
 
         m_IGUState = m_bestSolution;
         m_IGU.setState(m_bestSolution);
+
+        m_Counters.airflowIterations = m_IGU.getAirflowIterations() - airflowIterations;
+        m_Counters.deflectionEvaluations = m_IGU.getDeflectionEvaluations() - deflectionEvaluations;
     }
 
     void CNonLinearSolver::setTolerance(double const t_Tolerance)
@@ -109,6 +168,31 @@ namespace Tarcog::ISO15099
         return m_SolutionTolerance < m_Tolerance;
     }
 
+    void CNonLinearSolver::setMethod(const SolverMethod method)
+    {
+        m_Method = method;
+    }
+
+    SolverMethod CNonLinearSolver::method() const
+    {
+        return m_Method;
+    }
+
+    SolverCounters CNonLinearSolver::counters() const
+    {
+        return m_Counters;
+    }
+
+    void CNonLinearSolver::setTelemetryHook(SolverTelemetryHook hook)
+    {
+        m_TelemetryHook = std::move(hook);
+    }
+
+    const SolverTelemetryHook & CNonLinearSolver::telemetryHook() const
+    {
+        return m_TelemetryHook;
+    }
+
     double CNonLinearSolver::calculateTolerance(const std::vector<double> & t_Solution) const
     {
         assert(t_Solution.size() == m_IGUState.size());
@@ -123,10 +207,124 @@ namespace Tarcog::ISO15099
     void CNonLinearSolver::estimateNewState(const std::vector<double> & t_Solution)
     {
         assert(t_Solution.size() == m_IGUState.size());
+        if(m_Method == SolverMethod::Anderson)
+        {
+            estimateAndersonState(t_Solution);
+            return;
+        }
         for(size_t i = 0; i < m_IGUState.size(); ++i)
         {
             m_IGUState[i] = m_RelaxParam * t_Solution[i] + (1 - m_RelaxParam) * m_IGUState[i];
         }
     }
 
+    void CNonLinearSolver::estimateAndersonState(const std::vector<double> & t_Solution)
+    {
+        const auto size{m_IGUState.size()};
+        std::vector<double> residual(size);
+        for(size_t i = 0; i < size; ++i)
+        {
+            residual[i] = t_Solution[i] - m_IGUState[i];
+        }
+
+        if(!m_PreviousResidual.empty())
+        {
+            std::vector<double> residualDifference(size);
+            std::vector<double> stateDifference(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                residualDifference[i] = residual[i] - m_PreviousResidual[i];
+                stateDifference[i] = m_IGUState[i] - m_PreviousState[i];
+            }
+            m_ResidualDifferences.push_back(std::move(residualDifference));
+            m_StateDifferences.push_back(std::move(stateDifference));
+            if(m_ResidualDifferences.size() > IterationConstants::ANDERSON_DEPTH)
+            {
+                m_ResidualDifferences.pop_front();
+                m_StateDifferences.pop_front();
+            }
+        }
+        m_PreviousResidual = residual;
+        m_PreviousState = m_IGUState;
+
+        // Relaxed step corrected by the combination of previous steps that best cancels the
+        // current residual.
+        std::vector<double> newState(size);
+        for(size_t i = 0; i < size; ++i)
+        {
+            newState[i] = m_IGUState[i] + m_RelaxParam * residual[i];
+        }
+        const auto gamma{andersonCoefficients(residual)};
+        for(size_t j = 0; j < gamma.size(); ++j)
+        {
+            for(size_t i = 0; i < size; ++i)
+            {
+                newState[i] -= gamma[j]
+                               * (m_StateDifferences[j][i]
+                                  + m_RelaxParam * m_ResidualDifferences[j][i]);
+            }
+        }
+
+        // Temperatures and radiosities must stay positive. Otherwise fall back to relaxation
+        // and start the history over.
+        const auto isValid{std::ranges::all_of(
+          newState, [](const double value) { return std::isfinite(value) && value > 0; })};
+        if(isValid)
+        {
+            m_IGUState = std::move(newState);
+        }
+        else
+        {
+            clearAndersonHistory();
+            for(size_t i = 0; i < size; ++i)
+            {
+                m_IGUState[i] += m_RelaxParam * residual[i];
+            }
+        }
+    }
+
+    std::vector<double>
+      CNonLinearSolver::andersonCoefficients(const std::vector<double> & t_Residual) const
+    {
+        // Least squares through normal equations. History is short, so the system is small.
+        const auto & differences{m_ResidualDifferences};
+        const auto depth{differences.size()};
+        FenestrationCommon::SquareMatrix gram(depth);
+        std::vector<double> rhs(depth);
+        double trace{0};
+        for(size_t j = 0; j < depth; ++j)
+        {
+            for(size_t k = 0; k < depth; ++k)
+            {
+                gram(j, k) = std::inner_product(
+                  differences[j].begin(), differences[j].end(), differences[k].begin(), 0.0);
+            }
+            rhs[j] = std::inner_product(
+              differences[j].begin(), differences[j].end(), t_Residual.begin(), 0.0);
+            trace += gram(j, j);
+        }
+
+        if(depth == 0u || trace == 0)
+        {
+            return {};
+        }
+
+        // Consecutive differences become almost parallel close to the solution.
+        const auto regularization{1e-10 * trace / static_cast<double>(depth)};
+        for(size_t j = 0; j < depth; ++j)
+        {
+            gram(j, j) += regularization;
+        }
+
+        return FenestrationCommon::solveSystem(gram, rhs);
+    }
+
+    void CNonLinearSolver::clearAndersonHistory()
+    {
+        m_PreviousState.clear();
+        m_PreviousResidual.clear();
+        m_ResidualDifferences.clear();
+        m_StateDifferences.clear();
+    }
+
 }   // namespace Tarcog::ISO15099
@@ -1,17 +1,30 @@
 #pragma once
 
+#include <deque>
 #include <vector>
 
 #include "HeatFlowBalance.hpp"
 #include "IGU.hpp"
+#include "SolverTelemetry.hpp"
 
 namespace Tarcog::ISO15099
 {
+    //! Relaxation mixes each heat balance solution with the previous state. Anderson mixing
+    //! extrapolates from the last few iterations as well and usually converges in fewer outer
+    //! iterations, so airflow and deflection models are evaluated fewer times. Both stop at the
+    //! same tolerance.
+    enum class SolverMethod
+    {
+        Relaxation,
+        Anderson
+    };
 
     class CNonLinearSolver
     {
     public:
-        explicit CNonLinearSolver(CIGU & t_IGU, size_t numberOfIterations = 0u);
+        explicit CNonLinearSolver(CIGU & t_IGU,
+                                  size_t numberOfIterations = 0u,
+                                  SolverMethod method = SolverMethod::Relaxation);
 
         // sets tolerance for solution
         void setTolerance(double t_Tolerance);
@@ -25,6 +38,15 @@ namespace Tarcog::ISO15099
         [[nodiscard]] double solutionTolerance() const;
         [[nodiscard]] bool isToleranceAchieved() const;
 
+        void setMethod(SolverMethod method);
+        [[nodiscard]] SolverMethod method() const;
+
+        [[nodiscard]] SolverCounters counters() const;
+
+        //! Empty hook switches the telemetry off.
+        void setTelemetryHook(SolverTelemetryHook hook);
+        [[nodiscard]] const SolverTelemetryHook & telemetryHook() const;
+
     private:
         // Core steps extracted for clarity:
         void initialize();
@@ -32,10 +54,16 @@ namespace Tarcog::ISO15099
         void updateBestSolution(double achievedTolerance);
         void resetIfNeeded();
         [[nodiscard]] bool shouldContinue(double achievedTolerance) const;
+        void iterate();
+        void solveWithTelemetry();
 
         // low-level helpers from original
         [[nodiscard]] double calculateTolerance(const std::vector<double> & t_Solution) const;
         void estimateNewState(const std::vector<double> & t_Solution);
+        void estimateAndersonState(const std::vector<double> & t_Solution);
+        [[nodiscard]] std::vector<double>
+          andersonCoefficients(const std::vector<double> & t_Residual) const;
+        void clearAndersonHistory();
 
         // solver state
         CIGU & m_IGU;
@@ -47,6 +75,17 @@ namespace Tarcog::ISO15099
         size_t m_Iterations;
         double m_RelaxParam;
         double m_SolutionTolerance;
+
+        SolverMethod m_Method;
+        SolverCounters m_Counters;
+        SolverTelemetryHook m_TelemetryHook;
+
+        // Anderson mixing history. Differences of residuals and states between consecutive
+        // iterations, oldest first.
+        std::vector<double> m_PreviousState;
+        std::vector<double> m_PreviousResidual;
+        std::deque<std::vector<double>> m_ResidualDifferences;
+        std::deque<std::vector<double>> m_StateDifferences;
     };
 
 }   // namespace Tarcog::ISO15099
@@ -119,4 +119,12 @@ namespace Tarcog::ISO15099
         return J(Side::Front);
     }
 
+    void COutdoorEnvironment::appendToHash(FenestrationCommon::StableHash & hash) const
+    {
+        hash.add(std::string_view("Outdoor"));
+        CEnvironment::appendToHash(hash);
+        hash.add(surfaceTemperature(Side::Front)).add(m_Tsky);
+        hash.add(m_FractionOfClearSky).add(m_SkyModel);
+    }
+
 }   // namespace Tarcog::ISO15099
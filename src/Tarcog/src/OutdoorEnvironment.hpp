@@ -35,6 +35,8 @@ namespace Tarcog::ISO15099
 
         double getSolarRadiation() const;
 
+        void appendToHash(FenestrationCommon::StableHash & hash) const override;
+
     private:
         double getAirTemperature() override;
         double calculateIRFromVariables() override;
@@ -1,5 +1,6 @@
 #include <memory>
 #include <vector>
+#include <utility>
 #include <ranges>
 #include <stdexcept>
 #include <cassert>
@@ -63,7 +64,8 @@ namespace Tarcog::ISO15099
 
     CSingleSystem::CSingleSystem(const CSingleSystem & t_SingleSystem) : m_IGU(t_SingleSystem.m_IGU)
     {
-        operator=(t_SingleSystem);
+        // IGU is already cloned above. Going through operator= would clone it once more.
+        connectEnvironments(t_SingleSystem);
     }
 
     CSingleSystem & CSingleSystem::operator=(CSingleSystem const & t_SingleSystem)
@@ -74,6 +76,13 @@ namespace Tarcog::ISO15099
         }
 
         m_IGU = t_SingleSystem.m_IGU;
+        connectEnvironments(t_SingleSystem);
+
+        return *this;
+    }
+
+    void CSingleSystem::connectEnvironments(const CSingleSystem & t_SingleSystem)
+    {
         m_Environment[Environment::Indoor] =
           t_SingleSystem.m_Environment.at(Environment::Indoor)->cloneEnvironment();
         const auto aLastLayer = m_IGU.getEnvironment(Environment::Indoor);
@@ -87,9 +96,10 @@ namespace Tarcog::ISO15099
         // initializeStartValues();
 
         m_NonLinearSolver =
-          std::make_shared<CNonLinearSolver>(m_IGU, t_SingleSystem.getNumberOfIterations());
-
-        return *this;
+          std::make_shared<CNonLinearSolver>(m_IGU,
+                                             t_SingleSystem.getNumberOfIterations(),
+                                             t_SingleSystem.m_NonLinearSolver->method());
+        m_NonLinearSolver->setTelemetryHook(t_SingleSystem.m_NonLinearSolver->telemetryHook());
     }
 
     std::vector<std::shared_ptr<CIGUSolidLayer>> CSingleSystem::getSolidLayers() const
@@ -207,6 +217,24 @@ namespace Tarcog::ISO15099
         m_NonLinearSolver->setTolerance(t_Tolerance);
     }
 
+    void CSingleSystem::setSolverMethod(const SolverMethod method) const
+    {
+        assert(m_NonLinearSolver != nullptr);
+        m_NonLinearSolver->setMethod(method);
+    }
+
+    SolverCounters CSingleSystem::getSolverCounters() const
+    {
+        assert(m_NonLinearSolver != nullptr);
+        return m_NonLinearSolver->counters();
+    }
+
+    void CSingleSystem::setSolverTelemetryHook(SolverTelemetryHook hook) const
+    {
+        assert(m_NonLinearSolver != nullptr);
+        m_NonLinearSolver->setTelemetryHook(std::move(hook));
+    }
+
     size_t CSingleSystem::getNumberOfIterations() const
     {
         assert(m_NonLinearSolver != nullptr);
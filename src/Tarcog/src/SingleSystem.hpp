@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "IGU.hpp"
+#include "NonLinearSolver.hpp"
 
 #include "ShadingModifiers.hpp"
 
@@ -19,8 +20,6 @@ namespace Tarcog::ISO15099
 
     class CEnvironment;
 
-    class CNonLinearSolver;
-
     class CSingleSystem
     {
     public:
@@ -70,6 +69,10 @@ namespace Tarcog::ISO15099
 
         // Set solution tolerance
         void setTolerance(double t_Tolerance) const;
+        void setSolverMethod(SolverMethod method) const;
+        [[nodiscard]] SolverCounters getSolverCounters() const;
+        //! Hook is called at the end of every solve. Empty hook switches the telemetry off.
+        void setSolverTelemetryHook(SolverTelemetryHook hook) const;
         // Set intial guess for solution.
         void setInitialGuess(const std::vector<double> & t_Temperatures) const;
 
@@ -106,6 +109,10 @@ namespace Tarcog::ISO15099
         std::shared_ptr<CNonLinearSolver> m_NonLinearSolver;
         void initializeStartValues();
 
+        //! Clones environments of the given system, connects them to this IGU and creates the
+        //! solver. IGU must be copied before the call.
+        void connectEnvironments(const CSingleSystem & t_SingleSystem);
+
         // Helper enum use in evaluation of the shading modifiers
         enum class ShadePosition
         {
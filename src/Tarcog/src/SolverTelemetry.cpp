@@ -0,0 +1,108 @@
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+#include "SolverTelemetry.hpp"
+
+namespace Tarcog::ISO15099
+{
+    namespace
+    {
+        thread_local SolverTelemetry * activeTelemetry{nullptr};
+
+        void writeNumber(std::ostringstream & out, const double value)
+        {
+            if(std::isfinite(value))
+            {
+                out << value;
+            }
+            else
+            {
+                out << "null";
+            }
+        }
+    }   // namespace
+
+    std::string SolverTelemetry::toJson() const
+    {
+        std::ostringstream out;
+        out.precision(std::numeric_limits<double>::max_digits10);
+
+        out << "{\"iterations\":[";
+        for(size_t i = 0u; i < iterations.size(); ++i)
+        {
+            out << (i == 0u ? "" : ",") << "{\"iteration\":" << iterations[i].iteration
+                << ",\"residual\":";
+            writeNumber(out, iterations[i].residual);
+            out << ",\"relaxationParameter\":";
+            writeNumber(out, iterations[i].relaxationParameter);
+            out << "}";
+        }
+
+        out << "],\"restarts\":[";
+        for(size_t i = 0u; i < restarts.size(); ++i)
+        {
+            out << (i == 0u ? "" : ",") << "{\"iteration\":" << restarts[i].iteration
+                << ",\"relaxationParameter\":";
+            writeNumber(out, restarts[i].relaxationParameter);
+            out << "}";
+        }
+
+        out << "],\"times\":{\"balanceMatrix\":";
+        writeNumber(out, times.balanceMatrix);
+        out << ",\"layerStates\":";
+        writeNumber(out, times.layerStates);
+        out << ",\"deflection\":";
+        writeNumber(out, times.deflection);
+        out << ",\"gasProperties\":";
+        writeNumber(out, times.gasProperties);
+        out << ",\"total\":";
+        writeNumber(out, times.total);
+
+        out << "},\"counters\":{\"outerIterations\":" << counters.outerIterations
+            << ",\"airflowIterations\":" << counters.airflowIterations
+            << ",\"deflectionEvaluations\":" << counters.deflectionEvaluations;
+
+        out << "},\"solutionTolerance\":";
+        writeNumber(out, solutionTolerance);
+        out << ",\"toleranceAchieved\":" << (toleranceAchieved ? "true" : "false") << "}";
+
+        return out.str();
+    }
+
+    SolverTelemetry * activeSolverTelemetry()
+    {
+        return activeTelemetry;
+    }
+
+    ScopedTelemetryRecording::ScopedTelemetryRecording(SolverTelemetry & telemetry) :
+        m_Previous(activeTelemetry)
+    {
+        activeTelemetry = &telemetry;
+    }
+
+    ScopedTelemetryRecording::~ScopedTelemetryRecording()
+    {
+        activeTelemetry = m_Previous;
+    }
+
+    ScopedSolverTimer::ScopedSolverTimer(double SolverPhaseTimes::*phase) :
+        m_Telemetry(activeTelemetry),
+        m_Phase(phase)
+    {
+        if(m_Telemetry != nullptr)
+        {
+            m_Start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ScopedSolverTimer::~ScopedSolverTimer()
+    {
+        if(m_Telemetry != nullptr)
+        {
+            const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now()
+                                                        - m_Start};
+            m_Telemetry->times.*m_Phase += elapsed.count();
+        }
+    }
+}   // namespace Tarcog::ISO15099
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Tarcog::ISO15099
+{
+    //! Work done by the last solve.
+    struct SolverCounters
+    {
+        //! Heat balance solutions, including the ones dropped by relaxation restarts.
+        size_t outerIterations{0u};
+        //! Iteration steps of the ventilated gap airflow loops.
+        size_t airflowIterations{0u};
+        //! Pane load evaluations of the deflection model.
+        size_t deflectionEvaluations{0u};
+    };
+
+    struct SolverIteration
+    {
+        //! Counted from the start of the solve, iterations before restarts included.
+        size_t iteration{0u};
+        //! Largest change of the state made by the heat balance solution.
+        double residual{0};
+        double relaxationParameter{0};
+    };
+
+    //! Relaxation restart. State goes back to the best solution so far.
+    struct SolverRestart
+    {
+        size_t iteration{0u};
+        //! Relaxation parameter used after the restart.
+        double relaxationParameter{0};
+    };
+
+    //! Wall clock times in seconds. Gas properties are evaluated inside the other phases, so
+    //! their time is part of those phases as well.
+    struct SolverPhaseTimes
+    {
+        double balanceMatrix{0};
+        double layerStates{0};
+        double deflection{0};
+        double gasProperties{0};
+        double total{0};
+    };
+
+    //! Trace of a single solve.
+    struct SolverTelemetry
+    {
+        std::vector<SolverIteration> iterations;
+        std::vector<SolverRestart> restarts;
+        SolverPhaseTimes times;
+        SolverCounters counters;
+        double solutionTolerance{0};
+        bool toleranceAchieved{false};
+
+        //! Single JSON object with the same fields. Non finite numbers are written as null.
+        [[nodiscard]] std::string toJson() const;
+    };
+
+    //! Called at the end of every solve. Solves are recorded only while a hook is set.
+    using SolverTelemetryHook = std::function<void(const SolverTelemetry &)>;
+
+    //! Telemetry recorded by the solve running on this thread or nullptr if there is none.
+    [[nodiscard]] SolverTelemetry * activeSolverTelemetry();
+
+    //! Makes the telemetry active on this thread for the lifetime of the object.
+    class ScopedTelemetryRecording
+    {
+    public:
+        explicit ScopedTelemetryRecording(SolverTelemetry & telemetry);
+        ~ScopedTelemetryRecording();
+
+        ScopedTelemetryRecording(const ScopedTelemetryRecording &) = delete;
+        ScopedTelemetryRecording & operator=(const ScopedTelemetryRecording &) = delete;
+
+    private:
+        SolverTelemetry * m_Previous;
+    };
+
+    //! Adds the time spent in its scope to one of the phases of the active telemetry. Clock is
+    //! not read when there is no active telemetry.
+    class ScopedSolverTimer
+    {
+    public:
+        explicit ScopedSolverTimer(double SolverPhaseTimes::*phase);
+        ~ScopedSolverTimer();
+
+        ScopedSolverTimer(const ScopedSolverTimer &) = delete;
+        ScopedSolverTimer & operator=(const ScopedSolverTimer &) = delete;
+
+    private:
+        SolverTelemetry * m_Telemetry;
+        double SolverPhaseTimes::*m_Phase;
+        std::chrono::steady_clock::time_point m_Start;
+    };
+}   // namespace Tarcog::ISO15099
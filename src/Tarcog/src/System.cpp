@@ -1,3 +1,7 @@
+#include <exception>
+
+#include <WCECommon.hpp>
+
 #include "System.hpp"
 #include "IGU.hpp"
 #include "Environment.hpp"
@@ -9,16 +13,37 @@ namespace Tarcog::ISO15099
 {
     CSystem::CSystem(CIGU t_IGU,
                      const std::shared_ptr<CEnvironment> & t_Indoor,
-                     const std::shared_ptr<CEnvironment> & t_Outdoor)
-                         : m_igu(std::move(t_IGU))
+                     const std::shared_ptr<CEnvironment> & t_Outdoor,
+                     const bool t_ParallelSolve) :
+        m_igu(std::move(t_IGU)), m_ParallelSolve(t_ParallelSolve)
+    {
+        createSystems(t_Indoor, t_Outdoor);
+        solve();
+    }
+
+    CSystem::CSystem(CIGU t_IGU,
+                     const std::shared_ptr<CEnvironment> & t_Indoor,
+                     const std::shared_ptr<CEnvironment> & t_Outdoor,
+                     const std::map<System, std::vector<double>> & t_InitialGuess,
+                     const bool t_ParallelSolve) :
+        m_igu(std::move(t_IGU)), m_ParallelSolve(t_ParallelSolve)
+    {
+        createSystems(t_Indoor, t_Outdoor);
+        for(const auto & [key, temperatures] : t_InitialGuess)
+        {
+            m_System.at(key)->setInitialGuess(temperatures);
+        }
+        solve();
+    }
+
+    void CSystem::createSystems(const std::shared_ptr<CEnvironment> & t_Indoor,
+                                const std::shared_ptr<CEnvironment> & t_Outdoor)
     {
         m_System[System::SHGC] = std::make_shared<CSingleSystem>(m_igu, t_Indoor, t_Outdoor);
         m_System.at(System::SHGC)->setSolarRadiation(t_Outdoor->getDirectSolarRadiation());
         m_System[System::Uvalue] = std::make_shared<CSingleSystem>(
           m_igu, t_Indoor->cloneEnvironment(), t_Outdoor->cloneEnvironment());
         m_System.at(System::Uvalue)->setSolarRadiation(0);
-
-        solve();
     }
 
     std::vector<double> CSystem::getTemperatures(System const t_System)
@@ -130,6 +155,38 @@ namespace Tarcog::ISO15099
         return m_System.at(t_System)->getNumberOfIterations();
     }
 
+    SolverCounters CSystem::getSolverCounters(const System t_System)
+    {
+        checkSolved();
+        return m_System.at(t_System)->getSolverCounters();
+    }
+
+    void CSystem::setSolverMethod(const SolverMethod method)
+    {
+        for(auto & [key, system] : m_System)
+        {
+            std::ignore = key;
+            system->setSolverMethod(method);
+        }
+        m_Solved = false;
+    }
+
+    void CSystem::setSolverTelemetryHook(
+      const std::function<void(System, const SolverTelemetry &)> & hook)
+    {
+        for(auto & [key, system] : m_System)
+        {
+            SolverTelemetryHook systemHook;
+            if(hook)
+            {
+                systemHook = [hook, key](const SolverTelemetry & telemetry) {
+                    hook(key, telemetry);
+                };
+            }
+            system->setSolverTelemetryHook(std::move(systemHook));
+        }
+    }
+
     std::vector<double> CSystem::getSolidEffectiveLayerConductivities(const System t_System)
     {
         checkSolved();
@@ -242,14 +299,61 @@ namespace Tarcog::ISO15099
         m_Solved = false;
     }
 
+    void CSystem::setParallelSolve(const bool parallel)
+    {
+        m_ParallelSolve = parallel;
+    }
+
     void CSystem::solve()
     {
+        if(m_ParallelSolve)
+        {
+            solveInParallel();
+        }
+        else
+        {
+            for(auto & [key, system] : m_System)
+            {
+                std::ignore = key;
+                system->solve();
+            }
+        }
+        m_Solved = true;
+    }
+
+    void CSystem::solveInParallel()
+    {
+        std::vector<CSingleSystem *> systems;
         for(auto & [key, system] : m_System)
         {
             std::ignore = key;
-            system->solve();
+            systems.push_back(system.get());
+        }
+
+        // Exceptions cannot leave worker threads. They are collected and the one from the first
+        // system is rethrown, as it would be in the serial solve.
+        std::vector<std::exception_ptr> errors(systems.size());
+        FenestrationCommon::executeInParallelDynamic(
+          systems.size(),
+          [&](const size_t index) {
+              try
+              {
+                  systems[index]->solve();
+              }
+              catch(...)
+              {
+                  errors[index] = std::current_exception();
+              }
+          },
+          systems.size());
+
+        for(const auto & error : errors)
+        {
+            if(error)
+            {
+                std::rethrow_exception(error);
+            }
         }
-        m_Solved = true;
     }
 
     void CSystem::checkSolved()
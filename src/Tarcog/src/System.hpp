@@ -3,12 +3,14 @@
 #include "IGU.hpp"
 
 
+#include <functional>
 #include <memory>
 #include <vector>
 #include <map>
 
 #include "IGUConfigurations.hpp"
 #include "IGUGapLayer.hpp"
+#include "NonLinearSolver.hpp"
 #include "ShadingModifiers.hpp"
 
 
@@ -26,9 +28,21 @@ namespace Tarcog::ISO15099
     {
     public:
         virtual ~CSystem() = default;
+        //! U-value and SHGC systems are independent and can be solved on separate threads.
+        //! Results are the same in both modes.
         CSystem(CIGU t_IGU,
                 const std::shared_ptr<CEnvironment> & t_Indoor,
-                const std::shared_ptr<CEnvironment> & t_Outdoor);
+                const std::shared_ptr<CEnvironment> & t_Outdoor,
+                bool t_ParallelSolve = false);
+
+        //! Solves from the surface temperatures of a similar system, e.g. from
+        //! getTemperatures of a neighbouring design, instead of the linear profile between the
+        //! environments. Systems missing from the initial guess use the linear profile.
+        CSystem(CIGU t_IGU,
+                const std::shared_ptr<CEnvironment> & t_Indoor,
+                const std::shared_ptr<CEnvironment> & t_Outdoor,
+                const std::map<System, std::vector<double>> & t_InitialGuess,
+                bool t_ParallelSolve = false);
 
         [[nodiscard]] std::vector<double> getTemperatures(System t_System) override;
         [[nodiscard]] std::vector<double> getRadiosities(System t_System);
@@ -63,6 +77,14 @@ namespace Tarcog::ISO15099
         [[nodiscard]] double getHr(System sys, Environment environment) const override;
         [[nodiscard]] double getH(System sys, Environment environment) const override;
         [[nodiscard]] size_t getNumberOfIterations(System t_System);
+        [[nodiscard]] SolverCounters getSolverCounters(System t_System);
+
+        void setSolverMethod(SolverMethod method);
+
+        //! Hook is called at the end of every solve of each system. With the parallel solve it
+        //! can be called from two threads at the same time.
+        void setSolverTelemetryHook(
+          const std::function<void(System, const SolverTelemetry &)> & hook);
 
         [[nodiscard]] double relativeHeatGain(double Tsol);
 
@@ -84,15 +106,22 @@ namespace Tarcog::ISO15099
 
         [[nodiscard]] ShadingModifier getShadingModifier(System t_System, Environment env) const;
 
+        //! Takes effect on the next solve.
+        void setParallelSolve(bool parallel);
+
     private:
         CIGU m_igu;
 
+        void createSystems(const std::shared_ptr<CEnvironment> & t_Indoor,
+                           const std::shared_ptr<CEnvironment> & t_Outdoor);
         void solve();
+        void solveInParallel();
         void checkSolved();
 
         std::map<System, std::shared_ptr<CSingleSystem>> m_System;
 
         bool m_Solved{false};
+        bool m_ParallelSolve{false};
     };
 
 }   // namespace Tarcog::ISO15099
@@ -26,6 +26,8 @@ namespace Tarcog
         constexpr double RELAXATION_PARAMETER_AIRFLOW_MIN = 0.1;
         constexpr double RELAXATION_PARAMETER_AIRFLOW_STEP = 0.1;
         constexpr double CONVERGENCE_TOLERANCE_AIRFLOW = 1e-2;
+        //! Number of previous iterations used by Anderson mixing
+        constexpr size_t ANDERSON_DEPTH = 5;
     }   // namespace IterationConstants
 
     namespace MaterialConstants
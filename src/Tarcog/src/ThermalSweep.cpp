@@ -0,0 +1,226 @@
+#include <algorithm>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include <WCECommon.hpp>
+
+#include "ThermalSweep.hpp"
+#include "Environment.hpp"
+#include "IGUSolidLayer.hpp"
+#include "Layers.hpp"
+#include "System.hpp"
+
+namespace Tarcog::ISO15099
+{
+    namespace
+    {
+        std::array<size_t, 4> positions(const SweepPoint & point)
+        {
+            return {point.coatedSurface, point.gas, point.gapThickness, point.lowEEmissivity};
+        }
+
+        size_t axisSize(const size_t numberOfValues)
+        {
+            return std::max<size_t>(numberOfValues, 1u);
+        }
+    }   // namespace
+
+    CThermalSweep::CThermalSweep(SweepGlazing glazing,
+                                 SweepAxes axes,
+                                 const std::shared_ptr<CEnvironment> & indoor,
+                                 const std::shared_ptr<CEnvironment> & outdoor) :
+        m_Glazing(std::move(glazing)),
+        m_Axes(std::move(axes)),
+        m_Indoor(indoor),
+        m_Outdoor(outdoor),
+        m_AxisSizes{axisSize(m_Axes.coatedSurfaces.size()),
+                    axisSize(m_Axes.gases.size()),
+                    axisSize(m_Axes.gapThicknesses.size()),
+                    axisSize(m_Axes.lowEEmissivities.size())}
+    {
+        if(m_Indoor == nullptr || m_Outdoor == nullptr)
+        {
+            throw std::runtime_error("Environments of the thermal sweep have not been assigned.");
+        }
+        if(m_Glazing.panes.empty())
+        {
+            throw std::runtime_error("Thermal sweep glazing must have at least one pane.");
+        }
+        if(m_Axes.coatedSurfaces.empty() != m_Axes.lowEEmissivities.empty())
+        {
+            throw std::runtime_error("Coated surfaces and low-e emissivities of the thermal sweep "
+                                     "must be given together.");
+        }
+        for(const auto surface : m_Axes.coatedSurfaces)
+        {
+            if(surface >= 2u * m_Glazing.panes.size())
+            {
+                throw std::runtime_error("Coated surface is outside of the sweep glazing.");
+            }
+        }
+
+        size_t stride{1u};
+        for(size_t axis = m_AxisSizes.size(); axis-- > 0u;)
+        {
+            m_Strides[axis] = stride;
+            stride *= m_AxisSizes[axis];
+        }
+    }
+
+    size_t CThermalSweep::size() const
+    {
+        return m_AxisSizes[0] * m_Strides[0];
+    }
+
+    SweepPoint CThermalSweep::point(const size_t index) const
+    {
+        if(index >= size())
+        {
+            throw std::runtime_error("Thermal sweep point index is out of range.");
+        }
+
+        std::array<size_t, 4> position{};
+        for(size_t axis = 0u; axis < position.size(); ++axis)
+        {
+            position[axis] = (index / m_Strides[axis]) % m_AxisSizes[axis];
+        }
+        return {index, position[0], position[1], position[2], position[3]};
+    }
+
+    CIGU CThermalSweep::igu(const SweepPoint & point) const
+    {
+        auto panes{m_Glazing.panes};
+        if(!m_Axes.lowEEmissivities.empty())
+        {
+            const auto surface{m_Axes.coatedSurfaces.at(point.coatedSurface)};
+            auto & pane{panes[surface / 2u]};
+            (surface % 2u == 0u ? pane.frontEmissivity : pane.backEmissivity) =
+              m_Axes.lowEEmissivities.at(point.lowEEmissivity);
+        }
+
+        const auto gapThickness{m_Axes.gapThicknesses.empty()
+                                  ? m_Glazing.gapThickness
+                                  : m_Axes.gapThicknesses.at(point.gapThickness)};
+        const auto & gas{m_Axes.gases.empty() ? m_Glazing.gas : m_Axes.gases.at(point.gas)};
+
+        const auto solarRadiation{m_Outdoor->getDirectSolarRadiation()};
+        CIGU igu(m_Glazing.width, m_Glazing.height, m_Glazing.tilt);
+        for(size_t i = 0u; i < panes.size(); ++i)
+        {
+            if(i > 0u)
+            {
+                igu.addLayer(Layers::gap(gapThickness, gas));
+            }
+            const auto & pane{panes[i]};
+            auto layer{Layers::solid(pane.thickness,
+                                     pane.conductivity,
+                                     pane.frontEmissivity,
+                                     pane.frontIRTransmittance,
+                                     pane.backEmissivity,
+                                     pane.backIRTransmittance)};
+            layer->setSolarHeatGain(pane.solarAbsorptance, solarRadiation);
+            igu.addLayer(layer);
+        }
+        return igu;
+    }
+
+    void CThermalSweep::setChunkSize(const size_t chunkSize)
+    {
+        if(chunkSize == 0u)
+        {
+            throw std::runtime_error("Thermal sweep chunk size must be greater than zero.");
+        }
+        m_ChunkSize = chunkSize;
+    }
+
+    std::optional<size_t> CThermalSweep::nearestSolved(const SweepPoint & point,
+                                                       const size_t chunkStart) const
+    {
+        // The previous position along the fastest axis is the closest point in the chunk.
+        const auto position{positions(point)};
+        for(size_t axis = position.size(); axis-- > 0u;)
+        {
+            if(position[axis] > 0u && point.index - m_Strides[axis] >= chunkStart)
+            {
+                return point.index - m_Strides[axis];
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::vector<SweepResult> CThermalSweep::solveChunk(const size_t chunk) const
+    {
+        const auto first{chunk * m_ChunkSize};
+        const auto last{std::min(first + m_ChunkSize, size())};
+
+        std::vector<SweepResult> results;
+        std::vector<std::map<System, std::vector<double>>> solutions;
+        results.reserve(last - first);
+        solutions.reserve(last - first);
+        for(auto index = first; index < last; ++index)
+        {
+            const auto aPoint{point(index)};
+            const auto neighbour{nearestSolved(aPoint, first)};
+
+            std::map<System, std::vector<double>> initialGuess;
+            if(neighbour.has_value())
+            {
+                initialGuess = solutions[*neighbour - first];
+            }
+
+            CSystem system(igu(aPoint),
+                           m_Indoor->cloneEnvironment(),
+                           m_Outdoor->cloneEnvironment(),
+                           initialGuess);
+
+            results.push_back({aPoint,
+                               system.getUValue(),
+                               system.getSHGC(m_Glazing.solarTransmittance),
+                               system.getSolverCounters(System::Uvalue).outerIterations
+                                 + system.getSolverCounters(System::SHGC).outerIterations,
+                               neighbour.has_value()});
+            solutions.push_back({{System::Uvalue, system.getTemperatures(System::Uvalue)},
+                                 {System::SHGC, system.getTemperatures(System::SHGC)}});
+        }
+        return results;
+    }
+
+    void CThermalSweep::run(const SweepSink & sink, const size_t numberOfThreads) const
+    {
+        const auto numberOfChunks{(size() + m_ChunkSize - 1u) / m_ChunkSize};
+
+        // Exceptions cannot leave worker threads. The one from the first failed chunk is
+        // rethrown after all chunks are done.
+        std::mutex sinkMutex;
+        std::vector<std::exception_ptr> errors(numberOfChunks);
+        FenestrationCommon::executeInParallelDynamic(
+          numberOfChunks,
+          [&](const size_t chunk) {
+              try
+              {
+                  const auto results{solveChunk(chunk)};
+                  std::scoped_lock lock(sinkMutex);
+                  for(const auto & result : results)
+                  {
+                      sink(result);
+                  }
+              }
+              catch(...)
+              {
+                  errors[chunk] = std::current_exception();
+              }
+          },
+          numberOfThreads);
+
+        for(const auto & error : errors)
+        {
+            if(error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+}   // namespace Tarcog::ISO15099
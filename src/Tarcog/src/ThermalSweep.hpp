@@ -0,0 +1,118 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <WCEGases.hpp>
+
+#include "IGU.hpp"
+
+namespace Tarcog::ISO15099
+{
+    class CEnvironment;
+
+    struct SweepPane
+    {
+        double thickness{0.003048};
+        double conductivity{1.0};
+        double frontEmissivity{0.84};
+        double frontIRTransmittance{0};
+        double backEmissivity{0.84};
+        double backIRTransmittance{0};
+        //! Used by the SHGC system only.
+        double solarAbsorptance{0};
+    };
+
+    //! Glazing that is modified by the sweep. Gap thickness and gas apply to every gap.
+    struct SweepGlazing
+    {
+        std::vector<SweepPane> panes;
+        double gapThickness{0.0127};
+        Gases::CGas gas{};
+        double width{1.0};
+        double height{1.0};
+        double tilt{90};
+        //! Total solar transmittance passed to the SHGC calculation.
+        double solarTransmittance{0};
+    };
+
+    //! Values of the swept parameters. Empty axis keeps the value of the glazing. Low-e
+    //! emissivity replaces the emissivity of one surface. Surfaces are counted from the outdoor
+    //! side starting at zero, so the front and back surfaces of the first pane are 0 and 1.
+    struct SweepAxes
+    {
+        std::vector<size_t> coatedSurfaces;
+        std::vector<Gases::CGas> gases;
+        std::vector<double> gapThicknesses;
+        std::vector<double> lowEEmissivities;
+    };
+
+    //! Combination of the axes given by the position in each axis. Axes that were left empty
+    //! have position zero.
+    struct SweepPoint
+    {
+        size_t index{0u};
+        size_t coatedSurface{0u};
+        size_t gas{0u};
+        size_t gapThickness{0u};
+        size_t lowEEmissivity{0u};
+    };
+
+    struct SweepResult
+    {
+        SweepPoint point;
+        double uValue{0};
+        double shgc{0};
+        //! Outer solver iterations of the U-value and SHGC systems together.
+        size_t iterations{0u};
+        //! True if the solution started from the solution of a neighbouring point.
+        bool warmStarted{false};
+    };
+
+    using SweepSink = std::function<void(const SweepResult &)>;
+
+    //! Solves every combination of the sweep axes. Combinations are created from their index when
+    //! they are solved and only the results leave the sweep, so memory does not grow with the
+    //! number of combinations. Low-e emissivity changes fastest and coated surface slowest.
+    class CThermalSweep
+    {
+    public:
+        CThermalSweep(SweepGlazing glazing,
+                      SweepAxes axes,
+                      const std::shared_ptr<CEnvironment> & indoor,
+                      const std::shared_ptr<CEnvironment> & outdoor);
+
+        [[nodiscard]] size_t size() const;
+        [[nodiscard]] SweepPoint point(size_t index) const;
+        [[nodiscard]] CIGU igu(const SweepPoint & point) const;
+
+        //! Consecutive points are solved in chunks of this size, one chunk per thread at a time.
+        void setChunkSize(size_t chunkSize);
+
+        //! Every point except the first one in a chunk starts from the solution of the nearest
+        //! neighbour already solved in the chunk. Chunks do not depend on the number of threads,
+        //! so neither do the results. Sink receives the results of each finished chunk in index
+        //! order and is never called from two threads at the same time. Chunks finish in any
+        //! order. Zero numberOfThreads uses all cores.
+        void run(const SweepSink & sink, size_t numberOfThreads = 0u) const;
+
+    private:
+        [[nodiscard]] std::optional<size_t> nearestSolved(const SweepPoint & point,
+                                                          size_t chunkStart) const;
+        [[nodiscard]] std::vector<SweepResult> solveChunk(size_t chunk) const;
+
+        SweepGlazing m_Glazing;
+        SweepAxes m_Axes;
+        std::shared_ptr<CEnvironment> m_Indoor;
+        std::shared_ptr<CEnvironment> m_Outdoor;
+        //! Number of positions and index distance between neighbours along each axis, in the
+        //! order of SweepPoint.
+        std::array<size_t, 4> m_AxisSizes{};
+        std::array<size_t, 4> m_Strides{};
+        size_t m_ChunkSize{64u};
+    };
+}   // namespace Tarcog::ISO15099
@@ -0,0 +1,90 @@
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "WCETarcog.hpp"
+
+// Corner windows are calculated once and reused for every (Ucog, keff) query until the frames or
+// dividers change.
+
+namespace
+{
+    CMA::CMAFrame cmaFrame(double scale)
+    {
+        const auto frame = [scale](double uValue, double edgeUValue) {
+            return Tarcog::ISO15099::FrameData{.UValue = scale * uValue,
+                                               .EdgeUValue = scale * edgeUValue,
+                                               .ProjectedFrameDimension = 0.042875183,
+                                               .WettedLength = 0.110605026};
+        };
+        return {frame(1.30, 0.79), frame(1.65, 2.71), frame(2.27, 1.65), frame(2.31, 3.19)};
+    }
+
+    void setFrames(CMA::CMAWindowSingleVision & window, double scale)
+    {
+        using Tarcog::ISO15099::SingleVisionFramePosition;
+        window.setFrameData({{SingleVisionFramePosition::Top, cmaFrame(scale)},
+                             {SingleVisionFramePosition::Bottom, cmaFrame(scale)},
+                             {SingleVisionFramePosition::Left, cmaFrame(scale)},
+                             {SingleVisionFramePosition::Right, cmaFrame(scale)}});
+    }
+}   // namespace
+
+TEST(TestCMAWindowCornerResults, RepeatedQueriesAreStable)
+{
+    CMA::CMAWindowSingleVision window(1.2, 1.5);
+    setFrames(window, 1.0);
+
+    const auto uValue{window.uValue(1.258, 0.75)};
+    const auto shgc{window.shgc(0.341, 0.75)};
+    for(auto keff : {0.01, 0.75, 10.0})
+    {
+        EXPECT_GT(window.uValue(1.258, keff), 0.0);
+    }
+    EXPECT_EQ(uValue, window.uValue(1.258, 0.75));
+    EXPECT_EQ(shgc, window.shgc(0.341, 0.75));
+}
+
+TEST(TestCMAWindowCornerResults, FrameChangeRecalculatesCorners)
+{
+    CMA::CMAWindowSingleVision window(1.2, 1.5);
+    setFrames(window, 1.0);
+    const auto before{window.uValue(1.258, 0.75)};
+
+    setFrames(window, 1.5);
+    const auto after{window.uValue(1.258, 0.75)};
+    EXPECT_GT(after, before);
+
+    CMA::CMAWindowSingleVision fresh(1.2, 1.5);
+    setFrames(fresh, 1.5);
+    EXPECT_EQ(fresh.uValue(1.258, 0.75), after);
+    EXPECT_EQ(fresh.shgc(0.341, 0.75), window.shgc(0.341, 0.75));
+
+    window.setDividers(cmaFrame(1.0), 1u, 1u);
+    EXPECT_NE(after, window.uValue(1.258, 0.75));
+}
+
+TEST(TestCMAWindowCornerResults, BulkResultsMatchSingleQueries)
+{
+    CMA::CMAWindowSingleVision window(1.2, 1.5);
+    setFrames(window, 1.0);
+
+    const std::vector<double> uCOG{1.258, 0.8, 2.5, 5.0};
+    const std::vector<double> shgcCOG{0.341, 0.2, 0.6, 0.0};
+    const std::vector<double> tVis{0.535, 0.3, 0.7, 1.0};
+    const std::vector<double> keff{0.750454253, 0.01, 10.0, 2.0};
+
+    const auto results{window.bulkResults(uCOG, shgcCOG, tVis, keff)};
+    ASSERT_EQ(uCOG.size(), results.uValue.size());
+    ASSERT_EQ(uCOG.size(), results.shgc.size());
+    ASSERT_EQ(uCOG.size(), results.vt.size());
+    for(size_t row = 0u; row < uCOG.size(); ++row)
+    {
+        EXPECT_NEAR(window.uValue(uCOG[row], keff[row]), results.uValue[row], 1e-12);
+        EXPECT_NEAR(window.shgc(shgcCOG[row], keff[row]), results.shgc[row], 1e-12);
+        EXPECT_NEAR(window.vt(tVis[row]), results.vt[row], 1e-12);
+    }
+
+    const std::vector<double> shortColumn{0.5};
+    EXPECT_THROW((void)window.bulkResults(uCOG, shortColumn, tVis, keff), std::runtime_error);
+}
@@ -1,3 +1,4 @@
+#include <cmath>
 #include <gtest/gtest.h>
 
 #include <WCETarcog.hpp>
@@ -64,4 +65,52 @@ TEST_F(TestDeflectionDataInterpolation, InterpolationAtEndPoint)
         EXPECT_NEAR(col[i].x.value(), correctX[i], Tolerance);
         EXPECT_NEAR(col[i].y.value(), correctY[i], Tolerance);
     }
-}
\ No newline at end of file
+}
+
+TEST_F(TestDeflectionDataInterpolation, CurvesMatchTableInterpolation)
+{
+    const auto expectedCurve = [](const Table::Table2D<std::optional<double>> & table,
+                                  double aspectRatio) {
+        auto col{columnInterpolation(table, aspectRatio)};
+        for(auto & val : col)
+        {
+            val.x = std::exp(val.x.value());
+            if(val.y.has_value())
+            {
+                val.y = std::exp(val.y.value());
+            }
+        }
+        col.insert(col.begin(), {0, 0});
+        return col;
+    };
+
+    const auto expectSame = [](const std::vector<Table::point> & expected,
+                               const std::vector<Table::point> & curve) {
+        ASSERT_EQ(expected.size(), curve.size());
+        for(size_t i = 0u; i < expected.size(); ++i)
+        {
+            EXPECT_EQ(expected[i].x, curve[i].x);
+            EXPECT_EQ(expected[i].y, curve[i].y);
+        }
+    };
+
+    for(const auto aspectRatio : {1.0, 1.3, 2.5, 4.71, 10.0})
+    {
+        expectSame(expectedCurve(DeflectionData::getWNData(), aspectRatio),
+                   DeflectionData::getWNCurve(aspectRatio));
+        expectSame(expectedCurve(DeflectionData::getVNData(), aspectRatio),
+                   DeflectionData::getVNCurve(aspectRatio));
+    }
+}
+
+TEST_F(TestDeflectionDataInterpolation, CurveHasMissingPoints)
+{
+    const auto curve{DeflectionData::getVNCurve(1.5)};
+
+    EXPECT_EQ(102u, curve.size());
+    EXPECT_EQ(0.0, curve.front().x);
+    EXPECT_EQ(0.0, curve.front().y);
+    EXPECT_TRUE(curve[1].has_value());
+    EXPECT_FALSE(curve.back().y.has_value());
+    EXPECT_NEAR(std::exp(5.0), curve.back().x.value(), 1e-9);
+}
@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "WCETarcog.hpp"
+
+using namespace Tarcog::ISO15099;
+
+// Hourly results must come in order, match systems solved hour by hour and not depend on the
+// number of threads.
+
+namespace
+{
+    constexpr size_t numberOfHours{48u};
+
+    CIGU doubleClear()
+    {
+        CIGU igu(1.0, 1.0);
+        igu.addLayers(
+          {Layers::solid(0.003048, 1.0), Layers::gap(0.0127), Layers::solid(0.005715, 1.0)});
+        return igu;
+    }
+
+    WeatherSeries weather()
+    {
+        WeatherSeries series;
+        for(size_t hour = 0u; hour < numberOfHours; ++hour)
+        {
+            const auto daily{std::sin(2.0 * std::numbers::pi * static_cast<double>(hour) / 24.0)};
+            series.outdoorTemperature.push_back(273.15 + 8.0 * daily);
+            series.windSpeed.push_back(3.0 + daily);
+            series.skyTemperature.push_back(263.15 + 8.0 * daily);
+            series.directSolarRadiation.push_back(std::max(0.0, 800.0 * daily));
+        }
+        return series;
+    }
+
+    SolarSeries solar()
+    {
+        SolarSeries series{.layerAbsorptances = {{}, {}}};
+        for(size_t hour = 0u; hour < numberOfHours; ++hour)
+        {
+            const auto shift{0.01 * static_cast<double>(hour % 24u) / 24.0};
+            series.layerAbsorptances[0].push_back(0.096489 + shift);
+            series.layerAbsorptances[1].push_back(0.072640 - shift);
+            series.solarTransmittance.push_back(0.703296);
+        }
+        return series;
+    }
+
+    std::vector<HourlyResult> run(const CAnnualSimulation & simulation,
+                                  const AnnualSimulationOptions & options)
+    {
+        std::vector<HourlyResult> results;
+        simulation.run([&](const HourlyResult & result) { results.push_back(result); }, options);
+        return results;
+    }
+}   // namespace
+
+TEST(AnnualSimulation, MatchesHourlySystems)
+{
+    const auto indoor{Environments::indoor(294.15)};
+    const CAnnualSimulation simulation(doubleClear(), indoor, weather(), solar());
+    const auto results{run(simulation, {})};
+    ASSERT_EQ(numberOfHours, results.size());
+
+    const auto series{weather()};
+    const auto absorptances{solar()};
+    for(size_t hour = 0u; hour < numberOfHours; ++hour)
+    {
+        EXPECT_EQ(hour, results[hour].hour);
+
+        auto igu{doubleClear()};
+        igu.setAbsorptances({absorptances.layerAbsorptances[0][hour],
+                             absorptances.layerAbsorptances[1][hour]},
+                            series.directSolarRadiation[hour]);
+        auto outdoor{Environments::outdoor(series.outdoorTemperature[hour],
+                                           series.windSpeed[hour],
+                                           series.directSolarRadiation[hour],
+                                           series.skyTemperature[hour],
+                                           SkyModel::AllSpecified)};
+        outdoor->setHCoeffModel(BoundaryConditionsCoeffModel::CalculateH);
+        CSystem system(igu, Environments::indoor(294.15), outdoor);
+
+        EXPECT_NEAR(system.getUValue(), results[hour].uValue, 1e-4);
+        EXPECT_NEAR(system.getSHGC(0.703296), results[hour].shgc, 1e-5);
+        EXPECT_NEAR(system.getHeatFlow(System::SHGC, Environment::Indoor),
+                    results[hour].indoorHeatFlow,
+                    1e-3);
+        ASSERT_EQ(4u, results[hour].temperatures.size());
+        for(size_t i = 0u; i < results[hour].temperatures.size(); ++i)
+        {
+            EXPECT_NEAR(system.getTemperatures(System::SHGC)[i],
+                        results[hour].temperatures[i],
+                        1e-3);
+        }
+    }
+}
+
+TEST(AnnualSimulation, ParallelChunks)
+{
+    const CAnnualSimulation simulation(
+      doubleClear(), Environments::indoor(294.15), weather(), solar());
+    const auto serial{run(simulation, {})};
+    const auto chunked{run(simulation, {.chunkSize = 10u, .overlap = 3u, .numberOfThreads = 1u})};
+    const auto parallel{run(simulation, {.chunkSize = 10u, .overlap = 3u, .numberOfThreads = 4u})};
+    ASSERT_EQ(numberOfHours, chunked.size());
+    ASSERT_EQ(numberOfHours, parallel.size());
+    for(size_t hour = 0u; hour < numberOfHours; ++hour)
+    {
+        EXPECT_EQ(hour, parallel[hour].hour);
+        EXPECT_EQ(chunked[hour].uValue, parallel[hour].uValue);
+        EXPECT_EQ(chunked[hour].shgc, parallel[hour].shgc);
+        EXPECT_EQ(chunked[hour].temperatures, parallel[hour].temperatures);
+        EXPECT_NEAR(serial[hour].uValue, parallel[hour].uValue, 1e-4);
+    }
+}
+
+TEST(AnnualSimulation, InvalidSeries)
+{
+    auto shortWeather{weather()};
+    shortWeather.windSpeed.pop_back();
+    EXPECT_THROW(
+      CAnnualSimulation(doubleClear(), Environments::indoor(294.15), shortWeather, solar()),
+      std::runtime_error);
+
+    auto singleColumn{solar()};
+    singleColumn.layerAbsorptances.pop_back();
+    EXPECT_THROW(
+      CAnnualSimulation(doubleClear(), Environments::indoor(294.15), weather(), singleColumn),
+      std::runtime_error);
+
+    EXPECT_THROW(CAnnualSimulation(doubleClear(), nullptr, weather(), solar()), std::runtime_error);
+}
@@ -0,0 +1,84 @@
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "WCETarcog.hpp"
+#include "WCECommon.hpp"
+
+using namespace Tarcog::ISO15099;
+
+// Cache keys of the thermal inputs. Equal inputs give equal keys and every input changes it.
+
+namespace
+{
+    CIGU doubleClear(double gapThickness = 0.012,
+                     double conductance = 1.0,
+                     const Gases::CGas & gas = Gases::CGas())
+    {
+        CIGU igu(1.0, 1.0);
+        igu.addLayers({Layers::solid(0.005715, conductance),
+                       Layers::gap(gapThickness, gas),
+                       Layers::solid(0.005715, 1.0)});
+        return igu;
+    }
+
+    std::uint64_t keyOf(const CIGU & igu)
+    {
+        FenestrationCommon::StableHash hash;
+        hashAppend(hash, igu);
+        return hash.value();
+    }
+
+    std::uint64_t keyOf(const CEnvironment & environment)
+    {
+        FenestrationCommon::StableHash hash;
+        hashAppend(hash, environment);
+        return hash.value();
+    }
+
+    std::shared_ptr<CEnvironment> outdoor(double airTemperature = 255.15, double tSky = 255.15)
+    {
+        return Environments::outdoor(airTemperature, 5.5, 789.0, tSky, SkyModel::AllSpecified);
+    }
+}   // namespace
+
+TEST(IGUHash, EqualIGUsGiveEqualKeys)
+{
+    EXPECT_EQ(keyOf(doubleClear()), keyOf(doubleClear()));
+}
+
+TEST(IGUHash, LayerInputsChangeKey)
+{
+    const auto reference = keyOf(doubleClear());
+    EXPECT_NE(reference, keyOf(doubleClear(0.013)));
+    EXPECT_NE(reference, keyOf(doubleClear(0.012, 0.9)));
+
+    Gases::CGas argon;
+    argon.addGasItem(0.1, Gases::GasDef::Air);
+    argon.addGasItem(0.9, Gases::GasDef::Argon);
+    EXPECT_NE(reference, keyOf(doubleClear(0.012, 1.0, argon)));
+
+    auto tilted = doubleClear();
+    tilted.setTilt(60);
+    EXPECT_NE(reference, keyOf(tilted));
+
+    auto absorbing = doubleClear();
+    absorbing.getSolidLayers()[0]->setSolarAbsorptance(0.1);
+    EXPECT_NE(reference, keyOf(absorbing));
+}
+
+TEST(IGUHash, EnvironmentInputsChangeKey)
+{
+    const auto reference = keyOf(*outdoor());
+    EXPECT_EQ(reference, keyOf(*outdoor()));
+    EXPECT_NE(reference, keyOf(*outdoor(260.0)));
+    EXPECT_NE(reference, keyOf(*outdoor(255.15, 250.0)));
+
+    auto prescribed = outdoor();
+    prescribed->setHCoeffModel(BoundaryConditionsCoeffModel::HPrescribed, 20.0);
+    EXPECT_NE(reference, keyOf(*prescribed));
+
+    const auto indoor = Environments::indoor(294.15);
+    EXPECT_EQ(keyOf(*indoor), keyOf(*Environments::indoor(294.15)));
+    EXPECT_NE(keyOf(*indoor), keyOf(*Environments::indoor(295.15)));
+    EXPECT_NE(keyOf(*indoor), reference);
+}
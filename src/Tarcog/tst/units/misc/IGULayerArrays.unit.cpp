@@ -0,0 +1,72 @@
+#include <memory>
+#include <utility>
+#include <gtest/gtest.h>
+
+#include "WCETarcog.hpp"
+
+using namespace Tarcog::ISO15099;
+
+// Solid and gap layers are kept by position next to the linked layers. Copies must rebuild both
+// from the cloned layers.
+
+namespace
+{
+    CIGU tripleClear()
+    {
+        CIGU igu(1.0, 1.0);
+        igu.addLayers({Layers::solid(0.003048, 1.0),
+                       Layers::gap(0.0127),
+                       Layers::solid(0.003048, 1.0),
+                       Layers::gap(0.0127),
+                       Layers::solid(0.003048, 1.0)});
+        return igu;
+    }
+
+    void expectPositions(const CIGU & igu)
+    {
+        const auto layers{igu.getLayers()};
+        const auto & solids{igu.getSolidLayers()};
+        const auto & gaps{igu.getGapLayers()};
+        ASSERT_EQ(3u, solids.size());
+        ASSERT_EQ(2u, gaps.size());
+        for(size_t i = 0u; i < solids.size(); ++i)
+        {
+            EXPECT_EQ(layers[2u * i], solids[i]);
+        }
+        for(size_t i = 0u; i < gaps.size(); ++i)
+        {
+            EXPECT_EQ(layers[2u * i + 1u], gaps[i]);
+            EXPECT_EQ(solids[i], gaps[i]->getPreviousLayer());
+            EXPECT_EQ(solids[i + 1u], gaps[i]->getNextLayer());
+        }
+    }
+}   // namespace
+
+TEST(IGULayerArrays, LayersAreIndexedByPosition)
+{
+    expectPositions(tripleClear());
+}
+
+TEST(IGULayerArrays, CopyUsesClonedLayers)
+{
+    const auto igu{tripleClear()};
+    CIGU copy{igu};
+    expectPositions(copy);
+    EXPECT_NE(igu.getSolidLayers()[1], copy.getSolidLayers()[1]);
+    EXPECT_NE(igu.getGapLayers()[0], copy.getGapLayers()[0]);
+
+    CIGU assigned;
+    assigned = copy;
+    expectPositions(assigned);
+    EXPECT_NE(copy.getSolidLayers()[0], assigned.getSolidLayers()[0]);
+}
+
+TEST(IGULayerArrays, MoveKeepsLayers)
+{
+    auto igu{tripleClear()};
+    const auto middle{igu.getSolidLayers()[1]};
+
+    CIGU moved{std::move(igu)};
+    expectPositions(moved);
+    EXPECT_EQ(middle, moved.getSolidLayers()[1]);
+}
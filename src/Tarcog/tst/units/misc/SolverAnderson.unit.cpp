@@ -0,0 +1,106 @@
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "WCETarcog.hpp"
+
+#include "vectorTesting.hpp"
+
+using namespace Tarcog::ISO15099;
+
+// Anderson mixing must reach the same solution as the relaxation in fewer outer iterations, so
+// the airflow and deflection models nested in every iteration run fewer times.
+
+namespace
+{
+    std::shared_ptr<CEnvironment> outdoor()
+    {
+        auto environment = Environments::outdoor(255.15, 5.5, 0.0, 255.15, SkyModel::AllSpecified);
+        environment->setHCoeffModel(BoundaryConditionsCoeffModel::CalculateH);
+        return environment;
+    }
+
+    CIGU inBetweenShade()
+    {
+        const auto effectiveLayer{EffectiveLayers::makeCommonValues(
+          0.01, 0.2, EffectiveLayers::ShadeOpenness{0.1, 0.1, 0.1, 0.1})};
+
+        CIGU igu(1.0, 1.0);
+        igu.addLayers({Layers::solid(0.005715, 1.0),
+                       Layers::gap(0.0127),
+                       Layers::shading(effectiveLayer.thickness, 160.0, effectiveLayer.openness),
+                       Layers::gap(0.0127),
+                       Layers::solid(0.005715, 1.0)});
+        return igu;
+    }
+
+    CIGU doubleClearWithDeflection()
+    {
+        CIGU igu(1.0, 1.0);
+        igu.addLayers(
+          {Layers::solid(0.003048, 1.0), Layers::gap(0.0127), Layers::solid(0.005715, 1.0)});
+        igu.setDeflectionProperties(303.15, 101325.0);
+        return igu;
+    }
+
+    std::unique_ptr<CSingleSystem> solved(CIGU igu, SolverMethod method)
+    {
+        auto system = std::make_unique<CSingleSystem>(igu, Environments::indoor(295.15), outdoor());
+        system->setSolverMethod(method);
+        system->solve();
+        return system;
+    }
+
+    void expectSameSolution(const CSingleSystem & expected, const CSingleSystem & system)
+    {
+        EXPECT_TRUE(system.isToleranceAchieved());
+        Helper::testVectors(
+          "Temperature", expected.getTemperatures(), system.getTemperatures(), 1e-6);
+        Helper::testVectors("Radiosity", expected.getRadiosities(), system.getRadiosities(), 1e-6);
+        EXPECT_NEAR(expected.getUValue(), system.getUValue(), 1e-8);
+    }
+}   // namespace
+
+TEST(SolverAnderson, VentilatedShade)
+{
+    const auto relaxation{solved(inBetweenShade(), SolverMethod::Relaxation)};
+    const auto anderson{solved(inBetweenShade(), SolverMethod::Anderson)};
+    expectSameSolution(*relaxation, *anderson);
+
+    const auto relaxationCounters{relaxation->getSolverCounters()};
+    const auto andersonCounters{anderson->getSolverCounters()};
+    EXPECT_EQ(relaxation->getNumberOfIterations(), relaxationCounters.outerIterations);
+    EXPECT_LT(andersonCounters.outerIterations, relaxationCounters.outerIterations);
+    EXPECT_GT(andersonCounters.airflowIterations, 0u);
+    EXPECT_LT(andersonCounters.airflowIterations, relaxationCounters.airflowIterations);
+    EXPECT_EQ(0u, andersonCounters.deflectionEvaluations);
+}
+
+TEST(SolverAnderson, Deflection)
+{
+    const auto relaxation{solved(doubleClearWithDeflection(), SolverMethod::Relaxation)};
+    const auto anderson{solved(doubleClearWithDeflection(), SolverMethod::Anderson)};
+    expectSameSolution(*relaxation, *anderson);
+    Helper::testVectors("Max deflection",
+                        relaxation->getMaxLayerDeflections(),
+                        anderson->getMaxLayerDeflections(),
+                        1e-9);
+
+    const auto relaxationCounters{relaxation->getSolverCounters()};
+    const auto andersonCounters{anderson->getSolverCounters()};
+    EXPECT_LT(andersonCounters.outerIterations, relaxationCounters.outerIterations);
+    EXPECT_EQ(0u, andersonCounters.airflowIterations);
+    EXPECT_GT(andersonCounters.deflectionEvaluations, 0u);
+    EXPECT_LT(andersonCounters.deflectionEvaluations, relaxationCounters.deflectionEvaluations);
+}
+
+TEST(SolverAnderson, CopyKeepsMethod)
+{
+    auto igu{doubleClearWithDeflection()};
+    CSingleSystem system(igu, Environments::indoor(295.15), outdoor());
+    system.setSolverMethod(SolverMethod::Anderson);
+    auto copy{system};
+    copy.solve();
+    system.solve();
+    EXPECT_EQ(system.getSolverCounters().outerIterations,
+              copy.getSolverCounters().outerIterations);
+}
@@ -0,0 +1,101 @@
+#include <cmath>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "WCETarcog.hpp"
+
+using namespace Tarcog::ISO15099;
+
+// Telemetry is recorded only while a hook is set and must not change the solution.
+
+namespace
+{
+    CSystem doubleClearSystem()
+    {
+        auto outdoor = Environments::outdoor(305.15, 2.75, 783.0, 305.15, SkyModel::AllSpecified);
+        outdoor->setHCoeffModel(BoundaryConditionsCoeffModel::CalculateH);
+        auto indoor = Environments::indoor(297.15);
+
+        auto layer1 = Layers::solid(0.003048, 1.0);
+        layer1->setSolarHeatGain(0.096489, 783.0);
+        auto layer2 = Layers::solid(0.005715, 1.0);
+        layer2->setSolarHeatGain(0.072640, 783.0);
+
+        CIGU igu(1.0, 1.0);
+        igu.addLayers({layer1, Layers::gap(0.0127), layer2});
+        igu.setDeflectionProperties(303.15, 101325.0);
+
+        return CSystem(igu, indoor, outdoor);
+    }
+
+    void expectConsistent(const SolverTelemetry & telemetry)
+    {
+        ASSERT_FALSE(telemetry.iterations.empty());
+        EXPECT_EQ(telemetry.counters.outerIterations, telemetry.iterations.size());
+        for(size_t i = 0u; i < telemetry.iterations.size(); ++i)
+        {
+            EXPECT_EQ(i + 1u, telemetry.iterations[i].iteration);
+            EXPECT_TRUE(std::isfinite(telemetry.iterations[i].residual));
+            EXPECT_GT(telemetry.iterations[i].relaxationParameter, 0.0);
+        }
+        EXPECT_TRUE(telemetry.toleranceAchieved);
+        EXPECT_GT(telemetry.counters.deflectionEvaluations, 0u);
+
+        const auto & times{telemetry.times};
+        EXPECT_GT(times.total, 0.0);
+        EXPECT_GE(times.total, times.balanceMatrix + times.layerStates + times.deflection);
+        EXPECT_GT(times.gasProperties, 0.0);
+    }
+}   // namespace
+
+TEST(SolverTelemetry, RecordsEverySolve)
+{
+    auto reference{doubleClearSystem()};
+    auto system{doubleClearSystem()};
+
+    std::vector<System> systems;
+    std::vector<SolverTelemetry> records;
+    system.setSolverTelemetryHook([&](const System aSystem, const SolverTelemetry & telemetry) {
+        systems.push_back(aSystem);
+        records.push_back(telemetry);
+    });
+    reference.setTilt(90);
+    system.setTilt(90);
+
+    EXPECT_EQ(reference.getUValue(), system.getUValue());
+    EXPECT_EQ(reference.getTemperatures(System::Uvalue), system.getTemperatures(System::Uvalue));
+    ASSERT_EQ(2u, records.size());
+    EXPECT_NE(systems[0], systems[1]);
+    for(size_t i = 0u; i < records.size(); ++i)
+    {
+        expectConsistent(records[i]);
+        EXPECT_EQ(system.getNumberOfIterations(systems[i]), records[i].iterations.size());
+    }
+
+    system.setSolverTelemetryHook({});
+    system.setTilt(45);
+    EXPECT_GT(system.getUValue(), 0.0);
+    EXPECT_EQ(2u, records.size());
+}
+
+TEST(SolverTelemetry, JsonExport)
+{
+    SolverTelemetry telemetry;
+    telemetry.iterations = {{1u, 2.5, 1.0}, {2u, 0.5, 1.0}};
+    telemetry.restarts = {{2u, 0.9}};
+    telemetry.times.total = 0.25;
+    telemetry.counters.outerIterations = 2u;
+    telemetry.solutionTolerance = std::nan("");
+
+    const std::string expected{
+      "{\"iterations\":[{\"iteration\":1,\"residual\":2.5,\"relaxationParameter\":1},"
+      "{\"iteration\":2,\"residual\":0.5,\"relaxationParameter\":1}],"
+      "\"restarts\":[{\"iteration\":2,\"relaxationParameter\":0.90000000000000002}],"
+      "\"times\":{\"balanceMatrix\":0,\"layerStates\":0,\"deflection\":0,\"gasProperties\":0,"
+      "\"total\":0.25},"
+      "\"counters\":{\"outerIterations\":2,\"airflowIterations\":0,"
+      "\"deflectionEvaluations\":0},"
+      "\"solutionTolerance\":null,\"toleranceAchieved\":false}"};
+    EXPECT_EQ(expected, telemetry.toJson());
+}
@@ -0,0 +1,62 @@
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "WCETarcog.hpp"
+
+using namespace Tarcog::ISO15099;
+
+// U-value and SHGC systems solved on separate threads must give the same results as the serial
+// solve.
+
+namespace
+{
+    CSystem doubleClearSystem(bool parallelSolve)
+    {
+        auto outdoor = Environments::outdoor(305.15, 2.75, 783.0, 305.15, SkyModel::AllSpecified);
+        outdoor->setHCoeffModel(BoundaryConditionsCoeffModel::CalculateH);
+        auto indoor = Environments::indoor(297.15);
+
+        auto layer1 = Layers::solid(0.003048, 1.0);
+        layer1->setSolarHeatGain(0.096489, 783.0);
+        auto layer2 = Layers::solid(0.005715, 1.0);
+        layer2->setSolarHeatGain(0.072640, 783.0);
+
+        CIGU igu(1.0, 1.0);
+        igu.addLayers({layer1, Layers::gap(0.0127), layer2});
+        igu.setDeflectionProperties(303.15, 101325.0);
+
+        return CSystem(igu, indoor, outdoor, parallelSolve);
+    }
+
+    void expectSameResults(CSystem & expected, CSystem & system)
+    {
+        EXPECT_EQ(expected.getUValue(), system.getUValue());
+        EXPECT_EQ(expected.getSHGC(0.703296), system.getSHGC(0.703296));
+        for(const auto aSystem : {System::SHGC, System::Uvalue})
+        {
+            EXPECT_EQ(expected.getTemperatures(aSystem), system.getTemperatures(aSystem));
+            EXPECT_EQ(expected.getMaxLayerDeflections(aSystem),
+                      system.getMaxLayerDeflections(aSystem));
+            EXPECT_EQ(expected.getNumberOfIterations(aSystem),
+                      system.getNumberOfIterations(aSystem));
+        }
+    }
+}   // namespace
+
+TEST(SystemParallelSolve, SameResultsAsSerialSolve)
+{
+    auto serial{doubleClearSystem(false)};
+    auto parallel{doubleClearSystem(true)};
+    expectSameResults(serial, parallel);
+}
+
+TEST(SystemParallelSolve, ResolveAfterSwitchingMode)
+{
+    auto serial{doubleClearSystem(false)};
+    auto system{doubleClearSystem(false)};
+
+    system.setParallelSolve(true);
+    system.setTilt(45);
+    serial.setTilt(45);
+    expectSameResults(serial, system);
+}
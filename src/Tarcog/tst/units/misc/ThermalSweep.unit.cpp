@@ -0,0 +1,120 @@
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+#include "WCETarcog.hpp"
+
+using namespace Tarcog::ISO15099;
+
+// Sweep points are created from their index and warm started from their neighbours. Results must
+// not depend on the number of threads and must match systems solved one at a time.
+
+namespace
+{
+    std::shared_ptr<CEnvironment> outdoor()
+    {
+        auto environment =
+          Environments::outdoor(305.15, 2.75, 783.0, 305.15, SkyModel::AllSpecified);
+        environment->setHCoeffModel(BoundaryConditionsCoeffModel::CalculateH);
+        return environment;
+    }
+
+    Gases::CGas argonMixture()
+    {
+        Gases::CGas gas;
+        gas.addGasItem(0.1, Gases::GasDef::Air);
+        gas.addGasItem(0.9, Gases::GasDef::Argon);
+        return gas;
+    }
+
+    CThermalSweep doubleClearSweep()
+    {
+        SweepGlazing glazing{
+          .panes = {SweepPane{.thickness = 0.003048, .solarAbsorptance = 0.096489},
+                    SweepPane{.thickness = 0.005715, .solarAbsorptance = 0.072640}},
+          .solarTransmittance = 0.703296};
+        SweepAxes axes{.coatedSurfaces = {1u, 2u},
+                       .gases = {Gases::CGas(), argonMixture()},
+                       .gapThicknesses = {0.006, 0.0127, 0.02},
+                       .lowEEmissivities = {0.84, 0.1}};
+        CThermalSweep sweep(glazing, axes, Environments::indoor(297.15), outdoor());
+        sweep.setChunkSize(5u);
+        return sweep;
+    }
+
+    std::map<size_t, SweepResult> run(const CThermalSweep & sweep, size_t numberOfThreads)
+    {
+        std::map<size_t, SweepResult> results;
+        sweep.run([&](const SweepResult & result) { results[result.point.index] = result; },
+                  numberOfThreads);
+        return results;
+    }
+}   // namespace
+
+TEST(ThermalSweep, Points)
+{
+    const auto sweep{doubleClearSweep()};
+    ASSERT_EQ(24u, sweep.size());
+
+    const auto last{sweep.point(23u)};
+    EXPECT_EQ(23u, last.index);
+    EXPECT_EQ(1u, last.coatedSurface);
+    EXPECT_EQ(1u, last.gas);
+    EXPECT_EQ(2u, last.gapThickness);
+    EXPECT_EQ(1u, last.lowEEmissivity);
+
+    const auto aPoint{sweep.point(15u)};
+    EXPECT_EQ(1u, aPoint.coatedSurface);
+    EXPECT_EQ(0u, aPoint.gas);
+    EXPECT_EQ(1u, aPoint.gapThickness);
+    EXPECT_EQ(1u, aPoint.lowEEmissivity);
+
+    EXPECT_THROW((void)sweep.point(24u), std::runtime_error);
+}
+
+TEST(ThermalSweep, MatchesSingleSystems)
+{
+    const auto sweep{doubleClearSweep()};
+    const auto serial{run(sweep, 1u)};
+    const auto parallel{run(sweep, 4u)};
+    ASSERT_EQ(sweep.size(), serial.size());
+    ASSERT_EQ(sweep.size(), parallel.size());
+
+    size_t sweepIterations{0u};
+    size_t singleIterations{0u};
+    for(const auto & [index, result] : serial)
+    {
+        EXPECT_EQ(result.uValue, parallel.at(index).uValue);
+        EXPECT_EQ(result.shgc, parallel.at(index).shgc);
+        EXPECT_EQ(result.warmStarted, parallel.at(index).warmStarted);
+        if(index % 5u == 0u)
+        {
+            EXPECT_FALSE(result.warmStarted);
+        }
+
+        CSystem single(sweep.igu(result.point), Environments::indoor(297.15), outdoor());
+        EXPECT_NEAR(single.getUValue(), result.uValue, 1e-4);
+        EXPECT_NEAR(single.getSHGC(0.703296), result.shgc, 1e-5);
+
+        sweepIterations += result.iterations;
+        singleIterations += single.getSolverCounters(System::Uvalue).outerIterations
+                            + single.getSolverCounters(System::SHGC).outerIterations;
+    }
+    EXPECT_LT(sweepIterations, singleIterations);
+}
+
+TEST(ThermalSweep, InvalidAxes)
+{
+    SweepGlazing glazing{.panes = {SweepPane{}, SweepPane{}}};
+    EXPECT_THROW(CThermalSweep(glazing,
+                               SweepAxes{.coatedSurfaces = {4u}, .lowEEmissivities = {0.1}},
+                               Environments::indoor(297.15),
+                               outdoor()),
+                 std::runtime_error);
+    EXPECT_THROW(CThermalSweep(glazing,
+                               SweepAxes{.coatedSurfaces = {1u}},
+                               Environments::indoor(297.15),
+                               outdoor()),
+                 std::runtime_error);
+}
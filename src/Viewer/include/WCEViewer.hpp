@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../src/EnclosureRadiosity.hpp"
 #include "../src/EnclosureViewFactorInput.hpp"
 #include "../src/EnclosureViewFactors.hpp"
 #include "../src/Geometry2D.hpp"
@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+#include "BlockerBVH.hpp"
+#include "ViewerConstants.hpp"
+
+
+namespace Viewer
+{
+    namespace
+    {
+        // The tolerant intersection test can report a crossing up to about one tolerance outside
+        // both segments' boxes; padding the blocker boxes by more than twice that keeps the
+        // queries conservative.
+        const double boxPadding{4.0 * ViewerConstants::DISTANCE_TOLERANCE};
+
+        constexpr std::size_t leafSize{4u};
+    }   // namespace
+
+    BlockerBVH BlockerBVH::build(const std::vector<CSegment2D> & blockers)
+    {
+        BlockerBVH bvh;
+        if(blockers.empty())
+        {
+            return bvh;
+        }
+
+        bvh.m_boxes.reserve(blockers.size());
+        for(const auto & blocker : blockers)
+        {
+            const auto startPoint = blocker.startPoint();
+            const auto endPoint = blocker.endPoint();
+            bvh.m_boxes.push_back({.minX = std::min(startPoint.x(), endPoint.x()) - boxPadding,
+                                   .minY = std::min(startPoint.y(), endPoint.y()) - boxPadding,
+                                   .maxX = std::max(startPoint.x(), endPoint.x()) + boxPadding,
+                                   .maxY = std::max(startPoint.y(), endPoint.y()) + boxPadding});
+        }
+
+        bvh.m_order.resize(blockers.size());
+        std::iota(bvh.m_order.begin(), bvh.m_order.end(), std::size_t{0u});
+        bvh.m_nodes.reserve(2u * blockers.size() / leafSize + 1u);
+        bvh.buildNode(0u, blockers.size());
+
+        return bvh;
+    }
+
+    std::size_t BlockerBVH::buildNode(const std::size_t first, const std::size_t count)
+    {
+        const auto & boxes = m_boxes;
+        const auto begin = m_order.begin() + static_cast<std::ptrdiff_t>(first);
+        const auto end = begin + static_cast<std::ptrdiff_t>(count);
+
+        auto bounds = boxes[*begin];
+        auto centers = Box{.minX = bounds.minX + bounds.maxX,
+                           .minY = bounds.minY + bounds.maxY,
+                           .maxX = bounds.minX + bounds.maxX,
+                           .maxY = bounds.minY + bounds.maxY};
+        for(auto it = begin; it != end; ++it)
+        {
+            const auto & box = boxes[*it];
+            bounds = {.minX = std::min(bounds.minX, box.minX),
+                      .minY = std::min(bounds.minY, box.minY),
+                      .maxX = std::max(bounds.maxX, box.maxX),
+                      .maxY = std::max(bounds.maxY, box.maxY)};
+            centers = {.minX = std::min(centers.minX, box.minX + box.maxX),
+                       .minY = std::min(centers.minY, box.minY + box.maxY),
+                       .maxX = std::max(centers.maxX, box.minX + box.maxX),
+                       .maxY = std::max(centers.maxY, box.minY + box.maxY)};
+        }
+
+        const auto nodeIndex = m_nodes.size();
+        m_nodes.push_back({.box = bounds, .first = first, .count = count, .rightChild = 0u});
+        if(count <= leafSize)
+        {
+            return nodeIndex;
+        }
+
+        // Median split on the doubled centers (min + max) along the wider axis. Ties are broken
+        // by blocker index, so the split does not depend on the input order.
+        const bool splitX = centers.maxX - centers.minX >= centers.maxY - centers.minY;
+        const auto center = [&](const std::size_t idx) {
+            return splitX ? boxes[idx].minX + boxes[idx].maxX : boxes[idx].minY + boxes[idx].maxY;
+        };
+        const auto leftCount = count / 2u;
+        std::nth_element(begin,
+                         begin + static_cast<std::ptrdiff_t>(leftCount),
+                         end,
+                         [&](const std::size_t lhs, const std::size_t rhs) {
+                             return center(lhs) < center(rhs)
+                                    || (center(lhs) == center(rhs) && lhs < rhs);
+                         });
+
+        m_nodes[nodeIndex].count = 0u;
+        buildNode(first, leftCount);
+        const auto rightChild = buildNode(first + leftCount, count - leftCount);
+        m_nodes[nodeIndex].rightChild = rightChild;
+
+        return nodeIndex;
+    }
+
+    std::vector<std::size_t> BlockerBVH::candidatesForBoundingBox(const double minX,
+                                                                  const double minY,
+                                                                  const double maxX,
+                                                                  const double maxY) const
+    {
+        std::vector<std::size_t> result;
+        static_cast<void>(
+          anyInBoundingBox(minX, minY, maxX, maxY, [&](const std::size_t idx) {
+              result.push_back(idx);
+              return false;
+          }));
+
+        std::ranges::sort(result);
+        return result;
+    }
+
+    std::size_t BlockerBVH::nodeCount() const
+    {
+        return m_nodes.size();
+    }
+
+    bool BlockerBVH::overlaps(const Box & box, const Box & query)
+    {
+        return box.maxX >= query.minX && box.minX <= query.maxX && box.maxY >= query.minY
+               && box.minY <= query.maxY;
+    }
+
+    bool BlockerBVH::crosses(const Probe & probe, const Box & box)
+    {
+        // Liang-Barsky clip of the parameter range [0, 1] against both slabs.
+        double enter{0.0};
+        double exit{1.0};
+        const auto clip = [&](double start, double delta, double lo, double hi) {
+            if(delta == 0.0)
+            {
+                return start >= lo && start <= hi;
+            }
+            auto tLo = (lo - start) / delta;
+            auto tHi = (hi - start) / delta;
+            if(tLo > tHi)
+            {
+                std::swap(tLo, tHi);
+            }
+            enter = std::max(enter, tLo);
+            exit = std::min(exit, tHi);
+            return enter <= exit;
+        };
+
+        return clip(probe.startX, probe.deltaX, box.minX, box.maxX)
+               && clip(probe.startY, probe.deltaY, box.minY, box.maxY);
+    }
+}   // namespace Viewer
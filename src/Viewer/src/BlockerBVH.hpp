@@ -0,0 +1,164 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "Segment2D.hpp"
+
+namespace Viewer
+{
+    // Bounding-volume hierarchy over the blocker segments, the alternative to SpatialGrid for
+    // geometry whose blockers cluster in thin regions with large empty areas (frame cavities).
+    // The tree is built once by median splits along the longer axis of the blocker centers and
+    // stored flat in depth-first order, so memory is linear in the blocker count. Blocker boxes
+    // are padded by a few DISTANCE_TOLERANCE, so the queries return a superset of the blockers
+    // the tolerant CSegment2D tests can report - like the grid, it never changes the answer.
+    class BlockerBVH
+    {
+    public:
+        [[nodiscard]] static BlockerBVH build(const std::vector<CSegment2D> & blockers);
+
+        // Sorted indices of blockers whose bounding box overlaps the given bounding box.
+        [[nodiscard]] std::vector<std::size_t>
+          candidatesForBoundingBox(double minX, double minY, double maxX, double maxY) const;
+
+        // True if visit(idx) holds for one of the candidatesForBoundingBox, without building the
+        // list. Stops at the first blocker for which visit holds.
+        template<typename Visitor>
+        [[nodiscard]] bool anyInBoundingBox(
+          double minX, double minY, double maxX, double maxY, Visitor && visit) const;
+
+        // True if blocks(idx) holds for a blocker whose bounding box the segment crosses. The
+        // traversal stops at the first such blocker.
+        template<typename Predicate>
+        [[nodiscard]] bool anyAlongSegment(const CSegment2D & segment, Predicate && blocks) const;
+
+        [[nodiscard]] std::size_t nodeCount() const;
+
+    private:
+        struct Box
+        {
+            double minX;
+            double minY;
+            double maxX;
+            double maxY;
+        };
+
+        // Leaves hold count > 0 blockers starting at first in m_order. An inner node's left
+        // child directly follows it; the right child is at rightChild.
+        struct Node
+        {
+            Box box;
+            std::size_t first;
+            std::size_t count;
+            std::size_t rightChild;
+        };
+
+        // Straight segment as origin plus direction, for the slab test against node boxes.
+        struct Probe
+        {
+            double startX;
+            double startY;
+            double deltaX;
+            double deltaY;
+        };
+
+        // Deep enough for any median-split tree over an addressable number of blockers.
+        static constexpr std::size_t maxDepth{64u};
+
+        BlockerBVH() = default;
+
+        std::size_t buildNode(std::size_t first, std::size_t count);
+
+        [[nodiscard]] static bool crosses(const Probe & probe, const Box & box);
+        [[nodiscard]] static bool overlaps(const Box & box, const Box & query);
+
+        std::vector<Box> m_boxes;   // padded box of each blocker, by blocker index
+        std::vector<Node> m_nodes;
+        std::vector<std::size_t> m_order;   // blocker indices, grouped by leaf
+    };
+
+    template<typename Visitor>
+    bool BlockerBVH::anyInBoundingBox(const double minX,
+                                      const double minY,
+                                      const double maxX,
+                                      const double maxY,
+                                      Visitor && visit) const
+    {
+        if(m_nodes.empty())
+        {
+            return false;
+        }
+
+        const Box query{.minX = minX, .minY = minY, .maxX = maxX, .maxY = maxY};
+        std::array<std::size_t, maxDepth> stack{};
+        std::size_t top{0u};
+        stack[top++] = 0u;
+        while(top > 0u)
+        {
+            const auto nodeIndex = stack[--top];
+            const auto & node = m_nodes[nodeIndex];
+            if(!overlaps(node.box, query))
+            {
+                continue;
+            }
+            if(node.count > 0u)
+            {
+                for(auto idx = node.first; idx < node.first + node.count; ++idx)
+                {
+                    const auto blocker = m_order[idx];
+                    if(overlaps(m_boxes[blocker], query) && visit(blocker))
+                    {
+                        return true;
+                    }
+                }
+                continue;
+            }
+            stack[top++] = node.rightChild;
+            stack[top++] = nodeIndex + 1u;
+        }
+        return false;
+    }
+
+    template<typename Predicate>
+    bool BlockerBVH::anyAlongSegment(const CSegment2D & segment, Predicate && blocks) const
+    {
+        if(m_nodes.empty())
+        {
+            return false;
+        }
+
+        const Probe probe{.startX = segment.startPoint().x(),
+                          .startY = segment.startPoint().y(),
+                          .deltaX = segment.endPoint().x() - segment.startPoint().x(),
+                          .deltaY = segment.endPoint().y() - segment.startPoint().y()};
+
+        std::array<std::size_t, maxDepth> stack{};
+        std::size_t top{0u};
+        stack[top++] = 0u;
+        while(top > 0u)
+        {
+            const auto & node = m_nodes[stack[--top]];
+            if(!crosses(probe, node.box))
+            {
+                continue;
+            }
+            if(node.count > 0u)
+            {
+                for(auto idx = node.first; idx < node.first + node.count; ++idx)
+                {
+                    const auto blocker = m_order[idx];
+                    if(crosses(probe, m_boxes[blocker]) && blocks(blocker))
+                    {
+                        return true;
+                    }
+                }
+                continue;
+            }
+            stack[top++] = node.rightChild;
+            stack[top++] = static_cast<std::size_t>(&node - m_nodes.data()) + 1u;
+        }
+        return false;
+    }
+}   // namespace Viewer
@@ -0,0 +1,185 @@
+#include <algorithm>
+#include <cmath>
+
+#include "BlockerCoordinates.hpp"
+#include "ViewerConstants.hpp"
+
+
+namespace Viewer
+{
+    namespace
+    {
+        // CSegment2D::isInRectangleRange along one axis.
+        bool inRange(const double value, const double minValue, const double maxValue)
+        {
+            if(std::abs(maxValue - minValue) > ViewerConstants::DISTANCE_TOLERANCE)
+            {
+                return value < (maxValue - ViewerConstants::DISTANCE_TOLERANCE)
+                       && value > (minValue + ViewerConstants::DISTANCE_TOLERANCE);
+            }
+            return std::abs(value - maxValue) < ViewerConstants::DISTANCE_TOLERANCE;
+        }
+
+        // inRange with both branches evaluated and the result selected, for the batched kernel.
+        bool inRangeLane(const double value, const double minValue, const double maxValue)
+        {
+            const bool wide = std::abs(maxValue - minValue) > ViewerConstants::DISTANCE_TOLERANCE;
+            const bool inside = (value < (maxValue - ViewerConstants::DISTANCE_TOLERANCE))
+                                & (value > (minValue + ViewerConstants::DISTANCE_TOLERANCE));
+            const bool near = std::abs(value - maxValue) < ViewerConstants::DISTANCE_TOLERANCE;
+            return (wide & inside) | (!wide & near);
+        }
+    }   // namespace
+
+    SegmentLine lineOf(const CPoint2D & startPoint, const CPoint2D & endPoint)
+    {
+        const auto coeffA = startPoint.y() - endPoint.y();
+        const auto coeffB = endPoint.x() - startPoint.x();
+        return {.coeffA = coeffA,
+                .coeffB = coeffB,
+                .coeffC = coeffB * startPoint.y() + coeffA * startPoint.x(),
+                .minX = std::min(endPoint.x(), startPoint.x()),
+                .maxX = std::max(endPoint.x(), startPoint.x()),
+                .minY = std::min(endPoint.y(), startPoint.y()),
+                .maxY = std::max(endPoint.y(), startPoint.y()),
+                // The CSegment2D length, so a ray can be set up without constructing a CSegment2D.
+                .hasLength = std::sqrt(coeffB * coeffB + coeffA * coeffA) != 0};
+    }
+
+    SegmentLine lineOf(const CSegment2D & segment)
+    {
+        return lineOf(segment.startPoint(), segment.endPoint());
+    }
+
+    BlockerCoordinates::BlockerCoordinates(const std::vector<CSegment2D> & blockers)
+    {
+        for(auto * values : {&m_coeffA, &m_coeffB, &m_coeffC, &m_minX, &m_maxX, &m_minY, &m_maxY})
+        {
+            values->reserve(blockers.size());
+        }
+        for(const auto & blocker : blockers)
+        {
+            const auto line = lineOf(blocker);
+            m_coeffA.push_back(line.coeffA);
+            m_coeffB.push_back(line.coeffB);
+            m_coeffC.push_back(line.coeffC);
+            m_minX.push_back(line.minX);
+            m_maxX.push_back(line.maxX);
+            m_minY.push_back(line.minY);
+            m_maxY.push_back(line.maxY);
+        }
+    }
+
+    std::size_t BlockerCoordinates::size() const
+    {
+        return m_coeffA.size();
+    }
+
+    bool BlockerCoordinates::crossedBy(const SegmentLine & ray, const std::size_t idx) const
+    {
+        if(!ray.hasLength)
+        {
+            return false;
+        }
+
+        // CSegment2D::intersection with the ray as the first line.
+        const auto A1 = ray.coeffA;
+        const auto B1 = ray.coeffB;
+        const auto C1 = ray.coeffC;
+        const auto A2 = m_coeffA[idx];
+        const auto B2 = m_coeffB[idx];
+        const auto C2 = m_coeffC[idx];
+
+        auto x = 0.0;
+        auto y = 0.0;
+        if(std::abs(A1) > ViewerConstants::DISTANCE_TOLERANCE)
+        {
+            const auto t1 = C2 - C1 * A2 / A1;
+            const auto t2 = B2 - B1 * A2 / A1;
+            if(!(std::abs(t2) > ViewerConstants::DISTANCE_TOLERANCE))
+            {
+                return false;
+            }
+            y = t1 / t2;
+            x = (C1 - B1 * y) / A1;
+        }
+        else
+        {
+            y = C1 / B1;
+            x = (C2 - B2 * y) / A2;
+        }
+
+        return inRange(x, ray.minX, ray.maxX) && inRange(y, ray.minY, ray.maxY)
+               && inRange(x, m_minX[idx], m_maxX[idx]) && inRange(y, m_minY[idx], m_maxY[idx]);
+    }
+
+    bool BlockerCoordinates::anyCrossedBy(const SegmentLine & ray, const BlockerBatch & batch) const
+    {
+        if(!ray.hasLength || batch.count == 0u)
+        {
+            return false;
+        }
+
+        using Lanes = std::array<double, blockerBatchSize>;
+        Lanes A2{};
+        Lanes B2{};
+        Lanes C2{};
+        Lanes minX{};
+        Lanes maxX{};
+        Lanes minY{};
+        Lanes maxY{};
+        for(std::size_t lane = 0; lane < batch.count; ++lane)
+        {
+            const auto idx = batch.indices[lane];
+            A2[lane] = m_coeffA[idx];
+            B2[lane] = m_coeffB[idx];
+            C2[lane] = m_coeffC[idx];
+            minX[lane] = m_minX[idx];
+            maxX[lane] = m_maxX[idx];
+            minY[lane] = m_minY[idx];
+            maxY[lane] = m_maxY[idx];
+        }
+
+        // The choice between the two forms of CSegment2D::intersection depends on the ray
+        // only, so it is taken once for the whole batch.
+        const auto A1 = ray.coeffA;
+        const auto B1 = ray.coeffB;
+        const auto C1 = ray.coeffC;
+        Lanes x{};
+        Lanes y{};
+        std::array<bool, blockerBatchSize> solved{};
+        if(std::abs(A1) > ViewerConstants::DISTANCE_TOLERANCE)
+        {
+            for(std::size_t lane = 0; lane < blockerBatchSize; ++lane)
+            {
+                const auto t1 = C2[lane] - C1 * A2[lane] / A1;
+                const auto t2 = B2[lane] - B1 * A2[lane] / A1;
+                y[lane] = t1 / t2;
+                x[lane] = (C1 - B1 * y[lane]) / A1;
+                solved[lane] = std::abs(t2) > ViewerConstants::DISTANCE_TOLERANCE;
+            }
+        }
+        else
+        {
+            const auto yLine = C1 / B1;
+            for(std::size_t lane = 0; lane < blockerBatchSize; ++lane)
+            {
+                y[lane] = yLine;
+                x[lane] = (C2[lane] - B2[lane] * yLine) / A2[lane];
+                solved[lane] = true;
+            }
+        }
+
+        bool crossed = false;
+        for(std::size_t lane = 0; lane < blockerBatchSize; ++lane)
+        {
+            const bool hit = solved[lane] & (lane < batch.count)
+                             & inRangeLane(x[lane], ray.minX, ray.maxX)
+                             & inRangeLane(y[lane], ray.minY, ray.maxY)
+                             & inRangeLane(x[lane], minX[lane], maxX[lane])
+                             & inRangeLane(y[lane], minY[lane], maxY[lane]);
+            crossed |= hit;
+        }
+        return crossed;
+    }
+}   // namespace Viewer
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "Segment2D.hpp"
+
+namespace Viewer
+{
+    // A segment in the form CSegment2D::intersectionWithSegment works with: the line
+    // coeffA * x + coeffB * y = coeffC and the coordinate extent used by the range tests.
+    struct SegmentLine
+    {
+        double coeffA;
+        double coeffB;
+        double coeffC;
+        double minX;
+        double maxX;
+        double minY;
+        double maxY;
+        bool hasLength;
+    };
+
+    [[nodiscard]] SegmentLine lineOf(const CPoint2D & startPoint, const CPoint2D & endPoint);
+    [[nodiscard]] SegmentLine lineOf(const CSegment2D & segment);
+
+    // Blockers tested together by BlockerCoordinates::anyCrossedBy: four doubles are one AVX
+    // register and two SSE2/NEON registers.
+    constexpr std::size_t blockerBatchSize{4u};
+
+    // Up to blockerBatchSize blocker indices, collected by the candidate visitors.
+    struct BlockerBatch
+    {
+        std::array<std::size_t, blockerBatchSize> indices{};
+        std::size_t count{0u};
+
+        // Adds idx and returns true once the batch is full.
+        bool add(std::size_t idx)
+        {
+            indices[count++] = idx;
+            return count == indices.size();
+        }
+    };
+
+    // The blocker segments as a structure of arrays, so the blocking tests of the view-factor
+    // engine read a few flat coordinate arrays instead of whole CSegment2D objects. crossedBy
+    // uses exactly the arithmetic of CSegment2D::intersectionWithSegment and therefore gives the
+    // same answer bit for bit; the BlockerCoordinates tests compare the two.
+    class BlockerCoordinates
+    {
+    public:
+        explicit BlockerCoordinates(const std::vector<CSegment2D> & blockers);
+
+        [[nodiscard]] std::size_t size() const;
+
+        // Same as raySegment.intersectionWithSegment(blockers[idx]) for ray = lineOf(raySegment).
+        [[nodiscard]] bool crossedBy(const SegmentLine & ray, std::size_t idx) const;
+
+        // True if crossedBy holds for one of the blockers in batch. The lanes are evaluated
+        // without branches so the compiler can vectorise them; every lane performs the same
+        // operations as crossedBy, so the answer is identical to the scalar path. Both are built
+        // without multiply-add contraction (see Viewer/CMakeLists.txt) to keep it that way.
+        [[nodiscard]] bool anyCrossedBy(const SegmentLine & ray, const BlockerBatch & batch) const;
+
+    private:
+        std::vector<double> m_coeffA;
+        std::vector<double> m_coeffB;
+        std::vector<double> m_coeffC;
+        std::vector<double> m_minX;
+        std::vector<double> m_maxX;
+        std::vector<double> m_minY;
+        std::vector<double> m_maxY;
+    };
+}   // namespace Viewer
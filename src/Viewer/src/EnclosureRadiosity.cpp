@@ -0,0 +1,156 @@
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "EnclosureRadiosity.hpp"
+
+
+using namespace FenestrationCommon;
+
+namespace Viewer
+{
+    namespace
+    {
+        double blackBodyEmissivePower(const double temperature)
+        {
+            return ConstantsData::STEFANBOLTZMANN * std::pow(temperature, 4);
+        }
+
+        // Ratio of the smallest to the largest pivot below which the radiosity system of a block
+        // is treated as singular.
+        constexpr double singularPivotRatio{1e-10};
+
+        SquareMatrix radiosityMatrix(const SquareMatrix & viewFactors,
+                                     const std::vector<double> & reflectance)
+        {
+            const auto size = viewFactors.size();
+            SquareMatrix result{size};
+            for(std::size_t row = 0; row < size; ++row)
+            {
+                for(std::size_t col = 0; col < size; ++col)
+                {
+                    result(row, col) = -reflectance[row] * viewFactors(row, col);
+                }
+                result(row, row) += 1.0;
+            }
+            return result;
+        }
+    }   // namespace
+
+    EnclosureRadiosity::EnclosureRadiosity(const EnclosureViewFactorResult & viewFactors,
+                                           const std::vector<RadiationSegment> & segments,
+                                           std::set<std::size_t> openEnclosureIds) :
+        m_environmentViewFactor(viewFactors.environmentViewFactor)
+    {
+        if(segments.size() != viewFactors.size())
+        {
+            throw std::runtime_error(
+              "Number of radiation segments does not match the view factor result.");
+        }
+
+        m_emissivity.reserve(segments.size());
+        for(const auto & segment : segments)
+        {
+            if(segment.emissivity < 0.0 || segment.emissivity > 1.0)
+            {
+                throw std::runtime_error("Radiation segment emissivity must be between 0 and 1.");
+            }
+            m_emissivity.push_back(segment.emissivity);
+        }
+
+        m_blocks.reserve(viewFactors.blocks.size());
+        for(const auto & block : viewFactors.blocks)
+        {
+            std::vector<double> reflectance;
+            reflectance.reserve(block.segments.size());
+            for(const auto segment : block.segments)
+            {
+                reflectance.push_back(1.0 - m_emissivity[segment]);
+            }
+            LUFactor factor{radiosityMatrix(block.viewFactors, reflectance)};
+            if(!(factor.smallestPivot() > singularPivotRatio * factor.largestPivot()))
+            {
+                throw std::runtime_error(
+                  "Radiosity system of enclosure " + std::to_string(block.enclosureId)
+                  + " is singular. A closed enclosure needs a segment with nonzero emissivity.");
+            }
+            m_blocks.push_back({.segments = block.segments,
+                                .viewFactors = block.viewFactors,
+                                .factor = std::move(factor),
+                                .open = openEnclosureIds.contains(block.enclosureId)});
+        }
+    }
+
+    RadiositySolution EnclosureRadiosity::solve(const std::vector<double> & temperatures,
+                                                const double environmentTemperature) const
+    {
+        auto solutions =
+          solve(std::vector<std::vector<double>>{temperatures}, environmentTemperature);
+        return std::move(solutions.front());
+    }
+
+    std::vector<RadiositySolution>
+      EnclosureRadiosity::solve(const std::vector<std::vector<double>> & temperatureStates,
+                                const double environmentTemperature) const
+    {
+        const auto segmentCount = m_emissivity.size();
+        for(const auto & temperatures : temperatureStates)
+        {
+            if(temperatures.size() != segmentCount)
+            {
+                throw std::runtime_error(
+                  "Number of temperatures does not match the number of radiation segments.");
+            }
+        }
+
+        const auto environmentPower = blackBodyEmissivePower(environmentTemperature);
+        std::vector<RadiositySolution> result(
+          temperatureStates.size(),
+          RadiositySolution{.radiosity = std::vector<double>(segmentCount, 0.0),
+                            .netHeatFlux = std::vector<double>(segmentCount, 0.0)});
+
+        for(const auto & block : m_blocks)
+        {
+            const auto & members = block.segments;
+            const auto environmentFactor = [&](const std::size_t row) {
+                return block.open ? m_environmentViewFactor[members[row]] : 0.0;
+            };
+
+            std::vector<std::vector<double>> rightHandSides;
+            rightHandSides.reserve(temperatureStates.size());
+            for(const auto & temperatures : temperatureStates)
+            {
+                std::vector<double> rightHandSide(members.size());
+                for(std::size_t row = 0; row < members.size(); ++row)
+                {
+                    const auto emissivity = m_emissivity[members[row]];
+                    rightHandSide[row] =
+                      emissivity * blackBodyEmissivePower(temperatures[members[row]])
+                      + (1.0 - emissivity) * environmentFactor(row) * environmentPower;
+                }
+                rightHandSides.push_back(std::move(rightHandSide));
+            }
+
+            const auto radiosities = block.factor.solve(rightHandSides);
+
+            for(std::size_t state = 0; state < temperatureStates.size(); ++state)
+            {
+                const auto & radiosity = radiosities[state];
+                for(std::size_t row = 0; row < members.size(); ++row)
+                {
+                    // Irradiation G = sum(F * J) + F_env * E_env; the net flux is J - G.
+                    double irradiation = environmentFactor(row) * environmentPower;
+                    for(std::size_t col = 0; col < members.size(); ++col)
+                    {
+                        irradiation += block.viewFactors(row, col) * radiosity[col];
+                    }
+                    result[state].radiosity[members[row]] = radiosity[row];
+                    result[state].netHeatFlux[members[row]] = radiosity[row] - irradiation;
+                }
+            }
+        }
+
+        return result;
+    }
+}   // namespace Viewer
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <set>
+#include <vector>
+
+#include <WCECommon.hpp>
+
+#include "EnclosureViewFactorInput.hpp"
+#include "EnclosureViewFactors.hpp"
+
+namespace Viewer
+{
+    // Radiosity and net radiative heat flux of every radiation segment, in input order. The net
+    // heat flux is positive when the surface emits more than it absorbs.
+    struct RadiositySolution
+    {
+        std::vector<double> radiosity;     // [W/m2]
+        std::vector<double> netHeatFlux;   // [W/m2]
+    };
+
+    // Net-radiation solve for gray, diffuse enclosures on top of computeEnclosureViewFactors.
+    // Each enclosure block is solved on its own: (I - diag(1 - emissivity) * F) J = emissivity *
+    // sigma * T^4. The matrix depends on geometry and emissivity only, so it is factorized once in
+    // the constructor; new temperatures reuse the factorizations, and many temperature states are
+    // solved together as one multi right-hand-side system. Segments of the enclosures listed in
+    // openEnclosureIds also exchange with a black environment through environmentViewFactor; for
+    // closed enclosures that value is only the closure residual and is ignored.
+    //
+    // A closed enclosure whose segments are all perfect reflectors has no unique solution and
+    // the constructor throws. The check compares the smallest pivot of the factorization with the
+    // largest one, which is cheaper than a condition number but only a bound on it: enclosures
+    // with very small, nonzero total emissivity pass and lose accuracy roughly in proportion to
+    // that ratio.
+    class EnclosureRadiosity
+    {
+    public:
+        EnclosureRadiosity(const EnclosureViewFactorResult & viewFactors,
+                           const std::vector<RadiationSegment> & segments,
+                           std::set<std::size_t> openEnclosureIds = {});
+
+        // Surface temperatures [K] in segment order. The environment temperature [K] is seen by
+        // the open enclosures only.
+        [[nodiscard]] RadiositySolution solve(const std::vector<double> & temperatures,
+                                              double environmentTemperature = 0.0) const;
+
+        // One solution per temperature state, all solved against the same factorizations.
+        [[nodiscard]] std::vector<RadiositySolution>
+          solve(const std::vector<std::vector<double>> & temperatureStates,
+                double environmentTemperature = 0.0) const;
+
+    private:
+        struct Block
+        {
+            std::vector<std::size_t> segments;
+            FenestrationCommon::SquareMatrix viewFactors;
+            FenestrationCommon::LUFactor factor;
+            bool open;
+        };
+
+        std::vector<Block> m_blocks;
+        std::vector<double> m_emissivity;
+        std::vector<double> m_environmentViewFactor;
+    };
+}   // namespace Viewer
@@ -30,6 +30,15 @@ namespace Viewer
         CPoint2D endPoint;
     };
 
+    // Spatial index that narrows the third-surface blocking tests to the blockers near a segment
+    // pair. Both give the same view factors. The hierarchy adapts to blockers clustered in thin
+    // regions with large empty areas (frame cavities), where uniform cells stay crowded.
+    enum class BlockerIndex
+    {
+        UniformGrid,
+        BoundingVolumeHierarchy
+    };
+
     // Tuning for computeEnclosureViewFactors. The defaults reproduce the legacy behavior:
     // closed enclosures, no smoothing, and the legacy subdivision count.
     struct ViewFactorOptions
@@ -48,7 +57,13 @@ namespace Viewer
         // Spatial-grid density; empty means auto-pick from the blocker count.
         std::optional<std::size_t> gridCellsPerAxis{};
 
+        // Blocker index for the pair loop; gridCellsPerAxis applies to the uniform grid only.
+        BlockerIndex blockerIndex{BlockerIndex::UniformGrid};
+
         // Parallelize the pair loop; false forces a deterministic serial run.
         bool multithread{true};
+
+        // Worker threads of the parallel pair loop; empty means one per hardware thread.
+        std::optional<std::size_t> threadCount{};
     };
 }   // namespace Viewer
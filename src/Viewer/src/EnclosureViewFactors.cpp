@@ -1,8 +1,17 @@
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <initializer_list>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
+#include "BlockerBVH.hpp"
+#include "BlockerCoordinates.hpp"
 #include "EnclosureViewFactors.hpp"
 #include "SpatialGrid.hpp"
 #include "ViewFactorClosure.hpp"
@@ -16,7 +25,8 @@ using namespace FenestrationCommon;
 // CGeometry2D::checkViewFactors exactly (cross-string for clear pairs, subdivision for
 // partially shadowed/blocked pairs), but it is built on the pure Viewer::detail free functions
 // and supports multiple enclosures and an explicit blocker list. The EnclosureViewFactorsParity
-// tests pin it to CGeometry2D. The spatial grid and threading land in later steps.
+// tests pin it to CGeometry2D. Segments are grouped by enclosure up front and every enclosure
+// is evaluated and stored as its own dense block.
 namespace Viewer
 {
     namespace
@@ -54,102 +64,173 @@ namespace Viewer
                     .maxY = std::max(yCoords)};
         }
 
-        // CGeometry2D::pointInSegmentsView, over plain CSegment2D.
-        bool pointInSegmentsView(const CSegment2D & segmentA,
-                                 const CSegment2D & segmentB,
-                                 const CPoint2D & point)
+        // Blocker segments together with their coordinate arrays for the intersection tests.
+        struct Blockers
         {
-            std::vector<CSegment2D> polygon;
-            polygon.push_back(segmentA);
-            const CSegment2D side2{segmentA.endPoint(), segmentB.startPoint()};
-            if(side2.length() > 0)
+            const std::vector<CSegment2D> & segments;
+            const BlockerCoordinates & coordinates;
+        };
+
+        // The seg1-seg2 polygon of CGeometry2D::pointInSegmentsView, built once per pair in
+        // fixed storage. Zero-length connecting sides are left out, as in CGeometry2D.
+        class SegmentsView
+        {
+        public:
+            SegmentsView(const CSegment2D & segmentA, const CSegment2D & segmentB)
             {
-                polygon.push_back(side2);
+                add(segmentA);
+                addSide(segmentA.endPoint(), segmentB.startPoint());
+                add(segmentB);
+                addSide(segmentB.endPoint(), segmentA.startPoint());
             }
-            polygon.push_back(segmentB);
-            const CSegment2D side4{segmentB.endPoint(), segmentA.startPoint()};
-            if(side4.length() > 0)
+
+            [[nodiscard]] bool contains(const CPoint2D & point) const
             {
-                polygon.push_back(side4);
+                return std::all_of(
+                  m_edges.begin(),
+                  m_edges.begin() + static_cast<std::ptrdiff_t>(m_count),
+                  [&](const CSegment2D & edge) {
+                      return detail::pointPosition(edge, point) == PointPosition::Visible;
+                  });
             }
 
-            return std::ranges::all_of(polygon, [&](const CSegment2D & edge) {
-                return detail::pointPosition(edge, point) == PointPosition::Visible;
-            });
+        private:
+            void add(const CSegment2D & edge)
+            {
+                m_edges[m_count++] = edge;
+            }
+
+            void addSide(const CPoint2D & from, const CPoint2D & to)
+            {
+                const CSegment2D side{from, to};
+                if(side.length() > 0)
+                {
+                    add(side);
+                }
+            }
+
+            std::array<CSegment2D, 4> m_edges{};
+            std::size_t m_count{0u};
+        };
+
+        // Grid: any candidate of the pair's bounding box for which blocks holds.
+        template<typename Predicate>
+        bool anyBlockerAlong(const SpatialGrid & grid,
+                             const CSegment2D &,
+                             const Bounds & bounds,
+                             Predicate && blocks)
+        {
+            return grid.anyInBoundingBox(
+              bounds.minX, bounds.minY, bounds.maxX, bounds.maxY, blocks);
+        }
+
+        // Hierarchy: only the blockers whose boxes the ray itself crosses.
+        template<typename Predicate>
+        bool anyBlockerAlong(const BlockerBVH & bvh,
+                             const CSegment2D & ray,
+                             const Bounds &,
+                             Predicate && blocks)
+        {
+            return bvh.anyAlongSegment(ray, blocks);
         }
 
         // CGeometry2D::thirdSurfaceShadowing (full test on the connecting rays), restricted to the
-        // grid candidates for the pair's bounding box.
+        // index candidates for the pair's bounding box. Rays and polygon live on the stack.
+        template<typename Index>
         bool thirdSurfaceShadowing(const CSegment2D & segmentA,
                                    const CSegment2D & segmentB,
-                                   const std::vector<CSegment2D> & blockers,
-                                   const SpatialGrid & grid)
+                                   const Blockers & blockers,
+                                   const Index & index)
         {
-            std::vector<CSegment2D> rays;
-            const CSegment2D r11{segmentA.startPoint(), segmentB.endPoint()};
-            if(r11.length() > 0)
+            std::array<SegmentLine, 2> rays{};
+            std::size_t rayCount{0u};
+            for(const auto & ray : {lineOf(segmentA.startPoint(), segmentB.endPoint()),
+                                    lineOf(segmentA.endPoint(), segmentB.startPoint())})
             {
-                rays.push_back(r11);
-            }
-            const CSegment2D r22{segmentA.endPoint(), segmentB.startPoint()};
-            if(r22.length() > 0)
-            {
-                rays.push_back(r22);
+                if(ray.hasLength)
+                {
+                    rays[rayCount++] = ray;
+                }
             }
-            if(rays.empty())
+            if(rayCount == 0u)
             {
                 return false;
             }
 
-            const auto bounds = pairBounds(segmentA, segmentB);
-            const auto candidates =
-              grid.candidatesForBoundingBox(bounds.minX, bounds.minY, bounds.maxX, bounds.maxY);
-
-            const auto blocks = [&](const std::size_t idx) {
-                const auto & blocker = blockers[idx];
-                if(blocker == segmentA || blocker == segmentB)
+            // Candidates are tested against the rays a batch at a time; only a batch that no ray
+            // crosses goes on to the polygon test.
+            const SegmentsView view{segmentA, segmentB};
+            BlockerBatch batch;
+            const auto batchBlocks = [&] {
+                bool blocked = false;
+                for(std::size_t ray = 0; ray < rayCount && !blocked; ++ray)
                 {
-                    return false;
+                    blocked = blockers.coordinates.anyCrossedBy(rays[ray], batch);
                 }
-                const auto crossesRay = [&](const CSegment2D & ray) {
-                    return ray.intersectionWithSegment(blocker);
-                };
-                return std::ranges::any_of(rays, crossesRay)
-                       || pointInSegmentsView(segmentA, segmentB, blocker.startPoint())
-                       || pointInSegmentsView(segmentA, segmentB, blocker.endPoint());
+                for(std::size_t lane = 0; lane < batch.count && !blocked; ++lane)
+                {
+                    const auto & blocker = blockers.segments[batch.indices[lane]];
+                    blocked =
+                      view.contains(blocker.startPoint()) || view.contains(blocker.endPoint());
+                }
+                batch.count = 0u;
+                return blocked;
             };
 
-            return std::ranges::any_of(candidates, blocks);
+            const auto bounds = pairBounds(segmentA, segmentB);
+            const auto found = index.anyInBoundingBox(
+              bounds.minX, bounds.minY, bounds.maxX, bounds.maxY, [&](const std::size_t idx) {
+                  const auto & blocker = blockers.segments[idx];
+                  if(blocker == segmentA || blocker == segmentB)
+                  {
+                      return false;
+                  }
+                  return batch.add(idx) && batchBlocks();
+              });
+            return found || batchBlocks();
         }
 
         // CGeometry2D::thirdSurfaceShadowingSimple (center-line test, used while subdividing),
-        // restricted to the grid candidates for the pair's bounding box.
+        // restricted to the index candidates along the center line and tested in batches.
+        template<typename Index>
         bool thirdSurfaceShadowingSimple(const CSegment2D & segmentA,
                                          const CSegment2D & segmentB,
-                                         const std::vector<CSegment2D> & blockers,
-                                         const SpatialGrid & grid)
+                                         const Blockers & blockers,
+                                         const Index & index)
         {
             const CSegment2D centerLine{segmentA.centerPoint(), segmentB.centerPoint()};
+            const auto line = lineOf(centerLine);
             const auto bounds = pairBounds(segmentA, segmentB);
-            const auto candidates =
-              grid.candidatesForBoundingBox(bounds.minX, bounds.minY, bounds.maxX, bounds.maxY);
 
-            return std::ranges::any_of(candidates, [&](const std::size_t idx) {
-                const auto & blocker = blockers[idx];
-                return blocker != segmentA && blocker != segmentB
-                       && centerLine.intersectionWithSegment(blocker);
-            });
+            BlockerBatch batch;
+            const auto batchBlocks = [&] {
+                const auto blocked = blockers.coordinates.anyCrossedBy(line, batch);
+                batch.count = 0u;
+                return blocked;
+            };
+
+            const auto visit = [&](const std::size_t idx) {
+                const auto & blocker = blockers.segments[idx];
+                return blocker != segmentA && blocker != segmentB && batch.add(idx)
+                       && batchBlocks();
+            };
+            const auto found = anyBlockerAlong(index, centerLine, bounds, visit);
+            return found || batchBlocks();
         }
 
-        // CGeometry2D::viewFactorCoeff (subdivision path for partial / blocked pairs).
+        // CGeometry2D::viewFactorCoeff (subdivision path for partial / blocked pairs). The
+        // sub-segments go to per-thread scratch vectors that keep their capacity between pairs.
+        template<typename Index>
         double subdividedCoefficient(const CSegment2D & segmentA,
                                      const CSegment2D & segmentB,
-                                     const std::vector<CSegment2D> & blockers,
-                                     const SpatialGrid & grid,
+                                     const Blockers & blockers,
+                                     const Index & index,
                                      const std::size_t subdivision)
         {
-            const auto subsA = detail::subdivide(segmentA, subdivision);
-            const auto subsB = detail::subdivide(segmentB, subdivision);
+            thread_local std::vector<CSegment2D> subsA;
+            thread_local std::vector<CSegment2D> subsB;
+            detail::subdivide(segmentA, subdivision, subsA);
+            detail::subdivide(segmentB, subdivision, subsB);
 
             double coefficient = 0.0;
             for(const auto & subA : subsA)
@@ -157,7 +238,7 @@ namespace Viewer
                 for(const auto & subB : subsB)
                 {
                     if(detail::selfShadow(subA, subB) == Shadowing::No
-                       && !thirdSurfaceShadowingSimple(subA, subB, blockers, grid))
+                       && !thirdSurfaceShadowingSimple(subA, subB, blockers, index))
                     {
                         coefficient += detail::crossStringCoefficient(subA, subB);
                     }
@@ -167,12 +248,14 @@ namespace Viewer
             return coefficient < ViewerConstants::MIN_VIEW_COEFF ? 0.0 : coefficient;
         }
 
-        // Raw cross-string coefficient for one pair (CGeometry2D::checkViewFactors body).
-        double pairCoefficient(const CSegment2D & segmentA,
-                               const CSegment2D & segmentB,
-                               const std::vector<CSegment2D> & blockers,
-                               const SpatialGrid & grid,
-                               const std::size_t subdivision)
+        // Raw cross-string coefficient for one pair (CGeometry2D::checkViewFactors body) when it
+        // needs no subdivision: zero for a totally self-shadowed pair and the plain cross-string
+        // value for a clear one. Empty when the pair has to go through subdividedCoefficient.
+        template<typename Index>
+        std::optional<double> directCoefficient(const CSegment2D & segmentA,
+                                                const CSegment2D & segmentB,
+                                                const Blockers & blockers,
+                                                const Index & index)
         {
             const auto shadow = detail::selfShadow(segmentA, segmentB);
             if(shadow == Shadowing::Total)
@@ -180,12 +263,12 @@ namespace Viewer
                 return 0.0;
             }
 
-            const auto blocked = thirdSurfaceShadowing(segmentA, segmentB, blockers, grid);
+            const auto blocked = thirdSurfaceShadowing(segmentA, segmentB, blockers, index);
             if(!blocked && shadow == Shadowing::No)
             {
                 return detail::crossStringCoefficient(segmentA, segmentB);
             }
-            return subdividedCoefficient(segmentA, segmentB, blockers, grid, subdivision);
+            return std::nullopt;
         }
 
         std::vector<EngineSegment> buildSegments(const std::vector<RadiationSegment> & segments)
@@ -220,25 +303,309 @@ namespace Viewer
             return result;
         }
 
-        // Per-row deficit (1 - row sum). For an open enclosure this is the view factor to the
-        // environment; for a closed enclosure it is the small closure residual.
-        std::vector<double> environmentViewFactors(const SquareMatrix & viewFactors)
+        // Groups the segments into one empty block per enclosure, ordered by enclosure id, with
+        // the members in input order.
+        std::vector<EnclosureViewFactorBlock>
+          groupByEnclosure(const std::vector<EngineSegment> & segments)
+        {
+            std::map<std::size_t, std::vector<std::size_t>> groups;
+            for(std::size_t idx = 0; idx < segments.size(); ++idx)
+            {
+                groups[segments[idx].enclosureId].push_back(idx);
+            }
+
+            std::vector<EnclosureViewFactorBlock> result;
+            result.reserve(groups.size());
+            for(auto & [enclosureId, members] : groups)
+            {
+                const auto size = members.size();
+                result.push_back({.enclosureId = enclosureId,
+                                  .segments = std::move(members),
+                                  .viewFactors = SquareMatrix{size}});
+            }
+            return result;
+        }
+
+        SpatialGrid buildGrid(const std::vector<CSegment2D> & blockers,
+                              const ViewFactorOptions & options)
+        {
+            const auto cellsPerAxis = options.gridCellsPerAxis.value_or(
+              SpatialGrid::suggestCellsPerAxis(blockers.size()));
+            return SpatialGrid::build(blockers, cellsPerAxis);
+        }
+
+        // One selected pair of an enclosure block, by position within the block.
+        struct PairTask
+        {
+            std::size_t block;
+            std::size_t row;
+            std::size_t col;
+        };
+
+        // Pairs per task of the first pass. A pair that needs no subdivision costs a handful of
+        // intersection tests, so such pairs are grouped to keep the scheduling overhead small.
+        constexpr std::size_t pairsPerTile{32u};
+
+        // The pair with the given number, where firstPair holds the number of the first pair of
+        // every block. Empty blocks share their number with the next block, so upper_bound
+        // lands on the block that actually holds the pair.
+        PairTask pairAt(const std::vector<EnclosureViewFactorBlock> & blocks,
+                        const std::vector<std::size_t> & firstPair,
+                        const std::size_t number)
+        {
+            const auto block = static_cast<std::size_t>(
+              std::ranges::upper_bound(firstPair, number) - firstPair.begin() - 1);
+            const auto size = blocks[block].segments.size();
+            const auto local = number - firstPair[block];
+
+            // Number of the first pair of row within the block.
+            const auto rowStart = [size](const std::size_t row) {
+                return row * (2u * size - row - 1u) / 2u;
+            };
+            std::size_t lower{0u};
+            std::size_t upper{size - 1u};
+            while(upper - lower > 1u)
+            {
+                const auto middle = (lower + upper) / 2u;
+                if(rowStart(middle) <= local)
+                {
+                    lower = middle;
+                }
+                else
+                {
+                    upper = middle;
+                }
+            }
+            return {.block = block, .row = lower, .col = lower + 1u + local - rowStart(lower)};
+        }
+
+        // Moves pair to the next pair in numbering order. Past the last pair it is left pointing
+        // behind the blocks, which callers never read.
+        void nextPair(const std::vector<EnclosureViewFactorBlock> & blocks, PairTask & pair)
+        {
+            const auto size = blocks[pair.block].segments.size();
+            if(++pair.col < size)
+            {
+                return;
+            }
+            if(++pair.row + 1u < size)
+            {
+                pair.col = pair.row + 1u;
+                return;
+            }
+            do
+            {
+                ++pair.block;
+            } while(pair.block < blocks.size() && blocks[pair.block].segments.size() < 2u);
+            pair.row = 0u;
+            pair.col = 1u;
+        }
+
+        template<typename Task>
+        void runTasks(const std::size_t count, const ViewFactorOptions & options, Task && task)
+        {
+            if(options.multithread && count > 1u)
+            {
+                FenestrationCommon::executeInParallelDynamic<std::size_t>(
+                  count, task, options.threadCount.value_or(0u));
+                return;
+            }
+            for(std::size_t idx = 0; idx < count; ++idx)
+            {
+                task(idx);
+            }
+        }
+
+        // Evaluates the upper-triangle pairs of all blocks that isSelected accepts (by input
+        // index) and writes them together with their mirrors. Returns the number of evaluated
+        // pairs.
+        //
+        // Pair costs are very uneven: rows near the top of the triangle hold the most pairs, and
+        // a partially shadowed or blocked pair costs subdivision^2 center-line tests. Work is
+        // therefore scheduled per pair, not per row, in two dynamically scheduled passes. The
+        // first pass runs over tiles of pairs and finishes the ones that need no subdivision;
+        // the second runs every deferred pair as its own task. Each pair writes only its cell and
+        // the mirror, so both passes are race-free without locks, and every coefficient comes
+        // from the same code - the result does not depend on the schedule or the thread count.
+        template<typename Index, typename Selected>
+        std::size_t computeBlocks(std::vector<EnclosureViewFactorBlock> & blocks,
+                                  const std::vector<EngineSegment> & segments,
+                                  const std::vector<CSegment2D> & blockerSegments,
+                                  const Index & index,
+                                  const ViewFactorOptions & options,
+                                  Selected && isSelected)
+        {
+            const BlockerCoordinates coordinates{blockerSegments};
+            const Blockers blockers{.segments = blockerSegments, .coordinates = coordinates};
+
+            // Upper-triangle pairs are numbered block after block, row-major within a block, and
+            // tiles are ranges of these numbers. A tile finds its first pair from the number, so
+            // no list of all pairs is kept; only the deferred pairs are collected.
+            std::vector<std::size_t> firstPair{0u};
+            firstPair.reserve(blocks.size() + 1u);
+            for(const auto & block : blocks)
+            {
+                const auto size = block.segments.size();
+                firstPair.push_back(firstPair.back() + (size < 2u ? 0u : size * (size - 1u) / 2u));
+            }
+            const auto totalPairs = firstPair.back();
+
+            const auto segmentsOf = [&](const PairTask & pair) {
+                const auto & members = blocks[pair.block].segments;
+                return std::pair<const EngineSegment &, const EngineSegment &>{
+                  segments[members[pair.row]], segments[members[pair.col]]};
+            };
+            const auto isSelectedPair = [&](const PairTask & pair) {
+                const auto & members = blocks[pair.block].segments;
+                return isSelected(members[pair.row], members[pair.col]);
+            };
+            const auto store = [&](const PairTask & pair, const double coefficient) {
+                const auto [segmentRow, segmentCol] = segmentsOf(pair);
+                auto & viewFactors = blocks[pair.block].viewFactors;
+                viewFactors(pair.row, pair.col) = coefficient / (2.0 * segmentRow.length);
+                viewFactors(pair.col, pair.row) = coefficient / (2.0 * segmentCol.length);
+            };
+
+            std::atomic<std::size_t> evaluated{0u};
+            std::mutex deferredMutex;
+            std::vector<PairTask> deferred;
+            const auto tiles = (totalPairs + pairsPerTile - 1u) / pairsPerTile;
+            runTasks(tiles, options, [&](const std::size_t tile) {
+                const auto first = tile * pairsPerTile;
+                const auto count = std::min(totalPairs - first, pairsPerTile);
+                auto pair = pairAt(blocks, firstPair, first);
+
+                std::array<PairTask, pairsPerTile> tileDeferred{};
+                std::size_t deferredCount{0u};
+                std::size_t selectedCount{0u};
+                for(std::size_t step = 0; step < count; ++step, nextPair(blocks, pair))
+                {
+                    if(!isSelectedPair(pair))
+                    {
+                        continue;
+                    }
+                    ++selectedCount;
+                    const auto [segmentRow, segmentCol] = segmentsOf(pair);
+                    const auto coefficient = directCoefficient(
+                      segmentRow.geometry, segmentCol.geometry, blockers, index);
+                    if(coefficient.has_value())
+                    {
+                        store(pair, coefficient.value());
+                    }
+                    else
+                    {
+                        tileDeferred[deferredCount++] = pair;
+                    }
+                }
+
+                evaluated += selectedCount;
+                if(deferredCount > 0u)
+                {
+                    std::lock_guard lock(deferredMutex);
+                    deferred.insert(
+                      deferred.end(), tileDeferred.begin(), tileDeferred.begin() + deferredCount);
+                }
+            });
+
+            // The order of the deferred pairs depends on the schedule, but every pair writes only
+            // its own cells, so the result does not.
+            runTasks(deferred.size(), options, [&](const std::size_t task) {
+                const auto & pair = deferred[task];
+                const auto [segmentRow, segmentCol] = segmentsOf(pair);
+                store(pair,
+                      subdividedCoefficient(segmentRow.geometry,
+                                            segmentCol.geometry,
+                                            blockers,
+                                            index,
+                                            options.subdivision));
+            });
+
+            return evaluated.load();
+        }
+
+        // Reciprocity is implicit (one coefficient feeds both off-diagonal entries). Optional
+        // least-squares smoothing closes the closed enclosures (rows -> 1); open enclosures keep
+        // their deficit as the environment view factor, the per-row (1 - row sum).
+        EnclosureViewFactorResult finalizeResult(std::vector<EnclosureViewFactorBlock> blocks,
+                                                 const std::vector<EngineSegment> & segments,
+                                                 const ViewFactorOptions & options)
         {
-            const auto size = viewFactors.size();
-            std::vector<double> result(size, 0.0);
-            for(std::size_t row = 0; row < size; ++row)
+            EnclosureViewFactorResult result{
+              .blocks = {},
+              .locations = std::vector<EnclosureViewFactorResult::Location>(segments.size()),
+              .environmentViewFactor = std::vector<double>(segments.size(), 0.0)};
+
+            for(std::size_t blockIndex = 0; blockIndex < blocks.size(); ++blockIndex)
             {
-                double sum = 0.0;
-                for(std::size_t col = 0; col < size; ++col)
+                auto & block = blocks[blockIndex];
+                const auto size = block.segments.size();
+                if(options.leastSquaresSmoothing)
                 {
-                    sum += viewFactors(row, col);
+                    std::vector<double> areas;
+                    areas.reserve(size);
+                    for(const auto member : block.segments)
+                    {
+                        areas.push_back(segments[member].length);
+                    }
+                    block.viewFactors =
+                      smoothViewFactors(block.viewFactors,
+                                        areas,
+                                        std::vector<std::size_t>(size, block.enclosureId),
+                                        options.openEnclosureIds);
+                }
+
+                for(std::size_t row = 0; row < size; ++row)
+                {
+                    double sum = 0.0;
+                    for(std::size_t col = 0; col < size; ++col)
+                    {
+                        sum += block.viewFactors(row, col);
+                    }
+                    result.environmentViewFactor[block.segments[row]] = 1.0 - sum;
+                    result.locations[block.segments[row]] = {.block = blockIndex, .position = row};
                 }
-                result[row] = 1.0 - sum;
             }
+            result.blocks = std::move(blocks);
+
             return result;
         }
+
+        constexpr auto allPairs = [](std::size_t, std::size_t) { return true; };
     }   // namespace
 
+    std::size_t EnclosureViewFactorResult::size() const
+    {
+        return locations.size();
+    }
+
+    double EnclosureViewFactorResult::viewFactor(const std::size_t row,
+                                                 const std::size_t col) const
+    {
+        const auto & from = locations.at(row);
+        const auto & to = locations.at(col);
+        if(from.block != to.block)
+        {
+            return 0.0;
+        }
+        return blocks[from.block].viewFactors(from.position, to.position);
+    }
+
+    SquareMatrix EnclosureViewFactorResult::denseViewFactors() const
+    {
+        SquareMatrix result{size()};
+        for(const auto & block : blocks)
+        {
+            for(std::size_t row = 0; row < block.segments.size(); ++row)
+            {
+                for(std::size_t col = 0; col < block.segments.size(); ++col)
+                {
+                    result(block.segments[row], block.segments[col]) = block.viewFactors(row, col);
+                }
+            }
+        }
+        return result;
+    }
+
     EnclosureViewFactorResult
     computeEnclosureViewFactors(const std::vector<RadiationSegment> & segments,
                                 const std::vector<BlockingSegment> & blockers,
@@ -246,65 +613,132 @@ namespace Viewer
     {
         const auto engineSegments = buildSegments(segments);
         const auto blockerSegments = buildBlockers(engineSegments, blockers);
-        const auto cellsPerAxis = options.gridCellsPerAxis.value_or(
-          SpatialGrid::suggestCellsPerAxis(blockerSegments.size()));
-        const auto grid = SpatialGrid::build(blockerSegments, cellsPerAxis);
-        const auto size = engineSegments.size();
-
-        SquareMatrix viewFactors{size};
-
-        // Each row is independent and writes only its own upper-triangle cells (row, col) and
-        // their mirror (col, row) for col > row, so distinct rows touch disjoint cells - the
-        // parallel pass is race-free without locks (the matrix is pre-sized and never resized).
-        const auto computeRow = [&](const std::size_t row) {
-            for(std::size_t col = row + 1; col < size; ++col)
-            {
-                if(engineSegments[row].enclosureId != engineSegments[col].enclosureId)
-                {
-                    continue;
-                }
+        auto blocks = groupByEnclosure(engineSegments);
 
-                const auto coefficient = pairCoefficient(engineSegments[row].geometry,
-                                                          engineSegments[col].geometry,
-                                                          blockerSegments,
-                                                          grid,
-                                                          options.subdivision);
-                viewFactors(row, col) = coefficient / (2.0 * engineSegments[row].length);
-                viewFactors(col, row) = coefficient / (2.0 * engineSegments[col].length);
-            }
-        };
-
-        if(options.multithread && size > 1)
+        if(options.blockerIndex == BlockerIndex::BoundingVolumeHierarchy)
         {
-            FenestrationCommon::executeInParallel<std::size_t>(0, size - 1, computeRow);
+            const auto bvh = BlockerBVH::build(blockerSegments);
+            computeBlocks(blocks, engineSegments, blockerSegments, bvh, options, allPairs);
         }
         else
         {
-            for(std::size_t row = 0; row < size; ++row)
+            const auto grid = buildGrid(blockerSegments, options);
+            computeBlocks(blocks, engineSegments, blockerSegments, grid, options, allPairs);
+        }
+
+        return finalizeResult(std::move(blocks), engineSegments, options);
+    }
+
+    IncrementalEnclosureViewFactors::IncrementalEnclosureViewFactors(
+      std::vector<RadiationSegment> segments,
+      const std::vector<BlockingSegment> & blockers,
+      ViewFactorOptions options) :
+        m_segments(std::move(segments)),
+        m_options(std::move(options)),
+        m_blockers(buildBlockers(buildSegments(m_segments), blockers)),
+        m_grid(buildGrid(m_blockers, m_options))
+    {
+        const auto engineSegments = buildSegments(m_segments);
+        m_rawBlocks = groupByEnclosure(engineSegments);
+        m_recomputedPairs =
+          computeBlocks(m_rawBlocks, engineSegments, m_blockers, m_grid, m_options, allPairs);
+        m_result = finalizeResult(m_rawBlocks, engineSegments, m_options);
+    }
+
+    const EnclosureViewFactorResult & IncrementalEnclosureViewFactors::result() const
+    {
+        return m_result;
+    }
+
+    const std::vector<RadiationSegment> & IncrementalEnclosureViewFactors::segments() const
+    {
+        return m_segments;
+    }
+
+    std::size_t IncrementalEnclosureViewFactors::recomputedPairs() const
+    {
+        return m_recomputedPairs;
+    }
+
+    const EnclosureViewFactorResult &
+      IncrementalEnclosureViewFactors::update(const std::vector<SegmentChange> & changes)
+    {
+        // Cells touched by the moved segments before and after the move. A pair whose grid
+        // candidates do not reach any of them keeps exactly the same blocker set.
+        // m_blockers continues with the explicit blockers, so it cannot be used for the check.
+        for(const auto & change : changes)
+        {
+            if(change.index >= m_segments.size())
             {
-                computeRow(row);
+                throw std::out_of_range(
+                  "IncrementalEnclosureViewFactors::update: segment index out of range.");
             }
         }
 
-        // Reciprocity is implicit (one coefficient feeds both off-diagonal entries). Optional
-        // least-squares smoothing closes the closed enclosures (rows -> 1); open enclosures keep
-        // their deficit as the environment view factor.
-        if(options.leastSquaresSmoothing)
+        std::vector<bool> moved(m_segments.size(), false);
+        std::vector<SpatialGrid::CellRange> touchedCells;
+        for(const auto & change : changes)
         {
-            std::vector<double> areas;
-            std::vector<std::size_t> enclosureIds;
-            areas.reserve(size);
-            enclosureIds.reserve(size);
-            for(const auto & segment : engineSegments)
+            const auto & oldSegment = m_blockers[change.index];
+            const CSegment2D newSegment{change.segment.startPoint, change.segment.endPoint};
+            touchedCells.push_back(m_grid.cellsForSegment(oldSegment));
+            touchedCells.push_back(m_grid.cellsForSegment(newSegment));
+            m_grid.moveBlocker(change.index, oldSegment, newSegment);
+
+            m_blockers[change.index] = newSegment;
+            m_segments[change.index] = change.segment;
+            moved[change.index] = true;
+        }
+
+        const auto engineSegments = buildSegments(m_segments);
+        std::vector<SpatialGrid::CellRange> segmentCells;
+        segmentCells.reserve(engineSegments.size());
+        for(const auto & segment : engineSegments)
+        {
+            segmentCells.push_back(m_grid.cellsForSegment(segment.geometry));
+        }
+
+        // Enclosures that kept their members keep their raw block; a block whose membership
+        // changed is evaluated in full.
+        auto blocks = groupByEnclosure(engineSegments);
+        std::vector<bool> fresh(m_segments.size(), false);
+        for(auto & block : blocks)
+        {
+            const auto previous = std::ranges::find_if(m_rawBlocks, [&](const auto & rawBlock) {
+                return rawBlock.enclosureId == block.enclosureId
+                       && rawBlock.segments == block.segments;
+            });
+            if(previous != m_rawBlocks.end())
             {
-                areas.push_back(segment.length);
-                enclosureIds.push_back(segment.enclosureId);
+                block.viewFactors = previous->viewFactors;
+                continue;
+            }
+            for(const auto member : block.segments)
+            {
+                fresh[member] = true;
             }
-            viewFactors =
-              smoothViewFactors(viewFactors, areas, enclosureIds, options.openEnclosureIds);
         }
 
-        return {.viewFactors = viewFactors,
-                .environmentViewFactor = environmentViewFactors(viewFactors)};
+        const auto isAffected = [&](const std::size_t row, const std::size_t col) {
+            if(fresh[row] || moved[row] || moved[col])
+            {
+                return true;
+            }
+            const SpatialGrid::CellRange pairCells{
+              .colLo = std::min(segmentCells[row].colLo, segmentCells[col].colLo),
+              .colHi = std::max(segmentCells[row].colHi, segmentCells[col].colHi),
+              .rowLo = std::min(segmentCells[row].rowLo, segmentCells[col].rowLo),
+              .rowHi = std::max(segmentCells[row].rowHi, segmentCells[col].rowHi)};
+            return std::ranges::any_of(touchedCells, [&](const SpatialGrid::CellRange & cells) {
+                return cells.overlaps(pairCells);
+            });
+        };
+
+        m_recomputedPairs =
+          computeBlocks(blocks, engineSegments, m_blockers, m_grid, m_options, isAffected);
+        m_rawBlocks = std::move(blocks);
+        m_result = finalizeResult(m_rawBlocks, engineSegments, m_options);
+
+        return m_result;
     }
 }   // namespace Viewer
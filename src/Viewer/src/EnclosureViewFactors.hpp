@@ -5,18 +5,43 @@
 #include <WCECommon.hpp>
 
 #include "EnclosureViewFactorInput.hpp"
+#include "SpatialGrid.hpp"
 
 namespace Viewer
 {
-    // Result of computeEnclosureViewFactors. The matrix is block-diagonal over enclosures,
-    // sized to all radiation segments and indexed in input order; cross-enclosure entries are
-    // exactly zero. environmentViewFactor holds the per-row (1 - row sum): for an open (auto)
-    // enclosure this is the view factor to the environment (the room); for a closed enclosure it
-    // is the (small) closure residual, near zero after smoothing.
-    struct EnclosureViewFactorResult
+    // View factors of one enclosure. segments lists the input indices of its radiation segments
+    // in ascending order and viewFactors is the dense block indexed like segments.
+    struct EnclosureViewFactorBlock
     {
+        std::size_t enclosureId{0};
+        std::vector<std::size_t> segments;
         FenestrationCommon::SquareMatrix viewFactors;
+    };
+
+    // Result of computeEnclosureViewFactors, stored block-sparse: one dense block per enclosure,
+    // ordered by enclosure id. Global indices follow the input order of the radiation segments
+    // and cross-enclosure entries are exactly zero, so the full matrix is block-diagonal and is
+    // only assembled on request. environmentViewFactor holds the per-row (1 - row sum): for an
+    // open (auto) enclosure this is the view factor to the environment (the room); for a closed
+    // enclosure it is the (small) closure residual, near zero after smoothing.
+    struct EnclosureViewFactorResult
+    {
+        struct Location
+        {
+            std::size_t block{0};
+            std::size_t position{0};
+        };
+
+        std::vector<EnclosureViewFactorBlock> blocks;
+        std::vector<Location> locations;   // block and position of every input segment
         std::vector<double> environmentViewFactor;
+
+        [[nodiscard]] std::size_t size() const;
+
+        // View factor between two input segments; zero across enclosures.
+        [[nodiscard]] double viewFactor(std::size_t row, std::size_t col) const;
+
+        [[nodiscard]] FenestrationCommon::SquareMatrix denseViewFactors() const;
     };
 
     // Computes radiation view factors for one or more closed enclosures. Pure: it owns no
@@ -26,4 +51,44 @@ namespace Viewer
     computeEnclosureViewFactors(const std::vector<RadiationSegment> & segments,
                                 const std::vector<BlockingSegment> & blockers,
                                 const ViewFactorOptions & options = {});
+
+    // New geometry (or enclosure) for the radiation segment at index.
+    struct SegmentChange
+    {
+        std::size_t index;
+        RadiationSegment segment;
+    };
+
+    // Keeps the raw view-factor blocks and the blocker grid of the last computation, so that
+    // moving a few segments recomputes only the pairs they can influence: the rows and columns of
+    // the moved segments and the pairs whose grid candidates contain a moved segment before or
+    // after the move. Any other pair sees exactly the same geometry and blockers as before. An
+    // enclosure whose membership changed is evaluated in full. The result is identical to
+    // computeEnclosureViewFactors over the updated segments. The bookkeeping is done on the
+    // uniform grid, so ViewFactorOptions::blockerIndex is not used here.
+    class IncrementalEnclosureViewFactors
+    {
+    public:
+        IncrementalEnclosureViewFactors(std::vector<RadiationSegment> segments,
+                                        const std::vector<BlockingSegment> & blockers,
+                                        ViewFactorOptions options = {});
+
+        [[nodiscard]] const EnclosureViewFactorResult & result() const;
+        [[nodiscard]] const std::vector<RadiationSegment> & segments() const;
+
+        // Applies the changes in order and refreshes the result.
+        const EnclosureViewFactorResult & update(const std::vector<SegmentChange> & changes);
+
+        // Number of segment pairs evaluated by the last update (all pairs after construction).
+        [[nodiscard]] std::size_t recomputedPairs() const;
+
+    private:
+        std::vector<RadiationSegment> m_segments;
+        ViewFactorOptions m_options;
+        std::vector<CSegment2D> m_blockers;
+        SpatialGrid m_grid;
+        std::vector<EnclosureViewFactorBlock> m_rawBlocks;
+        EnclosureViewFactorResult m_result;
+        std::size_t m_recomputedPairs{0};
+    };
 }   // namespace Viewer
@@ -1,5 +1,6 @@
 #include <cassert>
 #include <algorithm>
+#include <mutex>
 #include <stdexcept>
 
 #include "Geometry2DBeam.hpp"
@@ -148,7 +149,7 @@ namespace Viewer
         m_ProfileAngle(t_ProfileAngle)
     {}
 
-    std::vector<BeamViewFactor> CDirect2DRaysResult::beamViewFactors() const
+    const std::vector<BeamViewFactor> & CDirect2DRaysResult::beamViewFactors() const
     {
         return m_ViewFactors;
     }
@@ -163,51 +164,140 @@ namespace Viewer
         return m_ProfileAngle;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////
+    // CDirect2DRaysResults
+    ////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        bool keyLess(const std::pair<long long, CDirect2DRaysResults::Result> & t_Result,
+                     long long t_Key)
+        {
+            return t_Result.first < t_Key;
+        }
+    }   // namespace
+
+    CDirect2DRaysResults::Result CDirect2DRaysResults::find(long long const t_Key) const
+    {
+        std::shared_lock lock(m_Mutex);
+        const auto it = std::lower_bound(m_Results.begin(), m_Results.end(), t_Key, keyLess);
+        if(it != m_Results.end() && it->first == t_Key)
+        {
+            return it->second;
+        }
+        return nullptr;
+    }
+
+    void CDirect2DRaysResults::insert(std::vector<std::pair<long long, Result>> t_Results)
+    {
+        std::unique_lock lock(m_Mutex);
+        for(auto & result : t_Results)
+        {
+            const auto it =
+              std::lower_bound(m_Results.begin(), m_Results.end(), result.first, keyLess);
+            if(it == m_Results.end() || it->first != result.first)
+            {
+                m_Results.insert(it, std::move(result));
+            }
+        }
+    }
+
+    size_t CDirect2DRaysResults::size() const
+    {
+        std::shared_lock lock(m_Mutex);
+        return m_Results.size();
+    }
+
+    std::shared_ptr<CDirect2DRaysResults>
+      sharedRayResults(Side const t_Side, const std::vector<CGeometry2D> & t_Geometries2D)
+    {
+        // Exact coordinates are the key, so only truly identical geometry shares results.
+        std::vector<double> key{static_cast<double>(t_Side)};
+        for(const auto & geometry : t_Geometries2D)
+        {
+            key.push_back(static_cast<double>(geometry.segments().size()));
+            for(const auto & segment : geometry.segments())
+            {
+                key.push_back(segment.startPoint().x());
+                key.push_back(segment.startPoint().y());
+                key.push_back(segment.endPoint().x());
+                key.push_back(segment.endPoint().y());
+            }
+        }
+
+        static std::mutex registryMutex;
+        static std::map<std::vector<double>, std::weak_ptr<CDirect2DRaysResults>> registry;
+
+        std::lock_guard lock(registryMutex);
+        if(auto existing = registry[key].lock())
+        {
+            return existing;
+        }
+        std::erase_if(registry, [](const auto & entry) { return entry.second.expired(); });
+        auto results = std::make_shared<CDirect2DRaysResults>();
+        registry[key] = results;
+        return results;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////
     // CDirect2DRays
     ////////////////////////////////////////////////////////////////////////////////////////
 
-    CDirect2DRays::CDirect2DRays(Side const t_Side) : m_Side(t_Side)
+    CDirect2DRays::CDirect2DRays(Side const t_Side) :
+        m_Side(t_Side),
+        m_RayResults(sharedRayResults(m_Side, m_Geometries2D))
     {}
 
     void CDirect2DRays::appendGeometry2D(const CGeometry2D & t_Geometry2D)
     {
         m_Geometries2D.push_back(t_Geometry2D);
+        m_RayResults = sharedRayResults(m_Side, m_Geometries2D);
     }
 
     std::vector<BeamViewFactor> CDirect2DRays::beamViewFactors(double const t_ProfileAngle,
                                                                const BeamPosition beamPosition)
     {
-        checkForProfileAngle(t_ProfileAngle, beamPosition);
-        return m_RayResults.at(keyFromProfileAngle(t_ProfileAngle, beamPosition)).beamViewFactors();
+        return resultForProfileAngle(t_ProfileAngle, beamPosition)->beamViewFactors();
     }
 
     double CDirect2DRays::directToDirect(double const t_ProfileAngle,
                                          const BeamPosition beamPosition)
     {
-        checkForProfileAngle(t_ProfileAngle, beamPosition);
-        return m_RayResults.at(keyFromProfileAngle(t_ProfileAngle, beamPosition)).directToDirect();
+        return resultForProfileAngle(t_ProfileAngle, beamPosition)->directToDirect();
     }
 
-    void CDirect2DRays::checkForProfileAngle(const double t_ProfileAngle,
-                                             const BeamPosition beamPosition)
+    size_t CDirect2DRays::numberOfStoredResults() const
+    {
+        return m_RayResults->size();
+    }
+
+    CDirect2DRaysResults::Result
+      CDirect2DRays::resultForProfileAngle(const double t_ProfileAngle,
+                                           const BeamPosition beamPosition)
     {   // Need to have this in case the profile angle is not precalculated
-        if(!m_RayResults.count(keyFromProfileAngle(t_ProfileAngle, beamPosition)))
+        const auto key{keyFromProfileAngle(t_ProfileAngle, beamPosition)};
+        if(auto stored = m_RayResults->find(key))
         {
-            m_RayResults[keyFromProfileAngle(t_ProfileAngle, beamPosition)] =
-              calculateAllProperties(t_ProfileAngle, beamPosition);
+            return stored;
         }
+        m_RayResults->insert(
+          {{key,
+            std::make_shared<const CDirect2DRaysResult>(
+              calculateAllProperties(t_ProfileAngle, beamPosition))}});
+        // Another thread may have stored the same angle first; everyone uses that one.
+        return m_RayResults->find(key);
     }
 
-    CDirect2DRaysResult CDirect2DRays::calculateAllProperties(double const t_ProfileAngle,
-                                                              const BeamPosition beamPosition)
+    CDirect2DRaysResult CDirect2DRays::calculateAllProperties(
+      double const t_ProfileAngle, const BeamPosition beamPosition) const
     {
         auto boundaries{findRayBoundaries(t_ProfileAngle)};
         auto rays{findInBetweenRays(t_ProfileAngle, boundaries)};
         return calculateBeamProperties(t_ProfileAngle, beamPosition, rays);
     }
 
-    CDirect2DRays::RayBoundaries CDirect2DRays::findRayBoundaries(double const t_ProfileAngle)
+    CDirect2DRays::RayBoundaries
+      CDirect2DRays::findRayBoundaries(double const t_ProfileAngle) const
     {
         RayBoundaries result;
 
@@ -242,7 +332,7 @@ namespace Viewer
     }
 
     std::vector<CDirect2DRay> CDirect2DRays::findInBetweenRays(double const t_ProfileAngle,
-                                                               RayBoundaries & boudnaries)
+                                                               RayBoundaries & boudnaries) const
     {
         std::vector<CPoint2D> inBetweenPoints;
 
@@ -290,9 +380,10 @@ namespace Viewer
         return rays;
     }
 
-    CDirect2DRaysResult CDirect2DRays::calculateBeamProperties(double const t_ProfileAngle,
-                                                               const BeamPosition beamPosition,
-                                                               std::vector<CDirect2DRay> & rays)
+    CDirect2DRaysResult
+      CDirect2DRays::calculateBeamProperties(double const t_ProfileAngle,
+                                             const BeamPosition beamPosition,
+                                             std::vector<CDirect2DRay> & rays) const
     {
         // First check all segments and calculate total ray height
         auto totalHeight = 0.0;
@@ -382,13 +473,46 @@ namespace Viewer
     }
 
     void CDirect2DRays::precalculateForProfileAngles(const std::vector<double> & t_ProfileAngles,
-                                                     const BeamPosition beamPosition)
+                                                     const BeamPosition beamPosition,
+                                                     size_t const numberOfThreads)
     {
+        auto & results{*m_RayResults};
+
+        // Only the angles that no cell with this geometry has calculated yet, each once.
+        std::vector<std::pair<long long, double>> missing;
         for(const auto & angle : t_ProfileAngles)
         {
-            m_RayResults[keyFromProfileAngle(angle, beamPosition)] =
-              calculateAllProperties(angle, beamPosition);
+            const auto key{keyFromProfileAngle(angle, beamPosition)};
+            if(results.find(key) == nullptr)
+            {
+                missing.emplace_back(key, angle);
+            }
         }
+        std::sort(missing.begin(), missing.end(), [](const auto & lhs, const auto & rhs) {
+            return lhs.first < rhs.first;
+        });
+        missing.erase(std::unique(missing.begin(),
+                                  missing.end(),
+                                  [](const auto & lhs, const auto & rhs) {
+                                      return lhs.first == rhs.first;
+                                  }),
+                      missing.end());
+
+        // Every profile angle is independent and only reads the geometry.
+        const auto threads{std::min(
+          numberOfThreads == 0u ? getNumberOfThreads(missing.size()) : numberOfThreads,
+          std::max<size_t>(1u, missing.size() / precalculationAnglesPerThread))};
+        std::vector<std::pair<long long, CDirect2DRaysResults::Result>> calculated(missing.size());
+        executeInParallelDynamic<size_t>(
+          missing.size(),
+          [&](const size_t index) {
+              const auto & [key, angle] = missing[index];
+              calculated[index] = {key,
+                                   std::make_shared<const CDirect2DRaysResult>(
+                                     calculateAllProperties(angle, beamPosition))};
+          },
+          threads);
+        results.insert(std::move(calculated));
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////
@@ -425,11 +549,12 @@ namespace Viewer
     }
 
     void CGeometry2DBeam::precalculateForProfileAngles(FenestrationCommon::Side side,
-                                                       const std::vector<double> & t_ProfileAngles)
+                                                       const std::vector<double> & t_ProfileAngles,
+                                                       size_t const numberOfThreads)
     {
         const BeamPosition beamPosition =
           side == Side::Front ? BeamPosition::Outside : BeamPosition::Inside;
-        m_Ray.at(side).precalculateForProfileAngles(t_ProfileAngles, beamPosition);
+        m_Ray.at(side).precalculateForProfileAngles(t_ProfileAngles, beamPosition, numberOfThreads);
     }
 
     long long int keyFromProfileAngle(const double angle, const BeamPosition position)
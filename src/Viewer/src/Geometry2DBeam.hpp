@@ -4,6 +4,8 @@
 #include <vector>
 #include <map>
 #include <optional>
+#include <shared_mutex>
+#include <utility>
 
 #include "ViewSegment2D.hpp"
 
@@ -121,7 +123,7 @@ namespace Viewer
                             std::vector<BeamViewFactor> t_BeamViewFactors);
 
         // Beam view factors for given profile angle
-        [[nodiscard]] std::vector<BeamViewFactor> beamViewFactors() const;
+        [[nodiscard]] const std::vector<BeamViewFactor> & beamViewFactors() const;
 
         // Direct to direct transmitted beam component
         [[nodiscard]] double directToDirect() const;
@@ -134,10 +136,50 @@ namespace Viewer
         double m_ProfileAngle;
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////////
+    // CDirect2DRaysResults
+    ////////////////////////////////////////////////////////////////////////////////////////
+
+    // Ray results of one set of enclosures, as a flat array sorted by keyFromProfileAngle. The
+    // table is shared by every CDirect2DRays with the same side and segment coordinates (see
+    // sharedRayResults), so it is guarded for concurrent readers and writers.
+    class CDirect2DRaysResults
+    {
+    public:
+        using Result = std::shared_ptr<const CDirect2DRaysResult>;
+
+        // Stored result for the key or nullptr. Results are never replaced, so the pointer stays
+        // valid and unchanged while other threads insert.
+        [[nodiscard]] Result find(long long t_Key) const;
+
+        // Adds the results whose keys are not stored yet; existing keys keep their result.
+        void insert(std::vector<std::pair<long long, Result>> t_Results);
+
+        [[nodiscard]] size_t size() const;
+
+    private:
+        mutable std::shared_mutex m_Mutex;
+        std::vector<std::pair<long long, Result>> m_Results;
+    };
+
+    // Process-wide table for the given side and enclosures. Enclosures with identical segment
+    // coordinates get the same table for as long as any CDirect2DRays holds it. The registry
+    // keeps tables only weakly, so a table and its results are released together with the last
+    // CDirect2DRays using it, and the next request for the same geometry starts empty. Results
+    // therefore never outlive their users and separate callers do not see each other's results
+    // unless their objects are alive at the same time.
+    std::shared_ptr<CDirect2DRaysResults>
+      sharedRayResults(FenestrationCommon::Side t_Side,
+                       const std::vector<CGeometry2D> & t_Geometries2D);
+
     ////////////////////////////////////////////////////////////////////////////////////////
     // CDirect2DRays
     ////////////////////////////////////////////////////////////////////////////////////////
 
+    // Profile angles below this count are calculated on the calling thread; above it every
+    // additional thread gets at least this many angles.
+    constexpr size_t precalculationAnglesPerThread{4u};
+
     // Keeps information about group of direct rays entering or exiting the enclosure
     class CDirect2DRays
     {
@@ -153,8 +195,15 @@ namespace Viewer
         // Direct to direct transmitted beam component
         double directToDirect(double t_ProfileAngle, BeamPosition beamPosition);
 
+        // Calculates the missing profile angles in parallel and stores them in the shared table.
+        // Zero numberOfThreads lets FenestrationCommon::getNumberOfThreads decide; either way no
+        // more threads are started than there are precalculationAnglesPerThread angles to share.
         void precalculateForProfileAngles(const std::vector<double> & t_ProfileAngles,
-                                          BeamPosition beamPosition);
+                                          BeamPosition beamPosition,
+                                          size_t numberOfThreads = 0u);
+
+        // Number of profile angle results available to this set of enclosures.
+        [[nodiscard]] size_t numberOfStoredResults() const;
 
     private:
         struct RayBoundaries
@@ -168,20 +217,19 @@ namespace Viewer
             [[nodiscard]] bool isInRay(CPoint2D const & t_Point) const;
         };
 
-        CDirect2DRaysResult calculateAllProperties(double t_ProfileAngle,
-                                                   BeamPosition beamPosition);
+        [[nodiscard]] CDirect2DRaysResult calculateAllProperties(double t_ProfileAngle,
+                                                                 BeamPosition beamPosition) const;
 
         // Finds lower and upper ray of every enclosure in the system
-        RayBoundaries findRayBoundaries(double t_ProfileAngle);
+        [[nodiscard]] RayBoundaries findRayBoundaries(double t_ProfileAngle) const;
 
         // Finds all points that are on the path of the ray
-        std::vector<CDirect2DRay> findInBetweenRays(double t_ProfileAngle,
-                                                    RayBoundaries & boudnaries);
+        [[nodiscard]] std::vector<CDirect2DRay> findInBetweenRays(double t_ProfileAngle,
+                                                                  RayBoundaries & boudnaries) const;
 
         // Calculate beam view factors
-        CDirect2DRaysResult calculateBeamProperties(double t_ProfileAngle,
-                                                    BeamPosition beamPosition,
-                                                    std::vector<CDirect2DRay> & rays);
+        [[nodiscard]] CDirect2DRaysResult calculateBeamProperties(
+          double t_ProfileAngle, BeamPosition beamPosition, std::vector<CDirect2DRay> & rays) const;
 
 
         [[nodiscard]] CViewSegment2D createSubBeam(CPoint2D const & t_Point,
@@ -191,8 +239,10 @@ namespace Viewer
 
         std::vector<CGeometry2D> m_Geometries2D;
 
-        std::map<long long, CDirect2DRaysResult> m_RayResults;
-        void checkForProfileAngle(double t_ProfileAngle, BeamPosition beamPosition);
+        // Shared table for the current geometry, looked up again whenever the geometry changes.
+        std::shared_ptr<CDirect2DRaysResults> m_RayResults;
+        [[nodiscard]] CDirect2DRaysResults::Result
+          resultForProfileAngle(double t_ProfileAngle, BeamPosition beamPosition);
     };
 
     ////////////////////////////////////////////////////////////////////////////////////////
@@ -214,7 +264,8 @@ namespace Viewer
         double directToDirect(double t_ProfileAngle, FenestrationCommon::Side t_Side);
 
         void precalculateForProfileAngles(FenestrationCommon::Side side,
-                                          const std::vector<double> & t_ProfileAngles);
+                                          const std::vector<double> & t_ProfileAngles,
+                                          size_t numberOfThreads = 0u);
 
     private:
         std::map<FenestrationCommon::Side, CDirect2DRays> m_Ray;
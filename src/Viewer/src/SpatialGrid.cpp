@@ -68,13 +68,15 @@ namespace Viewer
                              double cellWidth,
                              double cellHeight,
                              std::size_t cellsPerAxis,
-                             std::vector<std::vector<std::size_t>> buckets) :
+                             std::vector<std::vector<std::size_t>> buckets,
+                             std::vector<CellRange> blockerCells) :
         m_minX(minX),
         m_minY(minY),
         m_cellWidth(cellWidth),
         m_cellHeight(cellHeight),
         m_cellsPerAxis(cellsPerAxis),
-        m_buckets(std::move(buckets))
+        m_buckets(std::move(buckets)),
+        m_blockerCells(std::move(blockerCells))
     {}
 
     std::size_t SpatialGrid::suggestCellsPerAxis(const std::size_t blockerCount)
@@ -100,33 +102,28 @@ namespace Viewer
         const auto cellHeight =
           height > ViewerConstants::DISTANCE_TOLERANCE ? height / static_cast<double>(cells) : 0.0;
 
-        std::vector<std::vector<std::size_t>> buckets(cells * cells);
+        SpatialGrid grid{extent.minX,
+                         extent.minY,
+                         cellWidth,
+                         cellHeight,
+                         cells,
+                         std::vector<std::vector<std::size_t>>(cells * cells),
+                         {}};
+        grid.m_blockerCells.reserve(blockers.size());
         for(std::size_t idx = 0; idx < blockers.size(); ++idx)
         {
-            const auto & blocker = blockers[idx];
-            const auto startPoint = blocker.startPoint();
-            const auto endPoint = blocker.endPoint();
-
-            const auto colLo =
-              cellIndex(std::min(startPoint.x(), endPoint.x()), extent.minX, cellWidth, cells);
-            const auto colHi =
-              cellIndex(std::max(startPoint.x(), endPoint.x()), extent.minX, cellWidth, cells);
-            const auto rowLo =
-              cellIndex(std::min(startPoint.y(), endPoint.y()), extent.minY, cellHeight, cells);
-            const auto rowHi =
-              cellIndex(std::max(startPoint.y(), endPoint.y()), extent.minY, cellHeight, cells);
-
-            for(auto row = rowLo; row <= rowHi; ++row)
+            const auto range = grid.cellsForSegment(blockers[idx]);
+            grid.m_blockerCells.push_back(range);
+            for(auto row = range.rowLo; row <= range.rowHi; ++row)
             {
-                for(auto col = colLo; col <= colHi; ++col)
+                for(auto col = range.colLo; col <= range.colHi; ++col)
                 {
-                    buckets[row * cells + col].push_back(idx);
+                    grid.m_buckets[row * cells + col].push_back(idx);
                 }
             }
         }
 
-        return SpatialGrid{
-          extent.minX, extent.minY, cellWidth, cellHeight, cells, std::move(buckets)};
+        return grid;
     }
 
     std::size_t SpatialGrid::columnOf(const double xCoord) const
@@ -144,15 +141,12 @@ namespace Viewer
                                                                    const double maxX,
                                                                    const double maxY) const
     {
-        const auto colLo = columnOf(minX);
-        const auto colHi = columnOf(maxX);
-        const auto rowLo = rowOf(minY);
-        const auto rowHi = rowOf(maxY);
+        const auto range = cellsForBoundingBox(minX, minY, maxX, maxY);
 
         std::vector<std::size_t> result;
-        for(auto row = rowLo; row <= rowHi; ++row)
+        for(auto row = range.rowLo; row <= range.rowHi; ++row)
         {
-            for(auto col = colLo; col <= colHi; ++col)
+            for(auto col = range.colLo; col <= range.colHi; ++col)
             {
                 const auto & bucket = m_buckets[row * m_cellsPerAxis + col];
                 result.insert(result.end(), bucket.begin(), bucket.end());
@@ -164,4 +158,56 @@ namespace Viewer
         result.erase(duplicates.begin(), duplicates.end());
         return result;
     }
+
+    SpatialGrid::CellRange SpatialGrid::cellsForBoundingBox(const double minX,
+                                                            const double minY,
+                                                            const double maxX,
+                                                            const double maxY) const
+    {
+        return {.colLo = columnOf(minX),
+                .colHi = columnOf(maxX),
+                .rowLo = rowOf(minY),
+                .rowHi = rowOf(maxY)};
+    }
+
+    SpatialGrid::CellRange SpatialGrid::cellsForSegment(const CSegment2D & segment) const
+    {
+        const auto startPoint = segment.startPoint();
+        const auto endPoint = segment.endPoint();
+        return cellsForBoundingBox(std::min(startPoint.x(), endPoint.x()),
+                                   std::min(startPoint.y(), endPoint.y()),
+                                   std::max(startPoint.x(), endPoint.x()),
+                                   std::max(startPoint.y(), endPoint.y()));
+    }
+
+    void SpatialGrid::moveBlocker(const std::size_t idx,
+                                  const CSegment2D & oldSegment,
+                                  const CSegment2D & newSegment)
+    {
+        const auto oldRange = cellsForSegment(oldSegment);
+        for(auto row = oldRange.rowLo; row <= oldRange.rowHi; ++row)
+        {
+            for(auto col = oldRange.colLo; col <= oldRange.colHi; ++col)
+            {
+                std::erase(m_buckets[row * m_cellsPerAxis + col], idx);
+            }
+        }
+
+        const auto newRange = cellsForSegment(newSegment);
+        m_blockerCells[idx] = newRange;
+        for(auto row = newRange.rowLo; row <= newRange.rowHi; ++row)
+        {
+            for(auto col = newRange.colLo; col <= newRange.colHi; ++col)
+            {
+                auto & bucket = m_buckets[row * m_cellsPerAxis + col];
+                bucket.insert(std::ranges::lower_bound(bucket, idx), idx);
+            }
+        }
+    }
+
+    bool SpatialGrid::CellRange::overlaps(const CellRange & other) const
+    {
+        return colLo <= other.colHi && other.colLo <= colHi && rowLo <= other.rowHi
+               && other.rowLo <= rowHi;
+    }
 }   // namespace Viewer
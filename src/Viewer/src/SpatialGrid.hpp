@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <vector>
 
@@ -8,14 +9,26 @@
 namespace Viewer
 {
     // Uniform spatial grid over the blocker segments' bounding box, built once and queried
-    // read-only. It narrows the third-surface blocking tests from "every blocker" to the few
-    // whose cells overlap a segment pair's region. Each blocker is bucketed into the cells of its
-    // bounding box, and candidatesForBoundingBox returns the blockers whose cells overlap the
-    // queried box, so the result is always a superset of the truly relevant blockers (no false
-    // negatives) - it only ever narrows the brute-force set, never changes the answer.
+    // read-only; moveBlocker re-buckets a single blocker for incremental updates. It narrows the
+    // third-surface blocking tests from "every blocker" to the few whose cells overlap a segment
+    // pair's region. Each blocker is bucketed into the cells of its bounding box, and
+    // candidatesForBoundingBox returns the blockers whose cells overlap the queried box, so the
+    // result is always a superset of the truly relevant blockers (no false negatives) - it only
+    // ever narrows the brute-force set, never changes the answer.
     class SpatialGrid
     {
     public:
+        // Inclusive range of grid cells covered by a bounding box.
+        struct CellRange
+        {
+            std::size_t colLo;
+            std::size_t colHi;
+            std::size_t rowLo;
+            std::size_t rowHi;
+
+            [[nodiscard]] bool overlaps(const CellRange & other) const;
+        };
+
         [[nodiscard]] static SpatialGrid build(const std::vector<CSegment2D> & blockers,
                                                std::size_t cellsPerAxis);
 
@@ -26,13 +39,33 @@ namespace Viewer
         [[nodiscard]] std::vector<std::size_t>
           candidatesForBoundingBox(double minX, double minY, double maxX, double maxY) const;
 
+        // True if visit(idx) holds for one of the candidatesForBoundingBox, without building the
+        // list: a blocker that spans several queried cells is visited only in the first cell it
+        // shares with the query. Stops at the first blocker for which visit holds.
+        template<typename Visitor>
+        [[nodiscard]] bool anyInBoundingBox(
+          double minX, double minY, double maxX, double maxY, Visitor && visit) const;
+
+        [[nodiscard]] CellRange
+          cellsForBoundingBox(double minX, double minY, double maxX, double maxY) const;
+
+        [[nodiscard]] CellRange cellsForSegment(const CSegment2D & segment) const;
+
+        // Re-buckets blocker idx after it moved from oldSegment to newSegment. The grid extent is
+        // kept; coordinates outside of it clamp into the border cells, so the candidate lists stay
+        // a superset of the relevant blockers.
+        void moveBlocker(std::size_t idx,
+                         const CSegment2D & oldSegment,
+                         const CSegment2D & newSegment);
+
     private:
         SpatialGrid(double minX,
                     double minY,
                     double cellWidth,
                     double cellHeight,
                     std::size_t cellsPerAxis,
-                    std::vector<std::vector<std::size_t>> buckets);
+                    std::vector<std::vector<std::size_t>> buckets,
+                    std::vector<CellRange> blockerCells);
 
         [[nodiscard]] std::size_t columnOf(double xCoord) const;
         [[nodiscard]] std::size_t rowOf(double yCoord) const;
@@ -43,5 +76,33 @@ namespace Viewer
         double m_cellHeight;
         std::size_t m_cellsPerAxis;
         std::vector<std::vector<std::size_t>> m_buckets;   // row-major, m_cellsPerAxis^2 cells
+        std::vector<CellRange> m_blockerCells;             // cells of every blocker
     };
+
+    template<typename Visitor>
+    bool SpatialGrid::anyInBoundingBox(const double minX,
+                                       const double minY,
+                                       const double maxX,
+                                       const double maxY,
+                                       Visitor && visit) const
+    {
+        const auto range = cellsForBoundingBox(minX, minY, maxX, maxY);
+        for(auto row = range.rowLo; row <= range.rowHi; ++row)
+        {
+            for(auto col = range.colLo; col <= range.colHi; ++col)
+            {
+                for(const auto idx : m_buckets[row * m_cellsPerAxis + col])
+                {
+                    const auto & cells = m_blockerCells[idx];
+                    const auto firstShared = row == std::max(cells.rowLo, range.rowLo)
+                                             && col == std::max(cells.colLo, range.colLo);
+                    if(firstShared && visit(idx))
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
 }   // namespace Viewer
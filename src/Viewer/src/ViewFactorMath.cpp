@@ -86,6 +86,15 @@ namespace Viewer::detail
     }
 
     std::vector<CSegment2D> subdivide(const CSegment2D & segment, const std::size_t count)
+    {
+        std::vector<CSegment2D> result;
+        subdivide(segment, count, result);
+        return result;
+    }
+
+    void subdivide(const CSegment2D & segment,
+                   const std::size_t count,
+                   std::vector<CSegment2D> & out)
     {
         if(count == 0)
         {
@@ -97,17 +106,15 @@ namespace Viewer::detail
         const auto dx = (end.x() - start.x()) / static_cast<double>(count);
         const auto dy = (end.y() - start.y()) / static_cast<double>(count);
 
-        std::vector<CSegment2D> result;
-        result.reserve(count);
+        out.clear();
+        out.reserve(count);
         CPoint2D from = start;
         for(std::size_t idx = 1; idx <= count; ++idx)
         {
             const CPoint2D to{start.x() + static_cast<double>(idx) * dx,
                               start.y() + static_cast<double>(idx) * dy};
-            result.emplace_back(from, to);
+            out.emplace_back(from, to);
             from = to;
         }
-
-        return result;
     }
 }   // namespace Viewer::detail
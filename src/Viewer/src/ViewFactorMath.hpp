@@ -29,4 +29,8 @@ namespace Viewer::detail
     // Splits a segment into count equal sub-segments (CViewSegment2D::subSegments). Throws if
     // count is zero.
     [[nodiscard]] std::vector<CSegment2D> subdivide(const CSegment2D & segment, std::size_t count);
+
+    // Output-parameter variant: replaces the contents of out, so a caller can reuse one scratch
+    // vector across pairs. The value-returning overload delegates to it.
+    void subdivide(const CSegment2D & segment, std::size_t count, std::vector<CSegment2D> & out);
 }   // namespace Viewer::detail
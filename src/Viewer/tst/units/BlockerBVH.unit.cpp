@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <array>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "WCEViewer.hpp"
+#include "../../src/BlockerBVH.hpp"
+
+
+using namespace Viewer;
+
+namespace
+{
+    // Short blockers clustered along two thin strips of [0, 10]^2, with empty space between.
+    std::vector<CSegment2D> stripBlockers()
+    {
+        std::vector<CSegment2D> blockers;
+        for(size_t idx = 0; idx < 20; ++idx)
+        {
+            const auto x = 0.5 * static_cast<double>(idx);
+            blockers.emplace_back(CPoint2D{x, 0.0}, CPoint2D{x + 0.4, 0.1});
+            blockers.emplace_back(CPoint2D{9.9, x}, CPoint2D{10.0, x + 0.4});
+        }
+        return blockers;
+    }
+
+    bool bboxOverlaps(const CSegment2D & segment, const std::array<double, 4> & box)
+    {
+        const auto segMinX = std::min(segment.startPoint().x(), segment.endPoint().x());
+        const auto segMaxX = std::max(segment.startPoint().x(), segment.endPoint().x());
+        const auto segMinY = std::min(segment.startPoint().y(), segment.endPoint().y());
+        const auto segMaxY = std::max(segment.startPoint().y(), segment.endPoint().y());
+        return !(segMaxX < box[0] || segMinX > box[2] || segMaxY < box[1] || segMinY > box[3]);
+    }
+
+    bool contains(const std::vector<std::size_t> & values, std::size_t value)
+    {
+        return std::ranges::find(values, value) != values.end();
+    }
+}   // namespace
+
+TEST(BlockerBVH, NeverProducesFalseNegative)
+{
+    const auto blockers = stripBlockers();
+    const auto bvh = BlockerBVH::build(blockers);
+
+    const std::vector<std::array<double, 4>> queries{
+      {0.5, 0.0, 2.5, 0.05}, {0, 0, 10, 10}, {9.95, 7, 9.96, 9}, {3, 3, 4, 4}, {0, 4, 10, 5}};
+    for(const auto & box : queries)
+    {
+        const auto candidates = bvh.candidatesForBoundingBox(box[0], box[1], box[2], box[3]);
+        EXPECT_TRUE(std::ranges::is_sorted(candidates));
+        for(std::size_t idx = 0; idx < blockers.size(); ++idx)
+        {
+            if(bboxOverlaps(blockers[idx], box))
+            {
+                EXPECT_TRUE(contains(candidates, idx)) << "hierarchy dropped blocker " << idx;
+            }
+        }
+    }
+
+    // The empty middle of the domain has no candidates at all.
+    EXPECT_TRUE(bvh.candidatesForBoundingBox(3, 3, 4, 4).empty());
+}
+
+TEST(BlockerBVH, SegmentQueryMatchesBruteForce)
+{
+    const auto blockers = stripBlockers();
+    const auto bvh = BlockerBVH::build(blockers);
+    EXPECT_LT(bvh.nodeCount(), blockers.size());
+
+    const std::vector<CSegment2D> rays{CSegment2D{{1.2, -1.0}, {1.2, 1.0}},
+                                       CSegment2D{{0.0, 5.0}, {10.5, 5.1}},
+                                       CSegment2D{{2.0, 2.0}, {8.0, 8.0}},
+                                       CSegment2D{{0.0, 10.0}, {10.0, 0.0}}};
+    for(const auto & ray : rays)
+    {
+        const auto crosses = [&](const std::size_t idx) {
+            return ray.intersectionWithSegment(blockers[idx]);
+        };
+        const auto bruteForce = std::ranges::any_of(blockers, [&](const CSegment2D & blocker) {
+            return ray.intersectionWithSegment(blocker);
+        });
+        EXPECT_EQ(bruteForce, bvh.anyAlongSegment(ray, crosses));
+    }
+}
+
+TEST(BlockerBVH, EmptyHierarchyHasNoCandidates)
+{
+    const auto bvh = BlockerBVH::build({});
+    EXPECT_TRUE(bvh.candidatesForBoundingBox(0, 0, 1, 1).empty());
+    EXPECT_FALSE(bvh.anyAlongSegment(CSegment2D{{0, 0}, {1, 1}}, [](std::size_t) { return true; }));
+}
@@ -0,0 +1,97 @@
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "WCEViewer.hpp"
+#include "../../src/BlockerCoordinates.hpp"
+
+
+using namespace Viewer;
+
+namespace
+{
+    // Axis-aligned, collinear, touching, crossing and zero-length segments on a coarse lattice,
+    // so that the tolerance branches of CSegment2D::intersectionWithSegment are all exercised.
+    std::vector<CSegment2D> latticeSegments()
+    {
+        std::vector<CSegment2D> result;
+        const std::vector<CPoint2D> points{
+          {0, 0}, {1, 0}, {0, 1}, {1, 1}, {0.5, 0.5}, {0.5, 0}, {2, 1}, {1, 2}, {0, 2}};
+        for(const auto & from : points)
+        {
+            for(const auto & to : points)
+            {
+                result.emplace_back(from, to);
+            }
+        }
+        return result;
+    }
+
+    std::vector<CSegment2D> randomSegments(std::size_t count)
+    {
+        std::mt19937 generator{20240531u};
+        std::uniform_real_distribution<double> coordinate{-1.0, 1.0};
+        std::vector<CSegment2D> result;
+        for(std::size_t idx = 0; idx < count; ++idx)
+        {
+            result.emplace_back(CPoint2D{coordinate(generator), coordinate(generator)},
+                                CPoint2D{coordinate(generator), coordinate(generator)});
+        }
+        return result;
+    }
+
+    void expectSameAsSegment2D(const std::vector<CSegment2D> & segments)
+    {
+        const BlockerCoordinates coordinates{segments};
+        ASSERT_EQ(segments.size(), coordinates.size());
+        for(const auto & ray : segments)
+        {
+            const auto line = lineOf(ray);
+            for(std::size_t idx = 0; idx < segments.size(); ++idx)
+            {
+                EXPECT_EQ(ray.intersectionWithSegment(segments[idx]),
+                          coordinates.crossedBy(line, idx));
+            }
+        }
+    }
+
+    // Every window of consecutive blockers, of every batch size, against the scalar test.
+    void expectBatchesMatchScalar(const std::vector<CSegment2D> & segments)
+    {
+        const BlockerCoordinates coordinates{segments};
+        for(const auto & ray : segments)
+        {
+            const auto line = lineOf(ray);
+            for(std::size_t count = 1u; count <= blockerBatchSize; ++count)
+            {
+                for(std::size_t first = 0; first + count <= segments.size(); ++first)
+                {
+                    BlockerBatch batch;
+                    bool expected = false;
+                    for(auto idx = first; idx < first + count; ++idx)
+                    {
+                        static_cast<void>(batch.add(idx));
+                        expected = expected || ray.intersectionWithSegment(segments[idx]);
+                    }
+                    EXPECT_EQ(expected, coordinates.anyCrossedBy(line, batch));
+                }
+            }
+        }
+    }
+}   // namespace
+
+TEST(BlockerCoordinates, LatticeMatchesSegment2D)
+{
+    expectSameAsSegment2D(latticeSegments());
+}
+
+TEST(BlockerCoordinates, RandomSegmentsMatchSegment2D)
+{
+    expectSameAsSegment2D(randomSegments(200u));
+}
+
+TEST(BlockerCoordinates, BatchesMatchScalarTest)
+{
+    expectBatchesMatchScalar(latticeSegments());
+    expectBatchesMatchScalar(randomSegments(60u));
+}
@@ -0,0 +1,83 @@
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "WCECommon.hpp"
+#include "WCEViewer.hpp"
+
+using namespace Viewer;
+using namespace FenestrationCommon;
+
+namespace
+{
+    // Two slats of a venetian-like cell, with coordinates no other test uses.
+    CDirect2DRays makeRays(Side side, double spacing = 0.0123)
+    {
+        CDirect2DRays rays(side);
+        for(const auto yOffset : {0.0, spacing})
+        {
+            CGeometry2D slat;
+            slat.appendSegment(CViewSegment2D{{0.0, yOffset}, {0.00741, yOffset + 0.0037}});
+            slat.appendSegment(CViewSegment2D{{0.00741, yOffset + 0.0037}, {0.0148, yOffset}});
+            rays.appendGeometry2D(slat);
+        }
+        return rays;
+    }
+
+    const std::vector<double> profileAngles{-60.0, -30.0, -15.0, 0.0, 15.0, 30.0, 45.0, 60.0};
+}   // namespace
+
+TEST(Enclosure2DBeamSharedResults, ParallelPrecalculationMatchesOnDemand)
+{
+    std::vector<double> directToDirect;
+    std::vector<std::vector<BeamViewFactor>> viewFactors;
+    {
+        auto rays = makeRays(Side::Front);
+        for(const auto angle : profileAngles)
+        {
+            directToDirect.push_back(rays.directToDirect(angle, BeamPosition::Outside));
+            viewFactors.push_back(rays.beamViewFactors(angle, BeamPosition::Outside));
+        }
+    }
+
+    // The first set of rays is gone, so its results are gone with it and everything is
+    // calculated again, this time in parallel.
+    auto rays = makeRays(Side::Front);
+    EXPECT_EQ(0u, rays.numberOfStoredResults());
+    rays.precalculateForProfileAngles(profileAngles, BeamPosition::Outside, 4u);
+    EXPECT_EQ(profileAngles.size(), rays.numberOfStoredResults());
+
+    for(size_t idx = 0; idx < profileAngles.size(); ++idx)
+    {
+        const auto angle = profileAngles[idx];
+        EXPECT_EQ(directToDirect[idx], rays.directToDirect(angle, BeamPosition::Outside));
+
+        const auto precalculated = rays.beamViewFactors(angle, BeamPosition::Outside);
+        ASSERT_EQ(viewFactors[idx].size(), precalculated.size());
+        for(size_t vf = 0; vf < precalculated.size(); ++vf)
+        {
+            EXPECT_EQ(viewFactors[idx][vf].enclosureIndex, precalculated[vf].enclosureIndex);
+            EXPECT_EQ(viewFactors[idx][vf].segmentIndex, precalculated[vf].segmentIndex);
+            EXPECT_EQ(viewFactors[idx][vf].value, precalculated[vf].value);
+            EXPECT_EQ(viewFactors[idx][vf].percentHit, precalculated[vf].percentHit);
+        }
+    }
+}
+
+TEST(Enclosure2DBeamSharedResults, IdenticalGeometryShareResults)
+{
+    auto first = makeRays(Side::Front);
+    first.precalculateForProfileAngles(profileAngles, BeamPosition::Outside, 4u);
+
+    auto second = makeRays(Side::Front);
+    EXPECT_EQ(profileAngles.size(), second.numberOfStoredResults());
+
+    // Another side or another spacing is a different table.
+    auto back = makeRays(Side::Back);
+    EXPECT_EQ(0u, back.numberOfStoredResults());
+    auto wider = makeRays(Side::Front, 0.0124);
+    EXPECT_EQ(0u, wider.numberOfStoredResults());
+
+    // Repeated and already stored angles are not calculated again.
+    second.precalculateForProfileAngles({0.0, 0.0, 5.0}, BeamPosition::Outside, 1u);
+    EXPECT_EQ(profileAngles.size() + 1u, first.numberOfStoredResults());
+}
@@ -0,0 +1,161 @@
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "WCEViewer.hpp"
+
+
+using namespace Viewer;
+
+namespace
+{
+    std::vector<RadiationSegment> unitSquare(const std::vector<double> & emissivities)
+    {
+        const std::vector<CPoint2D> vertices{{0, 0}, {0, 1}, {1, 1}, {1, 0}};
+        std::vector<RadiationSegment> segments;
+        for(size_t idx = 0; idx < vertices.size(); ++idx)
+        {
+            segments.push_back({.startPoint = vertices[idx],
+                                .endPoint = vertices[(idx + 1) % vertices.size()],
+                                .emissivity = emissivities[idx],
+                                .enclosureId = 0u});
+        }
+        return segments;
+    }
+
+    double emissivePower(double temperature)
+    {
+        return ConstantsData::STEFANBOLTZMANN * std::pow(temperature, 4);
+    }
+}   // namespace
+
+TEST(EnclosureRadiosity, BlackEnclosureExchangesEmissivePower)
+{
+    const auto segments = unitSquare({1.0, 1.0, 1.0, 1.0});
+    const auto viewFactors = computeEnclosureViewFactors(segments, {});
+    const EnclosureRadiosity radiosity(viewFactors, segments);
+
+    const std::vector<double> temperatures{300.0, 310.0, 320.0, 290.0};
+    const auto solution = radiosity.solve(temperatures);
+
+    for(size_t row = 0; row < segments.size(); ++row)
+    {
+        double expected = emissivePower(temperatures[row]);
+        for(size_t col = 0; col < segments.size(); ++col)
+        {
+            expected -= viewFactors.viewFactor(row, col) * emissivePower(temperatures[col]);
+        }
+        EXPECT_NEAR(emissivePower(temperatures[row]), solution.radiosity[row], 1e-9);
+        EXPECT_NEAR(expected, solution.netHeatFlux[row], 1e-9);
+    }
+}
+
+TEST(EnclosureRadiosity, GrayEnclosureConservesEnergy)
+{
+    const auto segments = unitSquare({0.9, 0.3, 0.84, 0.5});
+    const auto viewFactors =
+      computeEnclosureViewFactors(segments, {}, {.leastSquaresSmoothing = true});
+    const EnclosureRadiosity radiosity(viewFactors, segments);
+
+    // An isothermal enclosure is in equilibrium whatever the emissivities.
+    const auto isothermal = radiosity.solve(std::vector<double>(4u, 300.0));
+    for(size_t idx = 0; idx < segments.size(); ++idx)
+    {
+        EXPECT_NEAR(emissivePower(300.0), isothermal.radiosity[idx], 1e-9);
+        EXPECT_NEAR(0.0, isothermal.netHeatFlux[idx], 1e-9);
+    }
+
+    // Otherwise the net heat leaving the surfaces sums to zero, and the hot wall loses heat.
+    const auto solution = radiosity.solve({350.0, 300.0, 280.0, 300.0});
+    double total = 0.0;
+    for(size_t idx = 0; idx < segments.size(); ++idx)
+    {
+        total += solution.netHeatFlux[idx];   // all walls have unit length
+    }
+    EXPECT_NEAR(0.0, total, 1e-9);
+    EXPECT_GT(solution.netHeatFlux[0], 0.0);
+    EXPECT_LT(solution.netHeatFlux[2], 0.0);
+}
+
+TEST(EnclosureRadiosity, BatchedStatesMatchSingleSolves)
+{
+    auto segments = unitSquare({0.9, 0.3, 0.84, 0.5});
+    for(auto segment : unitSquare({0.6, 0.6, 0.2, 0.95}))
+    {
+        segment.enclosureId = 1u;
+        segments.push_back(segment);
+    }
+    const auto viewFactors = computeEnclosureViewFactors(segments, {});
+    const EnclosureRadiosity radiosity(viewFactors, segments);
+
+    const std::vector<std::vector<double>> states{
+      {300, 310, 320, 330, 280, 290, 300, 310},
+      {250, 260, 270, 280, 350, 340, 330, 320},
+      {300, 300, 300, 300, 300, 300, 300, 300}};
+    const auto batched = radiosity.solve(states);
+
+    ASSERT_EQ(states.size(), batched.size());
+    for(size_t state = 0; state < states.size(); ++state)
+    {
+        const auto single = radiosity.solve(states[state]);
+        EXPECT_EQ(single.radiosity, batched[state].radiosity);
+        EXPECT_EQ(single.netHeatFlux, batched[state].netHeatFlux);
+    }
+}
+
+TEST(EnclosureRadiosity, OpenEnclosureExchangesWithEnvironment)
+{
+    // A U-shaped cavity open at the top, black walls at the environment temperature.
+    const std::vector<RadiationSegment> segments{
+      {.startPoint = {0, 1}, .endPoint = {0, 0}, .emissivity = 1.0, .enclosureId = 0u},
+      {.startPoint = {0, 0}, .endPoint = {1, 0}, .emissivity = 1.0, .enclosureId = 0u},
+      {.startPoint = {1, 0}, .endPoint = {1, 1}, .emissivity = 1.0, .enclosureId = 0u}};
+    const auto viewFactors = computeEnclosureViewFactors(segments, {}, {.openEnclosureIds = {0u}});
+    const EnclosureRadiosity radiosity(viewFactors, segments, {0u});
+
+    const auto equilibrium = radiosity.solve({293.15, 293.15, 293.15}, 293.15);
+    for(const auto flux : equilibrium.netHeatFlux)
+    {
+        EXPECT_NEAR(0.0, flux, 1e-9);
+    }
+
+    // A warmer bottom loses heat to the walls and to the colder room.
+    const auto solution = radiosity.solve({293.15, 313.15, 293.15}, 273.15);
+    EXPECT_GT(solution.netHeatFlux[1], 0.0);
+    EXPECT_NEAR(viewFactors.environmentViewFactor[1]
+                    * (emissivePower(313.15) - emissivePower(273.15))
+                  + viewFactors.viewFactor(1u, 0u)
+                      * (emissivePower(313.15) - emissivePower(293.15))
+                  + viewFactors.viewFactor(1u, 2u)
+                      * (emissivePower(313.15) - emissivePower(293.15)),
+                solution.netHeatFlux[1],
+                1e-9);
+}
+
+TEST(EnclosureRadiosity, InvalidInputThrows)
+{
+    const auto segments = unitSquare({0.9, 0.9, 0.9, 0.9});
+    const auto viewFactors = computeEnclosureViewFactors(segments, {});
+    const EnclosureRadiosity radiosity(viewFactors, segments);
+
+    EXPECT_THROW(static_cast<void>(radiosity.solve(std::vector<double>{300.0})),
+                 std::runtime_error);
+    EXPECT_THROW(EnclosureRadiosity(viewFactors, unitSquare({0.9, 1.2, 0.9, 0.9})),
+                 std::runtime_error);
+}
+
+TEST(EnclosureRadiosity, PerfectlyReflectingClosedEnclosureThrows)
+{
+    const auto mirrors = unitSquare({0.0, 0.0, 0.0, 0.0});
+    EXPECT_THROW(EnclosureRadiosity(computeEnclosureViewFactors(mirrors, {}), mirrors),
+                 std::runtime_error);
+
+    // One emitting segment is enough to make the system solvable.
+    const auto segments = unitSquare({0.0, 0.0, 0.5, 0.0});
+    const EnclosureRadiosity radiosity(computeEnclosureViewFactors(segments, {}), segments);
+    const auto solution = radiosity.solve({300.0, 300.0, 300.0, 300.0}, 300.0);
+    for(const auto flux : solution.netHeatFlux)
+    {
+        EXPECT_NEAR(0.0, flux, 1e-9);
+    }
+}
@@ -110,7 +110,8 @@ TEST(EnclosureViewFactorsBench, DISABLED_GridDensitySweep)
         const ViewFactorOptions options{
           .gridCellsPerAxis = cells, .multithread = multithread};
         const auto start = std::chrono::steady_clock::now();
-        const auto viewFactors = computeEnclosureViewFactors(segments, {}, options).viewFactors;
+        const auto viewFactors =
+          computeEnclosureViewFactors(segments, {}, options).denseViewFactors();
         const auto stop = std::chrono::steady_clock::now();
         const auto milliseconds = std::chrono::duration<double, std::milli>(stop - start).count();
         return std::pair{milliseconds, viewFactors};
@@ -129,3 +130,64 @@ TEST(EnclosureViewFactorsBench, DISABLED_GridDensitySweep)
     std::cout << "suggestCellsPerAxis(" << segments.size()
               << ") = " << SpatialGrid::suggestCellsPerAxis(segments.size()) << "\n";
 }
+
+// Uniform grid (auto density) against the bounding-volume hierarchy on the comb fixture. Both
+// indexes must give the same matrix; the table shows which one culls the blockers faster as the
+// comb grows.
+TEST(EnclosureViewFactorsBench, DISABLED_GridVersusHierarchy)
+{
+    std::cout << "\nsegments   grid(ms)   hierarchy(ms)   speedup   maxDiff(hierarchy-vs-grid)\n";
+
+    const std::vector<std::pair<std::size_t, std::size_t>> shapes{
+      {8, 2}, {8, 4}, {14, 5}, {24, 6}};
+    for(const auto & [teeth, subdivision] : shapes)
+    {
+        const auto segments = makeCombEnclosure(teeth, subdivision);
+
+        const auto timeRun = [&](BlockerIndex blockerIndex) {
+            const ViewFactorOptions options{.blockerIndex = blockerIndex, .multithread = false};
+            const auto start = std::chrono::steady_clock::now();
+            const auto viewFactors =
+              computeEnclosureViewFactors(segments, {}, options).denseViewFactors();
+            const auto stop = std::chrono::steady_clock::now();
+            const auto milliseconds =
+              std::chrono::duration<double, std::milli>(stop - start).count();
+            return std::pair{milliseconds, viewFactors};
+        };
+
+        const auto [gridMs, gridVf] = timeRun(BlockerIndex::UniformGrid);
+        const auto [bvhMs, bvhVf] = timeRun(BlockerIndex::BoundingVolumeHierarchy);
+        std::cout << segments.size() << "\t" << gridMs << "\t" << bvhMs << "\t"
+                  << (gridMs / bvhMs) << "\t" << maxAbsDifference(bvhVf, gridVf) << "\n";
+    }
+}
+
+// Scaling curve of the pair scheduler: wall-clock time against the worker-thread count on the
+// comb fixtures. Counts above the hardware thread count only show the scheduling overhead.
+TEST(EnclosureViewFactorsBench, DISABLED_ThreadScaling)
+{
+    std::cout << "\nhardware threads = " << std::thread::hardware_concurrency() << "\n";
+    std::cout << "segments   threads   time(ms)   speedup\n";
+
+    const std::vector<std::pair<std::size_t, std::size_t>> shapes{{8, 4}, {14, 5}, {24, 6}};
+    for(const auto & [teeth, subdivision] : shapes)
+    {
+        const auto segments = makeCombEnclosure(teeth, subdivision);
+
+        const auto timeRun = [&](const ViewFactorOptions & options) {
+            const auto start = std::chrono::steady_clock::now();
+            const auto result = computeEnclosureViewFactors(segments, {}, options);
+            const auto stop = std::chrono::steady_clock::now();
+            return std::chrono::duration<double, std::milli>(stop - start).count();
+        };
+
+        const auto serialMs = timeRun({.multithread = false});
+        std::cout << segments.size() << "\t1\t" << serialMs << "\t1\n";
+        for(const std::size_t threads : {2u, 4u, 8u, 16u})
+        {
+            const auto parallelMs = timeRun({.multithread = true, .threadCount = threads});
+            std::cout << segments.size() << "\t" << threads << "\t" << parallelMs << "\t"
+                      << (serialMs / parallelMs) << "\n";
+        }
+    }
+}
@@ -102,9 +102,9 @@ TEST(EnclosureViewFactorsClosure, SmoothingClosesConcaveEnclosure)
     EXPECT_LT(maxAbs(smoothed.environmentViewFactor), maxAbs(raw.environmentViewFactor));
     EXPECT_NEAR(0.0, maxAbs(smoothed.environmentViewFactor), 1e-6);
 
-    for(size_t idx = 0; idx < smoothed.viewFactors.size(); ++idx)
+    for(size_t idx = 0; idx < smoothed.size(); ++idx)
     {
-        EXPECT_NEAR(0.0, smoothed.viewFactors(idx, idx), 1e-12);
+        EXPECT_NEAR(0.0, smoothed.viewFactor(idx, idx), 1e-12);
     }
 }
 
@@ -114,11 +114,11 @@ TEST(EnclosureViewFactorsClosure, SmoothingSkipsOpenEnclosure)
 {
     const auto shape = openUShape(0);
 
-    const auto without = computeEnclosureViewFactors(shape, {}).viewFactors;
+    const auto without = computeEnclosureViewFactors(shape, {}).denseViewFactors();
     const auto with =
       computeEnclosureViewFactors(
         shape, {}, {.leastSquaresSmoothing = true, .openEnclosureIds = {0u}})
-        .viewFactors;
+        .denseViewFactors();
 
     ASSERT_EQ(without.size(), with.size());
     for(size_t row = 0; row < without.size(); ++row)
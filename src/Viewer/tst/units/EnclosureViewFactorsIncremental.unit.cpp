@@ -0,0 +1,146 @@
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "WCEViewer.hpp"
+
+
+using namespace Viewer;
+using namespace FenestrationCommon;
+
+// Incremental updates must reproduce a full computeEnclosureViewFactors run over the moved
+// geometry exactly, while evaluating only the pairs the moved segments can influence.
+
+namespace
+{
+    // A comb of teeth with every edge subdivided, so most pairs are partially blocked and the
+    // grid has short blockers to cull.
+    std::vector<RadiationSegment> makeComb(std::size_t teeth, std::size_t enclosureId = 0u)
+    {
+        constexpr std::size_t subdivisionPerEdge = 3;
+        std::vector<RadiationSegment> segments;
+        const auto addEdge = [&](const CPoint2D & from, const CPoint2D & to) {
+            for(std::size_t step = 0; step < subdivisionPerEdge; ++step)
+            {
+                const auto t0 = static_cast<double>(step) / subdivisionPerEdge;
+                const auto t1 = static_cast<double>(step + 1) / subdivisionPerEdge;
+                segments.push_back({.startPoint = {from.x() + (to.x() - from.x()) * t0,
+                                                   from.y() + (to.y() - from.y()) * t0},
+                                    .endPoint = {from.x() + (to.x() - from.x()) * t1,
+                                                 from.y() + (to.y() - from.y()) * t1},
+                                    .emissivity = 0.9,
+                                    .enclosureId = enclosureId});
+            }
+        };
+
+        for(std::size_t tooth = 0; tooth < teeth; ++tooth)
+        {
+            const auto xLeft = static_cast<double>(tooth);
+            const auto xRight = xLeft + 0.4;
+            addEdge({xLeft, 0.0}, {xLeft, 3.0});
+            addEdge({xLeft, 3.0}, {xRight, 3.0});
+            addEdge({xRight, 3.0}, {xRight, 0.0});
+        }
+        return segments;
+    }
+
+    RadiationSegment raised(const RadiationSegment & segment, double offset)
+    {
+        auto result = segment;
+        result.startPoint = {segment.startPoint.x(), segment.startPoint.y() + offset};
+        result.endPoint = {segment.endPoint.x(), segment.endPoint.y() + offset};
+        return result;
+    }
+
+    void expectSameResult(const EnclosureViewFactorResult & expected,
+                          const EnclosureViewFactorResult & result)
+    {
+        ASSERT_EQ(expected.size(), result.size());
+        for(size_t row = 0; row < expected.size(); ++row)
+        {
+            for(size_t col = 0; col < expected.size(); ++col)
+            {
+                EXPECT_EQ(expected.viewFactor(row, col), result.viewFactor(row, col))
+                  << "mismatch at (" << row << ", " << col << ")";
+            }
+        }
+        EXPECT_EQ(expected.environmentViewFactor, result.environmentViewFactor);
+    }
+}   // namespace
+
+TEST(EnclosureViewFactorsIncremental, SingleMoveMatchesFullRecompute)
+{
+    const auto segments = makeComb(6u);
+    const std::vector<BlockingSegment> blockers{{.startPoint = {0.0, 3.5}, .endPoint = {6.0, 3.5}}};
+    const ViewFactorOptions options{.leastSquaresSmoothing = false};
+
+    IncrementalEnclosureViewFactors incremental(segments, blockers, options);
+    expectSameResult(computeEnclosureViewFactors(segments, blockers, options),
+                     incremental.result());
+
+    const auto totalPairs = segments.size() * (segments.size() - 1u) / 2u;
+    EXPECT_EQ(totalPairs, incremental.recomputedPairs());
+
+    // Raise the first segment on the left side of the first tooth
+    incremental.update({{.index = 0u, .segment = raised(segments[0u], 0.2)}});
+
+    expectSameResult(computeEnclosureViewFactors(incremental.segments(), blockers, options),
+                     incremental.result());
+    EXPECT_LT(incremental.recomputedPairs(), totalPairs / 2u);
+}
+
+TEST(EnclosureViewFactorsIncremental, RepeatedMovesWithSmoothing)
+{
+    auto segments = makeComb(4u, 0u);
+    const auto second = makeComb(2u, 1u);
+    segments.insert(segments.end(), second.begin(), second.end());
+    const ViewFactorOptions options{.leastSquaresSmoothing = true, .openEnclosureIds = {1u}};
+
+    IncrementalEnclosureViewFactors incremental(segments, {}, options);
+
+    for(size_t step = 1u; step <= 3u; ++step)
+    {
+        const auto offset = 0.05 * static_cast<double>(step);
+        incremental.update({{.index = 4u, .segment = raised(segments[4u], offset)},
+                            {.index = 20u, .segment = raised(segments[20u], -offset)}});
+        expectSameResult(computeEnclosureViewFactors(incremental.segments(), {}, options),
+                         incremental.result());
+    }
+
+    // Moving a segment into the other enclosure must clear its old pairs.
+    auto moved = incremental.segments()[7u];
+    moved.enclosureId = 1u;
+    incremental.update({{.index = 7u, .segment = moved}});
+    expectSameResult(computeEnclosureViewFactors(incremental.segments(), {}, options),
+                     incremental.result());
+}
+
+TEST(EnclosureViewFactorsIncremental, MoveOutsideOriginalGridExtent)
+{
+    const auto segments = makeComb(4u);
+    const ViewFactorOptions options{.leastSquaresSmoothing = false};
+    IncrementalEnclosureViewFactors incremental(segments, {}, options);
+
+    // The grid is laid out over the original geometry; cells of the moved segment are clamped
+    // to its border.
+    incremental.update({{.index = 2u, .segment = raised(segments[2u], 10.0)},
+                        {.index = 5u, .segment = raised(segments[5u], -10.0)}});
+    expectSameResult(computeEnclosureViewFactors(incremental.segments(), {}, options),
+                     incremental.result());
+
+    incremental.update({{.index = 2u, .segment = segments[2u]}});
+    expectSameResult(computeEnclosureViewFactors(incremental.segments(), {}, options),
+                     incremental.result());
+}
+
+TEST(EnclosureViewFactorsIncremental, IndexOfExplicitBlockerIsRejected)
+{
+    const auto segments = makeComb(2u);
+    const std::vector<BlockingSegment> blockers{{.startPoint = {0.0, 3.5}, .endPoint = {2.0, 3.5}}};
+    IncrementalEnclosureViewFactors incremental(segments, blockers);
+
+    const auto before = incremental.result();
+    EXPECT_THROW(
+      incremental.update({{.index = segments.size(), .segment = raised(segments[0u], 0.1)}}),
+      std::out_of_range);
+    expectSameResult(before, incremental.result());
+}
@@ -34,12 +34,12 @@ namespace
           .leastSquaresSmoothing = false, .multithread = false};
         const auto result = computeEnclosureViewFactors(segments, {}, rawOptions);
 
-        ASSERT_EQ(legacyVF.size(), result.viewFactors.size());
+        ASSERT_EQ(legacyVF.size(), result.size());
         for(size_t row = 0; row < legacyVF.size(); ++row)
         {
             for(size_t col = 0; col < legacyVF.size(); ++col)
             {
-                EXPECT_NEAR(legacyVF(row, col), result.viewFactors(row, col), 1e-12)
+                EXPECT_NEAR(legacyVF(row, col), result.viewFactor(row, col), 1e-12)
                   << "mismatch at (" << row << ", " << col << ")";
             }
         }
@@ -105,15 +105,15 @@ TEST(EnclosureViewFactors, GridMatchesBruteForce)
     const auto brute =
       computeEnclosureViewFactors(
         segments, {}, {.leastSquaresSmoothing = false, .gridCellsPerAxis = 1u})
-        .viewFactors;
+        .denseViewFactors();
     const auto autoGrid =
       computeEnclosureViewFactors(
         segments, {}, {.leastSquaresSmoothing = false})
-        .viewFactors;
+        .denseViewFactors();
     const auto fineGrid =
       computeEnclosureViewFactors(
         segments, {}, {.leastSquaresSmoothing = false, .gridCellsPerAxis = 8u})
-        .viewFactors;
+        .denseViewFactors();
 
     ASSERT_EQ(brute.size(), autoGrid.size());
     for(size_t row = 0; row < brute.size(); ++row)
@@ -126,6 +126,51 @@ TEST(EnclosureViewFactors, GridMatchesBruteForce)
     }
 }
 
+// The blocker index must not change the answer either: the hierarchy returns the same matrix as
+// the grid on a comb of subdivided teeth with an extra blocker across the top.
+TEST(EnclosureViewFactors, BoundingVolumeHierarchyMatchesGrid)
+{
+    std::vector<RadiationSegment> segments;
+    const auto addEdge = [&](const CPoint2D & from, const CPoint2D & to) {
+        constexpr size_t steps = 3;
+        for(size_t step = 0; step < steps; ++step)
+        {
+            const auto t0 = static_cast<double>(step) / steps;
+            const auto t1 = static_cast<double>(step + 1) / steps;
+            segments.push_back({.startPoint = {from.x() + (to.x() - from.x()) * t0,
+                                               from.y() + (to.y() - from.y()) * t0},
+                                .endPoint = {from.x() + (to.x() - from.x()) * t1,
+                                             from.y() + (to.y() - from.y()) * t1},
+                                .emissivity = 0.9,
+                                .enclosureId = 0u});
+        }
+    };
+    for(size_t tooth = 0; tooth < 5; ++tooth)
+    {
+        const auto xLeft = static_cast<double>(tooth);
+        addEdge({xLeft, 0.0}, {xLeft, 3.0});
+        addEdge({xLeft, 3.0}, {xLeft + 0.4, 3.0});
+        addEdge({xLeft + 0.4, 3.0}, {xLeft + 0.4, 0.0});
+    }
+    const std::vector<BlockingSegment> blockers{{.startPoint = {0.2, 3.2}, .endPoint = {4.2, 3.2}}};
+
+    const auto grid = computeEnclosureViewFactors(segments, blockers, {}).denseViewFactors();
+    const auto bvh =
+      computeEnclosureViewFactors(
+        segments, blockers, {.blockerIndex = BlockerIndex::BoundingVolumeHierarchy})
+        .denseViewFactors();
+
+    ASSERT_EQ(grid.size(), bvh.size());
+    for(size_t row = 0; row < grid.size(); ++row)
+    {
+        for(size_t col = 0; col < grid.size(); ++col)
+        {
+            EXPECT_EQ(grid(row, col), bvh(row, col))
+              << "grid and hierarchy differ at (" << row << ", " << col << ")";
+        }
+    }
+}
+
 // Threading must not change the result: the serial and parallel paths produce a bit-identical
 // matrix (each row writes disjoint cells, so there is no race and no reordering of arithmetic).
 TEST(EnclosureViewFactors, SerialAndParallelAgree)
@@ -145,10 +190,10 @@ TEST(EnclosureViewFactors, SerialAndParallelAgree)
 
     const auto serial =
       computeEnclosureViewFactors(segments, {}, {.multithread = false})
-        .viewFactors;
+        .denseViewFactors();
     const auto parallel =
       computeEnclosureViewFactors(segments, {}, {.multithread = true})
-        .viewFactors;
+        .denseViewFactors();
 
     ASSERT_EQ(serial.size(), parallel.size());
     for(size_t row = 0; row < serial.size(); ++row)
@@ -161,6 +206,44 @@ TEST(EnclosureViewFactors, SerialAndParallelAgree)
     }
 }
 
+// The pair schedule must not change the result either: any thread count reproduces the serial
+// matrix bit for bit on a geometry where many pairs go through the subdivision path.
+TEST(EnclosureViewFactors, ThreadCountDoesNotChangeResult)
+{
+    std::vector<RadiationSegment> segments;
+    for(size_t tooth = 0; tooth < 4; ++tooth)
+    {
+        const auto xLeft = static_cast<double>(tooth);
+        const std::vector<CPoint2D> vertices{
+          {xLeft, 0.0}, {xLeft, 1.0}, {xLeft, 2.0}, {xLeft + 0.5, 2.0}, {xLeft + 0.5, 0.0}};
+        for(size_t idx = 0; idx + 1 < vertices.size(); ++idx)
+        {
+            segments.push_back({.startPoint = vertices[idx],
+                                .endPoint = vertices[idx + 1],
+                                .emissivity = 0.9,
+                                .enclosureId = tooth % 2u});
+        }
+    }
+
+    const auto serial =
+      computeEnclosureViewFactors(segments, {}, {.multithread = false}).denseViewFactors();
+    for(const std::size_t threads : {2u, 3u, 16u})
+    {
+        const auto parallel =
+          computeEnclosureViewFactors(segments, {}, {.multithread = true, .threadCount = threads})
+            .denseViewFactors();
+        ASSERT_EQ(serial.size(), parallel.size());
+        for(size_t row = 0; row < serial.size(); ++row)
+        {
+            for(size_t col = 0; col < serial.size(); ++col)
+            {
+                EXPECT_EQ(serial(row, col), parallel(row, col))
+                  << threads << " threads differ at (" << row << ", " << col << ")";
+            }
+        }
+    }
+}
+
 // New capability beyond CGeometry2D: two separate enclosures in one call must not see each
 // other (block-diagonal matrix), and each closed block must still close to one.
 TEST(EnclosureViewFactors, MultiEnclosureIsBlockDiagonal)
@@ -182,7 +265,8 @@ TEST(EnclosureViewFactors, MultiEnclosureIsBlockDiagonal)
 
     const ViewFactorOptions rawOptions{
       .leastSquaresSmoothing = false, .multithread = false};
-    const auto viewFactors = computeEnclosureViewFactors(segments, {}, rawOptions).viewFactors;
+    const auto viewFactors =
+      computeEnclosureViewFactors(segments, {}, rawOptions).denseViewFactors();
 
     ASSERT_EQ(8u, viewFactors.size());
     for(size_t row = 0; row < 8; ++row)
@@ -204,3 +288,51 @@ TEST(EnclosureViewFactors, MultiEnclosureIsBlockDiagonal)
         EXPECT_NEAR(1.0, withinSum, 1e-9) << "row " << row << " block does not close to one";
     }
 }
+
+// Segments of different enclosures may be interleaved in the input. Each enclosure is stored as
+// its own block in input order, and the sparse lookup agrees with the assembled dense matrix.
+TEST(EnclosureViewFactors, InterleavedEnclosuresAreStoredAsBlocks)
+{
+    std::vector<RadiationSegment> segments;
+    const std::vector<CPoint2D> vertices{{0, 0}, {0, 1}, {1, 1}, {1, 0}};
+    for(size_t idx = 0; idx < vertices.size(); ++idx)
+    {
+        for(const std::size_t enclosureId : {7u, 3u})
+        {
+            const auto offsetX = enclosureId == 7u ? 10.0 : 0.0;
+            const auto & start = vertices[idx];
+            const auto & end = vertices[(idx + 1) % vertices.size()];
+            segments.push_back({.startPoint = {start.x() + offsetX, start.y()},
+                                .endPoint = {end.x() + offsetX, end.y()},
+                                .emissivity = 0.9,
+                                .enclosureId = enclosureId});
+        }
+    }
+
+    const auto result = computeEnclosureViewFactors(segments, {});
+
+    ASSERT_EQ(2u, result.blocks.size());
+    EXPECT_EQ(3u, result.blocks[0].enclosureId);
+    EXPECT_EQ(std::vector<std::size_t>({1u, 3u, 5u, 7u}), result.blocks[0].segments);
+    EXPECT_EQ(7u, result.blocks[1].enclosureId);
+    EXPECT_EQ(std::vector<std::size_t>({0u, 2u, 4u, 6u}), result.blocks[1].segments);
+    EXPECT_EQ(4u, result.blocks[1].viewFactors.size());
+
+    const auto dense = result.denseViewFactors();
+    ASSERT_EQ(segments.size(), dense.size());
+    for(size_t row = 0; row < dense.size(); ++row)
+    {
+        for(size_t col = 0; col < dense.size(); ++col)
+        {
+            EXPECT_EQ(dense(row, col), result.viewFactor(row, col));
+            if(segments[row].enclosureId != segments[col].enclosureId)
+            {
+                EXPECT_EQ(0.0, dense(row, col));
+            }
+        }
+    }
+
+    // Opposite walls of a unit square see each other with sqrt(2) - 1.
+    EXPECT_NEAR(std::sqrt(2.0) - 1.0, result.viewFactor(0u, 4u), 1e-9);
+    EXPECT_NEAR(std::sqrt(2.0) - 1.0, result.viewFactor(1u, 5u), 1e-9);
+}
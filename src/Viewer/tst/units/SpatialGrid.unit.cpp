@@ -101,3 +101,42 @@ TEST(SpatialGrid, SuggestCellsPerAxisIsClamped)
     EXPECT_EQ(8u, SpatialGrid::suggestCellsPerAxis(100));  // capped at the target
     EXPECT_EQ(8u, SpatialGrid::suggestCellsPerAxis(100000));
 }
+
+TEST(SpatialGrid, VisitorSeesEachCandidateOnce)
+{
+    // Long blockers span many cells, so the visitor must de-duplicate them.
+    auto blockers = cornerBlockers();
+    blockers.emplace_back(CPoint2D{0, 0}, CPoint2D{10, 10});
+    blockers.emplace_back(CPoint2D{0, 5}, CPoint2D{10, 5});
+    auto grid = SpatialGrid::build(blockers, 4);
+
+    const auto expectSameAsCandidates = [&](const std::array<double, 4> & box) {
+        std::vector<std::size_t> visited;
+        const auto found = grid.anyInBoundingBox(
+          box[0], box[1], box[2], box[3], [&](const std::size_t idx) {
+              visited.push_back(idx);
+              return false;
+          });
+        EXPECT_FALSE(found);
+        std::ranges::sort(visited);
+        EXPECT_EQ(grid.candidatesForBoundingBox(box[0], box[1], box[2], box[3]), visited);
+    };
+
+    const std::vector<std::array<double, 4>> queries{
+      {0.5, 0.5, 2.5, 2.5}, {0, 0, 10, 10}, {7, 7, 9, 9}, {3, 3, 4, 4}, {0, 4, 10, 5}};
+    for(const auto & box : queries)
+    {
+        expectSameAsCandidates(box);
+    }
+
+    grid.moveBlocker(5u, blockers[5u], CSegment2D{{0, 1}, {10, 9}});
+    for(const auto & box : queries)
+    {
+        expectSameAsCandidates(box);
+    }
+
+    // The visitor stops at the first blocker it accepts.
+    std::size_t visits{0u};
+    EXPECT_TRUE(grid.anyInBoundingBox(0, 0, 10, 10, [&](std::size_t) { return ++visits > 0u; }));
+    EXPECT_EQ(1u, visits);
+}